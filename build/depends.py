@@ -433,7 +433,9 @@ class SoundTouch(Dependence):
 
 class RubberBand(Dependence):
     def sources(self, build):
-        sources = ['engine/enginebufferscalerubberband.cpp', ]
+        sources = ['engine/enginebufferscalerubberband.cpp',
+                   'engine/enginebufferscalerubberbandthreaded.cpp',
+                   'engine/rubberbandworker.cpp', ]
         return sources
 
     def configure(self, build, conf, env=None):
@@ -516,6 +518,7 @@ class MixxxCore(Feature):
 
                    "configobject.cpp",
                    "control/control.cpp",
+                   "control/controlnotifier.cpp",
                    "control/controlbehavior.cpp",
                    "control/controlmodel.cpp",
                    "controlobject.cpp",
@@ -563,6 +566,7 @@ class MixxxCore(Feature):
                    "effects/effectchain.cpp",
                    "effects/effect.cpp",
                    "effects/effectparameter.cpp",
+                   "effects/oversamplingeffectprocessor.cpp",
 
                    "effects/effectrack.cpp",
                    "effects/effectchainslot.cpp",
@@ -588,6 +592,7 @@ class MixxxCore(Feature):
                    "effects/native/echoeffect.cpp",
                    "effects/native/autopaneffect.cpp",
                    "effects/native/phasereffect.cpp",
+                   "effects/native/convolutionreverbeffect.cpp",
 
                    "engine/effects/engineeffectsmanager.cpp",
                    "engine/effects/engineeffectrack.cpp",
@@ -601,9 +606,14 @@ class MixxxCore(Feature):
 
                    "engine/engineworker.cpp",
                    "engine/engineworkerscheduler.cpp",
+                   "engine/enginethreadpool.cpp",
+                   "engine/callbackprofiler.cpp",
                    "engine/enginebuffer.cpp",
                    "engine/enginebufferscale.cpp",
                    "engine/enginebufferscalelinear.cpp",
+                   "engine/interpolationkernels.cpp",
+                   "engine/partitionedconvolution.cpp",
+                   "engine/partitionedconvolver.cpp",
                    "engine/enginefilterbiquad1.cpp",
                    "engine/enginefiltermoogladder4.cpp",
                    "engine/enginefilterbessel4.cpp",
@@ -613,6 +623,7 @@ class MixxxCore(Feature):
                    "engine/enginefilterlinkwitzriley4.cpp",
                    "engine/enginefilterlinkwitzriley8.cpp",
                    "engine/enginefilter.cpp",
+                   "engine/engineoversampler.cpp",
                    "engine/engineobject.cpp",
                    "engine/enginepregain.cpp",
                    "engine/enginechannel.cpp",
@@ -625,7 +636,8 @@ class MixxxCore(Feature):
                    "engine/enginemicrophone.cpp",
                    "engine/enginedeck.cpp",
                    "engine/engineaux.cpp",
-                   "engine/channelmixer_autogen.cpp",
+                   "engine/channelmixer.cpp",
+                   "engine/offlinerenderer.cpp",
 
                    "engine/enginecontrol.cpp",
                    "engine/ratecontrol.cpp",
@@ -641,6 +653,7 @@ class MixxxCore(Feature):
                    "cachingreader.cpp",
                    "cachingreaderchunk.cpp",
                    "cachingreaderworker.cpp",
+                   "pcmcache.cpp",
 
                    "analyserrg.cpp",
                    "analyserqueue.cpp",
@@ -684,6 +697,7 @@ class MixxxCore(Feature):
                    "sources/soundsourcepluginlibrary.cpp",
                    "sources/soundsource.cpp",
                    "sources/audiosource.cpp",
+                   "sources/audiosourcepcmcache.cpp",
 
                    "metadata/trackmetadata.cpp",
                    "metadata/trackmetadatataglib.cpp",
@@ -755,9 +769,12 @@ class MixxxCore(Feature):
                    "library/trackcollection.cpp",
                    "library/basesqltablemodel.cpp",
                    "library/basetrackcache.cpp",
+                   "library/columnartrackindex.cpp",
+                   "library/selectthread.cpp",
                    "library/columncache.cpp",
                    "library/librarytablemodel.cpp",
                    "library/searchquery.cpp",
+                   "library/searchindex.cpp",
                    "library/searchqueryparser.cpp",
                    "library/analysislibrarytablemodel.cpp",
                    "library/missingtablemodel.cpp",
@@ -904,6 +921,10 @@ class MixxxCore(Feature):
                    "skin/launchimage.cpp",
 
                    "sampleutil.cpp",
+                   "sampleutil_sse2.cpp",
+                   "sampleutil_avx2.cpp",
+                   "sampleutil_avx512.cpp",
+                   "sampleutil_neon.cpp",
                    "samplebuffer.cpp",
                    "singularsamplebuffer.cpp",
                    "circularsamplebuffer.cpp",
@@ -945,6 +966,7 @@ class MixxxCore(Feature):
                    "util/timer.cpp",
                    "util/performancetimer.cpp",
                    "util/threadcputimer.cpp",
+                   "util/cpufeatures.cpp",
                    "util/version.cpp",
                    "util/rlimit.cpp",
                    "util/valuetransformer.cpp",
@@ -956,6 +978,7 @@ class MixxxCore(Feature):
                    "util/xml.cpp",
                    "util/tapfilter.cpp",
                    "util/movinginterquartilemean.cpp",
+                   "util/fft.cpp",
                    "util/console.cpp",
                    "util/dbid.cpp",
 
@@ -536,6 +536,35 @@ class AddressSanitizer(Feature):
         build.env.Append(LINKFLAGS="-fsanitize=address -fno-omit-frame-pointer")
 
 
+class RealtimeAllocationDetector(Feature):
+    def description(self):
+        return "Realtime Allocation Detector"
+
+    def enabled(self, build):
+        build.flags['rtalloc'] = util.get_flags(build.env, 'rtalloc', 0)
+        return bool(int(build.flags['rtalloc']))
+
+    def add_options(self, build, vars):
+        vars.Add("rtalloc", "Set to 1 to count heap allocations on the engine threads. Linux only.", 0)
+
+    def configure(self, build, conf):
+        if not self.enabled(build):
+            return
+
+        if not build.platform_is_linux:
+            raise Exception('The realtime allocation detector requires glibc.')
+        # Both replace malloc as well.
+        if (int(util.get_flags(build.env, 'asan', 0)) or
+                int(util.get_flags(build.env, 'perftools', 0))):
+            raise Exception('The realtime allocation detector can not be '
+                            'combined with asan or perftools.')
+
+        build.env.Append(CPPDEFINES='__RTALLOCDETECTOR__')
+
+    def sources(self, build):
+        return ['util/realtimeallocationdetector.cpp']
+
+
 class PerfTools(Feature):
     def description(self):
         return "Google PerfTools"
@@ -766,6 +795,31 @@ class TestSuite(Feature):
         return []
 
 
+class BenchmarkSuite(Feature):
+    def description(self):
+        return "Mixxx Benchmark Suite"
+
+    def enabled(self, build):
+        build.flags['benchmark'] = util.get_flags(build.env, 'benchmark', 0) or \
+            'mixxx-benchmark' in SCons.BUILD_TARGETS
+        if int(build.flags['benchmark']):
+            return True
+        return False
+
+    def add_options(self, build, vars):
+        vars.Add('benchmark',
+                 'Set to 1 to build the mixxx-benchmark target. Requires Google Benchmark.', 0)
+
+    def configure(self, build, conf):
+        if not self.enabled(build):
+            return
+        # Only linked into mixxx-benchmark, see src/SConscript.
+        if (not conf.CheckCXXHeader('benchmark/benchmark.h') or
+                not conf.CheckLib(['benchmark', 'libbenchmark'], autoadd=False)):
+            raise Exception(
+                'Could not find Google Benchmark (libbenchmark) or its development headers.')
+
+
 class Shoutcast(Feature):
     def description(self):
         return "Shoutcast Broadcasting (OGG/MP3)"
@@ -3,7 +3,7 @@ import argparse
 import sys
 
 # Usage:
-# ./generate_sample_functions.py --sampleutil_autogen_h ../src/sampleutil_autogen.h --channelmixer_autogen_cpp ../src/engine/channelmixer_autogen.cpp
+# ./generate_sample_functions.py --sampleutil_autogen_h ../src/sampleutil_autogen.h
 
 BASIC_INDENT = 4
 
@@ -25,112 +25,6 @@ def hanging_indent(base, groups, hanging_suffix, terminator, depth=0):
         groups,
         [hanging_suffix] * (len(groups) - 1) + [terminator])))
 
-def write_channelmixer_autogen(output, num_channels):
-    output.append('#include "engine/channelmixer.h"')
-    output.append('#include "util/timer.h"')
-    output.append('#include "sampleutil.h"')
-    output.append('////////////////////////////////////////////////////////')
-    output.append('// THIS FILE IS AUTO-GENERATED. DO NOT EDIT DIRECTLY! //')
-    output.append('// SEE scripts/generate_sample_functions.py           //')
-    output.append('////////////////////////////////////////////////////////')
-    output.append('')
-    output.append('// static')
-
-    def write_mixchannels(ramping, output):
-        if ramping:
-            header = 'void ChannelMixer::mixChannelsRamping('
-        else:
-            header = 'void ChannelMixer::mixChannels('
-        args = ['const EngineMaster::GainCalculator& gainCalculator',
-                'QVarLengthArray<EngineMaster::ChannelInfo*, kPreallocatedChannels>* activeChannels',
-                'QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache',
-                'CSAMPLE* pOutput',
-                'unsigned int iBufferSize']
-        output.extend(hanging_indent(header, args, ',', ') {'))
-
-        def write(data, depth=0):
-            output.append(' ' * (BASIC_INDENT * depth) + data)
-
-        write('int totalActive = activeChannels->size();', depth=1)
-
-        write('if (totalActive == 0) {', depth=1)
-        write('ScopedTimer t("EngineMaster::mixChannels%(variant)s_0active");' %
-              {'variant': 'Ramping' if ramping else ''}, depth=2)
-        write('SampleUtil::clear(pOutput, iBufferSize);', depth=2)
-        for i in xrange(1, num_channels+1):
-            write('} else if (totalActive == %d) {' % i, depth=1)
-            write('ScopedTimer t("EngineMaster::mixChannels%(variant)s_%(i)dactive");' %
-                  {'variant': 'Ramping' if ramping else '', 'i': i}, depth=2)
-            if ramping:
-                write('CSAMPLE_GAIN oldGain[%(i)d];' % {'i': i}, depth=2)
-            write('CSAMPLE_GAIN newGain[%(i)d];' % {'i': i}, depth=2)
-            for j in xrange(i):
-                write('EngineMaster::ChannelInfo* pChannel%(j)d = activeChannels->at(%(j)d);' % {'j': j}, depth=2)
-                write('const int channelIndex%(j)d = pChannel%(j)d->m_index;' % {'j': j}, depth=2)
-                write('EngineMaster::GainCache& gainCache%(j)d = (*channelGainCache)[channelIndex%(j)d];' % {'j': j}, depth=2)
-                if ramping:
-                    write('oldGain[%(j)d] = gainCache%(j)d.m_gain;' % {'j': j}, depth=2)
-                write('if (gainCache%(j)d.m_fadeout) {' % {'j': j}, depth=2)
-                write('newGain[%(j)d] = 0;' % {'j': j}, depth=3)
-                write('gainCache%(j)d.m_fadeout = false;' % {'j': j}, depth=3)
-                write('} else {', depth=2)
-                write('newGain[%(j)d] = gainCalculator.getGain(pChannel%(j)d);' % {'j': j}, depth=3)
-                write('}', depth=2)
-                write('gainCache%(j)d.m_gain = newGain[%(j)d];' % {'j': j}, depth=2)
-                write('CSAMPLE* pBuffer%(j)d = pChannel%(j)d->m_pBuffer;' % {'j': j}, depth=2)
-
-            arg_groups = ['pOutput'] + ['pBuffer%(j)d, newGain[%(j)d]' % {'j': j} for j in xrange(i)] + ['iBufferSize']
-            call_prefix = "SampleUtil::" + copy_with_gain_method_name(i) + '('
-
-            if ramping:
-                arg_groups_ramping = ['pOutput'] + ['pBuffer%(j)d, oldGain[%(j)d], newGain[%(j)d]' % {'j': j} for j in xrange(i)] + ['iBufferSize']
-                call_prefix_ramping = "SampleUtil::" + copy_with_ramping_gain_method_name(i) + '('
-                write('int i = 0;', depth=2)
-                write('for(; i < totalActive; ++i) {', depth=2)
-                write('if (oldGain[i] != newGain[i]) {', depth=3)
-                write('break;', depth=4)
-                write('}', depth=3)
-                write('}', depth=2)
-                write('if (i == totalActive) {', depth=2)
-                output.extend(hanging_indent(call_prefix, arg_groups, ',', ');', depth=3))
-                write('} else {', depth=2)
-                output.extend(hanging_indent(call_prefix_ramping, arg_groups_ramping, ',', ');', depth=3))
-                write('}', depth=2)
-            else:
-                output.extend(hanging_indent(call_prefix, arg_groups, ',', ');', depth=2))
-
-        write('} else {', depth=1)
-        write('ScopedTimer t("EngineMaster::mixChannels%(variant)s_%%1active", activeChannels->size());' %
-              {'variant': 'Ramping' if ramping else ''}, depth=2)
-        write('// Set pOutput to all 0s', depth=2)
-        write('SampleUtil::clear(pOutput, iBufferSize);', depth=2)
-        write('for (int i = 0; i < activeChannels->size(); ++i) {', depth=2)
-        write('EngineMaster::ChannelInfo* pChannelInfo = activeChannels->at(i);', depth=3)
-
-        write('const int channelIndex = pChannelInfo->m_index;', depth=3)
-        write('EngineMaster::GainCache& gainCache = (*channelGainCache)[channelIndex];', depth=3)
-        if ramping:
-            write('CSAMPLE_GAIN oldGain = gainCache.m_gain;', depth=3)
-        write('CSAMPLE_GAIN newGain;', depth=3)
-        write('if (gainCache.m_fadeout) {', depth=3)
-        write('newGain = 0;', depth=4)
-        write('gainCache.m_fadeout = false;', depth=4)
-        write('} else {', depth=3)
-        write('newGain = gainCalculator.getGain(pChannelInfo);', depth=4)
-        write('}', depth=3)
-        write('gainCache.m_gain = newGain;', depth=3)
-
-        write('CSAMPLE* pBuffer = pChannelInfo->m_pBuffer;', depth=3)
-        if ramping:
-            write('SampleUtil::addWithRampingGain(pOutput, pBuffer, oldGain, newGain, iBufferSize);', depth=3)
-        else:
-            write('SampleUtil::addWithGain(pOutput, pBuffer, newGain, iBufferSize);', depth=3)
-        write('}', depth=2)
-        write('}', depth=1)
-        output.append('}')
-    write_mixchannels(False, output)
-    write_mixchannels(True, output)
-
 def write_sampleutil_autogen(output, num_channels):
     output.append('#ifndef SAMPLEUTILAUTOGEN_H')
     output.append('#define SAMPLEUTILAUTOGEN_H')
@@ -236,22 +130,14 @@ def main(args):
               if args.sampleutil_autogen_h else sys.stdout)
     output.write('\n'.join(sampleutil_output_lines) + '\n')
 
-    channelmixer_output_lines = []
-    write_channelmixer_autogen(channelmixer_output_lines, args.max_channels)
-
-    output = (open(args.channelmixer_autogen_cpp, 'w')
-              if args.channelmixer_autogen_cpp else sys.stdout)
-    output.write('\n'.join(channelmixer_output_lines) + '\n')
-
 
 
 if __name__ == '__main__':
     parser = argparse.ArgumentParser(
-        description='Auto-generate sample processing and mixing functions.' +
+        description='Auto-generate sample processing functions.' +
         'Example Call:' +
-        './generate_sample_functions.py --sampleutil_autogen_h ../src/sampleutil_autogen.h --channelmixer_autogen_cpp ../src/engine/channelmixer_autogen.cpp')
+        './generate_sample_functions.py --sampleutil_autogen_h ../src/sampleutil_autogen.h')
     parser.add_argument('--sampleutil_autogen_h')
-    parser.add_argument('--channelmixer_autogen_cpp')
     parser.add_argument('--max_channels', type=int, default=32)
     args = parser.parse_args()
     main(args)
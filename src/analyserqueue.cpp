@@ -2,6 +2,7 @@
 
 #include <QtDebug>
 #include <QMutexLocker>
+#include <QScopedPointer>
 
 #include "trackinfoobject.h"
 #include "playerinfo.h"
@@ -36,11 +37,13 @@ namespace {
             kAnalysisFramesPerBlock * kAnalysisChannels;
 } // anonymous namespace
 
-AnalyserQueue::AnalyserQueue(TrackCollection* pTrackCollection)
+AnalyserQueue::AnalyserQueue(ConfigObject<ConfigValue>* pConfig,
+                             TrackCollection* pTrackCollection)
         : m_aq(),
           m_exit(false),
           m_aiCheckPriorities(false),
           m_sampleBuffer(kAnalysisSamplesPerBlock),
+          m_pcmCache(pConfig),
           m_tioq(),
           m_qm(),
           m_qwait(),
@@ -174,7 +177,8 @@ TrackPointer AnalyserQueue::dequeueNextBlocking() {
 }
 
 // This is called from the AnalyserQueue thread
-bool AnalyserQueue::doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudioSource) {
+bool AnalyserQueue::doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudioSource,
+                               PcmCacheWriter* pPcmCacheWriter) {
 
     QTime progressUpdateInhibitTimer;
     progressUpdateInhibitTimer.start(); // Inhibit Updates for 60 milliseconds
@@ -200,6 +204,10 @@ bool AnalyserQueue::doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudi
         frameIndex += framesRead;
         DEBUG_ASSERT(pAudioSource->isValidFrameIndex(frameIndex));
 
+        if (pPcmCacheWriter && 0 < framesRead) {
+            pPcmCacheWriter->write(m_sampleBuffer.data(), framesRead);
+        }
+
         // To compare apples to apples, let's only look at blocks that are
         // the full block size.
         if (kAnalysisFramesPerBlock == framesRead) {
@@ -220,6 +228,9 @@ bool AnalyserQueue::doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudi
                 qWarning() << "Failed to read sample data from file:"
                         << tio->getFilename()
                         << "@" << frameIndex;
+                // The samples after the gap would be cached at the wrong
+                // position.
+                pPcmCacheWriter = NULL;
                 if (0 >= framesRead) {
                     // If no frames have been read then abort the analysis.
                     // Otherwise we might get stuck in this loop forever.
@@ -273,6 +284,12 @@ bool AnalyserQueue::doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudi
         }
     } while (!dieflag && (frameIndex < pAudioSource->getMaxFrameIndex()));
 
+    // Only keep the decoded samples if the whole track has been read.
+    // Otherwise the caller deletes the writer, which discards the file.
+    if (pPcmCacheWriter && !dieflag) {
+        pPcmCacheWriter->commit(pAudioSource->getFrameCount());
+    }
+
     return !cancelled; //don't return !dieflag or we might reanalyze over and over
 }
 
@@ -341,7 +358,10 @@ void AnalyserQueue::run() {
 
         if (processTrack) {
             emitUpdateProgress(nextTrack, 0);
-            bool completed = doAnalysis(nextTrack, pAudioSource);
+            QScopedPointer<PcmCacheWriter> pPcmCacheWriter(
+                    m_pcmCache.createWriter(nextTrack, pAudioSource->getFrameRate()));
+            bool completed = doAnalysis(nextTrack, pAudioSource,
+                                        pPcmCacheWriter.data());
             if (!completed) {
                 // This track was cancelled
                 QListIterator<Analyser*> itf(m_aq);
@@ -434,7 +454,7 @@ void AnalyserQueue::queueAnalyseTrack(TrackPointer tio) {
 // static
 AnalyserQueue* AnalyserQueue::createDefaultAnalyserQueue(
         ConfigObject<ConfigValue>* pConfig, TrackCollection* pTrackCollection) {
-    AnalyserQueue* ret = new AnalyserQueue(pTrackCollection);
+    AnalyserQueue* ret = new AnalyserQueue(pConfig, pTrackCollection);
 
     ret->addAnalyser(new AnalyserWaveform(pConfig));
     ret->addAnalyser(new AnalyserGain(pConfig));
@@ -449,7 +469,7 @@ AnalyserQueue* AnalyserQueue::createDefaultAnalyserQueue(
 // static
 AnalyserQueue* AnalyserQueue::createAnalysisFeatureAnalyserQueue(
         ConfigObject<ConfigValue>* pConfig, TrackCollection* pTrackCollection) {
-    AnalyserQueue* ret = new AnalyserQueue(pTrackCollection);
+    AnalyserQueue* ret = new AnalyserQueue(pConfig, pTrackCollection);
 
     ret->addAnalyser(new AnalyserGain(pConfig));
     VampAnalyser::initializePluginPaths();
@@ -3,6 +3,7 @@
 
 #include "configobject.h"
 #include "analyser.h"
+#include "pcmcache.h"
 #include "trackinfoobject.h"
 #include "sources/audiosource.h"
 #include "samplebuffer.h"
@@ -21,7 +22,8 @@ class AnalyserQueue : public QThread {
     Q_OBJECT
 
   public:
-    AnalyserQueue(TrackCollection* pTrackCollection);
+    AnalyserQueue(ConfigObject<ConfigValue>* pConfig,
+                  TrackCollection* pTrackCollection);
     virtual ~AnalyserQueue();
     void stop();
     void queueAnalyseTrack(TrackPointer tio);
@@ -47,6 +49,7 @@ class AnalyserQueue : public QThread {
     void run();
 
   private:
+    friend class PcmCacheTest;
 
     struct progress_info {
         TrackPointer current_track;
@@ -61,7 +64,10 @@ class AnalyserQueue : public QThread {
 
     bool isLoadedTrackWaiting(TrackPointer analysingTrack);
     TrackPointer dequeueNextBlocking();
-    bool doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudioSource);
+    // Also writes the decoded samples to pPcmCacheWriter unless it is NULL.
+    // They are only committed if the whole track has been decoded.
+    bool doAnalysis(TrackPointer tio, Mixxx::AudioSourcePointer pAudioSource,
+                    PcmCacheWriter* pPcmCacheWriter);
     void emitUpdateProgress(TrackPointer tio, int progress);
     void emptyCheck();
 
@@ -70,6 +76,9 @@ class AnalyserQueue : public QThread {
 
     SampleBuffer m_sampleBuffer;
 
+    // Filled with the decoded samples of every analysed track if enabled.
+    const PcmCache m_pcmCache;
+
     // The processing queue and associated mutex
     QQueue<TrackPointer> m_tioq;
     QMutex m_qm;
@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <QVector>
+
+#include "analyserwaveform.h"
+#include "benchmark/benchmarkenvironment.h"
+#include "trackinfoobject.h"
+#include "util/math.h"
+#include "util/types.h"
+
+namespace {
+
+const int kSampleRate = 44100;
+// The block size the AnalyserQueue passes to the analysers
+const int kAnalysisBlockSamples = 4096 * 2;
+const int kTrackSeconds = 30;
+
+// Analyses the waveform and waveform summary of a 30 s stereo track, i.e.
+// the per track work of the AnalyserQueue apart from decoding.
+void BM_AnalyserWaveform(benchmark::State& state) {
+    const int totalSamples = kSampleRate * 2 * kTrackSeconds;
+    QVector<CSAMPLE> track(totalSamples);
+    for (int i = 0; i < totalSamples / 2; ++i) {
+        double phase = 2 * M_PI * 440.0 * i / kSampleRate;
+        track[i * 2] = static_cast<CSAMPLE>(sin(phase));
+        track[i * 2 + 1] = static_cast<CSAMPLE>(sin(phase * 1.5));
+    }
+
+    AnalyserWaveform analyser(BenchmarkEnvironment::config());
+    while (state.KeepRunning()) {
+        TrackPointer pTrack(new TrackInfoObject("benchmark"));
+        pTrack->setSampleRate(kSampleRate);
+        if (!analyser.initialise(pTrack, kSampleRate, totalSamples)) {
+            state.SkipWithError("AnalyserWaveform::initialise failed");
+            break;
+        }
+        for (int i = 0; i < totalSamples; i += kAnalysisBlockSamples) {
+            analyser.process(track.constData() + i,
+                             math_min(kAnalysisBlockSamples, totalSamples - i));
+        }
+        analyser.cleanup(pTrack);
+    }
+    state.SetItemsProcessed(state.iterations() * (totalSamples / 2));
+}
+BENCHMARK(BM_AnalyserWaveform)->Unit(benchmark::kMillisecond);
+
+} // anonymous namespace
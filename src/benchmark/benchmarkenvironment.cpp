@@ -0,0 +1,100 @@
+#include "benchmark/benchmarkenvironment.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QList>
+#include <QSharedPointer>
+#include <QtDebug>
+
+#include "control/control.h"
+#include "controlobject.h"
+#include "soundsourceproxy.h"
+#include "util/assert.h"
+
+#ifdef __FFMPEGFILE__
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+}
+#endif
+
+namespace {
+
+bool removeRecursively(const QDir& dir) {
+    bool result = true;
+    if (dir.exists()) {
+        foreach (QFileInfo info, dir.entryInfoList(QDir::NoDotAndDotDot |
+                                                   QDir::System |
+                                                   QDir::Hidden |
+                                                   QDir::AllDirs |
+                                                   QDir::Files,
+                                                   QDir::DirsFirst)) {
+            if (info.isDir()) {
+                result = removeRecursively(QDir(info.absoluteFilePath()));
+            } else {
+                result = QFile::remove(info.absoluteFilePath());
+            }
+            if (!result) {
+                return result;
+            }
+        }
+        result = dir.rmdir(dir.absolutePath());
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+// static
+BenchmarkEnvironment* BenchmarkEnvironment::s_pInstance = NULL;
+
+BenchmarkEnvironment::BenchmarkEnvironment(int& argc, char** argv)
+        : m_argc(argc),
+          m_pApplication(new MixxxApplication(m_argc, argv)),
+          m_settingsPath(QDir::temp().absoluteFilePath(
+                  QString("mixxx-benchmark-%1").arg(
+                          QCoreApplication::applicationPid()))) {
+    DEBUG_ASSERT(s_pInstance == NULL);
+    s_pInstance = this;
+
+#ifdef __FFMPEGFILE__
+    av_register_all();
+    avcodec_register_all();
+#endif
+    SoundSourceProxy::loadPlugins();
+
+    QDir().mkpath(m_settingsPath);
+    m_pConfig.reset(new ConfigObject<ConfigValue>(
+            QDir(m_settingsPath).filePath("benchmark.cfg")));
+}
+
+BenchmarkEnvironment::~BenchmarkEnvironment() {
+    m_pConfig.reset();
+    removeRecursively(QDir(m_settingsPath));
+    m_pApplication.reset();
+    s_pInstance = NULL;
+}
+
+// static
+ConfigObject<ConfigValue>* BenchmarkEnvironment::config() {
+    DEBUG_ASSERT(s_pInstance != NULL);
+    return s_pInstance->m_pConfig.data();
+}
+
+// static
+QString BenchmarkEnvironment::testFilePath(const QString& fileName) {
+    return QDir::current().absoluteFilePath("src/test/" + fileName);
+}
+
+// static
+void BenchmarkEnvironment::deleteLeakedControls() {
+    QList<QSharedPointer<ControlDoublePrivate> > leakedControls;
+    ControlDoublePrivate::getControls(&leakedControls);
+    foreach (QSharedPointer<ControlDoublePrivate> pCDP, leakedControls) {
+        if (pCDP.isNull()) {
+            continue;
+        }
+        delete pCDP->getCreatorCO();
+    }
+}
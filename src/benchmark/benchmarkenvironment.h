@@ -0,0 +1,40 @@
+#ifndef BENCHMARKENVIRONMENT_H
+#define BENCHMARKENVIRONMENT_H
+
+#include <QScopedPointer>
+#include <QString>
+
+#include "configobject.h"
+#include "mixxxapplication.h"
+
+// The process wide state of mixxx-benchmark. Like MixxxTest::ApplicationScope
+// it keeps a single MixxxApplication alive while the benchmarks run, and it
+// provides a scratch settings directory that is deleted on exit.
+class BenchmarkEnvironment {
+  public:
+    BenchmarkEnvironment(int& argc, char** argv);
+    ~BenchmarkEnvironment();
+
+    // The configuration of the scratch settings directory. Libraries and
+    // analysis results created by benchmarks are stored next to it.
+    static ConfigObject<ConfigValue>* config();
+
+    // Returns the absolute path of a file in src/test. mixxx-benchmark has to
+    // be run from the root of the source tree, like mixxx-test.
+    static QString testFilePath(const QString& fileName);
+
+    // Deletes the controls that are still alive. Benchmarks that create
+    // engine objects call this after deleting them so the next benchmark can
+    // create the same controls again. See ~MixxxTest.
+    static void deleteLeakedControls();
+
+  private:
+    static BenchmarkEnvironment* s_pInstance;
+
+    int& m_argc;
+    QScopedPointer<MixxxApplication> m_pApplication;
+    const QString m_settingsPath;
+    QScopedPointer<ConfigObject<ConfigValue> > m_pConfig;
+};
+
+#endif /* BENCHMARKENVIRONMENT_H */
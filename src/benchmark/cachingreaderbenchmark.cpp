@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <QTest>
+
+#include "benchmark/benchmarkenvironment.h"
+#include "cachingreader.h"
+#include "engine/engineworkerscheduler.h"
+#include "trackinfoobject.h"
+#include "util/types.h"
+
+namespace {
+
+const int kFramesPerBuffer = 1024;
+// The section of src/test/sine-30.wav that is read over and over. It fits
+// into the cache of the default size.
+const int kReadSamples = 44100 * 2 * 10;
+
+bool isSilent(const CSAMPLE* pBuffer, int numSamples) {
+    for (int i = 0; i < numSamples; ++i) {
+        if (pBuffer[i] != CSAMPLE_ZERO) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Waits until the worker has read all chunks of the first kReadSamples.
+bool waitUntilCached(CachingReader* pReader,
+                     EngineWorkerScheduler* pScheduler) {
+    CSAMPLE buffer[kFramesPerBuffer * 2];
+    HintVector hints;
+    Hint hint;
+    hint.sample = 0;
+    hint.length = kReadSamples;
+    hint.priority = HINT_PRIORITY_IMMINENT;
+    hints.append(hint);
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+        pReader->process();
+        pReader->hintAndMaybeWake(hints);
+        pScheduler->runWorkers();
+        bool cached = true;
+        for (int sample = 0; cached && sample < kReadSamples;
+                sample += kFramesPerBuffer * 2) {
+            pReader->read(sample, kFramesPerBuffer * 2, buffer);
+            cached = !isSilent(buffer, kFramesPerBuffer * 2);
+        }
+        if (cached) {
+            return true;
+        }
+        QTest::qSleep(10); // millis
+    }
+    return false;
+}
+
+// Engine sized reads that are served from the cache, i.e. the cost of the
+// chunk lookup and the copy.
+void BM_CachingReaderRead(benchmark::State& state) {
+    EngineWorkerScheduler scheduler;
+    scheduler.start(QThread::HighPriority);
+    {
+        CachingReader reader("[Benchmark]", BenchmarkEnvironment::config());
+        reader.setScheduler(&scheduler);
+        reader.newTrack(TrackPointer(new TrackInfoObject(
+                BenchmarkEnvironment::testFilePath("sine-30.wav"))));
+        scheduler.runWorkers();
+        if (!waitUntilCached(&reader, &scheduler)) {
+            state.SkipWithError("Could not read src/test/sine-30.wav");
+        } else {
+            CSAMPLE buffer[kFramesPerBuffer * 2];
+            int sample = 0;
+            while (state.KeepRunning()) {
+                reader.read(sample, kFramesPerBuffer * 2, buffer);
+                sample = (sample + kFramesPerBuffer * 2) % kReadSamples;
+            }
+            state.SetItemsProcessed(state.iterations() * kFramesPerBuffer);
+        }
+    }
+    BenchmarkEnvironment::deleteLeakedControls();
+}
+BENCHMARK(BM_CachingReaderRead);
+
+} // anonymous namespace
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <QSet>
+
+#include "benchmark/benchmarkenvironment.h"
+#include "effects/effectinstantiator.h"
+#include "engine/channelhandle.h"
+#include "engine/effects/engineeffect.h"
+#include "engine/effects/groupfeaturestate.h"
+#include "util/math.h"
+#include "util/types.h"
+
+#include "effects/native/autopaneffect.h"
+#include "effects/native/bessel4lvmixeqeffect.h"
+#include "effects/native/bessel8lvmixeqeffect.h"
+#include "effects/native/bitcrushereffect.h"
+#include "effects/native/convolutionreverbeffect.h"
+#include "effects/native/echoeffect.h"
+#include "effects/native/filtereffect.h"
+#include "effects/native/flangereffect.h"
+#include "effects/native/graphiceqeffect.h"
+#include "effects/native/linkwitzriley8eqeffect.h"
+#include "effects/native/moogladder4filtereffect.h"
+#include "effects/native/phasereffect.h"
+#ifndef __MACAPPSTORE__
+#include "effects/native/reverbeffect.h"
+#endif
+
+namespace {
+
+const int kSampleRate = 44100;
+const int kFramesPerBuffer = 1024;
+
+// Processes a stereo sine with the default parameters of the effect.
+template<typename Effect>
+void BM_EffectProcess(benchmark::State& state) {
+    {
+        ChannelHandleFactory factory;
+        ChannelHandleAndGroup channel(
+                factory.getOrCreateHandle("[Channel1]"), "[Channel1]");
+        QSet<ChannelHandleAndGroup> registeredChannels;
+        registeredChannels.insert(channel);
+
+        EngineEffect effect(Effect::getManifest(), registeredChannels,
+                EffectInstantiatorPointer(
+                        new EffectProcessorInstantiator<Effect>()));
+
+        CSAMPLE input[kFramesPerBuffer * 2];
+        CSAMPLE output[kFramesPerBuffer * 2];
+        for (int i = 0; i < kFramesPerBuffer; ++i) {
+            double phase = 2 * M_PI * 440.0 * i / kSampleRate;
+            input[i * 2] = static_cast<CSAMPLE>(sin(phase));
+            input[i * 2 + 1] = static_cast<CSAMPLE>(sin(phase * 1.5));
+        }
+        GroupFeatureState groupFeatures;
+        // Measure the steady state rather than the initial fade in.
+        effect.advanceEnableState();
+
+        while (state.KeepRunning()) {
+            effect.process(channel.handle(), input, output,
+                           kFramesPerBuffer * 2, kSampleRate,
+                           EffectProcessor::ENABLED, groupFeatures);
+            benchmark::DoNotOptimize(output[0]);
+        }
+        state.SetItemsProcessed(state.iterations() * kFramesPerBuffer);
+        state.SetLabel(Effect::getId().toStdString());
+    }
+    BenchmarkEnvironment::deleteLeakedControls();
+}
+BENCHMARK_TEMPLATE(BM_EffectProcess, Bessel4LVMixEQEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, Bessel8LVMixEQEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, LinkwitzRiley8EQEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, GraphicEQEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, FilterEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, MoogLadder4FilterEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, BitCrusherEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, FlangerEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, EchoEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, AutoPanEffect);
+#ifndef __MACAPPSTORE__
+BENCHMARK_TEMPLATE(BM_EffectProcess, ReverbEffect);
+#endif
+BENCHMARK_TEMPLATE(BM_EffectProcess, PhaserEffect);
+BENCHMARK_TEMPLATE(BM_EffectProcess, ConvolutionReverbEffect);
+
+} // anonymous namespace
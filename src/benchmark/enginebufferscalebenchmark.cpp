@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <QScopedPointer>
+#include <QString>
+
+#include "engine/enginebufferscalelinear.h"
+#include "engine/enginebufferscalerubberband.h"
+#include "engine/enginebufferscalest.h"
+#include "engine/readaheadmanager.h"
+#include "util/math.h"
+#include "util/types.h"
+
+namespace {
+
+const int kSampleRate = 44100;
+const int kFramesPerBuffer = 1024;
+
+// Serves an endless stereo sine with a different frequency per channel
+// instead of reading from a CachingReader.
+class SineReadAheadManager : public ReadAheadManager {
+  public:
+    SineReadAheadManager()
+            : m_phase(0.0) {
+    }
+
+    virtual int getNextSamples(double dRate, CSAMPLE* buffer,
+                               int requested_samples) {
+        Q_UNUSED(dRate);
+        for (int i = 0; i < requested_samples / 2; ++i) {
+            buffer[i * 2] = static_cast<CSAMPLE>(sin(m_phase));
+            buffer[i * 2 + 1] = static_cast<CSAMPLE>(sin(m_phase * 1.5));
+            m_phase += 2 * M_PI * 440.0 / kSampleRate;
+        }
+        return requested_samples;
+    }
+
+  private:
+    double m_phase;
+};
+
+// Plays at 1.05 times the original tempo. Keylock capable scalers keep the
+// original pitch.
+template<typename Scaler>
+void BM_EngineBufferScale(benchmark::State& state) {
+    const bool keylock = state.range(0) != 0;
+    SineReadAheadManager readAheadManager;
+    Scaler scaler(&readAheadManager);
+    double tempoRatio = 1.05;
+    double pitchRatio = keylock ? 1.0 : tempoRatio;
+    scaler.setSampleRate(kSampleRate);
+    scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    // Fill the internal buffers of the scalers
+    for (int i = 0; i < 10; ++i) {
+        scaler.getScaled(kFramesPerBuffer * 2);
+    }
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(scaler.getScaled(kFramesPerBuffer * 2));
+    }
+    state.SetItemsProcessed(state.iterations() * kFramesPerBuffer);
+    state.SetLabel(keylock ? "keylock" : "vinyl");
+}
+// Arg: keylock
+BENCHMARK_TEMPLATE(BM_EngineBufferScale, EngineBufferScaleLinear)->Arg(0);
+BENCHMARK_TEMPLATE(BM_EngineBufferScale, EngineBufferScaleST)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_EngineBufferScale, EngineBufferScaleRubberBand)->Arg(0)->Arg(1);
+
+// Plays at 0.87 times the original tempo with each interpolation of
+// EngineBufferScaleLinear. The label reports the largest difference of the
+// left channel to the ideal sine, so the cost can be weighed against the
+// accuracy.
+void BM_EngineBufferScaleLinearInterpolation(benchmark::State& state) {
+    const EngineBufferScaleLinear::Interpolation interpolation =
+            static_cast<EngineBufferScaleLinear::Interpolation>(state.range(0));
+    const double kRate = 0.87;
+    SineReadAheadManager readAheadManager;
+    EngineBufferScaleLinear scaler(&readAheadManager);
+    scaler.setInterpolation(interpolation);
+    double tempoRatio = kRate;
+    double pitchRatio = kRate;
+    scaler.setSampleRate(kSampleRate);
+    // Twice, so the rate is not ramped from 1.0
+    scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+
+    double maxError = 0;
+    int frame = 0;
+    for (int i = 0; i < 10; ++i) {
+        const CSAMPLE* pOutput = scaler.getScaled(kFramesPerBuffer * 2);
+        for (int j = 0; j < kFramesPerBuffer; ++j, ++frame) {
+            const double expected =
+                    sin(2 * M_PI * 440.0 / kSampleRate * frame * kRate);
+            // Skip the frames that are computed with the silent history
+            if (frame >= 16) {
+                maxError = math_max(maxError, fabs(pOutput[j * 2] - expected));
+            }
+        }
+    }
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(scaler.getScaled(kFramesPerBuffer * 2));
+    }
+    state.SetItemsProcessed(state.iterations() * kFramesPerBuffer);
+    const char* names[] = { "linear", "cubic", "sinc" };
+    state.SetLabel(QString("%1, max error %2")
+                   .arg(names[interpolation])
+                   .arg(maxError, 0, 'e', 1)
+                   .toStdString());
+}
+// Arg: EngineBufferScaleLinear::Interpolation
+BENCHMARK(BM_EngineBufferScaleLinearInterpolation)
+        ->Arg(EngineBufferScaleLinear::LINEAR)
+        ->Arg(EngineBufferScaleLinear::CUBIC)
+        ->Arg(EngineBufferScaleLinear::SINC);
+
+} // anonymous namespace
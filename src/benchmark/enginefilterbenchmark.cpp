@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <QVector>
+
+#include "benchmark/legacyenginefilteriir.h"
+#include "engine/enginefilterbessel4.h"
+#include "engine/enginefilterbessel8.h"
+#include "engine/enginefilterlinkwitzriley8.h"
+#include "engine/engineoversampler.h"
+#include "util/types.h"
+
+namespace {
+
+const int kSampleRate = 44100;
+
+void fillSine(QVector<CSAMPLE>* pBuffer) {
+    for (int i = 0; i < pBuffer->size(); i += 2) {
+        (*pBuffer)[i] = static_cast<CSAMPLE>(sin(i * 0.01));
+        (*pBuffer)[i + 1] = static_cast<CSAMPLE>(sin(i * 0.015));
+    }
+}
+
+// Filters a stereo buffer of range(0) frames with settled coefficients. The
+// Legacy filters are the direct form II code EngineFilterIIR used before, to
+// compare against.
+template<typename Filter>
+void BM_EngineFilterIIR(benchmark::State& state) {
+    const int bufferSize = state.range(0) * 2;
+    Filter filter(kSampleRate, 1000);
+    filter.assumeSettled();
+    QVector<CSAMPLE> input(bufferSize);
+    QVector<CSAMPLE> output(bufferSize);
+    fillSine(&input);
+    while (state.KeepRunning()) {
+        filter.process(input.constData(), output.data(), bufferSize);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, EngineFilterBessel4Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, EngineFilterBessel8Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, EngineFilterLinkwtzRiley8Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, LegacyEngineFilterBessel4Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, LegacyEngineFilterBessel8Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIR, LegacyEngineFilterLinkwtzRiley8Low)->Arg(64)->Arg(1024);
+
+// Like BM_EngineFilterIIR, but the coefficients change in every callback, as
+// they do while a filter knob is turned. The legacy filters cross fade
+// between the old and the new coefficients instead of moving them.
+template<typename Filter>
+void BM_EngineFilterIIRSweep(benchmark::State& state) {
+    const int bufferSize = state.range(0) * 2;
+    Filter filter(kSampleRate, 1000);
+    filter.assumeSettled();
+    QVector<CSAMPLE> input(bufferSize);
+    QVector<CSAMPLE> output(bufferSize);
+    fillSine(&input);
+    int i = 0;
+    while (state.KeepRunning()) {
+        filter.setFrequencyCorners(kSampleRate, 1000 + (i++ % 100) * 10);
+        filter.process(input.constData(), output.data(), bufferSize);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_EngineFilterIIRSweep, EngineFilterBessel4Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIRSweep, EngineFilterLinkwtzRiley8Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIRSweep, LegacyEngineFilterBessel4Low)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EngineFilterIIRSweep, LegacyEngineFilterLinkwtzRiley8Low)->Arg(64)->Arg(1024);
+
+// Upsamples and downsamples range(1) frames by the factor range(0), which is
+// the overhead of an effect that opts in to oversampling.
+void BM_EngineOversampler(benchmark::State& state) {
+    const int factor = state.range(0);
+    const int numFrames = state.range(1);
+    EngineOversampler oversampler(factor);
+    QVector<CSAMPLE> input(numFrames * 2);
+    QVector<CSAMPLE> oversampled(numFrames * 2 * factor);
+    QVector<CSAMPLE> output(numFrames * 2);
+    fillSine(&input);
+    while (state.KeepRunning()) {
+        oversampler.upsample(input.constData(), oversampled.data(), numFrames);
+        oversampler.downsample(oversampled.constData(), output.data(), numFrames);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * numFrames);
+}
+BENCHMARK(BM_EngineOversampler)->ArgPair(2, 1024)->ArgPair(4, 1024);
+
+// The reference: The generic direct form II interpreter of fidlib, which is
+// what EngineFilterIIR computes, one channel after the other.
+void BM_FidlibDirectForm(benchmark::State& state) {
+    const int bufferSize = state.range(0) * 2;
+    char spec[] = "LpBe8";
+    FidFilter* pFilter = fid_design(spec, kSampleRate, 1000, 0, 0, NULL);
+    double (*pFunc)(void*, double);
+    void* pRun = fid_run_new(pFilter, &pFunc);
+    void* pBuf1 = fid_run_newbuf(pRun);
+    void* pBuf2 = fid_run_newbuf(pRun);
+    QVector<CSAMPLE> input(bufferSize);
+    QVector<CSAMPLE> output(bufferSize);
+    fillSine(&input);
+    while (state.KeepRunning()) {
+        for (int i = 0; i < bufferSize; i += 2) {
+            output[i] = static_cast<CSAMPLE>(pFunc(pBuf1, input[i]));
+            output[i + 1] = static_cast<CSAMPLE>(pFunc(pBuf2, input[i + 1]));
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("LpBe8");
+    fid_run_freebuf(pBuf2);
+    fid_run_freebuf(pBuf1);
+    fid_run_free(pRun);
+    free(pFilter);
+}
+BENCHMARK(BM_FidlibDirectForm)->Arg(64)->Arg(1024);
+
+} // anonymous namespace
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <QList>
+#include <QScopedPointer>
+#include <QTest>
+
+#include "benchmark/benchmarkenvironment.h"
+#include "controlobject.h"
+#include "effects/effectsmanager.h"
+#include "engine/enginebuffer.h"
+#include "engine/enginedeck.h"
+#include "engine/enginemaster.h"
+#include "trackinfoobject.h"
+
+namespace {
+
+// The frames per callback of the default latency
+const int kFramesPerBuffer = 1024;
+
+// An EngineMaster with numDecks decks that play src/test/sine-30.wav in a
+// loop.
+class EngineFixture {
+  public:
+    EngineFixture(int numDecks)
+            : m_pNumDecks(new ControlObject(ConfigKey("[Master]", "num_decks"))),
+              m_pEffectsManager(new EffectsManager(
+                      NULL, BenchmarkEnvironment::config())),
+              m_pEngineMaster(new EngineMaster(
+                      BenchmarkEnvironment::config(), "[Master]",
+                      m_pEffectsManager.data(), false, true)) {
+        for (int i = 0; i < numDecks; ++i) {
+            const QString group = QString("[Channel%1]").arg(i + 1);
+            EngineDeck* pDeck = new EngineDeck(
+                    m_pEngineMaster->registerChannelGroup(group),
+                    BenchmarkEnvironment::config(), m_pEngineMaster.data(),
+                    m_pEffectsManager.data(), EngineChannel::CENTER);
+            m_pEngineMaster->addChannel(pDeck);
+            m_pNumDecks->set(m_pNumDecks->get() + 1);
+            ControlObject::set(ConfigKey(group, "master"), 1.0);
+            m_decks.append(pDeck);
+        }
+        foreach (EngineDeck* pDeck, m_decks) {
+            loadTrack(pDeck);
+        }
+        ControlObject::set(ConfigKey("[Master]", "enabled"), 1.0);
+    }
+
+    ~EngineFixture() {
+        // Deletes the decks.
+        m_pEngineMaster.reset();
+        m_pEffectsManager.reset();
+        m_pNumDecks.reset();
+        BenchmarkEnvironment::deleteLeakedControls();
+    }
+
+    bool allTracksLoaded() const {
+        foreach (EngineDeck* pDeck, m_decks) {
+            if (!pDeck->getEngineBuffer()->isTrackLoaded()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void process() {
+        m_pEngineMaster->process(kFramesPerBuffer * 2);
+    }
+
+  private:
+    void loadTrack(EngineDeck* pDeck) {
+        TrackPointer pTrack(new TrackInfoObject(
+                BenchmarkEnvironment::testFilePath("sine-30.wav")));
+        pDeck->getEngineBuffer()->slotLoadTrack(pTrack, true);
+        process();
+        for (int i = 0; i < 100 && !pDeck->getEngineBuffer()->isTrackLoaded();
+                ++i) {
+            QTest::qSleep(100); // millis
+        }
+        ControlObject::set(ConfigKey(pDeck->getGroup(), "repeat"), 1.0);
+        ControlObject::set(ConfigKey(pDeck->getGroup(), "play"), 1.0);
+    }
+
+    QScopedPointer<ControlObject> m_pNumDecks;
+    QScopedPointer<EffectsManager> m_pEffectsManager;
+    QScopedPointer<EngineMaster> m_pEngineMaster;
+    QList<EngineDeck*> m_decks;
+};
+
+void BM_EngineMasterProcess(benchmark::State& state) {
+    EngineFixture engine(static_cast<int>(state.range(0)));
+    if (!engine.allTracksLoaded()) {
+        state.SkipWithError("Could not load src/test/sine-30.wav");
+        return;
+    }
+    // Let the reader fill the cache around the play positions.
+    for (int i = 0; i < 10; ++i) {
+        engine.process();
+        QTest::qSleep(10);
+    }
+    while (state.KeepRunning()) {
+        engine.process();
+    }
+    state.SetItemsProcessed(state.iterations() * kFramesPerBuffer);
+}
+BENCHMARK(BM_EngineMasterProcess)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+} // anonymous namespace
@@ -0,0 +1,181 @@
+#ifndef LEGACYENGINEFILTERIIR_H
+#define LEGACYENGINEFILTERIIR_H
+
+#include <stdio.h>
+#include <string.h>
+
+#include "util/types.h"
+#define MIXXX
+#include <fidlib.h>
+
+// The direct form II EngineFilterIIR as it was before it was replaced by
+// EngineFilterBiquadCascade. Only kept as the baseline of
+// enginefilterbenchmark, so only the low passes it measures are here.
+// Coefficient changes cross fade between the old and the new filter for one
+// buffer, as they used to.
+template<unsigned int SIZE>
+class LegacyEngineFilterIIRLow {
+  public:
+    LegacyEngineFilterIIRLow()
+            : m_doRamping(false) {
+        memset(m_coef, 0, sizeof(m_coef));
+        memset(m_oldCoef, 0, sizeof(m_oldCoef));
+        memset(m_buf1, 0, sizeof(m_buf1));
+        memset(m_buf2, 0, sizeof(m_buf2));
+        memset(m_oldBuf1, 0, sizeof(m_oldBuf1));
+        memset(m_oldBuf2, 0, sizeof(m_oldBuf2));
+    }
+
+    void assumeSettled() {
+        m_doRamping = false;
+    }
+
+    void process(const CSAMPLE* pIn, CSAMPLE* pOutput, const int iBufferSize) {
+        if (!m_doRamping) {
+            for (int i = 0; i < iBufferSize; i += 2) {
+                pOutput[i] = processSample(m_coef, m_buf1, pIn[i]);
+                pOutput[i + 1] = processSample(m_coef, m_buf2, pIn[i + 1]);
+            }
+            return;
+        }
+        double cross_mix = 0.0;
+        double cross_inc = 4.0 / static_cast<double>(iBufferSize);
+        for (int i = 0; i < iBufferSize; i += 2) {
+            double old1 = processSample(m_oldCoef, m_oldBuf1, pIn[i]);
+            double old2 = processSample(m_oldCoef, m_oldBuf2, pIn[i + 1]);
+            double new1 = processSample(m_coef, m_buf1, pIn[i]);
+            double new2 = processSample(m_coef, m_buf2, pIn[i + 1]);
+            if (i < iBufferSize / 2) {
+                pOutput[i] = old1;
+                pOutput[i + 1] = old2;
+            } else {
+                pOutput[i] = new1 * cross_mix + old1 * (1.0 - cross_mix);
+                pOutput[i + 1] = new2 * cross_mix + old2 * (1.0 - cross_mix);
+                cross_mix += cross_inc;
+            }
+        }
+        m_doRamping = false;
+    }
+
+  protected:
+    void setCoefs(const char* spec, double sampleRate, double freq0) {
+        char spec_d[40];
+        strcpy(spec_d, spec);
+        memcpy(m_oldCoef, m_coef, sizeof(m_coef));
+        m_coef[0] = fid_design_coef(m_coef + 1, SIZE, spec_d, sampleRate,
+                                    freq0, 0, 0);
+        initBuffers();
+    }
+
+    // Two cascaded low passes of SIZE / 2, e.g. a Linkwitz-Riley filter.
+    void setCoefs2(const char* spec, double sampleRate, double freq0) {
+        char spec_d[40];
+        strcpy(spec_d, spec);
+        memcpy(m_oldCoef, m_coef, sizeof(m_coef));
+        m_coef[0] = fid_design_coef(m_coef + 1, SIZE / 2, spec_d, sampleRate,
+                                    freq0, 0, 0) *
+                fid_design_coef(m_coef + 1 + SIZE / 2, SIZE / 2, spec_d,
+                                sampleRate, freq0, 0, 0);
+        initBuffers();
+    }
+
+  private:
+    void initBuffers() {
+        memcpy(m_oldBuf1, m_buf1, sizeof(m_buf1));
+        memcpy(m_oldBuf2, m_buf2, sizeof(m_buf2));
+        memset(m_buf1, 0, sizeof(m_buf1));
+        memset(m_buf2, 0, sizeof(m_buf2));
+        m_doRamping = true;
+    }
+
+    inline double processSample(double* coef, double* buf, double val);
+
+    double m_coef[SIZE + 1];
+    double m_oldCoef[SIZE + 1];
+    double m_buf1[SIZE];
+    double m_oldBuf1[SIZE];
+    double m_buf2[SIZE];
+    double m_oldBuf2[SIZE];
+    bool m_doRamping;
+};
+
+template<>
+inline double LegacyEngineFilterIIRLow<4>::processSample(double* coef,
+                                                         double* buf,
+                                                         double val) {
+    double tmp, fir, iir;
+    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
+    iir = val * coef[0];
+    iir -= coef[1] * tmp; fir = tmp;
+    iir -= coef[2] * buf[0]; fir += buf[0] + buf[0];
+    fir += iir;
+    tmp = buf[1]; buf[1] = iir; val = fir;
+    iir = val;
+    iir -= coef[3] * tmp; fir = tmp;
+    iir -= coef[4] * buf[2]; fir += buf[2] + buf[2];
+    fir += iir;
+    buf[3] = iir; val = fir;
+    return val;
+}
+
+template<>
+inline double LegacyEngineFilterIIRLow<8>::processSample(double* coef,
+                                                         double* buf,
+                                                         double val) {
+    double tmp, fir, iir;
+    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
+    buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
+    iir = val * coef[0];
+    iir -= coef[1] * tmp; fir = tmp;
+    iir -= coef[2] * buf[0]; fir += buf[0] + buf[0];
+    fir += iir;
+    tmp = buf[1]; buf[1] = iir; val = fir;
+    iir = val;
+    iir -= coef[3] * tmp; fir = tmp;
+    iir -= coef[4] * buf[2]; fir += buf[2] + buf[2];
+    fir += iir;
+    tmp = buf[3]; buf[3] = iir; val = fir;
+    iir = val;
+    iir -= coef[5] * tmp; fir = tmp;
+    iir -= coef[6] * buf[4]; fir += buf[4] + buf[4];
+    fir += iir;
+    tmp = buf[5]; buf[5] = iir; val = fir;
+    iir = val;
+    iir -= coef[7] * tmp; fir = tmp;
+    iir -= coef[8] * buf[6]; fir += buf[6] + buf[6];
+    fir += iir;
+    buf[7] = iir; val = fir;
+    return val;
+}
+
+class LegacyEngineFilterBessel4Low : public LegacyEngineFilterIIRLow<4> {
+  public:
+    LegacyEngineFilterBessel4Low(int sampleRate, double freqCorner1) {
+        setFrequencyCorners(sampleRate, freqCorner1);
+    }
+    void setFrequencyCorners(int sampleRate, double freqCorner1) {
+        setCoefs("LpBe4", sampleRate, freqCorner1);
+    }
+};
+
+class LegacyEngineFilterBessel8Low : public LegacyEngineFilterIIRLow<8> {
+  public:
+    LegacyEngineFilterBessel8Low(int sampleRate, double freqCorner1) {
+        setFrequencyCorners(sampleRate, freqCorner1);
+    }
+    void setFrequencyCorners(int sampleRate, double freqCorner1) {
+        setCoefs("LpBe8", sampleRate, freqCorner1);
+    }
+};
+
+class LegacyEngineFilterLinkwtzRiley8Low : public LegacyEngineFilterIIRLow<8> {
+  public:
+    LegacyEngineFilterLinkwtzRiley8Low(int sampleRate, double freqCorner1) {
+        setFrequencyCorners(sampleRate, freqCorner1);
+    }
+    void setFrequencyCorners(int sampleRate, double freqCorner1) {
+        setCoefs2("LpBu4", sampleRate, freqCorner1);
+    }
+};
+
+#endif // LEGACYENGINEFILTERIIR_H
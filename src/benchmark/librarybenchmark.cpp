@@ -0,0 +1,289 @@
+#include <benchmark/benchmark.h>
+
+#include <QCoreApplication>
+#include <QHash>
+#include <QScopedPointer>
+#include <QSet>
+#include <QSqlQuery>
+#include <QStringList>
+#include <QVector>
+
+#include "benchmark/benchmarkenvironment.h"
+#include "library/basetrackcache.h"
+#include "library/dao/trackdao.h"
+#include "library/queryutil.h"
+#include "library/searchqueryparser.h"
+#include "library/trackcollection.h"
+#include "util/assert.h"
+
+namespace {
+
+const int kNumTracks = 250000;
+
+const char* kGenres[] = {
+    "House", "Techno", "Drum & Bass", "Dubstep", "Hip Hop",
+    "Jazz", "Rock", "Pop", "Ambient", "Trance",
+};
+const int kNumGenres = sizeof(kGenres) / sizeof(kGenres[0]);
+
+const char* kSearchQueries[] = {
+    "",
+    "artist 42",
+    "title 1234",
+    "bpm:>128",
+    "genre:house artist 7",
+    "-genre:rock title",
+};
+const int kNumSearchQueries = sizeof(kSearchQueries) / sizeof(kSearchQueries[0]);
+
+// The columns of the sort benchmark, sorted by in that order
+const char* kSortColumns[] = {
+    "artist", "title", "bpm", "year",
+};
+const int kNumSortColumns = sizeof(kSortColumns) / sizeof(kSortColumns[0]);
+
+// A library of kNumTracks synthetic tracks and the BaseTrackCache on top of
+// it that the library view uses. It is created by the first benchmark that
+// needs it and shared by all others, since filling the database takes a
+// while.
+class LibraryFixture {
+  public:
+    static LibraryFixture* instance() {
+        if (s_pInstance == NULL) {
+            s_pInstance = new LibraryFixture();
+            // Close the database before the application is gone.
+            qAddPostRoutine(destroy);
+        }
+        return s_pInstance;
+    }
+
+    TrackCollection* collection() {
+        return &m_trackCollection;
+    }
+
+    BaseTrackCache* trackCache() {
+        return m_pTrackCache.data();
+    }
+
+    const QSet<TrackId>& trackIds() const {
+        return m_trackIds;
+    }
+
+    const QStringList& columns() const {
+        return m_columns;
+    }
+
+  private:
+    LibraryFixture()
+            : m_trackCollection(BenchmarkEnvironment::config()) {
+        QSqlDatabase database = m_trackCollection.getDatabase();
+        ScopedTransaction transaction(database);
+        QSqlQuery locationQuery(database);
+        locationQuery.prepare(
+                "INSERT INTO track_locations "
+                "(location, filename, directory, filesize, fs_deleted, "
+                "needs_verification) "
+                "VALUES (:location, :filename, :directory, 0, 0, 0)");
+        QSqlQuery libraryQuery(database);
+        libraryQuery.prepare(
+                "INSERT INTO library "
+                "(artist, title, album, album_artist, year, genre, "
+                "tracknumber, location, comment, duration, bitrate, "
+                "samplerate, bpm, channels, mixxx_deleted) "
+                "VALUES (:artist, :title, :album, :artist, :year, :genre, "
+                ":tracknumber, :location, :comment, 300, 320, 44100, :bpm, "
+                "2, 0)");
+        for (int i = 0; i < kNumTracks; ++i) {
+            const QString directory = QString("/music/artist %1").arg(i % 1000);
+            const QString filename = QString("track %1.mp3").arg(i);
+            const QString location = directory + "/" + filename;
+            locationQuery.bindValue(":location", location);
+            locationQuery.bindValue(":filename", filename);
+            locationQuery.bindValue(":directory", directory);
+            RELEASE_ASSERT(locationQuery.exec());
+
+            libraryQuery.bindValue(":artist", QString("Artist %1").arg(i % 1000));
+            libraryQuery.bindValue(":title", QString("Title %1").arg(i));
+            libraryQuery.bindValue(":album", QString("Album %1").arg(i % 8000));
+            libraryQuery.bindValue(":year", QString::number(1970 + i % 50));
+            libraryQuery.bindValue(":genre", kGenres[i % kNumGenres]);
+            libraryQuery.bindValue(":tracknumber", QString::number(i % 12 + 1));
+            libraryQuery.bindValue(":location", locationQuery.lastInsertId());
+            libraryQuery.bindValue(":comment", QString("Comment %1").arg(i % 97));
+            libraryQuery.bindValue(":bpm", 80.0 + (i % 900) / 10.0);
+            RELEASE_ASSERT(libraryQuery.exec());
+            m_trackIds.insert(TrackId(libraryQuery.lastInsertId()));
+        }
+        transaction.commit();
+
+        // The same view and columns as the MixxxLibraryFeature.
+        m_columns << "library." + LIBRARYTABLE_ID
+                  << "library." + LIBRARYTABLE_ARTIST
+                  << "library." + LIBRARYTABLE_TITLE
+                  << "library." + LIBRARYTABLE_ALBUM
+                  << "library." + LIBRARYTABLE_ALBUMARTIST
+                  << "library." + LIBRARYTABLE_YEAR
+                  << "library." + LIBRARYTABLE_GENRE
+                  << "library." + LIBRARYTABLE_COMPOSER
+                  << "library." + LIBRARYTABLE_GROUPING
+                  << "library." + LIBRARYTABLE_TRACKNUMBER
+                  << "library." + LIBRARYTABLE_BPM
+                  << "library." + LIBRARYTABLE_DURATION
+                  << "library." + LIBRARYTABLE_COMMENT
+                  << "library." + LIBRARYTABLE_MIXXXDELETED
+                  << "track_locations.location"
+                  << "track_locations.fs_deleted";
+        QSqlQuery query(database);
+        RELEASE_ASSERT(query.exec(QString(
+                "CREATE TEMPORARY VIEW IF NOT EXISTS library_cache_view AS "
+                "SELECT %1 FROM library "
+                "INNER JOIN track_locations ON library.location = track_locations.id")
+                .arg(m_columns.join(","))));
+        for (QStringList::iterator it = m_columns.begin();
+             it != m_columns.end(); ++it) {
+            if (it->startsWith("library.")) {
+                *it = it->replace("library.", "");
+            } else if (it->startsWith("track_locations.")) {
+                *it = it->replace("track_locations.", "");
+            }
+        }
+        m_pTrackCache.reset(new BaseTrackCache(
+                &m_trackCollection, "library_cache_view", LIBRARYTABLE_ID,
+                m_columns, true));
+        m_pTrackCache->buildIndex();
+    }
+
+    static void destroy() {
+        delete s_pInstance;
+        s_pInstance = NULL;
+    }
+
+    static LibraryFixture* s_pInstance;
+
+    TrackCollection m_trackCollection;
+    QScopedPointer<BaseTrackCache> m_pTrackCache;
+    QSet<TrackId> m_trackIds;
+    QStringList m_columns;
+};
+
+// static
+LibraryFixture* LibraryFixture::s_pInstance = NULL;
+
+// Searching and sorting the whole library like the library view does on each
+// key press in the search box, without the results of previous searches.
+// Free-text searches compare every row with LIKE, unless useSearchIndex is
+// set.
+void filterAndSort(benchmark::State& state, bool useSearchIndex) {
+    LibraryFixture* pLibrary = LibraryFixture::instance();
+    pLibrary->trackCache()->setSearchIndexEnabled(useSearchIndex);
+    const QString query(kSearchQueries[state.range(0)]);
+    QVector<BaseTrackCache::SortColumn> sortColumns;
+    sortColumns << BaseTrackCache::SortColumn(
+            pLibrary->columns().indexOf(LIBRARYTABLE_ARTIST),
+            Qt::AscendingOrder);
+    QHash<TrackId, int> trackToIndex;
+    while (state.KeepRunning()) {
+        pLibrary->trackCache()->slotInvalidateQueryResults();
+        pLibrary->trackCache()->filterAndSort(
+                pLibrary->trackIds(), query, "", sortColumns, &trackToIndex);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumTracks);
+    state.SetLabel(QString("\"%1\" -> %2 tracks")
+                   .arg(query).arg(trackToIndex.size()).toStdString());
+    pLibrary->trackCache()->setSearchIndexEnabled(false);
+}
+
+void BM_BaseTrackCacheFilterAndSort(benchmark::State& state) {
+    filterAndSort(state, false);
+}
+BENCHMARK(BM_BaseTrackCacheFilterAndSort)
+        ->DenseRange(0, kNumSearchQueries - 1)
+        ->Unit(benchmark::kMillisecond);
+
+void BM_BaseTrackCacheFilterAndSortIndexed(benchmark::State& state) {
+    filterAndSort(state, true);
+}
+BENCHMARK(BM_BaseTrackCacheFilterAndSortIndexed)
+        ->DenseRange(0, kNumSearchQueries - 1)
+        ->Unit(benchmark::kMillisecond);
+
+// Typing a query into the search box one character after another. Each
+// search after the first only filters the tracks the one before matched.
+void BM_BaseTrackCacheTypeSearch(benchmark::State& state) {
+    LibraryFixture* pLibrary = LibraryFixture::instance();
+    const QString query("title 1234");
+    QVector<BaseTrackCache::SortColumn> sortColumns;
+    sortColumns << BaseTrackCache::SortColumn(
+            pLibrary->columns().indexOf(LIBRARYTABLE_ARTIST),
+            Qt::AscendingOrder);
+    QHash<TrackId, int> trackToIndex;
+    while (state.KeepRunning()) {
+        pLibrary->trackCache()->slotInvalidateQueryResults();
+        for (int i = 1; i <= query.size(); ++i) {
+            pLibrary->trackCache()->filterAndSort(
+                    pLibrary->trackIds(), query.left(i), "", sortColumns,
+                    &trackToIndex);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * query.size());
+    state.SetLabel(QString("\"%1\" -> %2 tracks")
+                   .arg(query).arg(trackToIndex.size()).toStdString());
+}
+BENCHMARK(BM_BaseTrackCacheTypeSearch)
+        ->Unit(benchmark::kMillisecond);
+
+// Sorting the whole library by 1 to kNumSortColumns columns, like clicking
+// the headers of the library view one after another.
+void BM_BaseTrackCacheSort(benchmark::State& state) {
+    LibraryFixture* pLibrary = LibraryFixture::instance();
+    QVector<BaseTrackCache::SortColumn> sortColumns;
+    QStringList names;
+    for (int i = 0; i < state.range(0); ++i) {
+        sortColumns << BaseTrackCache::SortColumn(
+                pLibrary->columns().indexOf(kSortColumns[i]),
+                (i % 2 == 0) ? Qt::AscendingOrder : Qt::DescendingOrder);
+        names << kSortColumns[i];
+    }
+    QHash<TrackId, int> trackToIndex;
+    while (state.KeepRunning()) {
+        pLibrary->trackCache()->filterAndSort(
+                pLibrary->trackIds(), "", "", sortColumns, &trackToIndex);
+    }
+    state.SetItemsProcessed(state.iterations() * kNumTracks);
+    state.SetLabel(names.join(", ").toStdString());
+}
+BENCHMARK(BM_BaseTrackCacheSort)
+        ->DenseRange(1, kNumSortColumns)
+        ->Unit(benchmark::kMillisecond);
+
+// Loading all tracks into the BaseTrackCache, which happens once when the
+// library is shown.
+void BM_BaseTrackCacheBuildIndex(benchmark::State& state) {
+    LibraryFixture* pLibrary = LibraryFixture::instance();
+    while (state.KeepRunning()) {
+        pLibrary->trackCache()->buildIndex();
+    }
+    state.SetItemsProcessed(state.iterations() * kNumTracks);
+}
+BENCHMARK(BM_BaseTrackCacheBuildIndex)
+        ->Unit(benchmark::kMillisecond);
+
+void BM_SearchQueryParser(benchmark::State& state) {
+    LibraryFixture* pLibrary = LibraryFixture::instance();
+    QSqlDatabase database = pLibrary->collection()->getDatabase();
+    SearchQueryParser parser(database);
+    const QString query(kSearchQueries[state.range(0)]);
+    QStringList searchColumns;
+    searchColumns << "artist" << "album" << "album_artist" << "location"
+                  << "grouping" << "comment" << "title" << "genre";
+    while (state.KeepRunning()) {
+        std::unique_ptr<QueryNode> pQuery(
+                parser.parseQuery(query, searchColumns, ""));
+        benchmark::DoNotOptimize(pQuery.get());
+    }
+    state.SetLabel(QString("\"%1\"").arg(query).toStdString());
+}
+BENCHMARK(BM_SearchQueryParser)
+        ->DenseRange(0, kNumSearchQueries - 1);
+
+} // anonymous namespace
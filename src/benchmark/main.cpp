@@ -0,0 +1,21 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark/benchmarkenvironment.h"
+#include "util/console.h"
+
+// Runs the benchmarks in src/benchmark. Google Benchmark's flags are
+// available, e.g. --benchmark_filter=EngineMaster to select benchmarks and
+// --benchmark_format=json or --benchmark_out=<file> for machine-readable
+// results that can be compared between revisions.
+int main(int argc, char** argv) {
+    Console console;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    BenchmarkEnvironment environment(argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
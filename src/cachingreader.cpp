@@ -5,6 +5,7 @@
 #include "controlobjectthread.h"
 
 #include "cachingreader.h"
+#include "playermanager.h"
 #include "trackinfoobject.h"
 #include "sampleutil.h"
 #include "util/counter.h"
@@ -26,37 +27,88 @@ namespace {
 // that for stereo samples.
 const SINT kDefaultHintSamples = 1024 * CachingReaderChunk::kChannels;
 
+// The number of read() calls after which the accumulated cache hits and misses
+// are reported to StatsManager.
+const int kReadsPerStatsReport = 1000;
+
+// The number of speculative read requests that may be pending in the worker
+// before prefetchWholeTrack stops issuing new ones. Kept small so that cue and
+// loop hints are not queued behind a long list of prefetches.
+const int kMaxPendingPrefetchRequests = 2;
+
+// Reads the configured number of chunks and whether the whole track should be
+// kept in memory. Only decks are configurable, samplers and preview decks play
+// short or few tracks and keep the default cache size.
+int configuredChunkCount(const QString& group,
+                         ConfigObject<ConfigValue>* pConfig,
+                         bool* pWholeTrackResident) {
+    *pWholeTrackResident = false;
+    int memoryMB = CachingReader::kDefaultMemoryMB;
+    if (pConfig != nullptr && PlayerManager::isDeckGroup(group)) {
+        *pWholeTrackResident = pConfig->getValueString(
+                ConfigKey("[Master]", "caching_reader_whole_track"), "0").toInt() != 0;
+        const int defaultMemoryMB = *pWholeTrackResident ?
+                CachingReader::kDefaultWholeTrackMemoryMB :
+                CachingReader::kDefaultMemoryMB;
+        memoryMB = pConfig->getValueString(
+                ConfigKey("[Master]", "caching_reader_memory_mb"),
+                QString::number(defaultMemoryMB)).toInt();
+    }
+    const SINT chunkBytes = CachingReaderChunk::kSamples * sizeof(CSAMPLE);
+    // At least a few chunks are needed around the play position and the hints.
+    return math_max(16, static_cast<int>(
+            static_cast<qint64>(memoryMB) * 1024 * 1024 / chunkBytes));
+}
+
 } // anonymous namespace
 
-// currently CachingReaderWorker::kCachingReaderChunkLength is 65536 (0x10000);
-// For 80 chunks we need 5242880 (0x500000) bytes (5 MiB) of Memory
+// CachingReaderChunk::kSamples is 16384, i.e. 64 KiB per chunk. 5 MiB hold
+// 80 chunks or about 13 seconds of audio at 48 kHz.
+//static
+const int CachingReader::kDefaultMemoryMB = 5;
 //static
-const int CachingReader::maximumCachingReaderChunksInMemory = 80;
+const int CachingReader::kDefaultWholeTrackMemoryMB = 256;
 
 CachingReader::CachingReader(QString group,
                              ConfigObject<ConfigValue>* config)
         : m_pConfig(config),
           m_chunkReadRequestFIFO(1024),
+          m_speculativeChunkReadRequestFIFO(1024),
           m_readerStatusFIFO(1024),
+          m_expiredChunkIndexFIFO(16),
+          m_hintGeneration(0),
           m_readerStatus(INVALID),
+          m_freeChunkCount(0),
+          m_pChunkIndex(new CachingReaderChunkIndex()),
+          m_bWholeTrackResident(false),
+          m_prefetchChunkIndex(0),
+          m_chunkHits(0),
+          m_chunkMisses(0),
+          m_readsSinceStatsReport(0),
+          m_chunkHitCounter(QString("CachingReader %1 chunk hits").arg(group)),
+          m_chunkMissCounter(QString("CachingReader %1 chunk misses").arg(group)),
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
-          m_sampleBuffer(CachingReaderChunk::kSamples * maximumCachingReaderChunksInMemory),
           m_maxReadableFrameIndex(Mixxx::AudioSource::getMinFrameIndex()),
-          m_worker(group, &m_chunkReadRequestFIFO, &m_readerStatusFIFO) {
-
-    m_allocatedCachingReaderChunks.reserve(m_sampleBuffer.size());
+          m_worker(group, config, &m_chunkReadRequestFIFO,
+                   &m_speculativeChunkReadRequestFIFO, &m_readerStatusFIFO,
+                   &m_expiredChunkIndexFIFO, &m_hintGeneration) {
+    const int chunkCount = configuredChunkCount(
+            group, config, &m_bWholeTrackResident);
+    SampleBuffer(CachingReaderChunk::kSamples * chunkCount).swap(m_sampleBuffer);
 
     CSAMPLE* bufferStart = m_sampleBuffer.data();
 
     // Divide up the allocated raw memory buffer into total_chunks
     // chunks. Initialize each chunk to hold nothing and add it to the free
     // list.
-    for (int i = 0; i < maximumCachingReaderChunksInMemory; ++i) {
+    m_chunks.reserve(chunkCount);
+    m_freeChunks.resize(chunkCount);
+    for (int i = 0; i < chunkCount; ++i) {
         CachingReaderChunkForOwner* c = new CachingReaderChunkForOwner(bufferStart);
 
         m_chunks.push_back(c);
-        m_freeChunks.push_back(c);
+        m_freeChunks[m_freeChunkCount++] = c;
 
         bufferStart += CachingReaderChunk::kSamples;
     }
@@ -78,21 +130,37 @@ CachingReader::CachingReader(QString group,
 CachingReader::~CachingReader() {
     m_worker.quitWait();
     qDeleteAll(m_chunks);
+
+    // Clean up chunk indices that are still in flight in either direction.
+    ReaderStatusUpdate status;
+    while (m_readerStatusFIFO.read(&status, 1) == 1) {
+        delete status.chunkIndex;
+    }
+    CachingReaderChunkIndex* pChunkIndex = nullptr;
+    while (m_expiredChunkIndexFIFO.read(&pChunkIndex, 1) == 1) {
+        delete pChunkIndex;
+    }
+    delete m_pChunkIndex;
 }
 
 
 void CachingReader::freeChunk(CachingReaderChunkForOwner* pChunk) {
     DEBUG_ASSERT(pChunk->getState() != CachingReaderChunkForOwner::READ_PENDING);
 
-    const int removed = m_allocatedCachingReaderChunks.remove(pChunk->getIndex());
-    // We'll tolerate not being in allocatedCachingReaderChunks,
-    // because sometime you free a chunk right after you allocated it.
-    DEBUG_ASSERT(removed <= 1);
+    // We'll tolerate not being in the index, because sometime you free a chunk
+    // right after you allocated it or the chunk belongs to a previous track
+    // whose index has been replaced.
+    const SINT chunkIndex = pChunk->getIndex();
+    if (0 <= chunkIndex && chunkIndex < m_pChunkIndex->size() &&
+            (*m_pChunkIndex)[chunkIndex] == pChunk) {
+        (*m_pChunkIndex)[chunkIndex] = nullptr;
+    }
 
     pChunk->removeFromList(
             &m_mruCachingReaderChunk, &m_lruCachingReaderChunk);
     pChunk->free();
-    m_freeChunks.push_back(pChunk);
+    DEBUG_ASSERT(m_freeChunkCount < m_freeChunks.size());
+    m_freeChunks[m_freeChunkCount++] = pChunk;
 }
 
 void CachingReader::freeAllChunks() {
@@ -104,26 +172,25 @@ void CachingReader::freeAllChunks() {
         }
 
         if (pChunk->getState() != CachingReaderChunkForOwner::FREE) {
-            pChunk->removeFromList(
-                    &m_mruCachingReaderChunk, &m_lruCachingReaderChunk);
-            pChunk->free();
-            m_freeChunks.push_back(pChunk);
+            freeChunk(pChunk);
         }
     }
 
-    m_allocatedCachingReaderChunks.clear();
     m_mruCachingReaderChunk = nullptr;
 }
 
 CachingReaderChunkForOwner* CachingReader::allocateChunk(SINT chunkIndex) {
-    if (m_freeChunks.isEmpty()) {
+    if (m_freeChunkCount == 0) {
         return nullptr;
     }
-    CachingReaderChunkForOwner* pChunk = m_freeChunks.takeFirst();
+    DEBUG_ASSERT_AND_HANDLE(0 <= chunkIndex && chunkIndex < m_pChunkIndex->size()) {
+        return nullptr;
+    }
+    CachingReaderChunkForOwner* pChunk = m_freeChunks[--m_freeChunkCount];
     pChunk->init(chunkIndex);
 
     //qDebug() << "Allocating chunk" << pChunk << pChunk->getIndex();
-    m_allocatedCachingReaderChunks.insert(chunkIndex, pChunk);
+    (*m_pChunkIndex)[chunkIndex] = pChunk;
 
     // Adjust the least-recently-used item before inserting the
     // chunk as the new most-recently-used item.
@@ -155,8 +222,10 @@ CachingReaderChunkForOwner* CachingReader::allocateChunkExpireLRU(SINT chunkInde
 }
 
 CachingReaderChunkForOwner* CachingReader::lookupChunk(SINT chunkIndex) {
-    // Defaults to nullptr if it's not in the hash.
-    CachingReaderChunkForOwner* chunk = m_allocatedCachingReaderChunks.value(chunkIndex, nullptr);
+    if (chunkIndex < 0 || chunkIndex >= m_pChunkIndex->size()) {
+        return nullptr;
+    }
+    CachingReaderChunkForOwner* chunk = m_pChunkIndex->at(chunkIndex);
 
     // Make sure the allocated number matches the indexed chunk number.
     DEBUG_ASSERT(chunk == nullptr || chunkIndex == chunk->getIndex());
@@ -178,6 +247,54 @@ CachingReaderChunkForOwner* CachingReader::lookupChunkAndFreshen(SINT chunkIndex
     return pChunk;
 }
 
+bool CachingReader::requestChunk(CachingReaderChunkForOwner* pChunk,
+                                 int priority) {
+    // Prefetch requests are never hinted again, so they must not be
+    // considered stale.
+    CachingReaderChunkReadRequest request(pChunk,
+            priority >= HINT_PRIORITY_SPECULATIVE &&
+            priority < HINT_PRIORITY_PREFETCH);
+    FIFO<CachingReaderChunkReadRequest>* pFIFO =
+            priority < HINT_PRIORITY_SPECULATIVE ?
+            &m_chunkReadRequestFIFO : &m_speculativeChunkReadRequestFIFO;
+    pChunk->giveToWorker();
+    // qDebug() << "Requesting read of chunk" << current << "into" << pChunk;
+    // qDebug() << "Requesting read into " << request.chunk->data;
+    if (pFIFO->write(&request, 1) != 1) {
+        qWarning() << "ERROR: Could not submit read request for "
+                   << pChunk->getIndex();
+        pChunk->takeFromWorker();
+        freeChunk(pChunk);
+        return false;
+    }
+    return true;
+}
+
+void CachingReader::swapChunkIndex(CachingReaderChunkIndex* pChunkIndex) {
+    DEBUG_ASSERT(pChunkIndex != nullptr);
+    // The chunks of the previous track have been freed already, except for
+    // pending reads which are tolerated by freeChunk.
+    CachingReaderChunkIndex* pExpiredChunkIndex = m_pChunkIndex;
+    m_pChunkIndex = pChunkIndex;
+    if (m_expiredChunkIndexFIFO.write(&pExpiredChunkIndex, 1) != 1) {
+        // Can't happen unless the worker is stuck for many track loads.
+        qWarning() << "CachingReader: Leaking expired chunk index";
+    }
+    m_prefetchChunkIndex = 0;
+}
+
+void CachingReader::reportCacheStats() {
+    if (m_chunkHits > 0) {
+        m_chunkHitCounter.increment(m_chunkHits);
+        m_chunkHits = 0;
+    }
+    if (m_chunkMisses > 0) {
+        m_chunkMissCounter.increment(m_chunkMisses);
+        m_chunkMisses = 0;
+    }
+    m_readsSinceStatsReport = 0;
+}
+
 void CachingReader::newTrack(TrackPointer pTrack) {
     m_worker.newTrack(pTrack);
     m_worker.workReady();
@@ -205,6 +322,7 @@ void CachingReader::process() {
             m_maxReadableFrameIndex = status.maxReadableFrameIndex;
             // Free all chunks with sample data from a previous track
             freeAllChunks();
+            swapChunkIndex(status.chunkIndex);
         }
         // Adjust the max. readable frame index
         if (m_readerStatus == TRACK_LOADED) {
@@ -283,10 +401,11 @@ int CachingReader::read(int sample, int numSamples, CSAMPLE* buffer) {
                 const CachingReaderChunkForOwner* const pChunk = lookupChunkAndFreshen(chunkIndex);
                 // If the chunk is not in cache, then we must return an error.
                 if (!pChunk || (pChunk->getState() != CachingReaderChunkForOwner::READY)) {
-                    Counter("CachingReader::read(): Failed to read chunk on cache miss")++;
+                    ++m_chunkMisses;
                     // Exit the loop and fill the remaining buffer with silence
                     break;
                 }
+                ++m_chunkHits;
 
                 // Please note that m_maxReadableFrameIndex might change with
                 // every read operation! On a cache miss audio data will be
@@ -333,6 +452,10 @@ int CachingReader::read(int sample, int numSamples, CSAMPLE* buffer) {
     // Finally fill the remaining buffer with silence.
     DEBUG_ASSERT(numSamples >= samplesRead);
     SampleUtil::clear(buffer, numSamples - samplesRead);
+
+    if (++m_readsSinceStatsReport >= kReadsPerStatsReport) {
+        reportCacheStats();
+    }
     return numSamples;
 }
 
@@ -342,74 +465,114 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
         return;
     }
 
+    // We are the only writer of the generation.
+    const int hintGeneration = m_hintGeneration.fetchAndAddOrdered(1) + 1;
+
     // For every chunk that the hints indicated, check if it is in the cache. If
-    // any are not, then wake.
+    // any are not, then wake. The hints for imminent playback are handled
+    // first so that they win if chunks need to be expired.
     bool shouldWake = false;
 
     for (HintVector::const_iterator it = hintList.constBegin();
          it != hintList.constEnd(); ++it) {
-        // Copy, don't use reference.
-        Hint hint = *it;
-
-        // Handle some special length values
-        if (hint.length == 0) {
-            hint.length = kDefaultHintSamples;
-        } else if (hint.length == -1) {
-            hint.sample -= kDefaultHintSamples;
-            hint.length = kDefaultHintSamples;
-            if (hint.sample < 0) {
-                hint.length += hint.sample;
-                hint.sample = 0;
-            }
+        if (it->priority < HINT_PRIORITY_SPECULATIVE) {
+            shouldWake = hintChunks(*it, hintGeneration) || shouldWake;
         }
-        if (hint.length < 0) {
-            qDebug() << "ERROR: Negative hint length. Ignoring.";
-            continue;
+    }
+    for (HintVector::const_iterator it = hintList.constBegin();
+         it != hintList.constEnd(); ++it) {
+        if (it->priority >= HINT_PRIORITY_SPECULATIVE) {
+            shouldWake = hintChunks(*it, hintGeneration) || shouldWake;
         }
+    }
 
-        const SINT hintFrame = CachingReaderChunk::samples2frames(hint.sample);
-        const SINT hintFrameCount = CachingReaderChunk::samples2frames(hint.length);
+    if (m_bWholeTrackResident && prefetchWholeTrack()) {
+        shouldWake = true;
+    }
 
-        SINT minReadableFrameIndex = hintFrame;
-        SINT maxReadableFrameIndex = hintFrame + hintFrameCount;
-        Mixxx::AudioSource::clampFrameInterval(&minReadableFrameIndex, &maxReadableFrameIndex, m_maxReadableFrameIndex);
-        if (minReadableFrameIndex >= maxReadableFrameIndex) {
-            // skip empty frame interval silently
-            continue;
+    // If there are chunks to be read, wake up.
+    if (shouldWake) {
+        m_worker.workReady();
+    }
+}
+
+bool CachingReader::hintChunks(Hint hint, int hintGeneration) {
+    // Handle some special length values
+    if (hint.length == 0) {
+        hint.length = kDefaultHintSamples;
+    } else if (hint.length == -1) {
+        hint.sample -= kDefaultHintSamples;
+        hint.length = kDefaultHintSamples;
+        if (hint.sample < 0) {
+            hint.length += hint.sample;
+            hint.sample = 0;
         }
+    }
+    if (hint.length < 0) {
+        qDebug() << "ERROR: Negative hint length. Ignoring.";
+        return false;
+    }
+
+    const SINT hintFrame = CachingReaderChunk::samples2frames(hint.sample);
+    const SINT hintFrameCount = CachingReaderChunk::samples2frames(hint.length);
 
-        const int firstCachingReaderChunkIndex = CachingReaderChunk::indexForFrame(minReadableFrameIndex);
-        const int lastCachingReaderChunkIndex = CachingReaderChunk::indexForFrame(maxReadableFrameIndex - 1);
-        for (int chunkIndex = firstCachingReaderChunkIndex; chunkIndex <= lastCachingReaderChunkIndex; ++chunkIndex) {
-            CachingReaderChunkForOwner* pChunk = lookupChunk(chunkIndex);
+    SINT minReadableFrameIndex = hintFrame;
+    SINT maxReadableFrameIndex = hintFrame + hintFrameCount;
+    Mixxx::AudioSource::clampFrameInterval(&minReadableFrameIndex, &maxReadableFrameIndex, m_maxReadableFrameIndex);
+    if (minReadableFrameIndex >= maxReadableFrameIndex) {
+        // skip empty frame interval silently
+        return false;
+    }
+
+    bool shouldWake = false;
+    const int firstCachingReaderChunkIndex = CachingReaderChunk::indexForFrame(minReadableFrameIndex);
+    const int lastCachingReaderChunkIndex = CachingReaderChunk::indexForFrame(maxReadableFrameIndex - 1);
+    for (int chunkIndex = firstCachingReaderChunkIndex; chunkIndex <= lastCachingReaderChunkIndex; ++chunkIndex) {
+        CachingReaderChunkForOwner* pChunk = lookupChunk(chunkIndex);
+        if (pChunk == nullptr) {
+            shouldWake = true;
+            pChunk = allocateChunkExpireLRU(chunkIndex);
             if (pChunk == nullptr) {
-                shouldWake = true;
-                pChunk = allocateChunkExpireLRU(chunkIndex);
-                if (pChunk == nullptr) {
-                    qDebug() << "ERROR: Couldn't allocate spare CachingReaderChunk to make CachingReaderChunkReadRequest.";
-                    continue;
-                }
-                CachingReaderChunkReadRequest request(pChunk);
-                pChunk->giveToWorker();
-                // qDebug() << "Requesting read of chunk" << current << "into" << pChunk;
-                // qDebug() << "Requesting read into " << request.chunk->data;
-                if (m_chunkReadRequestFIFO.write(&request, 1) != 1) {
-                    qWarning() << "ERROR: Could not submit read request for "
-                             << chunkIndex;
-                    pChunk->takeFromWorker();
-                    freeChunk(pChunk);
-                }
-                //qDebug() << "Checking chunk " << current << " shouldWake:" << shouldWake << " chunksToRead" << m_chunksToRead.size();
-            } else if (pChunk->getState() == CachingReaderChunkForOwner::READY) {
+                qDebug() << "ERROR: Couldn't allocate spare CachingReaderChunk to make CachingReaderChunkReadRequest.";
+                continue;
+            }
+            pChunk->setHintGeneration(hintGeneration);
+            requestChunk(pChunk, hint.priority);
+            //qDebug() << "Checking chunk " << current << " shouldWake:" << shouldWake << " chunksToRead" << m_chunksToRead.size();
+        } else {
+            // Keeps a pending speculative read from becoming stale.
+            pChunk->setHintGeneration(hintGeneration);
+            if (pChunk->getState() == CachingReaderChunkForOwner::READY) {
                 // This will cause the chunk to be 'freshened' in the cache. The
                 // chunk will be moved to the end of the LRU list.
                 freshenChunk(pChunk);
             }
         }
     }
+    return shouldWake;
+}
 
-    // If there are chunks to be read, wake up.
-    if (shouldWake) {
-        m_worker.workReady();
+bool CachingReader::prefetchWholeTrack() {
+    if (m_readerStatus != TRACK_LOADED ||
+            m_maxReadableFrameIndex <= Mixxx::AudioSource::getMinFrameIndex()) {
+        return false;
+    }
+    const SINT chunkCount = math_min(
+            static_cast<SINT>(m_pChunkIndex->size()),
+            CachingReaderChunk::indexForFrame(m_maxReadableFrameIndex - 1) + 1);
+    bool requested = false;
+    // Never expire cached chunks for prefetching, only fill free ones.
+    while (m_prefetchChunkIndex < chunkCount && m_freeChunkCount > 0 &&
+            m_speculativeChunkReadRequestFIFO.readAvailable() < kMaxPendingPrefetchRequests) {
+        const SINT chunkIndex = m_prefetchChunkIndex++;
+        if (lookupChunk(chunkIndex) != nullptr) {
+            continue;
+        }
+        CachingReaderChunkForOwner* pChunk = allocateChunk(chunkIndex);
+        if (pChunk == nullptr) {
+            break;
+        }
+        requested = requestChunk(pChunk, HINT_PRIORITY_PREFETCH) || requested;
     }
+    return requested;
 }
@@ -7,17 +7,30 @@
 #include <QtDebug>
 #include <QList>
 #include <QVector>
-#include <QLinkedList>
-#include <QHash>
 #include <QVarLengthArray>
 
 #include "util/types.h"
 #include "configobject.h"
 #include "trackinfoobject.h"
 #include "engine/engineworker.h"
+#include "util/counter.h"
 #include "util/fifo.h"
 #include "cachingreaderworker.h"
 
+// Priorities for hints. Lower values are more urgent.
+enum HintPriority {
+    // Samples that will be read imminently, e.g. around the play position.
+    HINT_PRIORITY_IMMINENT = 1,
+    // Samples that will be read soon, e.g. the start of an active loop.
+    HINT_PRIORITY_LOOP = 2,
+    // Samples that have the potential to be read, e.g. a cue point. Read
+    // requests for these are dropped if they are not hinted anymore by the
+    // time the reader gets to them.
+    HINT_PRIORITY_SPECULATIVE = 10,
+    // Used internally for decoding the whole track in the background.
+    HINT_PRIORITY_PREFETCH = 100
+};
+
 // A Hint is an indication to the CachingReader that a certain section of a
 // SoundSource will be used 'soon' and so it should be brought into memory by
 // the reader work thread.
@@ -27,11 +40,8 @@ typedef struct Hint {
     // If a range of samples should be present, use length to indicate that the
     // range (sample, sample+length) should be present in memory.
     int length;
-    // Currently unused -- but in the future could be used to prioritize certain
-    // hints over others. A priority of 1 is the highest priority and should be
-    // used for samples that will be read imminently. Hints for samples that
-    // have the potential to be read (i.e. a cue point) should be issued with
-    // priority >10.
+    // One of HintPriority. The reader reads chunks for hints with a priority
+    // below HINT_PRIORITY_SPECULATIVE before any others.
     int priority;
 } Hint;
 
@@ -58,7 +68,9 @@ typedef QVarLengthArray<Hint, 512> HintVector;
 // indicating which chunks should be kept fresh in the cache (see
 // hintAndMaybeWake). For example, the chunks around the playhead, the hotcue
 // positions, and loop points are all portions of the track that the user is
-// likely to dynamically jump to so we should keep them ready.
+// likely to dynamically jump to so we should keep them ready. Chunks that are
+// needed for imminent playback are read before speculative ones (see
+// HintPriority).
 //
 // The least recently used policy is implemented by keeping a linked list of the
 // least recently used chunks. When a chunk is "freshened" (i.e. accessed via
@@ -66,6 +78,13 @@ typedef QVarLengthArray<Hint, 512> HintVector;
 // least-recently-used list. When a chunk needs to be allocated and there are no
 // free chunks then the least recently used chunk is free'd (see
 // allocateChunkExpireLRU).
+//
+// The size of the cache is configurable for the decks with
+// [Master],caching_reader_memory_mb, samplers and preview decks always use
+// kDefaultMemoryMB. With [Master],caching_reader_whole_track
+// enabled the reader additionally decodes the whole track into the cache in
+// the background after it is loaded, as far as the cache size allows, so that
+// seeks to any position are served from memory.
 class CachingReader : public QObject {
     Q_OBJECT
 
@@ -96,7 +115,16 @@ class CachingReader : public QObject {
         m_worker.setScheduler(pScheduler);
     }
 
-    const static int maximumCachingReaderChunksInMemory;
+    // The cache size in MiB per deck if not configured otherwise.
+    static const int kDefaultMemoryMB;
+    // The default cache size in MiB per deck in whole track mode. Holds about
+    // 12 minutes of stereo audio at 44.1 kHz.
+    static const int kDefaultWholeTrackMemoryMB;
+
+    // Returns the number of chunks in the cache.
+    int getChunkCount() const {
+        return m_chunks.size();
+    }
 
   signals:
     // Emitted once a new track is loaded and ready to be read from.
@@ -110,7 +138,13 @@ class CachingReader : public QObject {
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
     FIFO<CachingReaderChunkReadRequest> m_chunkReadRequestFIFO;
+    FIFO<CachingReaderChunkReadRequest> m_speculativeChunkReadRequestFIFO;
     FIFO<ReaderStatusUpdate> m_readerStatusFIFO;
+    FIFO<CachingReaderChunkIndex*> m_expiredChunkIndexFIFO;
+
+    // Incremented for every call of hintAndMaybeWake. Every hinted chunk is
+    // stamped with it so that the worker can skip stale speculative reads.
+    QAtomicInt m_hintGeneration;
 
     // Looks for the provided chunk number in the index of in-memory chunks and
     // returns it if it is present. If not, returns nullptr. If it is present then
@@ -136,18 +170,53 @@ class CachingReader : public QObject {
     // Gets a chunk from the free list, frees the LRU CachingReaderChunk if none available.
     CachingReaderChunkForOwner* allocateChunkExpireLRU(SINT chunkIndex);
 
+    // Sends a read request with the given priority for an allocated chunk to
+    // the worker. Frees the chunk again and returns false if the request
+    // could not be sent.
+    bool requestChunk(CachingReaderChunkForOwner* pChunk, int priority);
+
+    // Makes sure that the chunks covered by a single hint are cached or
+    // requested. Returns true if the worker needs to be woken up.
+    bool hintChunks(Hint hint, int hintGeneration);
+
+    // Requests some of the chunks of the track that are not cached yet while
+    // the worker is idle and free chunks are available. Returns true if any
+    // were requested. Only used in whole track mode.
+    bool prefetchWholeTrack();
+
+    // Replaces the chunk index with the one for a newly loaded track and
+    // returns the previous one to the worker for deletion.
+    void swapChunkIndex(CachingReaderChunkIndex* pChunkIndex);
+
+    // Reports the accumulated cache hits and misses to StatsManager.
+    void reportCacheStats();
+
     ReaderStatus m_readerStatus;
 
     // Keeps track of all CachingReaderChunks we've allocated.
     QVector<CachingReaderChunkForOwner*> m_chunks;
 
-    // List of free chunks. Linked list so that we have constant time insertions
-    // and deletions. Iteration is not necessary.
-    QLinkedList<CachingReaderChunkForOwner*> m_freeChunks;
-
-    // Keeps track of what CachingReaderChunks we've allocated and indexes them based on what
-    // chunk number they are allocated to.
-    QHash<int, CachingReaderChunkForOwner*> m_allocatedCachingReaderChunks;
+    // Stack of free chunks with room for all chunks, so that freeing and
+    // allocating chunks never allocates memory. Only the first
+    // m_freeChunkCount entries are valid.
+    QVector<CachingReaderChunkForOwner*> m_freeChunks;
+    int m_freeChunkCount;
+
+    // Indexes the allocated chunks by the chunk number they are allocated to.
+    // Owned by the reader; replaced for every loaded track.
+    CachingReaderChunkIndex* m_pChunkIndex;
+
+    // Whether to decode the whole track into the cache after loading.
+    bool m_bWholeTrackResident;
+    // The next chunk number to consider in prefetchWholeTrack.
+    SINT m_prefetchChunkIndex;
+
+    // Chunk lookups by read() since the last stats report.
+    int m_chunkHits;
+    int m_chunkMisses;
+    int m_readsSinceStatsReport;
+    Counter m_chunkHitCounter;
+    Counter m_chunkMissCounter;
 
     // The linked list of recently-used chunks.
     CachingReaderChunkForOwner* m_mruCachingReaderChunk;
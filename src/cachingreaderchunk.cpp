@@ -3,6 +3,7 @@
 #include "cachingreaderchunk.h"
 
 #include "sampleutil.h"
+#include "util/compatibility.h"
 #include "util/math.h"
 
 
@@ -25,7 +26,8 @@ CachingReaderChunk::CachingReaderChunk(
         CSAMPLE* sampleBuffer)
         : m_index(kInvalidIndex),
           m_sampleBuffer(sampleBuffer),
-          m_frameCount(0) {
+          m_frameCount(0),
+          m_hintGeneration(0) {
 }
 
 CachingReaderChunk::~CachingReaderChunk() {
@@ -36,6 +38,10 @@ void CachingReaderChunk::init(SINT index) {
     m_frameCount = 0;
 }
 
+int CachingReaderChunk::getHintGeneration() const {
+    return load_atomic(m_hintGeneration);
+}
+
 bool CachingReaderChunk::isReadable(
         const Mixxx::AudioSourcePointer& pAudioSource,
         SINT maxReadableFrameIndex) const {
@@ -1,6 +1,9 @@
 #ifndef CACHINGREADERCHUNK_H
 #define CACHINGREADERCHUNK_H
 
+#include <QAtomicInt>
+#include <QVector>
+
 #include "sources/audiosource.h"
 
 // A Chunk is a memory-resident section of audio that has been cached.
@@ -80,6 +83,14 @@ public:
             SINT sampleOffset,
             SINT sampleCount) const;
 
+    // The hint generation in which the chunk has last been hinted.
+    // Written by the cache and read by the worker to detect stale
+    // speculative read requests, even while the worker owns the chunk.
+    int getHintGeneration() const;
+    void setHintGeneration(int hintGeneration) {
+        m_hintGeneration.fetchAndStoreRelease(hintGeneration);
+    }
+
 protected:
     explicit CachingReaderChunk(CSAMPLE* sampleBuffer);
     virtual ~CachingReaderChunk();
@@ -93,6 +104,8 @@ private:
     // set the frame count.
     CSAMPLE* const m_sampleBuffer;
     volatile SINT m_frameCount;
+
+    QAtomicInt m_hintGeneration;
 };
 
 // This derived class is only accessible for the cache as the owner,
@@ -147,5 +160,9 @@ private:
     CachingReaderChunkForOwner* m_pNext; // next item in double-linked list
 };
 
+// Flat lookup table from chunk index to the chunk that currently caches it
+// (or nullptr). One slot per chunk of the loaded track. It is allocated by the
+// worker thread when a track is loaded and handed over to the cache.
+typedef QVector<CachingReaderChunkForOwner*> CachingReaderChunkIndex;
 
 #endif // CACHINGREADERCHUNK_H
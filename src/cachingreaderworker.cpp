@@ -13,14 +13,23 @@
 
 CachingReaderWorker::CachingReaderWorker(
         QString group,
+        ConfigObject<ConfigValue>* pConfig,
         FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
-        FIFO<ReaderStatusUpdate>* pReaderStatusFIFO)
+        FIFO<CachingReaderChunkReadRequest>* pSpeculativeChunkReadRequestFIFO,
+        FIFO<ReaderStatusUpdate>* pReaderStatusFIFO,
+        FIFO<CachingReaderChunkIndex*>* pExpiredChunkIndexFIFO,
+        const QAtomicInt* pHintGeneration)
         : m_group(group),
           m_tag(QString("CachingReaderWorker %1").arg(m_group)),
           m_pChunkReadRequestFIFO(pChunkReadRequestFIFO),
+          m_pSpeculativeChunkReadRequestFIFO(pSpeculativeChunkReadRequestFIFO),
           m_pReaderStatusFIFO(pReaderStatusFIFO),
+          m_pExpiredChunkIndexFIFO(pExpiredChunkIndexFIFO),
+          m_pHintGeneration(pHintGeneration),
+          m_pcmCache(pConfig),
           m_maxReadableFrameIndex(Mixxx::AudioSource::getMinFrameIndex()),
-          m_stop(0) {
+          m_stop(0),
+          m_staleRequestCounter(QString("CachingReaderWorker %1 stale requests skipped").arg(group)) {
 }
 
 CachingReaderWorker::~CachingReaderWorker() {
@@ -31,6 +40,13 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
     CachingReaderChunk* pChunk = request.chunk;
     DEBUG_ASSERT(pChunk);
 
+    // Don't spend disk and decoding time on a chunk that nobody is going
+    // to need anymore.
+    if (isStale(request)) {
+        m_staleRequestCounter.increment();
+        return ReaderStatusUpdate(CHUNK_READ_INVALID, pChunk, m_maxReadableFrameIndex);
+    }
+
     // Before trying to read any data we need to check if the audio source
     // is available and if any audio data that is needed by the chunk is
     // actually available.
@@ -76,6 +92,7 @@ void CachingReaderWorker::run() {
 
     Event::start(m_tag);
     while (!load_atomic(m_stop)) {
+        deleteExpiredChunkIndices();
         if (m_newTrack) {
             TrackPointer pLoadTrack;
             { // locking scope
@@ -84,7 +101,7 @@ void CachingReaderWorker::run() {
                 m_newTrack = TrackPointer();
             } // implicitly unlocks the mutex
             loadTrack(pLoadTrack);
-        } else if (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
+        } else if (readNextRequest(&request)) {
             // Read the requested chunk and send the result
             const ReaderStatusUpdate update(processReadRequest(request));
             m_pReaderStatusFIFO->writeBlocking(&update, 1);
@@ -96,6 +113,33 @@ void CachingReaderWorker::run() {
     }
 }
 
+bool CachingReaderWorker::readNextRequest(CachingReaderChunkReadRequest* pRequest) {
+    // Check the imminent requests again before every speculative read so
+    // that a seek is never queued behind cue or loop prefetching.
+    return m_pChunkReadRequestFIFO->read(pRequest, 1) == 1 ||
+            m_pSpeculativeChunkReadRequestFIFO->read(pRequest, 1) == 1;
+}
+
+bool CachingReaderWorker::isStale(const CachingReaderChunkReadRequest& request) const {
+    if (!request.speculative) {
+        return false;
+    }
+    // The cache stamps every hinted chunk with the current generation, so a
+    // chunk that is still wanted is at most one generation behind. Unsigned
+    // arithmetic keeps this correct when the generation wraps around.
+    const unsigned int age =
+            static_cast<unsigned int>(load_atomic(*m_pHintGeneration)) -
+            static_cast<unsigned int>(request.chunk->getHintGeneration());
+    return age > 1;
+}
+
+void CachingReaderWorker::deleteExpiredChunkIndices() {
+    CachingReaderChunkIndex* pChunkIndex = nullptr;
+    while (m_pExpiredChunkIndexFIFO->read(&pChunkIndex, 1) == 1) {
+        delete pChunkIndex;
+    }
+}
+
 namespace
 {
     Mixxx::AudioSourcePointer openAudioSourceForReading(const TrackPointer& pTrack, const Mixxx::AudioSourceConfig& audioSrcCfg) {
@@ -132,7 +176,12 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
 
     Mixxx::AudioSourceConfig audioSrcCfg;
     audioSrcCfg.channelCountHint = CachingReaderChunk::kChannels;
-    m_pAudioSource = openAudioSourceForReading(pTrack, audioSrcCfg);
+    // Prefer the decoded samples of a previous analysis. Seeking in them is
+    // exact and doesn't need any decoding.
+    m_pAudioSource = m_pcmCache.openAudioSource(pTrack);
+    if (m_pAudioSource.isNull()) {
+        m_pAudioSource = openAudioSourceForReading(pTrack, audioSrcCfg);
+    }
     if (m_pAudioSource.isNull()) {
         m_maxReadableFrameIndex = Mixxx::AudioSource::getMinFrameIndex();
         // Must unlock before emitting to avoid deadlock
@@ -149,13 +198,21 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
     // be decreased to avoid repeated reading of corrupt audio data.
     m_maxReadableFrameIndex = m_pAudioSource->getMaxFrameIndex();
 
+    // Allocate the chunk lookup table for the new track here so that the
+    // engine doesn't have to.
+    const SINT chunkCount =
+            (m_maxReadableFrameIndex > Mixxx::AudioSource::getMinFrameIndex()) ?
+            CachingReaderChunk::indexForFrame(m_maxReadableFrameIndex - 1) + 1 : 0;
+
     status.maxReadableFrameIndex = m_maxReadableFrameIndex;
     status.status = TRACK_LOADED;
+    status.chunkIndex = new CachingReaderChunkIndex(chunkCount, nullptr);
     m_pReaderStatusFIFO->writeBlocking(&status, 1);
+    status.chunkIndex = nullptr;
 
     // Clear the chunks to read list.
     CachingReaderChunkReadRequest request;
-    while (m_pChunkReadRequestFIFO->read(&request, 1) == 1) {
+    while (readNextRequest(&request)) {
         qDebug() << "Skipping read request for " << request.chunk->getIndex();
         status.status = CHUNK_READ_INVALID;
         status.chunk = request.chunk;
@@ -8,18 +8,27 @@
 #include <QString>
 
 #include "cachingreaderchunk.h"
+#include "configobject.h"
+#include "pcmcache.h"
 #include "trackinfoobject.h"
 #include "engine/engineworker.h"
 #include "sources/audiosource.h"
+#include "util/counter.h"
 #include "util/fifo.h"
 
 
 typedef struct CachingReaderChunkReadRequest {
     CachingReaderChunk* chunk;
+    // Speculative requests are skipped by the worker if the chunk has not
+    // been hinted again in the meantime (see CachingReaderChunk::
+    // getHintGeneration).
+    bool speculative;
 
     explicit CachingReaderChunkReadRequest(
-            CachingReaderChunk* chunkArg = nullptr)
-        : chunk(chunkArg) {
+            CachingReaderChunk* chunkArg = nullptr,
+            bool speculativeArg = false)
+        : chunk(chunkArg),
+          speculative(speculativeArg) {
     }
 } CachingReaderChunkReadRequest;
 
@@ -36,10 +45,14 @@ typedef struct ReaderStatusUpdate {
     ReaderStatus status;
     CachingReaderChunk* chunk;
     SINT maxReadableFrameIndex;
+    // Only set for TRACK_LOADED. The receiver takes ownership and has to send
+    // its previous chunk index back to the worker for deletion.
+    CachingReaderChunkIndex* chunkIndex;
     ReaderStatusUpdate()
         : status(INVALID)
         , chunk(nullptr)
-        , maxReadableFrameIndex(Mixxx::AudioSource::getMinFrameIndex()) {
+        , maxReadableFrameIndex(Mixxx::AudioSource::getMinFrameIndex())
+        , chunkIndex(nullptr) {
     }
     ReaderStatusUpdate(
             ReaderStatus statusArg,
@@ -47,7 +60,8 @@ typedef struct ReaderStatusUpdate {
             SINT maxReadableFrameIndexArg)
         : status(statusArg)
         , chunk(chunkArg)
-        , maxReadableFrameIndex(maxReadableFrameIndexArg) {
+        , maxReadableFrameIndex(maxReadableFrameIndexArg)
+        , chunkIndex(nullptr) {
     }
 } ReaderStatusUpdate;
 
@@ -57,8 +71,12 @@ class CachingReaderWorker : public EngineWorker {
   public:
     // Construct a CachingReader with the given group.
     CachingReaderWorker(QString group,
+            ConfigObject<ConfigValue>* pConfig,
             FIFO<CachingReaderChunkReadRequest>* pChunkReadRequestFIFO,
-            FIFO<ReaderStatusUpdate>* pReaderStatusFIFO);
+            FIFO<CachingReaderChunkReadRequest>* pSpeculativeChunkReadRequestFIFO,
+            FIFO<ReaderStatusUpdate>* pReaderStatusFIFO,
+            FIFO<CachingReaderChunkIndex*>* pExpiredChunkIndexFIFO,
+            const QAtomicInt* pHintGeneration);
     virtual ~CachingReaderWorker();
 
     // Request to load a new track. wake() must be called afterwards.
@@ -81,9 +99,29 @@ class CachingReaderWorker : public EngineWorker {
     QString m_tag;
 
     // Thread-safe FIFOs for communication between the engine callback and
-    // reader thread.
+    // reader thread. Requests for imminent playback are always served before
+    // speculative ones.
     FIFO<CachingReaderChunkReadRequest>* m_pChunkReadRequestFIFO;
+    FIFO<CachingReaderChunkReadRequest>* m_pSpeculativeChunkReadRequestFIFO;
     FIFO<ReaderStatusUpdate>* m_pReaderStatusFIFO;
+    // Chunk indices that the engine no longer uses. Deleted by the worker so
+    // that the engine callback never frees memory.
+    FIFO<CachingReaderChunkIndex*>* m_pExpiredChunkIndexFIFO;
+
+    // Deletes all chunk indices returned by the engine.
+    void deleteExpiredChunkIndices();
+
+    // The current hint generation of the cache. Incremented by the engine
+    // for every list of hints it receives.
+    const QAtomicInt* m_pHintGeneration;
+
+    // Reads the next request, imminent requests first. Returns false if
+    // there is none.
+    bool readNextRequest(CachingReaderChunkReadRequest* pRequest);
+
+    // Returns true if the chunk of a speculative request has not been hinted
+    // by the last lists of hints and is not worth reading anymore.
+    bool isStale(const CachingReaderChunkReadRequest& request) const;
 
     // Queue of Tracks to load, and the corresponding lock. Must acquire the
     // lock to touch.
@@ -96,6 +134,9 @@ class CachingReaderWorker : public EngineWorker {
     ReaderStatusUpdate processReadRequest(
             const CachingReaderChunkReadRequest& request);
 
+    // Tracks are read from here instead of being decoded if available.
+    const PcmCache m_pcmCache;
+
     // The current audio source of the track loaded
     Mixxx::AudioSourcePointer m_pAudioSource;
 
@@ -107,6 +148,8 @@ class CachingReaderWorker : public EngineWorker {
     SINT m_maxReadableFrameIndex;
 
     QAtomicInt m_stop;
+
+    Counter m_staleRequestCounter;
 };
 
 
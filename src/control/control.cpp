@@ -2,6 +2,8 @@
 #include <QMutexLocker>
 
 #include "control/control.h"
+#include "control/controlnotifier.h"
+#include "util/compatibility.h"
 
 #include "util/stat.h"
 #include "util/timer.h"
@@ -37,6 +39,9 @@ ControlDoublePrivate::ControlDoublePrivate(ConfigKey key,
           m_trackFlags(Stat::COUNT | Stat::SUM | Stat::AVERAGE |
                        Stat::SAMPLE_VARIANCE | Stat::MIN | Stat::MAX),
           m_confirmRequired(false),
+          m_hasAsyncListeners(0),
+          m_asyncNotifyPending(0),
+          m_pAsyncSender(NULL),
           m_pCreatorCO(pCreatorCO) {
     initialize();
 }
@@ -64,6 +69,10 @@ void ControlDoublePrivate::initialize() {
 }
 
 ControlDoublePrivate::~ControlDoublePrivate() {
+    if (load_atomic(m_asyncNotifyPending)) {
+        ControlNotifier::cancel(this);
+    }
+
     s_qCOHashMutex.lock();
     //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
     s_qCOHash.remove(m_key);
@@ -196,12 +205,34 @@ void ControlDoublePrivate::setInner(double value, QObject* pSender) {
     m_value.setValue(value);
     emit(valueChanged(value, pSender));
 
+    if (load_atomic(m_hasAsyncListeners)) {
+        if (ControlNotifier::isDeferring()) {
+            // Queue a notification unless one is pending already, in which
+            // case it picks up the new value when it is dispatched.
+            m_pAsyncSender.fetchAndStoreOrdered(pSender);
+            if (m_asyncNotifyPending.testAndSetOrdered(0, 1) &&
+                    !ControlNotifier::enqueue(this)) {
+                m_asyncNotifyPending.fetchAndStoreOrdered(0);
+                emit(valueChangedAsync(value, pSender));
+            }
+        } else {
+            emit(valueChangedAsync(value, pSender));
+        }
+    }
+
     if (m_bTrack) {
         Stat::track(m_trackKey, static_cast<Stat::StatType>(m_trackType),
                     static_cast<Stat::ComputeFlags>(m_trackFlags), value);
     }
 }
 
+void ControlDoublePrivate::emitValueChangedAsync() {
+    // Clear the flag before reading the value so that a concurrent set either
+    // is included in this notification or queues a new one.
+    m_asyncNotifyPending.fetchAndStoreOrdered(0);
+    emit(valueChangedAsync(get(), load_atomic_pointer(m_pAsyncSender)));
+}
+
 void ControlDoublePrivate::setBehavior(ControlNumericBehavior* pBehavior) {
     // This marks the old mpBehavior for deletion. It is deleted once it is not
     // used in any other function
@@ -262,3 +293,13 @@ bool ControlDoublePrivate::connectValueChangeRequest(const QObject* receiver,
                 receiver, method, type);
     return m_confirmRequired;
 }
+
+bool ControlDoublePrivate::connectValueChangedAsync(const QObject* receiver,
+        const char* method, Qt::ConnectionType type) {
+    bool ret = connect(this, SIGNAL(valueChangedAsync(double, QObject*)),
+                       receiver, method, type);
+    if (ret) {
+        m_hasAsyncListeners.fetchAndStoreRelease(1);
+    }
+    return ret;
+}
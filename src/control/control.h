@@ -5,6 +5,7 @@
 #include <QMutex>
 #include <QString>
 #include <QObject>
+#include <QAtomicInt>
 #include <QAtomicPointer>
 
 #include "control/controlbehavior.h"
@@ -118,10 +119,20 @@ class ControlDoublePrivate : public QObject {
     bool connectValueChangeRequest(const QObject* receiver,
                                    const char* method, Qt::ConnectionType type);
 
+    // Connects a slot to valueChangedAsync. Use this instead of connecting to
+    // valueChanged for every listener that does not need a direct connection.
+    bool connectValueChangedAsync(const QObject* receiver,
+                                  const char* method, Qt::ConnectionType type);
+
   signals:
     // Emitted when the ControlDoublePrivate value changes. pSender is a
     // pointer to the setter of the value (potentially NULL).
     void valueChanged(double value, QObject* pSender);
+    // Emitted right after valueChanged. Only if the value is set from a
+    // real-time thread while GuiTick dispatches, the signal is deferred to the
+    // next ControlNotifier::dispatch() and repeated changes in between are
+    // coalesced into one. See ControlNotifier.
+    void valueChangedAsync(double value, QObject* pSender);
     void valueChangeRequest(double value);
 
   private:
@@ -129,6 +140,8 @@ class ControlDoublePrivate : public QObject {
                          bool bIgnoreNops, bool bTrack, bool bPersist);
     void initialize();
     void setInner(double value, QObject* pSender);
+    // Emits the deferred valueChangedAsync signal. Called by ControlNotifier.
+    void emitValueChangedAsync();
 
     ConfigKey m_key;
 
@@ -158,6 +171,13 @@ class ControlDoublePrivate : public QObject {
     // The default control value.
     ControlValueAtomic<double> m_defaultValue;
 
+    // Non-zero once anything was connected to valueChangedAsync.
+    QAtomicInt m_hasAsyncListeners;
+    // Non-zero while a deferred valueChangedAsync is queued in ControlNotifier.
+    QAtomicInt m_asyncNotifyPending;
+    // The setter of the most recent deferred value change.
+    QAtomicPointer<QObject> m_pAsyncSender;
+
     QSharedPointer<ControlNumericBehavior> m_pBehavior;
 
     ControlObject* m_pCreatorCO;
@@ -178,6 +198,8 @@ class ControlDoublePrivate : public QObject {
 
     // Mutex guarding access to s_qCOHash and s_qCOAliasHash.
     static QMutex s_qCOHashMutex;
+
+    friend class ControlNotifier;
 };
 
 
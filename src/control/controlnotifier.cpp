@@ -0,0 +1,143 @@
+#include <QMutexLocker>
+#include <QtDebug>
+
+#include "control/controlnotifier.h"
+#include "control/control.h"
+#include "util/compatibility.h"
+#include "util/counter.h"
+
+// Every control is queued at most once across all pipes so this only needs to
+// be larger than the number of controls that the engine writes between two GUI
+// ticks. If a pipe is full the control is notified synchronously.
+const int kControlNotifierPipeSize = 8192;
+
+// static
+QMutex ControlNotifier::s_mutex(QMutex::Recursive);
+// static
+QList<ControlNotifierPipe*> ControlNotifier::s_pipes;
+// static
+QVector<ControlDoublePrivate*> ControlNotifier::s_pending;
+// static
+QThreadStorage<ControlNotifierPipe*> ControlNotifier::s_threadPipes;
+// static
+QAtomicInt ControlNotifier::s_dispatchers;
+
+namespace {
+
+#ifdef _MSC_VER
+__declspec(thread) ControlNotifierPipe* s_pThreadPipe = NULL;
+#else
+__thread ControlNotifierPipe* s_pThreadPipe = NULL;
+#endif
+
+} // anonymous namespace
+
+ControlNotifierPipe::ControlNotifierPipe()
+        : FIFO<ControlDoublePrivate*>(kControlNotifierPipeSize) {
+    QMutexLocker locker(&ControlNotifier::s_mutex);
+    ControlNotifier::s_pipes.append(this);
+}
+
+ControlNotifierPipe::~ControlNotifierPipe() {
+    ControlNotifier::onPipeDestroyed(this);
+}
+
+// static
+void ControlNotifier::registerRealtimeThread() {
+    if (!isRealtimeThread()) {
+        s_pThreadPipe = new ControlNotifierPipe();
+        s_threadPipes.setLocalData(s_pThreadPipe);
+    }
+}
+
+// static
+void ControlNotifier::unregisterRealtimeThread() {
+    if (isRealtimeThread()) {
+        s_pThreadPipe = NULL;
+        // Deletes the pipe of this thread.
+        s_threadPipes.setLocalData(NULL);
+    }
+}
+
+// static
+bool ControlNotifier::isRealtimeThread() {
+    return s_pThreadPipe != NULL;
+}
+
+// static
+void ControlNotifier::registerDispatcher() {
+    s_dispatchers.ref();
+}
+
+// static
+void ControlNotifier::unregisterDispatcher() {
+    s_dispatchers.deref();
+    // Nothing is queued after this if it was the last dispatcher, so deliver
+    // what is left.
+    dispatch();
+}
+
+// static
+bool ControlNotifier::isDeferring() {
+    return s_pThreadPipe != NULL && load_atomic(s_dispatchers) > 0;
+}
+
+// static
+bool ControlNotifier::enqueue(ControlDoublePrivate* pControl) {
+    ControlNotifierPipe* pPipe = s_pThreadPipe;
+    if (pPipe == NULL) {
+        return false;
+    }
+    if (pPipe->write(&pControl, 1) != 1) {
+        Counter overflow("ControlNotifier pipe overflow");
+        overflow.increment();
+        return false;
+    }
+    return true;
+}
+
+// static
+void ControlNotifier::drainPipes() {
+    ControlDoublePrivate* pControl = NULL;
+    foreach (ControlNotifierPipe* pPipe, s_pipes) {
+        while (pPipe->read(&pControl, 1) == 1) {
+            s_pending.append(pControl);
+        }
+    }
+}
+
+// static
+void ControlNotifier::onPipeDestroyed(ControlNotifierPipe* pPipe) {
+    QMutexLocker locker(&s_mutex);
+    // Keep the remaining notifications of the pipe around for the next
+    // dispatch, otherwise the controls would stay marked as pending forever.
+    drainPipes();
+    s_pipes.removeAll(pPipe);
+}
+
+// static
+void ControlNotifier::dispatch() {
+    QMutexLocker locker(&s_mutex);
+    drainPipes();
+    // A slot may destroy a control and call cancel() (which re-locks the
+    // recursive mutex) while we are iterating, so index instead of iterating.
+    for (int i = 0; i < s_pending.size(); ++i) {
+        ControlDoublePrivate* pControl = s_pending[i];
+        if (pControl != NULL) {
+            s_pending[i] = NULL;
+            pControl->emitValueChangedAsync();
+        }
+    }
+    s_pending.clear();
+}
+
+// static
+void ControlNotifier::cancel(ControlDoublePrivate* pControl) {
+    QMutexLocker locker(&s_mutex);
+    drainPipes();
+    for (int i = 0; i < s_pending.size(); ++i) {
+        if (s_pending[i] == pControl) {
+            s_pending[i] = NULL;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef CONTROLNOTIFIER_H
+#define CONTROLNOTIFIER_H
+
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QThreadStorage>
+#include <QVector>
+
+#include "util/fifo.h"
+
+class ControlDoublePrivate;
+class ControlNotifierPipe;
+
+// ControlNotifier keeps real-time threads (the engine callback and its helper
+// threads) out of Qt's event system when they set controls.
+//
+// Normally ControlDoublePrivate emits valueChangedAsync synchronously, which
+// posts a queued event (i.e. allocates and locks) for every listener living in
+// another thread. On a thread registered with registerRealtimeThread, the
+// control is instead written to a single-producer/single-consumer pipe owned
+// by that thread. dispatch() later drains all pipes and emits
+// valueChangedAsync with the latest value. A control is in at most one pipe at
+// a time, so any number of writes between two dispatches are coalesced into a
+// single notification.
+//
+// Notifications are only deferred while a dispatcher is registered, i.e.
+// something calls dispatch() regularly (GuiTick). Without one, e.g. when
+// running headless or in tests, real-time threads emit valueChangedAsync
+// synchronously like every other thread.
+//
+// Listeners connected to valueChanged (i.e. direct connections) are notified
+// synchronously as before.
+class ControlNotifier {
+  public:
+    // Marks the calling thread as real-time. Allocates the pipe of the thread,
+    // so call this before the thread starts its real-time work.
+    static void registerRealtimeThread();
+    // Reverts registerRealtimeThread. Pending notifications of the thread are
+    // still delivered by the next dispatch.
+    static void unregisterRealtimeThread();
+
+    static bool isRealtimeThread();
+
+    // Marks that the calling object calls dispatch() from now on. Calls may
+    // nest.
+    static void registerDispatcher();
+    // Reverts registerDispatcher and delivers the pending notifications.
+    static void unregisterDispatcher();
+
+    // Returns whether notifications of controls set by the calling thread are
+    // deferred, i.e. it is a real-time thread and a dispatcher is registered.
+    static bool isDeferring();
+
+    // Queues a notification for pControl on the pipe of the calling real-time
+    // thread. Lock-free and allocation-free. Returns false if the notification
+    // could not be queued and the caller has to emit it itself.
+    static bool enqueue(ControlDoublePrivate* pControl);
+
+    // Emits valueChangedAsync for every control that was set from a real-time
+    // thread since the last call. Called by the dispatcher, i.e. once per GUI
+    // tick.
+    static void dispatch();
+
+    // Drops a pending notification for pControl. Called when pControl is
+    // destroyed.
+    static void cancel(ControlDoublePrivate* pControl);
+
+  private:
+    // Moves all queued controls into s_pending. Must hold s_mutex.
+    static void drainPipes();
+    static void onPipeDestroyed(ControlNotifierPipe* pPipe);
+
+    // Guards s_pipes and s_pending. Never locked by a real-time thread.
+    static QMutex s_mutex;
+    static QList<ControlNotifierPipe*> s_pipes;
+    static QVector<ControlDoublePrivate*> s_pending;
+    // Owns the pipes and deletes them when their thread exits. The pipe of the
+    // calling thread is also cached in a plain thread local, since
+    // QThreadStorage::localData is too slow for every set().
+    static QThreadStorage<ControlNotifierPipe*> s_threadPipes;
+    static QAtomicInt s_dispatchers;
+
+    friend class ControlNotifierPipe;
+};
+
+class ControlNotifierPipe : public FIFO<ControlDoublePrivate*> {
+  public:
+    ControlNotifierPipe();
+    virtual ~ControlNotifierPipe();
+};
+
+#endif /* CONTROLNOTIFIER_H */
@@ -68,7 +68,9 @@ bool ControlObjectSlave::connectValueChanged(const QObject* receiver,
                          static_cast<Qt::ConnectionType>(Qt::DirectConnection |
                                                          Qt::UniqueConnection));
             } else {
-                connect(m_pControl.data(), SIGNAL(valueChanged(double, QObject*)),
+                // Not being notified synchronously allows the control to defer
+                // and coalesce notifications for changes made by the engine.
+                m_pControl->connectValueChangedAsync(
                         this, SLOT(slotValueChangedAuto(double, QObject*)),
                         static_cast<Qt::ConnectionType>(Qt::AutoConnection |
                                                         Qt::UniqueConnection));
@@ -67,6 +67,22 @@ void Effect::removeFromEngine(EngineEffectChain* pChain, int iIndex) {
     m_pEngineEffect = NULL;
 }
 
+void Effect::registerChannel(const ChannelHandleAndGroup& handle_group) {
+    if (!m_pEngineEffect) {
+        return;
+    }
+    EffectChannelState* pState = m_pEngineEffect->createChannelState();
+    if (pState == NULL) {
+        return;
+    }
+    EffectsRequest* request = new EffectsRequest();
+    request->type = EffectsRequest::ADD_EFFECT_CHANNEL_STATE;
+    request->pTargetEffect = m_pEngineEffect;
+    request->channel = handle_group.handle();
+    request->AddEffectChannelState.pState = pState;
+    m_pEffectsManager->writeRequest(request);
+}
+
 void Effect::updateEngineState() {
     if (!m_pEngineEffect) {
         return;
@@ -8,6 +8,7 @@
 #include "effects/effectmanifest.h"
 #include "effects/effectparameter.h"
 #include "effects/effectinstantiator.h"
+#include "engine/channelhandle.h"
 
 class EffectProcessor;
 class EngineEffectChain;
@@ -54,6 +55,9 @@ class Effect : public QObject {
     void addToEngine(EngineEffectChain* pChain, int iIndex);
     void removeFromEngine(EngineEffectChain* pChain, int iIndex);
     void updateEngineState();
+    // Sends the engine effect the processor state for a channel registered
+    // after the effect was added to the engine.
+    void registerChannel(const ChannelHandleAndGroup& handle_group);
 
     QDomElement toXML(QDomDocument* doc) const;
     static EffectPointer fromXML(EffectsManager* pEffectsManager,
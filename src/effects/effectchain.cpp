@@ -28,8 +28,9 @@ EffectChain::~EffectChain() {
     }
 }
 
-void EffectChain::addToEngine(EngineEffectRack* pRack, int iIndex) {
-    m_pEngineEffectChain = new EngineEffectChain(m_id);
+void EffectChain::addToEngine(EngineEffectRack* pRack, int iIndex,
+                              const QString& slotGroup) {
+    m_pEngineEffectChain = new EngineEffectChain(m_id, slotGroup);
     EffectsRequest* pRequest = new EffectsRequest();
     pRequest->type = EffectsRequest::ADD_CHAIN_TO_RACK;
     pRequest->pTargetRack = pRack;
@@ -48,6 +49,14 @@ void EffectChain::addToEngine(EngineEffectRack* pRack, int iIndex) {
     }
 }
 
+void EffectChain::registerChannel(const ChannelHandleAndGroup& handle_group) {
+    foreach (EffectPointer pEffect, m_effects) {
+        if (pEffect) {
+            pEffect->registerChannel(handle_group);
+        }
+    }
+}
+
 void EffectChain::removeFromEngine(EngineEffectRack* pRack, int iIndex) {
     // Order doesn't matter when removing.
     for (int i = 0; i < m_effects.size(); ++i) {
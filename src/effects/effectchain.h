@@ -25,9 +25,14 @@ class EffectChain : public QObject {
                 EffectChainPointer prototype=EffectChainPointer());
     virtual ~EffectChain();
 
-    void addToEngine(EngineEffectRack* pRack, int iIndex);
+    // slotGroup is the group of the EffectChainSlot the chain is loaded into.
+    void addToEngine(EngineEffectRack* pRack, int iIndex,
+                     const QString& slotGroup);
     void removeFromEngine(EngineEffectRack* pRack, int iIndex);
     void updateEngineState();
+    // Creates the state for a newly registered channel in all effects of the
+    // chain that are loaded into the engine.
+    void registerChannel(const ChannelHandleAndGroup& handle_group);
 
     // The ID of an EffectChain is a unique ID given to it to help associate it
     // with the preset from which it was loaded.
@@ -178,7 +178,7 @@ void EffectChainSlot::loadEffectChain(EffectChainPointer pEffectChain) {
     if (pEffectChain) {
         m_pEffectChain = pEffectChain;
         m_pEffectChain->addToEngine(m_pEffectRack->getEngineEffectRack(),
-                                    m_iChainSlotNumber);
+                                    m_iChainSlotNumber, m_group);
         m_pEffectChain->updateEngineState();
 
         connect(m_pEffectChain.data(), SIGNAL(effectsChanged()),
@@ -280,6 +280,10 @@ void EffectChainSlot::registerChannel(const ChannelHandleAndGroup& handle_group)
     m_channelStatusMapper.setMapping(pEnableControl, handle_group.name());
     connect(pEnableControl, SIGNAL(valueChanged(double)),
             &m_channelStatusMapper, SLOT(map()));
+
+    if (m_pEffectChain) {
+        m_pEffectChain->registerChannel(handle_group);
+    }
 }
 
 void EffectChainSlot::slotEffectLoaded(EffectPointer pEffect, unsigned int slotNumber) {
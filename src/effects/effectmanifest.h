@@ -25,7 +25,8 @@ class EffectManifest {
         : m_isMixingEQ(false),
           m_isMasterEQ(false),
           m_isForFilterKnob(false),
-          m_effectRampsFromDry(false) {
+          m_effectRampsFromDry(false),
+          m_oversampling(1) {
     }
     virtual ~EffectManifest() {
         //qDebug() << debugString() << "deleted";
@@ -107,6 +108,17 @@ class EffectManifest {
         m_effectRampsFromDry = effectFadesFromDry;
     }
 
+    // The factor (1, 2 or 4) by which the sample rate is raised while the
+    // effect is processed, see OversamplingEffectProcessor. Effects that
+    // distort, e.g. by saturation or by quantization, opt in to keep the
+    // harmonics they create above the Nyquist frequency from aliasing.
+    virtual int oversampling() const {
+        return m_oversampling;
+    }
+    virtual void setOversampling(int factor) {
+        m_oversampling = factor;
+    }
+
   private:
     QString debugString() const {
         return QString("EffectManifest(%1)").arg(m_id);
@@ -124,6 +136,7 @@ class EffectManifest {
     bool m_isForFilterKnob;
     QList<EffectManifestParameter> m_parameters;
     bool m_effectRampsFromDry;
+    int m_oversampling;
 };
 
 #endif /* EFFECTMANIFEST_H */
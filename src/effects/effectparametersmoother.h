@@ -0,0 +1,174 @@
+#ifndef EFFECTPARAMETERSMOOTHER_H
+#define EFFECTPARAMETERSMOOTHER_H
+
+#include "sampleutil.h"
+#include "util/math.h"
+#include "util/types.h"
+
+// The time native effects take to follow a parameter change
+const double kEffectParameterRampSeconds = 0.05;
+
+// Smooths the changes of an effect parameter to avoid zipper noise. An effect
+// keeps one smoother per parameter and channel in its channel state, passes
+// the parameter value once per buffer to setTarget() and then reads the
+// smoothed values frame by frame with next(), all at once with fill() or
+// applies them as gain with applyGain().
+//
+// The length of a ramp is given in seconds, so it does not depend on the
+// buffer size and a ramp may span several buffers. This allows to run the
+// engine with large buffers without audible steps.
+class EffectParameterSmoother {
+  public:
+    enum Ramp {
+        // Changes by a constant amount per frame.
+        LINEAR,
+        // Changes by a constant ratio per frame, i.e. linearly on a
+        // logarithmic scale, which suits frequencies and periods. Ramps
+        // linearly unless both the start and the target are positive.
+        EXPONENTIAL
+    };
+
+    explicit EffectParameterSmoother(
+            Ramp ramp = LINEAR,
+            double rampSeconds = kEffectParameterRampSeconds)
+            : m_ramp(ramp),
+              m_rampSeconds(rampSeconds),
+              m_value(0.0),
+              m_target(0.0),
+              m_step(0.0),
+              m_bExponential(false),
+              m_iFramesLeft(0),
+              m_bInitialized(false) {
+    }
+
+    // Jumps to value, e.g. when the effect is enabled or disabled.
+    void reset(double value) {
+        m_value = value;
+        m_target = value;
+        m_iFramesLeft = 0;
+        m_bInitialized = true;
+    }
+
+    // Starts a ramp from the current value to target, unless target is
+    // already the target of the running ramp. The first call after
+    // construction jumps to target.
+    void setTarget(double target, unsigned int sampleRate) {
+        if (!m_bInitialized) {
+            reset(target);
+            return;
+        }
+        if (target == m_target) {
+            return;
+        }
+        m_target = target;
+        m_iFramesLeft = math_max(1, static_cast<int>(m_rampSeconds * sampleRate));
+        m_bExponential = m_ramp == EXPONENTIAL && m_value > 0.0 && target > 0.0;
+        if (m_bExponential) {
+            m_step = pow(target / m_value, 1.0 / m_iFramesLeft);
+        } else {
+            m_step = (target - m_value) / m_iFramesLeft;
+        }
+    }
+
+    bool isRamping() const {
+        return m_iFramesLeft > 0;
+    }
+
+    // The value of the last frame
+    double value() const {
+        return m_value;
+    }
+
+    double target() const {
+        return m_target;
+    }
+
+    // Advances by one frame and returns its value.
+    inline CSAMPLE next() {
+        if (m_iFramesLeft > 0) {
+            if (--m_iFramesLeft == 0) {
+                m_value = m_target;
+            } else if (m_bExponential) {
+                m_value *= m_step;
+            } else {
+                m_value += m_step;
+            }
+        }
+        return static_cast<CSAMPLE>(m_value);
+    }
+
+    // Advances by numFrames frames and returns the value of the last one, for
+    // parameters that are applied once per buffer.
+    double advance(int numFrames) {
+        if (numFrames >= m_iFramesLeft) {
+            m_value = m_target;
+            m_iFramesLeft = 0;
+        } else if (numFrames > 0) {
+            if (m_bExponential) {
+                m_value *= pow(m_step, numFrames);
+            } else {
+                m_value += m_step * numFrames;
+            }
+            m_iFramesLeft -= numFrames;
+        }
+        return m_value;
+    }
+
+    // Writes the values of the next numFrames frames to pValues.
+    void fill(CSAMPLE* pValues, int numFrames) {
+        const int rampFrames = math_min(numFrames, m_iFramesLeft);
+        if (m_bExponential) {
+            for (int i = 0; i < rampFrames; ++i) {
+                pValues[i] = next();
+            }
+        } else if (rampFrames > 0) {
+            // Without a dependency between the frames, so it vectorizes.
+            const double start = m_value;
+            for (int i = 0; i < rampFrames; ++i) {
+                pValues[i] = static_cast<CSAMPLE>(start + m_step * (i + 1));
+            }
+            pValues[rampFrames - 1] = static_cast<CSAMPLE>(advance(rampFrames));
+        }
+        const CSAMPLE last = static_cast<CSAMPLE>(m_value);
+        for (int i = rampFrames; i < numFrames; ++i) {
+            pValues[i] = last;
+        }
+    }
+
+    // Multiplies both channels of numFrames interleaved stereo frames with
+    // the values of the next frames.
+    void applyGain(CSAMPLE* pBuffer, int numFrames) {
+        int rampFrames = math_min(numFrames, m_iFramesLeft);
+        if (m_bExponential) {
+            for (int i = 0; i < rampFrames; ++i) {
+                const CSAMPLE gain = next();
+                pBuffer[i * 2] *= gain;
+                pBuffer[i * 2 + 1] *= gain;
+            }
+        } else if (rampFrames > 0) {
+            const CSAMPLE_GAIN startGain = static_cast<CSAMPLE_GAIN>(m_value);
+            const CSAMPLE_GAIN endGain =
+                    static_cast<CSAMPLE_GAIN>(advance(rampFrames));
+            SampleUtil::applyRampingGain(pBuffer, startGain, endGain,
+                                         rampFrames * 2);
+        }
+        if (rampFrames < numFrames) {
+            SampleUtil::applyGain(pBuffer + rampFrames * 2,
+                                  static_cast<CSAMPLE_GAIN>(m_value),
+                                  (numFrames - rampFrames) * 2);
+        }
+    }
+
+  private:
+    Ramp m_ramp;
+    double m_rampSeconds;
+    double m_value;
+    double m_target;
+    // The increment or the factor per frame
+    double m_step;
+    bool m_bExponential;
+    int m_iFramesLeft;
+    bool m_bInitialized;
+};
+
+#endif /* EFFECTPARAMETERSMOOTHER_H */
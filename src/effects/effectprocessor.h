@@ -5,12 +5,22 @@
 #include <QHash>
 #include <QPair>
 
+#include "sampleutil.h"
+#include "util/assert.h"
 #include "util/types.h"
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/channelhandle.h"
 
 class EngineEffect;
 
+// Base class of the state an EffectProcessor keeps for each channel it
+// processes. Channel states are created by the main thread and handed over to
+// the engine thread, so that the engine never has to allocate them.
+class EffectChannelState {
+  public:
+    virtual ~EffectChannelState() { }
+};
+
 class EffectProcessor {
   public:
     enum EnableState {
@@ -26,6 +36,25 @@ class EffectProcessor {
     virtual void initialize(
             const QSet<ChannelHandleAndGroup>& registeredChannels) = 0;
 
+    // Creates the state for one channel. Called from the main thread while the
+    // engine thread may be processing, so implementations must not touch the
+    // processor's members. Returns NULL if the processor has no per-channel
+    // state.
+    virtual EffectChannelState* createChannelState() const {
+        return NULL;
+    }
+
+    // Called from the engine thread to hand over a state created by
+    // createChannelState() for the channel handle. Returns true if the
+    // processor took ownership of pState. If the channel already has a state,
+    // returns false and the caller keeps ownership.
+    virtual bool loadChannelState(const ChannelHandle& handle,
+                                  EffectChannelState* pState) {
+        Q_UNUSED(handle);
+        Q_UNUSED(pState);
+        return false;
+    }
+
     // Take a buffer of numSamples samples of audio from a channel, provided as
     // pInput, process the buffer according to Effect-specific logic, and output
     // it to the buffer pOutput. If pInput is equal to pOutput, then the
@@ -41,15 +70,42 @@ class EffectProcessor {
                          const unsigned int sampleRate,
                          const enum EnableState enableState,
                          const GroupFeatureState& groupFeatures) = 0;
+
+    // Returns true if the last call of process() for the channel handle
+    // bypassed the effect because its input was silent and everything the
+    // effect still held for the channel had decayed. The output of that call
+    // is silent as well. Only called from the thread that processes the
+    // channel.
+    virtual bool isSleeping(const ChannelHandle& handle) const {
+        Q_UNUSED(handle);
+        return false;
+    }
 };
 
 // Helper class for automatically fetching channel state parameters upon receipt
-// of a channel-specific process call.
+// of a channel-specific process call. The state of every registered channel is
+// created by initialize() or shipped in by the EngineEffect when a channel is
+// registered later, so processing does not allocate.
+//
+// While the input of a channel is silent (see GroupFeatureState::silence) the
+// effect is processed until its output has been silent for tailFrames().
+// After that the effect sleeps for the channel, i.e. processChannel() is not
+// called and the output is cleared, until the input is no longer silent.
 template <typename T>
 class PerChannelEffectProcessor : public EffectProcessor {
+    struct ChannelState : public EffectChannelState {
+        ChannelState()
+                : silentFrames(0),
+                  sleeping(false) {
+        }
+        T state;
+        // The frames of silent output since the input became silent
+        unsigned int silentFrames;
+        bool sleeping;
+    };
     struct ChannelStateHolder {
-        ChannelStateHolder() : state(NULL) { }
-        T* state;
+        ChannelStateHolder() : pState(NULL) { }
+        ChannelState* pState;
     };
   public:
     PerChannelEffectProcessor() {
@@ -58,7 +114,7 @@ class PerChannelEffectProcessor : public EffectProcessor {
         for (typename ChannelHandleMap<ChannelStateHolder>::iterator it =
                      m_channelState.begin();
              it != m_channelState.end(); ++it) {
-            T* pState = it->state;
+            ChannelState* pState = it->pState;
             delete pState;
         }
         m_channelState.clear();
@@ -67,8 +123,36 @@ class PerChannelEffectProcessor : public EffectProcessor {
     virtual void initialize(
             const QSet<ChannelHandleAndGroup>& registeredChannels) {
         foreach (const ChannelHandleAndGroup& channel, registeredChannels) {
-            getOrCreateChannelState(channel.handle());
+            EffectChannelState* pState = createChannelState();
+            if (!loadChannelState(channel.handle(), pState)) {
+                delete pState;
+            }
+        }
+    }
+
+    virtual EffectChannelState* createChannelState() const {
+        ChannelState* pState = new ChannelState();
+        prepareChannelState(&pState->state);
+        return pState;
+    }
+
+    // Called for every new channel state before it is handed over to the
+    // engine, usually from the main thread. Processors whose state has to be
+    // allocated depending on the processor, e.g. on the length of a buffer,
+    // allocate it here. The same restrictions as for createChannelState()
+    // apply.
+    virtual void prepareChannelState(T* pState) const {
+        Q_UNUSED(pState);
+    }
+
+    virtual bool loadChannelState(const ChannelHandle& handle,
+                                  EffectChannelState* pState) {
+        ChannelStateHolder& holder = m_channelState[handle];
+        if (holder.pState != NULL || pState == NULL) {
+            return false;
         }
+        holder.pState = static_cast<ChannelState*>(pState);
+        return true;
     }
 
     virtual void process(const ChannelHandle& handle,
@@ -77,9 +161,45 @@ class PerChannelEffectProcessor : public EffectProcessor {
                          const unsigned int sampleRate,
                          const EffectProcessor::EnableState enableState,
                          const GroupFeatureState& groupFeatures) {
-        T* pState = getOrCreateChannelState(handle);
-        processChannel(handle, pState, pInput, pOutput, numSamples, sampleRate,
-                       enableState, groupFeatures);
+        ChannelState* pChannel = channelState(handle);
+        if (pChannel == NULL) {
+            // Never allocate in the engine thread. The channel passes through
+            // dry until its state arrives.
+            if (pInput != pOutput) {
+                SampleUtil::copy(pOutput, pInput, numSamples);
+            }
+            return;
+        }
+        // Only sleep while enabled, so enabling and disabling ramps as usual.
+        if (!groupFeatures.has_silence || !groupFeatures.silence ||
+                enableState != EffectProcessor::ENABLED) {
+            pChannel->silentFrames = 0;
+            pChannel->sleeping = false;
+            processChannel(handle, &pChannel->state, pInput, pOutput,
+                           numSamples, sampleRate, enableState, groupFeatures);
+            return;
+        }
+        if (pChannel->sleeping) {
+            SampleUtil::clear(pOutput, numSamples);
+            return;
+        }
+        processChannel(handle, &pChannel->state, pInput, pOutput, numSamples,
+                       sampleRate, enableState, groupFeatures);
+        if (SampleUtil::isSilent(pOutput, numSamples)) {
+            pChannel->silentFrames += numSamples / 2;
+            pChannel->sleeping = pChannel->silentFrames >=
+                    tailFrames(&pChannel->state, sampleRate);
+        } else {
+            pChannel->silentFrames = 0;
+        }
+    }
+
+    virtual bool isSleeping(const ChannelHandle& handle) const {
+        if (!m_channelState.contains(handle)) {
+            return false;
+        }
+        const ChannelState* pChannel = m_channelState.at(handle).pState;
+        return pChannel != NULL && pChannel->sleeping;
     }
 
     virtual void processChannel(const ChannelHandle& handle,
@@ -90,13 +210,25 @@ class PerChannelEffectProcessor : public EffectProcessor {
                                 const EffectProcessor::EnableState enableState,
                                 const GroupFeatureState& groupFeatures) = 0;
 
+    // The number of frames the output of an effect may stay silent before it
+    // sounds again without new input, e.g. because a delay line still holds
+    // audio that is not read yet. The default covers the short delay lines
+    // and the filters of the native effects; effects with long delay lines or
+    // reverb tanks return their length.
+    virtual unsigned int tailFrames(const T* pState,
+                                    unsigned int sampleRate) const {
+        Q_UNUSED(pState);
+        return sampleRate / 10;
+    }
+
   private:
-    inline T* getOrCreateChannelState(const ChannelHandle& handle) {
-        ChannelStateHolder& holder = m_channelState[handle];
-        if (holder.state == NULL) {
-            holder.state = new T();
-        }
-        return holder.state;
+    // Returns NULL for channels that were never registered with the
+    // EffectsManager. Never modifies m_channelState.
+    inline ChannelState* channelState(const ChannelHandle& handle) const {
+        ChannelState* pState = m_channelState.contains(handle) ?
+                m_channelState.at(handle).pState : NULL;
+        DEBUG_ASSERT(pState != NULL);
+        return pState;
     }
 
     ChannelHandleMap<ChannelStateHolder> m_channelState;
@@ -44,7 +44,7 @@ void EffectRack::addToEngine() {
         EffectChainPointer pChain = pSlot->getEffectChain();
         if (pChain) {
             // Add the effect to the engine.
-            pChain->addToEngine(m_pEngineEffectRack, i);
+            pChain->addToEngine(m_pEngineEffectRack, i, pSlot->getGroup());
             // Update its parameters in the engine.
             pChain->updateEngineState();
         }
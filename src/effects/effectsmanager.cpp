@@ -284,6 +284,8 @@ bool EffectsManager::writeRequest(EffectsRequest* request) {
         } else if (request->type == EffectsRequest::REMOVE_EFFECT_RACK) {
             //qDebug() << debugString() << "delete" << request->RemoveEffectRack.pRack;
             delete request->RemoveEffectRack.pRack;
+        } else if (request->type == EffectsRequest::ADD_EFFECT_CHANNEL_STATE) {
+            delete request->AddEffectChannelState.pState;
         }
         delete request;
         return false;
@@ -304,6 +306,9 @@ bool EffectsManager::writeRequest(EffectsRequest* request) {
         m_activeRequests[request->request_id] = request;
         return true;
     }
+    if (request->type == EffectsRequest::ADD_EFFECT_CHANNEL_STATE) {
+        delete request->AddEffectChannelState.pState;
+    }
     delete request;
     return false;
 }
@@ -347,6 +352,13 @@ void EffectsManager::processEffectsResponses() {
                 }
             }
 
+            // The engine took ownership of the channel state only if the
+            // request succeeded.
+            if (pRequest->type == EffectsRequest::ADD_EFFECT_CHANNEL_STATE &&
+                    !response.success) {
+                delete pRequest->AddEffectChannelState.pState;
+            }
+
             delete pRequest;
             it = m_activeRequests.erase(it);
         }
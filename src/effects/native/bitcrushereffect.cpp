@@ -18,6 +18,8 @@ EffectManifest BitCrusherEffect::getManifest() {
         "by the reduction of the resolution or bandwidth of the samples."));
     manifest.setIsForFilterKnob(true);
     manifest.setEffectRampsFromDry(true);
+    // The quantization creates harmonics far above the Nyquist frequency.
+    manifest.setOversampling(4);
 
     EffectManifestParameter* depth = manifest.addParameter();
     depth->setId("bit_depth");
@@ -53,8 +55,8 @@ EffectManifest BitCrusherEffect::getManifest() {
 BitCrusherEffect::BitCrusherEffect(EngineEffect* pEffect,
                                    const EffectManifest& manifest)
         : m_pBitDepthParameter(pEffect->getParameterById("bit_depth")),
-          m_pDownsampleParameter(pEffect->getParameterById("downsample")) {
-    Q_UNUSED(manifest);
+          m_pDownsampleParameter(pEffect->getParameterById("downsample")),
+          m_oversampling(manifest.oversampling()) {
 }
 
 BitCrusherEffect::~BitCrusherEffect() {
@@ -70,29 +72,33 @@ void BitCrusherEffect::processChannel(const ChannelHandle& handle,
                                       const GroupFeatureState& groupFeatures) {
     Q_UNUSED(handle);
     Q_UNUSED(groupFeatures);
-    Q_UNUSED(sampleRate); // we are normalized to 1
     Q_UNUSED(enableState); // no need to ramp, it is just a bitcrusher ;-)
 
-    const CSAMPLE downsample = m_pDownsampleParameter ?
-            m_pDownsampleParameter->value() : 0.0;
-
-    CSAMPLE bit_depth = m_pBitDepthParameter ?
-            m_pBitDepthParameter->value() : 16;
-
-    // divided by two because we use float math which includes the sing bit anyway
-    const CSAMPLE scale = pow(2.0f, bit_depth) / 2;
-    // Gain correction is required, because MSB (values above 0.5) is usually
-    // rarely used, to achieve equal loudness and maximum dynamic
-    const CSAMPLE gainCorrection = (17 - bit_depth) / 8;
+    pState->downsample.setTarget(m_pDownsampleParameter ?
+            m_pDownsampleParameter->value() : 0.0, sampleRate);
+    pState->bit_depth.setTarget(m_pBitDepthParameter ?
+            m_pBitDepthParameter->value() : 16, sampleRate);
 
+    // The downsampling is relative to the rate before oversampling.
+    const CSAMPLE oversamplingRatio = 1.0f / m_oversampling;
     const int kChannels = 2;
     for (unsigned int i = 0; i < numSamples; i += kChannels) {
-        pState->accumulator += downsample;
+        pState->accumulator += pState->downsample.next() * oversamplingRatio;
+        const CSAMPLE bit_depth = pState->bit_depth.next();
 
         if (pState->accumulator >= 1.0) {
             pState->accumulator -= 1.0;
             if (bit_depth < 16) {
-
+                if (bit_depth != pState->quantized_bit_depth) {
+                    pState->quantized_bit_depth = bit_depth;
+                    // divided by two because we use float math which includes the sing bit anyway
+                    pState->scale = pow(2.0f, bit_depth) / 2;
+                    // Gain correction is required, because MSB (values above 0.5) is usually
+                    // rarely used, to achieve equal loudness and maximum dynamic
+                    pState->gain_correction = (17 - bit_depth) / 8;
+                }
+                const CSAMPLE scale = pState->scale;
+                const CSAMPLE gainCorrection = pState->gain_correction;
                 pState->hold_l = floorf(SampleUtil::clampSample(pInput[i] * gainCorrection) * scale + 0.5f) / scale / gainCorrection;
                 pState->hold_r = floorf(SampleUtil::clampSample(pInput[i+1] * gainCorrection) * scale + 0.5f) / scale / gainCorrection;
             } else {
@@ -4,6 +4,7 @@
 #include <QMap>
 
 #include "effects/effect.h"
+#include "effects/effectparametersmoother.h"
 #include "effects/effectprocessor.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
@@ -15,11 +16,21 @@ struct BitCrusherGroupState {
     BitCrusherGroupState()
             : hold_l(0),
               hold_r(0),
-              accumulator(1) {
+              accumulator(1),
+              quantized_bit_depth(0),
+              scale(0),
+              gain_correction(0) {
     }
     CSAMPLE hold_l, hold_r;
     // Accumulated fractions of a samplerate period.
     CSAMPLE accumulator;
+    // The bit depth scale and gain_correction have been computed for. They
+    // only change while bit_depth ramps.
+    CSAMPLE quantized_bit_depth;
+    CSAMPLE scale;
+    CSAMPLE gain_correction;
+    EffectParameterSmoother downsample;
+    EffectParameterSmoother bit_depth;
 };
 
 class BitCrusherEffect : public PerChannelEffectProcessor<BitCrusherGroupState> {
@@ -46,6 +57,7 @@ class BitCrusherEffect : public PerChannelEffectProcessor<BitCrusherGroupState>
 
     EngineEffectParameter* m_pBitDepthParameter;
     EngineEffectParameter* m_pDownsampleParameter;
+    const int m_oversampling;
 
     DISALLOW_COPY_AND_ASSIGN(BitCrusherEffect);
 };
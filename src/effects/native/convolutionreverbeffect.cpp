@@ -0,0 +1,311 @@
+#include <QDir>
+#include <QMutexLocker>
+#include <QVector>
+#include <QtDebug>
+
+#include "effects/native/convolutionreverbeffect.h"
+
+#include "controlobject.h"
+#include "sampleutil.h"
+#include "soundsourceproxy.h"
+#include "util/cmdlineargs.h"
+#include "util/math.h"
+
+namespace {
+
+// Longer impulse responses are cut, which bounds the memory and the CPU load
+// of the worker.
+const int kMaxImpulseSeconds = 10;
+
+// The reverberation time of the synthesized impulse response
+const double kSynthesizedDecaySeconds = 2.0;
+
+// How often the loader checks for a new sample rate
+const int kLoaderPollMillis = 50;
+
+// Reads fileName as interleaved stereo at sampleRate into pImpulse.
+bool readImpulseResponse(const QString& fileName, int sampleRate,
+                         QVector<CSAMPLE>* pImpulse) {
+    SoundSourceProxy soundSourceProxy(fileName);
+    Mixxx::AudioSourceConfig audioSrcCfg;
+    audioSrcCfg.channelCountHint = 2;
+    Mixxx::AudioSourcePointer pAudioSource(
+            soundSourceProxy.openAudioSource(audioSrcCfg));
+    if (!pAudioSource) {
+        qWarning() << "Failed to open impulse response" << fileName;
+        return false;
+    }
+
+    const SINT fileRate = pAudioSource->getFrameRate();
+    const SINT frames = math_min(pAudioSource->getFrameCount(),
+                                 kMaxImpulseSeconds * fileRate);
+    QVector<CSAMPLE> fileImpulse(frames * 2);
+    const SINT framesRead = pAudioSource->readSampleFramesStereo(
+            frames, fileImpulse.data(), fileImpulse.size());
+    if (framesRead <= 0) {
+        qWarning() << "Failed to read impulse response" << fileName;
+        return false;
+    }
+
+    // Resample linearly, the impulse response is smooth enough.
+    const double step = static_cast<double>(fileRate) / sampleRate;
+    const int resampledFrames = static_cast<int>((framesRead - 1) / step) + 1;
+    pImpulse->resize(resampledFrames * 2);
+    for (int frame = 0; frame < resampledFrames; ++frame) {
+        const double position = frame * step;
+        const int index = math_min(static_cast<int>(position),
+                                   static_cast<int>(framesRead) - 1);
+        const int next = math_min(index + 1, static_cast<int>(framesRead) - 1);
+        const CSAMPLE frac = static_cast<CSAMPLE>(position - index);
+        for (int ch = 0; ch < 2; ++ch) {
+            const CSAMPLE a = fileImpulse[index * 2 + ch];
+            const CSAMPLE b = fileImpulse[next * 2 + ch];
+            (*pImpulse)[frame * 2 + ch] = a + frac * (b - a);
+        }
+    }
+    qDebug() << "Loaded impulse response" << fileName
+             << resampledFrames << "frames";
+    return true;
+}
+
+// Exponentially decaying noise, decorrelated between the channels and
+// darkening over time like the air absorption of a hall.
+void synthesizeImpulseResponse(int sampleRate, QVector<CSAMPLE>* pImpulse) {
+    const int frames = static_cast<int>(kSynthesizedDecaySeconds * sampleRate);
+    pImpulse->resize(frames * 2);
+    // -60 dB at the end
+    const double decay = log(1000.0) / frames;
+    unsigned int seeds[2] = { 1, 2 };
+    double lowPass[2] = { 0.0, 0.0 };
+    for (int frame = 0; frame < frames; ++frame) {
+        const double envelope = exp(-decay * frame);
+        const double cutoff = 0.9 - 0.8 * frame / frames;
+        for (int ch = 0; ch < 2; ++ch) {
+            seeds[ch] = seeds[ch] * 1103515245 + 12345;
+            const double noise = ((seeds[ch] >> 16) % 2000) / 1000.0 - 1.0;
+            lowPass[ch] += cutoff * (noise - lowPass[ch]);
+            (*pImpulse)[frame * 2 + ch] =
+                    static_cast<CSAMPLE>(lowPass[ch] * envelope);
+        }
+    }
+}
+
+// Scales the impulse response to unity power gain, so all impulse responses
+// play at about the level of the input.
+void normalizeImpulseResponse(QVector<CSAMPLE>* pImpulse) {
+    double energy = 0;
+    for (int i = 0; i < pImpulse->size(); ++i) {
+        energy += (*pImpulse)[i] * (*pImpulse)[i];
+    }
+    // Per channel
+    energy /= 2;
+    if (energy <= 0) {
+        return;
+    }
+    const CSAMPLE gain = static_cast<CSAMPLE>(1.0 / sqrt(energy));
+    for (int i = 0; i < pImpulse->size(); ++i) {
+        (*pImpulse)[i] *= gain;
+    }
+}
+
+} // anonymous namespace
+
+ConvolutionReverbGroupState::ConvolutionReverbGroupState()
+        : pConvolver(NULL) {
+    // Fade in the first buffer
+    level.reset(0.0);
+}
+
+ConvolutionReverbGroupState::~ConvolutionReverbGroupState() {
+    if (pLoader) {
+        pLoader->removeState(this);
+    }
+    delete pConvolver;
+    delete load_atomic_pointer(pNextConvolver);
+    delete load_atomic_pointer(pRetiredConvolver);
+}
+
+ConvolutionReverbLoader::ConvolutionReverbLoader(int sampleRate)
+        : m_requestedSampleRate(sampleRate),
+          m_stop(0),
+          m_iSampleRate(0),
+          m_pWorker(new PartitionedConvolverWorker()) {
+    start(QThread::LowPriority);
+}
+
+ConvolutionReverbLoader::~ConvolutionReverbLoader() {
+    stop();
+}
+
+void ConvolutionReverbLoader::stop() {
+    m_stop = 1;
+    wait();
+}
+
+PartitionedConvolver* ConvolutionReverbLoader::addState(
+        ConvolutionReverbGroupState* pState) {
+    QMutexLocker locker(&m_mutex);
+    m_states.append(pState);
+    if (!m_pKernel) {
+        return NULL;
+    }
+    return new PartitionedConvolver(m_pKernel, m_pWorker);
+}
+
+void ConvolutionReverbLoader::removeState(ConvolutionReverbGroupState* pState) {
+    QMutexLocker locker(&m_mutex);
+    m_states.removeAll(pState);
+}
+
+void ConvolutionReverbLoader::run() {
+    QThread::currentThread()->setObjectName("ConvolutionReverbLoader");
+    while (!load_atomic(m_stop)) {
+        deleteRetiredConvolvers();
+        const int sampleRate = load_atomic(m_requestedSampleRate);
+        if (sampleRate > 0 && sampleRate != m_iSampleRate) {
+            loadKernel(sampleRate);
+        } else {
+            msleep(kLoaderPollMillis);
+        }
+    }
+}
+
+void ConvolutionReverbLoader::loadKernel(int sampleRate) {
+    QVector<CSAMPLE> impulse;
+    QDir impulseDir(QDir(CmdlineArgs::Instance().getSettingsPath())
+                    .filePath("impulses"));
+    const QStringList fileNames = impulseDir.entryList(
+            SoundSourceProxy::getSupportedFileNamePatterns(),
+            QDir::Files, QDir::Name);
+    bool loaded = false;
+    foreach (const QString& fileName, fileNames) {
+        if (readImpulseResponse(impulseDir.filePath(fileName), sampleRate,
+                                &impulse)) {
+            loaded = true;
+            break;
+        }
+    }
+    if (!loaded) {
+        synthesizeImpulseResponse(sampleRate, &impulse);
+    }
+    normalizeImpulseResponse(&impulse);
+    PartitionedConvolverKernelPointer pKernel(
+            new PartitionedConvolverKernel(impulse.constData(),
+                                           impulse.size() / 2));
+    m_iSampleRate = sampleRate;
+
+    QMutexLocker locker(&m_mutex);
+    m_pKernel = pKernel;
+    foreach (ConvolutionReverbGroupState* pState, m_states) {
+        // A convolver the callback has not picked up yet is outdated now.
+        delete pState->pNextConvolver.fetchAndStoreRelease(
+                new PartitionedConvolver(pKernel, m_pWorker));
+    }
+}
+
+void ConvolutionReverbLoader::deleteRetiredConvolvers() {
+    QMutexLocker locker(&m_mutex);
+    foreach (ConvolutionReverbGroupState* pState, m_states) {
+        delete pState->pRetiredConvolver.fetchAndStoreAcquire(NULL);
+    }
+}
+
+// static
+QString ConvolutionReverbEffect::getId() {
+    return "org.mixxx.effects.convolutionreverb";
+}
+
+// static
+EffectManifest ConvolutionReverbEffect::getManifest() {
+    EffectManifest manifest;
+    manifest.setId(getId());
+    manifest.setName(QObject::tr("Convolution Reverb"));
+    manifest.setAuthor("The Mixxx Team");
+    manifest.setVersion("1.0");
+    manifest.setDescription(QObject::tr(
+            "Reverb with the impulse response of a real room. Place a WAV "
+            "file with the impulse response in the \"impulses\" folder of "
+            "the settings directory."));
+
+    EffectManifestParameter* level = manifest.addParameter();
+    level->setId("level");
+    level->setName(QObject::tr("Level"));
+    level->setDescription(QObject::tr("The level of the reverberation"));
+    level->setControlHint(EffectManifestParameter::CONTROL_KNOB_LINEAR);
+    level->setSemanticHint(EffectManifestParameter::SEMANTIC_UNKNOWN);
+    level->setUnitsHint(EffectManifestParameter::UNITS_UNKNOWN);
+    level->setMinimum(0.0);
+    level->setDefault(1.0);
+    level->setMaximum(2.0);
+
+    return manifest;
+}
+
+ConvolutionReverbEffect::ConvolutionReverbEffect(EngineEffect* pEffect,
+                                                 const EffectManifest& manifest)
+        : m_pLevelParameter(pEffect->getParameterById("level")) {
+    Q_UNUSED(manifest);
+    int sampleRate = static_cast<int>(
+            ControlObject::get(ConfigKey("[Master]", "samplerate")));
+    if (sampleRate <= 0) {
+        sampleRate = 44100;
+    }
+    // Starts loading the impulse response right away.
+    m_pLoader = QSharedPointer<ConvolutionReverbLoader>(
+            new ConvolutionReverbLoader(sampleRate));
+}
+
+ConvolutionReverbEffect::~ConvolutionReverbEffect() {
+    //qDebug() << debugString() << "destroyed";
+    // The channel states keep the loader around until they are deleted.
+    m_pLoader->stop();
+}
+
+void ConvolutionReverbEffect::prepareChannelState(
+        ConvolutionReverbGroupState* pState) const {
+    pState->pLoader = m_pLoader;
+    pState->pConvolver = m_pLoader->addState(pState);
+}
+
+void ConvolutionReverbEffect::processChannel(
+        const ChannelHandle& handle,
+        ConvolutionReverbGroupState* pState,
+        const CSAMPLE* pInput, CSAMPLE* pOutput,
+        const unsigned int numSamples,
+        const unsigned int sampleRate,
+        const EffectProcessor::EnableState enableState,
+        const GroupFeatureState& groupFeatures) {
+    Q_UNUSED(handle);
+    Q_UNUSED(enableState);
+    Q_UNUSED(groupFeatures);
+    m_pLoader->requestSampleRate(sampleRate);
+    // Take over a convolver for a new impulse response once the previous
+    // replaced one has been deleted by the loader.
+    if (load_atomic_pointer(pState->pRetiredConvolver) == NULL &&
+            load_atomic_pointer(pState->pNextConvolver) != NULL) {
+        PartitionedConvolver* pNext =
+                pState->pNextConvolver.fetchAndStoreAcquire(NULL);
+        pState->pRetiredConvolver.fetchAndStoreRelease(pState->pConvolver);
+        pState->pConvolver = pNext;
+        pState->level.reset(0.0);
+    }
+    if (pState->pConvolver == NULL) {
+        SampleUtil::clear(pOutput, numSamples);
+        return;
+    }
+    pState->pConvolver->process(pInput, pOutput, numSamples / 2);
+    pState->level.setTarget(m_pLevelParameter->value(), sampleRate);
+    pState->level.applyGain(pOutput, numSamples / 2);
+}
+
+unsigned int ConvolutionReverbEffect::tailFrames(
+        const ConvolutionReverbGroupState* pState,
+        unsigned int sampleRate) const {
+    Q_UNUSED(sampleRate);
+    if (pState->pConvolver == NULL) {
+        return 0;
+    }
+    // A quiet part of the impulse response may follow a silent one.
+    return pState->pConvolver->impulseFrames() +
+            PartitionedConvolver::latencyFrames();
+}
@@ -0,0 +1,136 @@
+#ifndef CONVOLUTIONREVERBEFFECT_H
+#define CONVOLUTIONREVERBEFFECT_H
+
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QList>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QThread>
+
+#include "util.h"
+#include "util/compatibility.h"
+#include "util/types.h"
+#include "effects/effectparametersmoother.h"
+#include "effects/effectprocessor.h"
+#include "engine/effects/engineeffect.h"
+#include "engine/effects/engineeffectparameter.h"
+#include "engine/partitionedconvolver.h"
+
+class ConvolutionReverbLoader;
+
+struct ConvolutionReverbGroupState {
+    ConvolutionReverbGroupState();
+    ~ConvolutionReverbGroupState();
+
+    // The convolver used by the callback. NULL until the impulse response is
+    // loaded.
+    PartitionedConvolver* pConvolver;
+    // A convolver for a newly loaded impulse response, handed over from the
+    // loader to the callback.
+    QAtomicPointer<PartitionedConvolver> pNextConvolver;
+    // The convolver replaced by pNextConvolver, handed back to the loader,
+    // which deletes it.
+    QAtomicPointer<PartitionedConvolver> pRetiredConvolver;
+    QSharedPointer<ConvolutionReverbLoader> pLoader;
+    EffectParameterSmoother level;
+
+    DISALLOW_COPY_AND_ASSIGN(ConvolutionReverbGroupState);
+};
+
+// Loads the impulse response for the sample rate of the engine and builds the
+// convolvers for it on its own thread, so neither the GUI thread nor the
+// callback decodes, resamples or allocates. The callback requests a new
+// sample rate, the loader polls for it. Shared with the channel states, which
+// may outlive the effect.
+class ConvolutionReverbLoader : public QThread {
+  public:
+    explicit ConvolutionReverbLoader(int sampleRate);
+    virtual ~ConvolutionReverbLoader();
+
+    // Stops the thread and waits for it to exit.
+    void stop();
+
+    // Lock-free, called from the callback.
+    void requestSampleRate(int sampleRate) {
+        if (load_atomic(m_requestedSampleRate) != sampleRate) {
+            m_requestedSampleRate.fetchAndStoreRelease(sampleRate);
+        }
+    }
+
+    // Registers pState and returns a convolver for the current impulse
+    // response, or NULL if it is not loaded yet. The convolvers for later
+    // impulse responses are handed to pState->pNextConvolver.
+    PartitionedConvolver* addState(ConvolutionReverbGroupState* pState);
+    // Returns when the loader no longer touches pState.
+    void removeState(ConvolutionReverbGroupState* pState);
+
+  protected:
+    void run();
+
+  private:
+    void loadKernel(int sampleRate);
+    void deleteRetiredConvolvers();
+
+    QAtomicInt m_requestedSampleRate;
+    QAtomicInt m_stop;
+    // The sample rate of m_pKernel. Only touched by the loader thread.
+    int m_iSampleRate;
+
+    // Guards m_pKernel and m_states
+    QMutex m_mutex;
+    PartitionedConvolverKernelPointer m_pKernel;
+    QList<ConvolutionReverbGroupState*> m_states;
+    const PartitionedConvolverWorkerPointer m_pWorker;
+
+    DISALLOW_COPY_AND_ASSIGN(ConvolutionReverbLoader);
+};
+
+// Convolves the channels with a recorded impulse response, e.g. of a room or
+// a plate. The impulse response is the first audio file in the "impulses"
+// folder of the settings directory that can be read. Without one, a
+// synthesized hall is used.
+//
+// All channels share the partitioned impulse response and one worker thread
+// for the tails, only the head of the impulse response is convolved in the
+// callback. The reverb is delayed by PartitionedConvolver::latencyFrames().
+// It is silent until ConvolutionReverbLoader has loaded the impulse response,
+// and again for a moment when the sample rate changes.
+class ConvolutionReverbEffect
+        : public PerChannelEffectProcessor<ConvolutionReverbGroupState> {
+  public:
+    ConvolutionReverbEffect(EngineEffect* pEffect,
+                            const EffectManifest& manifest);
+    virtual ~ConvolutionReverbEffect();
+
+    static QString getId();
+    static EffectManifest getManifest();
+
+    // See effectprocessor.h
+    void prepareChannelState(ConvolutionReverbGroupState* pState) const;
+
+    // See effectprocessor.h
+    void processChannel(const ChannelHandle& handle,
+                        ConvolutionReverbGroupState* pState,
+                        const CSAMPLE* pInput, CSAMPLE* pOutput,
+                        const unsigned int numSamples,
+                        const unsigned int sampleRate,
+                        const EffectProcessor::EnableState enableState,
+                        const GroupFeatureState& groupFeatures);
+
+    // See effectprocessor.h
+    unsigned int tailFrames(const ConvolutionReverbGroupState* pState,
+                            unsigned int sampleRate) const;
+
+  private:
+    QString debugString() const {
+        return getId();
+    }
+
+    EngineEffectParameter* m_pLevelParameter;
+    QSharedPointer<ConvolutionReverbLoader> m_pLoader;
+
+    DISALLOW_COPY_AND_ASSIGN(ConvolutionReverbEffect);
+};
+
+#endif /* CONVOLUTIONREVERBEFFECT_H */
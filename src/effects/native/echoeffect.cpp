@@ -108,9 +108,9 @@ void EchoEffect::processChannel(const ChannelHandle& handle, EchoGroupState* pGr
     DEBUG_ASSERT(0 == (numSamples % CHANNEL_COUNT));
     EchoGroupState& gs = *pGroupState;
     double delay_time = m_pDelayParameter->value();
-    double send_amount = m_pSendParameter->value();
-    double feedback_amount = m_pFeedbackParameter->value();
-    double pingpong_frac = m_pPingPongParameter->value();
+    gs.send_amount.setTarget(m_pSendParameter->value(), sampleRate);
+    gs.feedback_amount.setTarget(m_pFeedbackParameter->value(), sampleRate);
+    gs.pingpong_frac.setTarget(m_pPingPongParameter->value(), sampleRate);
 
     // TODO(owilliams): get actual sample rate from somewhere.
 
@@ -134,6 +134,8 @@ void EchoEffect::processChannel(const ChannelHandle& handle, EchoGroupState* pGr
 
     // Feedback the delay buffer and then add the new input.
     for (unsigned int i = 0; i < numSamples; i += CHANNEL_COUNT) {
+        const CSAMPLE send_amount = gs.send_amount.next();
+        const CSAMPLE feedback_amount = gs.feedback_amount.next();
         // Ramp the beginning and end of the delay buffer to prevent clicks.
         double write_ramper = 1.0;
         if (gs.write_position < RAMP_LENGTH) {
@@ -157,6 +159,7 @@ void EchoEffect::processChannel(const ChannelHandle& handle, EchoGroupState* pGr
     // Pingpong the output.  If the pingpong value is zero, all of the
     // math below should result in a simple copy of delay buf to pOutput.
     for (unsigned int i = 0; i < numSamples; i += CHANNEL_COUNT) {
+        const CSAMPLE pingpong_frac = gs.pingpong_frac.next();
         if (gs.ping_pong_left) {
             // Left sample plus a fraction of the right sample, normalized
             // by 1 + fraction.
@@ -186,3 +189,11 @@ void EchoEffect::processChannel(const ChannelHandle& handle, EchoGroupState* pGr
         }
     }
 }
+
+unsigned int EchoEffect::tailFrames(const EchoGroupState* pState,
+                                    unsigned int sampleRate) const {
+    Q_UNUSED(sampleRate);
+    // Once the output was silent for a whole delay period, everything left in
+    // the delay buffer is below the silence threshold and only decays.
+    return pState->prev_delay_samples / CHANNEL_COUNT;
+}
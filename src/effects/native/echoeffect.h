@@ -8,6 +8,7 @@
 #include "util/types.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
+#include "effects/effectparametersmoother.h"
 #include "effects/effectprocessor.h"
 #include "sampleutil.h"
 
@@ -28,6 +29,9 @@ struct EchoGroupState {
     int prev_delay_samples;
     int write_position;
     bool ping_pong_left;
+    EffectParameterSmoother send_amount;
+    EffectParameterSmoother feedback_amount;
+    EffectParameterSmoother pingpong_frac;
 };
 
 class EchoEffect : public PerChannelEffectProcessor<EchoGroupState> {
@@ -47,6 +51,10 @@ class EchoEffect : public PerChannelEffectProcessor<EchoGroupState> {
                         const EffectProcessor::EnableState enableState,
                         const GroupFeatureState& groupFeatures);
 
+    // See effectprocessor.h
+    unsigned int tailFrames(const EchoGroupState* pState,
+                            unsigned int sampleRate) const;
+
   private:
     int getDelaySamples(double delay_time, const unsigned int sampleRate) const;
 
@@ -65,7 +65,12 @@ EffectManifest FilterEffect::getManifest() {
 FilterGroupState::FilterGroupState()
         : m_loFreq(kMaxCorner),
           m_q(0.707106781),
-          m_hiFreq(kMinCorner) {
+          m_hiFreq(kMinCorner),
+          m_loFreqSmoother(EffectParameterSmoother::EXPONENTIAL),
+          m_hiFreqSmoother(EffectParameterSmoother::EXPONENTIAL) {
+    m_loFreqSmoother.reset(m_loFreq);
+    m_qSmoother.reset(m_q);
+    m_hiFreqSmoother.reset(m_hiFreq);
     m_pBuf = SampleUtil::alloc(MAX_BUFFER_LEN);
     m_pLowFilter = new EngineFilterBiquad1Low(1, m_loFreq, m_q, true);
     m_pHighFilter = new EngineFilterBiquad1High(1, m_hiFreq, m_q, true);
@@ -98,20 +103,23 @@ void FilterEffect::processChannel(const ChannelHandle& handle,
                                   const GroupFeatureState& groupFeatures) {
     Q_UNUSED(handle);
     Q_UNUSED(groupFeatures);
-    Q_UNUSED(sampleRate);
-
-    double hpf;
-    double lpf;
-    double q = m_pQ->value();
 
     if (enableState == EffectProcessor::DISABLING) {
         // Ramp to dry, when disabling, this will ramp from dry when enabling as well
-        hpf = kMinCorner;
-        lpf = kMaxCorner;
+        pState->m_hiFreqSmoother.reset(kMinCorner);
+        pState->m_loFreqSmoother.reset(kMaxCorner);
     } else {
-        hpf = m_pHPF->value();
-        lpf = m_pLPF->value();
+        pState->m_hiFreqSmoother.setTarget(m_pHPF->value(), sampleRate);
+        pState->m_loFreqSmoother.setTarget(m_pLPF->value(), sampleRate);
     }
+    pState->m_qSmoother.setTarget(m_pQ->value(), sampleRate);
+
+    // The filters ramp their coefficients over the buffer, so the corners
+    // only need to be smooth from buffer to buffer.
+    const int numFrames = numSamples / 2;
+    double hpf = pState->m_hiFreqSmoother.advance(numFrames);
+    double lpf = pState->m_loFreqSmoother.advance(numFrames);
+    double q = pState->m_qSmoother.advance(numFrames);
 
     if ((pState->m_loFreq != lpf) ||
             (pState->m_q != q) ||
@@ -2,6 +2,7 @@
 #define FILTEREFFECT_H
 
 #include "effects/effect.h"
+#include "effects/effectparametersmoother.h"
 #include "effects/effectprocessor.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
@@ -26,6 +27,10 @@ struct FilterGroupState {
     double m_q;
     double m_hiFreq;
 
+    EffectParameterSmoother m_loFreqSmoother;
+    EffectParameterSmoother m_qSmoother;
+    EffectParameterSmoother m_hiFreqSmoother;
+
 };
 
 class FilterEffect : public PerChannelEffectProcessor<FilterGroupState> {
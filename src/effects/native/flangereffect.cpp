@@ -83,9 +83,8 @@ void FlangerEffect::processChannel(const ChannelHandle& handle,
     Q_UNUSED(handle);
     Q_UNUSED(enableState);
     Q_UNUSED(groupFeatures);
-    Q_UNUSED(sampleRate);
-    CSAMPLE lfoPeriod = m_pPeriodParameter->value();
-    CSAMPLE lfoDepth = m_pDepthParameter->value();
+    pState->period.setTarget(m_pPeriodParameter->value(), sampleRate);
+    pState->depth.setTarget(m_pDepthParameter->value(), sampleRate);
     // Unused in EngineFlanger
     // CSAMPLE lfoDelay = m_pDelayParameter ?
     //         m_pDelayParameter->value().toDouble() : 0.0f;
@@ -100,6 +99,9 @@ void FlangerEffect::processChannel(const ChannelHandle& handle,
 
     const int kChannels = 2;
     for (unsigned int i = 0; i < numSamples; i += kChannels) {
+        const CSAMPLE lfoPeriod = pState->period.next();
+        const CSAMPLE lfoDepth = pState->depth.next();
+
         delayLeft[pState->delayPos] = pInput[i];
         delayRight[pState->delayPos] = pInput[i+1];
 
@@ -8,13 +8,15 @@
 #include "util/types.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
+#include "effects/effectparametersmoother.h"
 #include "effects/effectprocessor.h"
 #include "sampleutil.h"
 
 struct FlangerGroupState {
     FlangerGroupState()
             : delayPos(0),
-              time(0) {
+              time(0),
+              period(EffectParameterSmoother::EXPONENTIAL) {
         SampleUtil::applyGain(delayLeft, 0, MAX_BUFFER_LEN);
         SampleUtil::applyGain(delayRight, 0, MAX_BUFFER_LEN);
     }
@@ -22,6 +24,8 @@ struct FlangerGroupState {
     CSAMPLE delayLeft[MAX_BUFFER_LEN];
     unsigned int delayPos;
     unsigned int time;
+    EffectParameterSmoother period;
+    EffectParameterSmoother depth;
 };
 
 class FlangerEffect : public PerChannelEffectProcessor<FlangerGroupState> {
@@ -22,6 +22,9 @@ EffectManifest MoogLadder4FilterEffect::getManifest() {
             "A 4-pole Moog ladder filter, based on Antti Houvilainen's non linear digital implementation"));
     manifest.setEffectRampsFromDry(true);
     manifest.setIsForFilterKnob(true);
+    // The saturation of the ladder creates harmonics above the Nyquist
+    // frequency.
+    manifest.setOversampling(2);
 
     EffectManifestParameter* lpf = manifest.addParameter();
     lpf->setId("lpf");
@@ -67,7 +70,12 @@ MoogLadder4FilterGroupState::MoogLadder4FilterGroupState()
         : m_loFreq(kMaxCorner),
           m_resonance(0),
           m_hiFreq(kMinCorner),
-          m_samplerate(kStartupSamplerate) {
+          m_samplerate(kStartupSamplerate),
+          m_loFreqSmoother(EffectParameterSmoother::EXPONENTIAL),
+          m_hiFreqSmoother(EffectParameterSmoother::EXPONENTIAL) {
+    m_loFreqSmoother.reset(m_loFreq);
+    m_resonanceSmoother.reset(m_resonance);
+    m_hiFreqSmoother.reset(m_hiFreq);
     m_pBuf = SampleUtil::alloc(MAX_BUFFER_LEN);
     m_pLowFilter = new EngineFilterMoogLadder4Low(
             kStartupSamplerate, m_loFreq * kStartupSamplerate, m_resonance);
@@ -85,8 +93,8 @@ MoogLadder4FilterEffect::MoogLadder4FilterEffect(EngineEffect* pEffect,
                            const EffectManifest& manifest)
         : m_pLPF(pEffect->getParameterById("lpf")),
           m_pResonance(pEffect->getParameterById("resonance")),
-          m_pHPF(pEffect->getParameterById("hpf")) {
-    Q_UNUSED(manifest);
+          m_pHPF(pEffect->getParameterById("hpf")),
+          m_oversampling(manifest.oversampling()) {
 }
 
 MoogLadder4FilterEffect::~MoogLadder4FilterEffect() {
@@ -103,33 +111,38 @@ void MoogLadder4FilterEffect::processChannel(
         const GroupFeatureState& groupFeatures) {
     Q_UNUSED(handle);
     Q_UNUSED(groupFeatures);
-    Q_UNUSED(sampleRate);
 
-
-    double resonance = m_pResonance->value();
-    double hpf;
-    double lpf;
     if (enableState == EffectProcessor::DISABLING) {
         // Ramp to dry, when disabling, this will ramp from dry when enabling as well
-        hpf = kMinCorner;
-        lpf = kMaxCorner;
+        pState->m_hiFreqSmoother.reset(kMinCorner);
+        pState->m_loFreqSmoother.reset(kMaxCorner);
     } else {
-        hpf = m_pHPF->value();
-        lpf = m_pLPF->value();
+        pState->m_hiFreqSmoother.setTarget(m_pHPF->value(), sampleRate);
+        pState->m_loFreqSmoother.setTarget(m_pLPF->value(), sampleRate);
     }
+    pState->m_resonanceSmoother.setTarget(m_pResonance->value(), sampleRate);
+
+    // The parameters are set once per buffer, the smoothers spread a change
+    // over the following buffers.
+    const int numFrames = numSamples / 2;
+    double resonance = pState->m_resonanceSmoother.advance(numFrames);
+    double hpf = pState->m_hiFreqSmoother.advance(numFrames);
+    double lpf = pState->m_loFreqSmoother.advance(numFrames);
 
+    // The corners are relative to the rate before oversampling.
+    const double cornerRate = static_cast<double>(sampleRate) / m_oversampling;
     if (pState->m_loFreq != lpf ||
             pState->m_resonance != resonance ||
             pState->m_samplerate != sampleRate) {
         pState->m_pLowFilter->setParameter(
-                sampleRate, lpf * sampleRate, resonance);
+                sampleRate, lpf * cornerRate, resonance);
     }
 
     if (pState->m_hiFreq != hpf ||
             pState->m_resonance != resonance ||
             pState->m_samplerate != sampleRate) {
         pState->m_pHighFilter->setParameter(
-                sampleRate, hpf * sampleRate, resonance);
+                sampleRate, hpf * cornerRate, resonance);
     }
 
     const CSAMPLE* pLpfInput = pState->m_pBuf;
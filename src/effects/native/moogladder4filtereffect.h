@@ -2,6 +2,7 @@
 #define MOOGLADDER4FILTEREFFECT_H
 
 #include "effects/effect.h"
+#include "effects/effectparametersmoother.h"
 #include "effects/effectprocessor.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
@@ -27,6 +28,10 @@ struct MoogLadder4FilterGroupState {
     double m_hiFreq;
     double m_samplerate;
 
+    EffectParameterSmoother m_loFreqSmoother;
+    EffectParameterSmoother m_resonanceSmoother;
+    EffectParameterSmoother m_hiFreqSmoother;
+
 };
 
 class MoogLadder4FilterEffect : public PerChannelEffectProcessor<MoogLadder4FilterGroupState> {
@@ -54,6 +59,7 @@ class MoogLadder4FilterEffect : public PerChannelEffectProcessor<MoogLadder4Filt
     EngineEffectParameter* m_pLPF;
     EngineEffectParameter* m_pResonance;
     EngineEffectParameter* m_pHPF;
+    const int m_oversampling;
 
     DISALLOW_COPY_AND_ASSIGN(MoogLadder4FilterEffect);
 };
@@ -15,6 +15,7 @@
 #include "effects/native/echoeffect.h"
 #include "effects/native/autopaneffect.h"
 #include "effects/native/phasereffect.h"
+#include "effects/native/convolutionreverbeffect.h"
 
 NativeBackend::NativeBackend(QObject* pParent)
         : EffectsBackend(pParent, tr("Native")) {
@@ -37,6 +38,7 @@ NativeBackend::NativeBackend(QObject* pParent)
     registerEffect<ReverbEffect>();
 #endif
     registerEffect<PhaserEffect>();
+    registerEffect<ConvolutionReverbEffect>();
 }
 
 NativeBackend::~NativeBackend() {
@@ -115,12 +115,11 @@ void PhaserEffect::processChannel(const ChannelHandle& handle,
     Q_UNUSED(handle);
     Q_UNUSED(enableState);
     Q_UNUSED(groupFeatures);
-    Q_UNUSED(sampleRate);
 
-    CSAMPLE frequency = m_pLFOFrequencyParameter->value();
-    CSAMPLE depth = m_pDepthParameter->value();
-    CSAMPLE feedback = m_pFeedbackParameter->value();
-    CSAMPLE range = m_pRangeParameter->value();
+    pState->frequency.setTarget(m_pLFOFrequencyParameter->value(), sampleRate);
+    pState->depth.setTarget(m_pDepthParameter->value(), sampleRate);
+    pState->feedback.setTarget(m_pFeedbackParameter->value(), sampleRate);
+    pState->range.setTarget(m_pRangeParameter->value(), sampleRate);
     int stages = 2 * m_pStagesParameter->value();
 
     CSAMPLE* oldInLeft = pState->oldInLeft;
@@ -133,13 +132,18 @@ void PhaserEffect::processChannel(const ChannelHandle& handle,
     CSAMPLE filterCoefRight = 0;
 
     CSAMPLE left = 0, right = 0;
-    CSAMPLE freqSkip = frequency * 2.0 * M_PI / sampleRate;
+    const CSAMPLE radiansPerHz = 2.0 * M_PI / sampleRate;
 
     int stereoCheck = m_pStereoParameter->value();
     int counter = 0;
 
     const int kChannels = 2;
     for (unsigned int i = 0; i < numSamples; i += kChannels) {
+        const CSAMPLE freqSkip = pState->frequency.next() * radiansPerHz;
+        const CSAMPLE depth = pState->depth.next();
+        const CSAMPLE feedback = pState->feedback.next();
+        const CSAMPLE range = pState->range.next();
+
         left = pInput[i] + tanh(left * feedback); 
         right = pInput[i + 1] + tanh(right * feedback);
 
@@ -6,6 +6,7 @@
 #include "util/types.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectparameter.h"
+#include "effects/effectparametersmoother.h"
 #include "effects/effectprocessor.h"
 #include "sampleutil.h"
 #include <QDebug>
@@ -27,6 +28,10 @@ struct PhaserGroupState {
     CSAMPLE oldOutRight[MAXSTAGES];
     CSAMPLE leftPhase;
     CSAMPLE rightPhase;
+    EffectParameterSmoother frequency;
+    EffectParameterSmoother depth;
+    EffectParameterSmoother feedback;
+    EffectParameterSmoother range;
 };
 
 class PhaserEffect : public PerChannelEffectProcessor<PhaserGroupState> {
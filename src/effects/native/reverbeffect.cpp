@@ -116,3 +116,10 @@ void ReverbEffect::processChannel(const ChannelHandle& handle,
                 pOutput, pOutput, pState->crossfade_buffer, numSamples);
     }
 }
+
+unsigned int ReverbEffect::tailFrames(const ReverbGroupState* pState,
+                                      unsigned int sampleRate) const {
+    Q_UNUSED(pState);
+    // A round trip through the tank of the plate takes about 0.75 s.
+    return sampleRate;
+}
@@ -53,6 +53,10 @@ class ReverbEffect : public PerChannelEffectProcessor<ReverbGroupState> {
                         const EffectProcessor::EnableState enableState,
                         const GroupFeatureState& groupFeatures);
 
+    // See effectprocessor.h
+    unsigned int tailFrames(const ReverbGroupState* pState,
+                            unsigned int sampleRate) const;
+
   private:
     QString debugString() const {
         return getId();
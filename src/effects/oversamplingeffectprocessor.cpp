@@ -0,0 +1,135 @@
+#include "effects/oversamplingeffectprocessor.h"
+
+#include "sampleutil.h"
+#include "util/assert.h"
+#include "util/math.h"
+#include "util/timer.h"
+
+// A buffer of 1024 frames covers the callbacks of usual latencies in one go.
+const unsigned int OversamplingEffectProcessor::kBlockFrames = 1024;
+
+OversamplingEffectProcessor::ChannelState::ChannelState(
+        int factor, EffectChannelState* pInnerState)
+        : oversampler(factor),
+          pBuffer(SampleUtil::alloc(kBlockFrames * factor * 2)),
+          pInnerState(pInnerState) {
+}
+
+OversamplingEffectProcessor::ChannelState::~ChannelState() {
+    SampleUtil::free(pBuffer);
+    delete pInnerState;
+}
+
+OversamplingEffectProcessor::OversamplingEffectProcessor(
+        EffectProcessor* pProcessor, int factor, const QString& effectId)
+        : m_pProcessor(pProcessor),
+          m_factor(factor),
+          m_statArg(QString("%1_%2x").arg(effectId).arg(factor)) {
+}
+
+OversamplingEffectProcessor::~OversamplingEffectProcessor() {
+    for (ChannelHandleMap<ChannelStateHolder>::iterator it =
+                 m_channelState.begin();
+         it != m_channelState.end(); ++it) {
+        ChannelState* pState = it->pState;
+        delete pState;
+    }
+    m_channelState.clear();
+    delete m_pProcessor;
+}
+
+void OversamplingEffectProcessor::initialize(
+        const QSet<ChannelHandleAndGroup>& registeredChannels) {
+    // The channel states of the wrapped processor are part of ours, so it is
+    // initialized without channels.
+    m_pProcessor->initialize(QSet<ChannelHandleAndGroup>());
+    foreach (const ChannelHandleAndGroup& channel, registeredChannels) {
+        EffectChannelState* pState = createChannelState();
+        if (!loadChannelState(channel.handle(), pState)) {
+            delete pState;
+        }
+    }
+}
+
+EffectChannelState* OversamplingEffectProcessor::createChannelState() const {
+    return new ChannelState(m_factor, m_pProcessor->createChannelState());
+}
+
+bool OversamplingEffectProcessor::loadChannelState(
+        const ChannelHandle& handle, EffectChannelState* pState) {
+    ChannelStateHolder& holder = m_channelState[handle];
+    if (holder.pState != NULL || pState == NULL) {
+        return false;
+    }
+    ChannelState* pChannel = static_cast<ChannelState*>(pState);
+    if (pChannel->pInnerState != NULL &&
+            m_pProcessor->loadChannelState(handle, pChannel->pInnerState)) {
+        pChannel->pInnerState = NULL;
+    }
+    holder.pState = pChannel;
+    return true;
+}
+
+void OversamplingEffectProcessor::process(
+        const ChannelHandle& handle,
+        const CSAMPLE* pInput, CSAMPLE* pOutput,
+        const unsigned int numSamples,
+        const unsigned int sampleRate,
+        const EffectProcessor::EnableState enableState,
+        const GroupFeatureState& groupFeatures) {
+    ScopedTimer t("OversamplingEffectProcessor::process_%1", m_statArg);
+    ChannelState* pChannel = channelState(handle);
+    if (pChannel == NULL) {
+        // Never allocate in the engine thread, see PerChannelEffectProcessor.
+        if (pInput != pOutput) {
+            SampleUtil::copy(pOutput, pInput, numSamples);
+        }
+        return;
+    }
+
+    // A sleeping processor only clears its output, see
+    // PerChannelEffectProcessor::process(). It keeps sleeping as long as the
+    // input is silent, so there is nothing to resample.
+    if (groupFeatures.has_silence && groupFeatures.silence &&
+            enableState == EffectProcessor::ENABLED &&
+            m_pProcessor->isSleeping(handle)) {
+        SampleUtil::clear(pOutput, numSamples);
+        return;
+    }
+
+    if (enableState == EffectProcessor::ENABLING) {
+        // Drop what is left of the last time the effect was enabled.
+        pChannel->oversampler.reset();
+    }
+
+    // Lengths in frames have to be scaled to the raised rate.
+    GroupFeatureState features = groupFeatures;
+    features.beat_length *= m_factor;
+
+    const unsigned int numFrames = numSamples / 2;
+    for (unsigned int frame = 0; frame < numFrames; frame += kBlockFrames) {
+        const unsigned int frames = math_min(kBlockFrames, numFrames - frame);
+        // Ramp in the first and out in the last block only.
+        EffectProcessor::EnableState blockState = enableState;
+        if ((enableState == EffectProcessor::ENABLING && frame > 0) ||
+                (enableState == EffectProcessor::DISABLING &&
+                 frame + frames < numFrames)) {
+            blockState = EffectProcessor::ENABLED;
+        }
+        pChannel->oversampler.upsample(pInput + frame * 2, pChannel->pBuffer,
+                                       frames);
+        m_pProcessor->process(handle, pChannel->pBuffer, pChannel->pBuffer,
+                              frames * m_factor * 2, sampleRate * m_factor,
+                              blockState, features);
+        pChannel->oversampler.downsample(pChannel->pBuffer, pOutput + frame * 2,
+                                         frames);
+    }
+}
+
+OversamplingEffectProcessor::ChannelState*
+OversamplingEffectProcessor::channelState(const ChannelHandle& handle) const {
+    ChannelState* pState = m_channelState.contains(handle) ?
+            m_channelState.at(handle).pState : NULL;
+    DEBUG_ASSERT(pState != NULL);
+    return pState;
+}
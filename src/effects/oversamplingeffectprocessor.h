@@ -0,0 +1,82 @@
+#ifndef OVERSAMPLINGEFFECTPROCESSOR_H
+#define OVERSAMPLINGEFFECTPROCESSOR_H
+
+#include <QString>
+
+#include "effects/effectprocessor.h"
+#include "engine/channelhandle.h"
+#include "engine/engineoversampler.h"
+#include "util.h"
+
+// Runs another EffectProcessor at a multiple of the sample rate. The input of
+// each channel is upsampled into a buffer of the channel state, the wrapped
+// processor processes that buffer in place and the result is downsampled into
+// the output. The wrapped processor sees the raised sample rate, so effects
+// whose parameters are relative to the sample rate have to take the factor
+// into account, see EffectManifest::oversampling().
+//
+// The EngineEffect installs this for effects whose manifest asks for it. The
+// time it takes, including the wrapped processor, is reported to the
+// StatsManager in developer mode.
+class OversamplingEffectProcessor : public EffectProcessor {
+    struct ChannelState : public EffectChannelState {
+        ChannelState(int factor, EffectChannelState* pInnerState);
+        virtual ~ChannelState();
+        EngineOversampler oversampler;
+        // kBlockFrames at the raised rate
+        CSAMPLE* pBuffer;
+        // Owned until the state is handed to the wrapped processor
+        EffectChannelState* pInnerState;
+    };
+    struct ChannelStateHolder {
+        ChannelStateHolder() : pState(NULL) { }
+        ChannelState* pState;
+    };
+
+  public:
+    // Takes ownership of pProcessor. effectId names the stat.
+    OversamplingEffectProcessor(EffectProcessor* pProcessor, int factor,
+                                const QString& effectId);
+    virtual ~OversamplingEffectProcessor();
+
+    // See effectprocessor.h
+    void initialize(const QSet<ChannelHandleAndGroup>& registeredChannels);
+
+    // See effectprocessor.h
+    EffectChannelState* createChannelState() const;
+
+    // See effectprocessor.h
+    bool loadChannelState(const ChannelHandle& handle,
+                          EffectChannelState* pState);
+
+    // See effectprocessor.h
+    void process(const ChannelHandle& handle,
+                 const CSAMPLE* pInput, CSAMPLE* pOutput,
+                 const unsigned int numSamples,
+                 const unsigned int sampleRate,
+                 const enum EnableState enableState,
+                 const GroupFeatureState& groupFeatures);
+
+    // See effectprocessor.h
+    bool isSleeping(const ChannelHandle& handle) const {
+        return m_pProcessor->isSleeping(handle);
+    }
+
+  private:
+    // The number of frames at the original rate that are oversampled at once.
+    // Longer buffers are processed in blocks of this length.
+    static const unsigned int kBlockFrames;
+
+    // Returns NULL for channels that were never registered with the
+    // EffectsManager.
+    ChannelState* channelState(const ChannelHandle& handle) const;
+
+    EffectProcessor* m_pProcessor;
+    const int m_factor;
+    const QString m_statArg;
+    ChannelHandleMap<ChannelStateHolder> m_channelState;
+
+    DISALLOW_COPY_AND_ASSIGN(OversamplingEffectProcessor);
+};
+
+#endif /* OVERSAMPLINGEFFECTPROCESSOR_H */
@@ -0,0 +1,289 @@
+#include "engine/callbackprofiler.h"
+
+#include <cstring>
+
+#include <QMutexLocker>
+#include <QtDebug>
+
+#include "util/cmdlineargs.h"
+#include "util/math.h"
+#include "util/stat.h"
+#include "util/timer.h"
+
+namespace {
+
+// Enough for a quarter of a second of 1 ms callbacks between two calls to
+// collect().
+const int kProfileFifoSize = 1024;
+
+QString formatMillis(qint64 nanos) {
+    return QString::number(nanos / 1000000.0, 'f', 3) + " ms";
+}
+
+QString formatPercent(qint64 nanos, qint64 deadlineNanos) {
+    if (deadlineNanos <= 0) {
+        return "-";
+    }
+    return QString::number(100.0 * nanos / deadlineNanos, 'f', 1) + "%";
+}
+
+} // anonymous namespace
+
+// static
+QMutex CallbackProfiler::s_effectChainMutex;
+// static
+QStringList CallbackProfiler::s_effectChainNames;
+
+// static
+const char* CallbackProfile::stageName(Stage stage) {
+    switch (stage) {
+        case STAGE_EFFECTS_REQUESTS:
+            return "effects requests";
+        case STAGE_SYNC:
+            return "sync";
+        case STAGE_CHANNELS:
+            return "channels";
+        case STAGE_HEADPHONE_MIX:
+            return "headphone mix";
+        case STAGE_TALKOVER_MIX:
+            return "talkover mix";
+        case STAGE_BUS_MIX:
+            return "bus mix";
+        case STAGE_BUS_EFFECTS:
+            return "bus effects";
+        case STAGE_MASTER_EFFECTS:
+            return "master effects";
+        case STAGE_MASTER_OUTPUT:
+            return "master output";
+        case STAGE_SIDECHAIN:
+            return "sidechain";
+        case STAGE_VUMETER:
+            return "vu meter";
+        case STAGE_HEADPHONE_OUTPUT:
+            return "headphone output";
+        case STAGE_DELAY:
+            return "delay";
+        default:
+            return "unknown";
+    }
+}
+
+CallbackProfiler::CallbackProfiler()
+        : m_callbackNumber(0),
+          m_profiles(kProfileFifoSize),
+          m_channelNames(kCallbackProfilerMaxChannels),
+          m_callbackCount(0),
+          m_droppedCount(0),
+          m_bHavePrevious(false) {
+    memset(&m_current, 0, sizeof(m_current));
+    memset(&m_previous, 0, sizeof(m_previous));
+    memset(m_histogram, 0, sizeof(m_histogram));
+    for (int i = 0; i < CallbackProfile::STAGE_COUNT; ++i) {
+        m_stageStatKeys.append(QString("EngineMaster::process %1").arg(
+                CallbackProfile::stageName(
+                        static_cast<CallbackProfile::Stage>(i))));
+    }
+}
+
+CallbackProfiler::~CallbackProfiler() {
+}
+
+void CallbackProfiler::beginCallback(int framesPerBuffer, int sampleRate) {
+    m_callbackTimer.start();
+    m_lapTimer.start();
+    memset(&m_current, 0, sizeof(m_current));
+    m_current.callbackNumber = m_callbackNumber++;
+    m_current.framesPerBuffer = framesPerBuffer;
+    m_current.deadlineNanos = sampleRate > 0 ?
+            static_cast<qint64>(framesPerBuffer) * 1000000000LL / sampleRate : 0;
+    m_current.xrunBefore = m_xrunPending.fetchAndStoreRelaxed(0) != 0;
+}
+
+void CallbackProfiler::endCallback() {
+    m_current.callbackNanos = m_callbackTimer.elapsed();
+    for (int i = 0; i < kCallbackProfilerMaxEffectChains; ++i) {
+        m_current.effectChainNanos[i] =
+                m_effectChainNanos[i].fetchAndStoreRelaxed(0);
+    }
+    if (m_profiles.write(&m_current, 1) != 1) {
+        m_droppedProfiles.fetchAndAddRelaxed(1);
+    }
+}
+
+void CallbackProfiler::reportXrun() {
+    m_xrunPending.fetchAndStoreRelaxed(1);
+}
+
+void CallbackProfiler::setChannelName(int channelIndex, const QString& name) {
+    if (channelIndex < 0 || channelIndex >= kCallbackProfilerMaxChannels) {
+        return;
+    }
+    QMutexLocker locker(&m_mutex);
+    m_channelNames[channelIndex] = name;
+}
+
+// static
+int CallbackProfiler::effectChainSlot(const QString& name) {
+    QMutexLocker locker(&s_effectChainMutex);
+    int slot = s_effectChainNames.indexOf(name);
+    if (slot < 0 && s_effectChainNames.size() < kCallbackProfilerMaxEffectChains) {
+        s_effectChainNames.append(name);
+        slot = s_effectChainNames.size() - 1;
+    }
+    return slot;
+}
+
+void CallbackProfiler::collect() {
+    QMutexLocker locker(&m_mutex);
+    collectLocked();
+}
+
+void CallbackProfiler::collectLocked() {
+    const bool trackStats = CmdlineArgs::Instance().getDeveloper();
+    CallbackProfile profile;
+    while (m_profiles.read(&profile, 1) == 1) {
+        addToStatistics(profile);
+        if (trackStats) {
+            reportStats(profile);
+        }
+    }
+    m_droppedCount += m_droppedProfiles.fetchAndStoreRelaxed(0);
+}
+
+void CallbackProfiler::addToStatistics(const CallbackProfile& profile) {
+    ++m_callbackCount;
+
+    int bucket = kHistogramBuckets - 1;
+    if (profile.deadlineNanos > 0) {
+        bucket = static_cast<int>(
+                profile.callbackNanos * 10 / profile.deadlineNanos);
+    }
+    ++m_histogram[math_min(bucket, kHistogramBuckets - 1)];
+
+    if (m_slowest.size() < kKeptCallbacks ||
+            profile.callbackNanos > m_slowest.last().callbackNanos) {
+        int i = 0;
+        while (i < m_slowest.size() &&
+                m_slowest[i].callbackNanos >= profile.callbackNanos) {
+            ++i;
+        }
+        m_slowest.insert(i, profile);
+        if (m_slowest.size() > kKeptCallbacks) {
+            m_slowest.removeLast();
+        }
+    }
+
+    // The xrun is noticed at the start of the callback after the one that was
+    // too slow. If the previous profile was dropped, there is nothing to
+    // blame.
+    if (profile.xrunBefore && m_bHavePrevious &&
+            m_previous.callbackNumber + 1 == profile.callbackNumber) {
+        m_xruns.append(m_previous);
+        if (m_xruns.size() > kKeptCallbacks) {
+            m_xruns.removeFirst();
+        }
+    }
+    m_previous = profile;
+    m_bHavePrevious = true;
+}
+
+void CallbackProfiler::reportStats(const CallbackProfile& profile) {
+    for (int i = 0; i < CallbackProfile::STAGE_COUNT; ++i) {
+        Stat::track(m_stageStatKeys[i], Stat::DURATION_NANOSEC,
+                    kDefaultComputeFlags, profile.stageNanos[i]);
+    }
+    if (profile.deadlineNanos > 0) {
+        Stat::track("EngineMaster::process deadline usage",
+                    Stat::UNSPECIFIED, kDefaultComputeFlags,
+                    static_cast<double>(profile.callbackNanos) /
+                    profile.deadlineNanos);
+    }
+}
+
+quint64 CallbackProfiler::lateCallbackCount() const {
+    quint64 late = 0;
+    for (int i = 10; i < kHistogramBuckets; ++i) {
+        late += m_histogram[i];
+    }
+    return late;
+}
+
+QString CallbackProfiler::report() {
+    QMutexLocker locker(&m_mutex);
+    collectLocked();
+
+    QStringList lines;
+    lines << QString("Engine callbacks: %1, over deadline: %2, "
+                     "profiles dropped: %3")
+            .arg(m_callbackCount).arg(lateCallbackCount()).arg(m_droppedCount);
+
+    lines << "Callback time relative to the deadline:";
+    for (int i = 0; i < kHistogramBuckets; ++i) {
+        if (m_histogram[i] == 0) {
+            continue;
+        }
+        QString range = i < kHistogramBuckets - 1 ?
+                QString("%1-%2%").arg(i * 10, 3).arg((i + 1) * 10, 3) :
+                QString(">= %1%").arg(i * 10);
+        lines << QString("  %1: %2").arg(range, -10).arg(m_histogram[i]);
+    }
+
+    lines << QString("The %1 slowest callbacks:").arg(m_slowest.size());
+    foreach (const CallbackProfile& profile, m_slowest) {
+        appendProfile(&lines, profile);
+    }
+
+    lines << QString("The last %1 callbacks before an xrun:").arg(m_xruns.size());
+    foreach (const CallbackProfile& profile, m_xruns) {
+        appendProfile(&lines, profile);
+    }
+    return lines.join("\n");
+}
+
+void CallbackProfiler::appendProfile(QStringList* pLines,
+                                     const CallbackProfile& profile) const {
+    pLines->append(QString("  #%1: %2 of %3 (%4), %5 frames")
+            .arg(profile.callbackNumber)
+            .arg(formatMillis(profile.callbackNanos),
+                 formatMillis(profile.deadlineNanos),
+                 formatPercent(profile.callbackNanos, profile.deadlineNanos))
+            .arg(profile.framesPerBuffer));
+    for (int i = 0; i < CallbackProfile::STAGE_COUNT; ++i) {
+        if (profile.stageNanos[i] == 0) {
+            continue;
+        }
+        pLines->append(QString("    %1 %2 (%3)")
+                .arg(CallbackProfile::stageName(
+                        static_cast<CallbackProfile::Stage>(i)), -18)
+                .arg(formatMillis(profile.stageNanos[i]),
+                     formatPercent(profile.stageNanos[i], profile.deadlineNanos)));
+    }
+    for (int i = 0; i < kCallbackProfilerMaxChannels; ++i) {
+        if (profile.channelNanos[i] == 0) {
+            continue;
+        }
+        const QString name = m_channelNames[i].isEmpty() ?
+                QString("channel %1").arg(i) : m_channelNames[i];
+        pLines->append(QString("      %1 %2")
+                .arg(name, -16).arg(formatMillis(profile.channelNanos[i])));
+    }
+    QMutexLocker locker(&s_effectChainMutex);
+    for (int i = 0; i < s_effectChainNames.size(); ++i) {
+        if (profile.effectChainNanos[i] == 0) {
+            continue;
+        }
+        pLines->append(QString("      %1 %2")
+                .arg(s_effectChainNames[i], -16)
+                .arg(formatMillis(profile.effectChainNanos[i])));
+    }
+}
+
+void CallbackProfiler::reset() {
+    QMutexLocker locker(&m_mutex);
+    collectLocked();
+    m_callbackCount = 0;
+    m_droppedCount = 0;
+    memset(m_histogram, 0, sizeof(m_histogram));
+    m_slowest.clear();
+    m_xruns.clear();
+}
@@ -0,0 +1,181 @@
+#ifndef CALLBACKPROFILER_H
+#define CALLBACKPROFILER_H
+
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "util.h"
+#include "util/fifo.h"
+#include "util/performancetimer.h"
+
+// The number of channels and effect chains whose processing time is recorded
+// individually. Channels and chains beyond these are only accounted for in the
+// stage that processes them.
+const int kCallbackProfilerMaxChannels = 64;
+const int kCallbackProfilerMaxEffectChains = 64;
+
+// The processing time of each stage of one EngineMaster::process call.
+struct CallbackProfile {
+    // The sequential stages of EngineMaster::process. Effect chain times are
+    // included in the stage (or channel) that processed the chain.
+    enum Stage {
+        STAGE_EFFECTS_REQUESTS = 0,
+        STAGE_SYNC,
+        STAGE_CHANNELS,
+        STAGE_HEADPHONE_MIX,
+        STAGE_TALKOVER_MIX,
+        STAGE_BUS_MIX,
+        STAGE_BUS_EFFECTS,
+        STAGE_MASTER_EFFECTS,
+        STAGE_MASTER_OUTPUT,
+        STAGE_SIDECHAIN,
+        STAGE_VUMETER,
+        STAGE_HEADPHONE_OUTPUT,
+        STAGE_DELAY,
+        STAGE_COUNT
+    };
+
+    static const char* stageName(Stage stage);
+
+    quint32 callbackNumber;
+    int framesPerBuffer;
+    // An xrun was reported before this callback started, i.e. the previous
+    // callback (or the sound card) missed its deadline.
+    bool xrunBefore;
+    qint64 callbackNanos;
+    qint64 deadlineNanos;
+    qint32 stageNanos[STAGE_COUNT];
+    // Indexed by EngineMaster::ChannelInfo::m_index.
+    qint32 channelNanos[kCallbackProfilerMaxChannels];
+    // Indexed by CallbackProfiler::effectChainSlot.
+    qint32 effectChainNanos[kCallbackProfilerMaxEffectChains];
+};
+
+// CallbackProfiler records the time spent in each stage, channel and effect
+// chain of every engine callback and relates it to the callback's deadline
+// (the duration of the buffer it computes).
+//
+// The recording side is used by the engine threads. It neither locks nor
+// allocates: the profile of the running callback is filled in place and
+// written into a preallocated single-producer/single-consumer FIFO when the
+// callback ends. If the FIFO is full the profile is dropped and counted.
+//
+// collect() drains the FIFO from a non-realtime thread into a histogram of
+// callback time versus deadline, the slowest callbacks seen so far and the
+// callbacks that preceded an xrun. report() formats all of these with a
+// per-stage breakdown. In developer mode collect() also reports each stage to
+// the StatsManager.
+class CallbackProfiler {
+  public:
+    // The number of callbacks kept for the slowest and xrun lists.
+    static const int kKeptCallbacks = 8;
+    // The histogram has one bucket per 10% of the deadline. The last bucket
+    // holds all callbacks that took twice their deadline or longer.
+    static const int kHistogramBuckets = 21;
+
+    CallbackProfiler();
+    virtual ~CallbackProfiler();
+
+    // Real-time interface, called by the engine callback thread.
+
+    void beginCallback(int framesPerBuffer, int sampleRate);
+    // Adds the time since the previous lap or beginCallback to stage.
+    inline void lap(CallbackProfile::Stage stage) {
+        m_current.stageNanos[stage] += static_cast<qint32>(
+                m_lapTimer.restart());
+    }
+    void endCallback();
+
+    // May be called by any engine thread, but only by one thread per channel
+    // at a time.
+    inline void addChannelTime(int channelIndex, qint64 nanos) {
+        if (channelIndex >= 0 && channelIndex < kCallbackProfilerMaxChannels) {
+            m_current.channelNanos[channelIndex] += static_cast<qint32>(nanos);
+        }
+    }
+    // May be called by any engine thread concurrently.
+    inline void addEffectChainTime(int slot, qint64 nanos) {
+        if (slot >= 0 && slot < kCallbackProfilerMaxEffectChains) {
+            m_effectChainNanos[slot].fetchAndAddRelaxed(
+                    static_cast<int>(nanos));
+        }
+    }
+
+    // Marks the next callback as following an xrun. May be called from any
+    // thread.
+    void reportXrun();
+
+    // Non-real-time interface.
+
+    void setChannelName(int channelIndex, const QString& name);
+    // Returns the slot for the effect chain with the given name, registering
+    // the name if necessary, or -1 if all slots are taken. Chains with the
+    // same name share a slot. Shared by all CallbackProfilers.
+    static int effectChainSlot(const QString& name);
+
+    // Moves all recorded profiles into the statistics.
+    void collect();
+    // Collects and returns a human readable report of the statistics.
+    QString report();
+    // Collects and discards all statistics.
+    void reset();
+
+    // The statistics since the last reset. Call collect() first.
+    quint64 callbackCount() const {
+        return m_callbackCount;
+    }
+    quint64 lateCallbackCount() const;
+    quint64 histogramBucket(int bucket) const {
+        return m_histogram[bucket];
+    }
+    quint64 droppedProfileCount() const {
+        return m_droppedCount;
+    }
+    QList<CallbackProfile> slowestCallbacks() const {
+        return m_slowest;
+    }
+    QList<CallbackProfile> xrunCallbacks() const {
+        return m_xruns;
+    }
+
+  private:
+    void collectLocked();
+    void addToStatistics(const CallbackProfile& profile);
+    void reportStats(const CallbackProfile& profile);
+    void appendProfile(QStringList* pLines, const CallbackProfile& profile) const;
+
+    // Real-time state
+    CallbackProfile m_current;
+    PerformanceTimer m_callbackTimer;
+    PerformanceTimer m_lapTimer;
+    quint32 m_callbackNumber;
+    QAtomicInt m_effectChainNanos[kCallbackProfilerMaxEffectChains];
+    QAtomicInt m_xrunPending;
+    QAtomicInt m_droppedProfiles;
+    FIFO<CallbackProfile> m_profiles;
+
+    // Guards the statistics below. Never locked by a real-time thread.
+    QMutex m_mutex;
+    QVector<QString> m_channelNames;
+    quint64 m_callbackCount;
+    quint64 m_droppedCount;
+    quint64 m_histogram[kHistogramBuckets];
+    // Sorted by descending callbackNanos.
+    QList<CallbackProfile> m_slowest;
+    // The callbacks that were followed by an xrun, oldest first.
+    QList<CallbackProfile> m_xruns;
+    CallbackProfile m_previous;
+    bool m_bHavePrevious;
+    QVector<QString> m_stageStatKeys;
+
+    static QMutex s_effectChainMutex;
+    static QStringList s_effectChainNames;
+
+    DISALLOW_COPY_AND_ASSIGN(CallbackProfiler);
+};
+
+#endif /* CALLBACKPROFILER_H */
@@ -183,6 +183,13 @@ class ChannelHandleMap {
         return m_data[iHandle];
     }
 
+    // Whether an entry for handle exists, i.e. it was inserted or accessed
+    // with operator[] before. Unlike operator[] this never modifies the map, so
+    // it is safe to call concurrently with other readers.
+    bool contains(const ChannelHandle& handle) const {
+        return handle.valid() && handle.handle() < m_data.size();
+    }
+
     void clear() {
         m_data.clear();
     }
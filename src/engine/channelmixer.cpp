@@ -0,0 +1,76 @@
+#include "engine/channelmixer.h"
+#include "util/timer.h"
+#include "sampleutil.h"
+
+namespace {
+
+// Updates the gain cache of the channel and returns its new gain.
+inline CSAMPLE_GAIN updateGain(
+        const EngineMaster::GainCalculator& gainCalculator,
+        EngineMaster::ChannelInfo* pChannelInfo,
+        EngineMaster::GainCache* pGainCache) {
+    CSAMPLE_GAIN newGain;
+    if (pGainCache->m_fadeout) {
+        newGain = 0;
+        pGainCache->m_fadeout = false;
+    } else {
+        newGain = gainCalculator.getGain(pChannelInfo);
+    }
+    pGainCache->m_gain = newGain;
+    return newGain;
+}
+
+} // anonymous namespace
+
+// static
+void ChannelMixer::mixChannels(const EngineMaster::GainCalculator& gainCalculator,
+                               QVarLengthArray<EngineMaster::ChannelInfo*, kPreallocatedChannels>* activeChannels,
+                               QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache,
+                               CSAMPLE* pOutput,
+                               unsigned int iBufferSize) {
+    const int totalActive = activeChannels->size();
+    ScopedTimer t("EngineMaster::mixChannels_%1active", totalActive);
+    // Like activeChannels, these only allocate if there are more channels
+    // than preallocated.
+    QVarLengthArray<const CSAMPLE*, kPreallocatedChannels> buffers(totalActive);
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> newGain(totalActive);
+    for (int i = 0; i < totalActive; ++i) {
+        EngineMaster::ChannelInfo* pChannelInfo = activeChannels->at(i);
+        newGain[i] = updateGain(gainCalculator, pChannelInfo,
+                &(*channelGainCache)[pChannelInfo->m_index]);
+        buffers[i] = pChannelInfo->m_pBuffer;
+    }
+    SampleUtil::mixWithGain(pOutput, buffers.constData(), newGain.constData(),
+            totalActive, iBufferSize);
+}
+
+// static
+void ChannelMixer::mixChannelsRamping(const EngineMaster::GainCalculator& gainCalculator,
+                                      QVarLengthArray<EngineMaster::ChannelInfo*, kPreallocatedChannels>* activeChannels,
+                                      QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache,
+                                      CSAMPLE* pOutput,
+                                      unsigned int iBufferSize) {
+    const int totalActive = activeChannels->size();
+    ScopedTimer t("EngineMaster::mixChannelsRamping_%1active", totalActive);
+    QVarLengthArray<const CSAMPLE*, kPreallocatedChannels> buffers(totalActive);
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> oldGain(totalActive);
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> newGain(totalActive);
+    bool ramping = false;
+    for (int i = 0; i < totalActive; ++i) {
+        EngineMaster::ChannelInfo* pChannelInfo = activeChannels->at(i);
+        EngineMaster::GainCache& gainCache =
+                (*channelGainCache)[pChannelInfo->m_index];
+        oldGain[i] = gainCache.m_gain;
+        newGain[i] = updateGain(gainCalculator, pChannelInfo, &gainCache);
+        buffers[i] = pChannelInfo->m_pBuffer;
+        ramping = ramping || oldGain[i] != newGain[i];
+    }
+    if (ramping) {
+        SampleUtil::mixWithRampingGain(pOutput, buffers.constData(),
+                oldGain.constData(), newGain.constData(), totalActive,
+                iBufferSize);
+    } else {
+        SampleUtil::mixWithGain(pOutput, buffers.constData(),
+                newGain.constData(), totalActive, iBufferSize);
+    }
+}
@@ -6,6 +6,9 @@
 #include "util/types.h"
 #include "engine/enginemaster.h"
 
+// Mixes the active channels into an output buffer with the gains of the
+// GainCalculator. Any number of channels is mixed in a single pass with
+// SampleUtil::mixWithGain().
 class ChannelMixer {
   public:
     static void mixChannels(
@@ -14,6 +17,7 @@ class ChannelMixer {
         QVarLengthArray<EngineMaster::GainCache, kPreallocatedChannels>* channelGainCache,
         CSAMPLE* pOutput,
         unsigned int iBufferSize);
+    // Ramps from the cached gains of the previous callback to the new gains.
     static void mixChannelsRamping(
         const EngineMaster::GainCalculator& gainCalculator,
         QVarLengthArray<EngineMaster::ChannelInfo*, kPreallocatedChannels>* activeChannels,
@@ -581,7 +581,7 @@ void CueControl::hintReader(HintVector* pHintList) {
     if (cuePoint >= 0) {
         cue_hint.sample = m_pCuePoint->get();
         cue_hint.length = 0;
-        cue_hint.priority = 10;
+        cue_hint.priority = HINT_PRIORITY_SPECULATIVE;
         pHintList->append(cue_hint);
     }
 
@@ -597,7 +597,7 @@ void CueControl::hintReader(HintVector* pHintList) {
             if (cue_hint.sample % 2 != 0)
                 cue_hint.sample--;
             cue_hint.length = 0;
-            cue_hint.priority = 10;
+            cue_hint.priority = HINT_PRIORITY_SPECULATIVE;
             pHintList->append(cue_hint);
         }
     }
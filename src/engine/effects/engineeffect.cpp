@@ -1,4 +1,5 @@
 #include "engine/effects/engineeffect.h"
+#include "effects/oversamplingeffectprocessor.h"
 #include "sampleutil.h"
 
 
@@ -19,6 +20,10 @@ EngineEffect::EngineEffect(const EffectManifest& manifest,
 
     // Creating the processor must come last.
     m_pProcessor = pInstantiator->instantiate(this, manifest);
+    if (manifest.oversampling() > 1) {
+        m_pProcessor = new OversamplingEffectProcessor(
+                m_pProcessor, manifest.oversampling(), manifest.id());
+    }
     m_pProcessor->initialize(registeredChannels);
     m_effectRampsFromDry = manifest.effectRampsFromDry();
 }
@@ -81,6 +86,18 @@ bool EngineEffect::processEffectsRequest(const EffectsRequest& message,
             }
             pResponsePipe->writeMessages(&response, 1);
             return true;
+        case EffectsRequest::ADD_EFFECT_CHANNEL_STATE:
+            if (kEffectDebugOutput) {
+                qDebug() << debugString() << "ADD_EFFECT_CHANNEL_STATE"
+                         << "channel" << message.channel;
+            }
+            response.success = m_pProcessor->loadChannelState(
+                    message.channel, message.AddEffectChannelState.pState);
+            if (!response.success) {
+                response.status = EffectsResponse::INVALID_REQUEST;
+            }
+            pResponsePipe->writeMessages(&response, 1);
+            return true;
         default:
             break;
     }
@@ -118,7 +135,9 @@ void EngineEffect::process(const ChannelHandle& handle,
                     numSamples);
         }
     }
+}
 
+void EngineEffect::advanceEnableState() {
     if (m_enableState == EffectProcessor::DISABLING) {
         m_enableState = EffectProcessor::DISABLED;
     } else if (m_enableState == EffectProcessor::ENABLING) {
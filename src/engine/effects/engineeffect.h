@@ -31,6 +31,13 @@ class EngineEffect : public EffectsRequestHandler {
         return m_parametersById.value(id, NULL);
     }
 
+    // Creates the state of the processor for one channel. Safe to call from
+    // the main thread while the engine is processing. The state is handed to
+    // the engine with an ADD_EFFECT_CHANNEL_STATE request.
+    EffectChannelState* createChannelState() const {
+        return m_pProcessor->createChannelState();
+    }
+
     bool processEffectsRequest(
         const EffectsRequest& message,
         EffectsResponsePipe* pResponsePipe);
@@ -42,6 +49,16 @@ class EngineEffect : public EffectsRequestHandler {
                  const EffectProcessor::EnableState enableState,
                  const GroupFeatureState& groupFeatures);
 
+    // See EffectProcessor::isSleeping()
+    bool isSleeping(const ChannelHandle& handle) const {
+        return m_pProcessor->isSleeping(handle);
+    }
+
+    // Completes an enable or disable ramp after every channel had the chance
+    // to ramp in the previous callback. Must not be called concurrently with
+    // process().
+    void advanceEnableState();
+
     bool enabled() const {
         return m_enableState != EffectProcessor::DISABLED;
     }
@@ -1,21 +1,22 @@
 #include "engine/effects/engineeffectchain.h"
 
+#include "engine/callbackprofiler.h"
 #include "engine/effects/engineeffect.h"
 #include "sampleutil.h"
-#include "util/defs.h"
 
-EngineEffectChain::EngineEffectChain(const QString& id)
+EngineEffectChain::EngineEffectChain(const QString& id,
+                                     const QString& profilerName)
         : m_id(id),
+          m_iProfilerSlot(profilerName.isEmpty() ? -1 :
+                          CallbackProfiler::effectChainSlot(profilerName)),
           m_enableState(EffectProcessor::ENABLED),
           m_insertionType(EffectChain::INSERT),
-          m_dMix(0),
-          m_pBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)) {
+          m_dMix(0) {
     // Try to prevent memory allocation.
     m_effects.reserve(256);
 }
 
 EngineEffectChain::~EngineEffectChain() {
-    SampleUtil::free(m_pBuffer);
 }
 
 bool EngineEffectChain::addEffect(EngineEffect* pEffect, int iIndex) {
@@ -149,12 +150,35 @@ EngineEffectChain::ChannelStatus& EngineEffectChain::getChannelStatus(
     return m_channelStatus[handle];
 }
 
+void EngineEffectChain::advanceEnableState() {
+    if (m_enableState == EffectProcessor::DISABLING) {
+        m_enableState = EffectProcessor::DISABLED;
+    } else if (m_enableState == EffectProcessor::ENABLING) {
+        m_enableState = EffectProcessor::ENABLED;
+    }
+}
+
+// static
+void EngineEffectChain::updateSilence(const ChannelHandle& handle,
+                                      const EngineEffect* pEffect,
+                                      GroupFeatureState* pGroupFeatures) {
+    if (pGroupFeatures->silence && !pEffect->isSleeping(handle)) {
+        pGroupFeatures->silence = false;
+    }
+}
+
 void EngineEffectChain::process(const ChannelHandle& handle,
                                 CSAMPLE* pInOut,
+                                CSAMPLE* pScratchBuffer,
                                 const unsigned int numSamples,
                                 const unsigned int sampleRate,
-                                const GroupFeatureState& groupFeatures) {
-    ChannelStatus& channel_info = getChannelStatus(handle);
+                                GroupFeatureState* pGroupFeatures) {
+    // A channel without a status was never enabled. Don't create one here
+    // since growing m_channelStatus races with other channels being processed.
+    if (!m_channelStatus.contains(handle)) {
+        return;
+    }
+    ChannelStatus& channel_info = m_channelStatus[handle];
 
     if (m_enableState == EffectProcessor::DISABLED
             || channel_info.enable_state == EffectProcessor::DISABLED) {
@@ -187,13 +211,14 @@ void EngineEffectChain::process(const ChannelHandle& handle,
                 }
                 pEffect->process(handle, pInOut, pInOut,
                                  numSamples, sampleRate,
-                                 effectiveEnableState, groupFeatures);
+                                 effectiveEnableState, *pGroupFeatures);
+                updateSilence(handle, pEffect, pGroupFeatures);
             }
         } else if (wet_gain_old == 0.0 && wet_gain == 0.0) {
             // Fully dry, no ramp, insert optimization. No action is needed
         } else {
             // Clear scratch buffer.
-            SampleUtil::clear(m_pBuffer, numSamples);
+            SampleUtil::clear(pScratchBuffer, numSamples);
 
             // Chain each effect
             bool anyProcessed = false;
@@ -202,26 +227,27 @@ void EngineEffectChain::process(const ChannelHandle& handle,
                 if (pEffect == NULL || !pEffect->enabled()) {
                     continue;
                 }
-                const CSAMPLE* pIntermediateInput = (i == 0) ? pInOut : m_pBuffer;
-                CSAMPLE* pIntermediateOutput = m_pBuffer;
+                const CSAMPLE* pIntermediateInput = (i == 0) ? pInOut : pScratchBuffer;
+                CSAMPLE* pIntermediateOutput = pScratchBuffer;
                 pEffect->process(handle, pIntermediateInput, pIntermediateOutput,
                                  numSamples, sampleRate,
-                                 effectiveEnableState, groupFeatures);
+                                 effectiveEnableState, *pGroupFeatures);
+                updateSilence(handle, pEffect, pGroupFeatures);
                 anyProcessed = true;
             }
 
             if (anyProcessed) {
-                // m_pBuffer now contains the fully wet output.
+                // pScratchBuffer now contains the fully wet output.
                 // TODO(rryan): benchmark applyGain followed by addWithGain versus
                 // copy2WithGain.
                 SampleUtil::copy2WithRampingGain(
                     pInOut, pInOut, 1.0 - wet_gain_old, 1.0 - wet_gain,
-                    m_pBuffer, wet_gain_old, wet_gain, numSamples);
+                    pScratchBuffer, wet_gain_old, wet_gain, numSamples);
             }
         }
     } else { // SEND mode: output = input + effect(input) * wet
         // Clear scratch buffer.
-        SampleUtil::applyGain(m_pBuffer, 0.0, numSamples);
+        SampleUtil::applyGain(pScratchBuffer, 0.0, numSamples);
 
         // Chain each effect
         bool anyProcessed = false;
@@ -230,30 +256,27 @@ void EngineEffectChain::process(const ChannelHandle& handle,
             if (pEffect == NULL || !pEffect->enabled()) {
                 continue;
             }
-            const CSAMPLE* pIntermediateInput = (i == 0) ? pInOut : m_pBuffer;
-            CSAMPLE* pIntermediateOutput = m_pBuffer;
+            const CSAMPLE* pIntermediateInput = (i == 0) ? pInOut : pScratchBuffer;
+            CSAMPLE* pIntermediateOutput = pScratchBuffer;
             pEffect->process(handle, pIntermediateInput,
                              pIntermediateOutput, numSamples, sampleRate,
-                             effectiveEnableState, groupFeatures);
+                             effectiveEnableState, *pGroupFeatures);
+            updateSilence(handle, pEffect, pGroupFeatures);
             anyProcessed = true;
         }
 
         if (anyProcessed) {
-            // m_pBuffer now contains the fully wet output.
-            SampleUtil::addWithRampingGain(pInOut, m_pBuffer,
+            // pScratchBuffer now contains the fully wet output.
+            SampleUtil::addWithRampingGain(pInOut, pScratchBuffer,
                                            wet_gain_old, wet_gain, numSamples);
         }
     }
 
-    // Update ChannelStatus with the latest values.
+    // Update ChannelStatus with the latest values. The chain's own enable
+    // state is shared by all channels, so it is advanced once per callback by
+    // advanceEnableState() instead.
     channel_info.old_gain = wet_gain;
 
-    if (m_enableState == EffectProcessor::DISABLING) {
-        m_enableState = EffectProcessor::DISABLED;
-    } else if (m_enableState == EffectProcessor::ENABLING) {
-        m_enableState = EffectProcessor::ENABLED;
-    }
-
     if (channel_info.enable_state == EffectProcessor::DISABLING) {
         channel_info.enable_state = EffectProcessor::DISABLED;
     } else if (channel_info.enable_state == EffectProcessor::ENABLING) {
@@ -16,18 +16,32 @@ class EngineEffect;
 
 class EngineEffectChain : public EffectsRequestHandler {
   public:
-    EngineEffectChain(const QString& id);
+    // The processing time of the chain is recorded under profilerName by the
+    // CallbackProfiler. It is not recorded if profilerName is empty.
+    EngineEffectChain(const QString& id,
+                      const QString& profilerName = QString());
     virtual ~EngineEffectChain();
 
     bool processEffectsRequest(
         const EffectsRequest& message,
         EffectsResponsePipe* pResponsePipe);
 
+    // Applies the chain to the audio of one channel. pScratchBuffer must hold
+    // numSamples samples and must not be used by any other thread during the
+    // call. Different channels may be processed concurrently. Clears the
+    // silence of pGroupFeatures if the output of the chain is no longer
+    // silent, e.g. because an echo is still sounding.
     void process(const ChannelHandle& handle,
                  CSAMPLE* pInOut,
+                 CSAMPLE* pScratchBuffer,
                  const unsigned int numSamples,
                  const unsigned int sampleRate,
-                 const GroupFeatureState& groupFeatures);
+                 GroupFeatureState* pGroupFeatures);
+
+    // Completes an enable or disable ramp of the whole chain after every
+    // channel had the chance to ramp in the previous callback. Must not be
+    // called concurrently with process().
+    void advanceEnableState();
 
     const QString& id() const {
         return m_id;
@@ -35,6 +49,10 @@ class EngineEffectChain : public EffectsRequestHandler {
 
     bool enabledForChannel(const ChannelHandle& handle) const;
 
+    int profilerSlot() const {
+        return m_iProfilerSlot;
+    }
+
   private:
     struct ChannelStatus {
         ChannelStatus()
@@ -55,16 +73,22 @@ class EngineEffectChain : public EffectsRequestHandler {
     bool enableForChannel(const ChannelHandle& handle);
     bool disableForChannel(const ChannelHandle& handle);
 
+    // Keeps the silence of pGroupFeatures after pEffect processed the
+    // channel only if the effect slept.
+    static void updateSilence(const ChannelHandle& handle,
+                              const EngineEffect* pEffect,
+                              GroupFeatureState* pGroupFeatures);
+
     // Gets or creates a ChannelStatus entry in m_channelStatus for the provided
     // handle.
     ChannelStatus& getChannelStatus(const ChannelHandle& handle);
 
     QString m_id;
+    const int m_iProfilerSlot;
     EffectProcessor::EnableState m_enableState;
     EffectChain::InsertionType m_insertionType;
     CSAMPLE m_dMix;
     QList<EngineEffect*> m_effects;
-    CSAMPLE* m_pBuffer;
     ChannelHandleMap<ChannelStatus> m_channelStatus;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffectChain);
@@ -1,6 +1,8 @@
 #include "engine/effects/engineeffectrack.h"
 
+#include "engine/callbackprofiler.h"
 #include "engine/effects/engineeffectchain.h"
+#include "util/performancetimer.h"
 
 EngineEffectRack::EngineEffectRack(int iRackNumber)
         : m_iRackNumber(iRackNumber) {
@@ -43,12 +45,27 @@ bool EngineEffectRack::processEffectsRequest(const EffectsRequest& message,
 
 void EngineEffectRack::process(const ChannelHandle& handle,
                                CSAMPLE* pInOut,
+                               CSAMPLE* pScratchBuffer,
                                const unsigned int numSamples,
                                const unsigned int sampleRate,
-                               const GroupFeatureState& groupFeatures) {
-    foreach (EngineEffectChain* pChain, m_chains) {
-        if (pChain != NULL) {
-            pChain->process(handle, pInOut, numSamples, sampleRate, groupFeatures);
+                               GroupFeatureState* pGroupFeatures,
+                               CallbackProfiler* pProfiler) {
+    // Several channels may be processed concurrently, so don't use foreach,
+    // which copies the list and touches its reference count.
+    for (int i = 0; i < m_chains.size(); ++i) {
+        EngineEffectChain* pChain = m_chains.at(i);
+        if (pChain == NULL) {
+            continue;
+        }
+        if (pProfiler != NULL) {
+            PerformanceTimer timer;
+            timer.start();
+            pChain->process(handle, pInOut, pScratchBuffer, numSamples,
+                            sampleRate, pGroupFeatures);
+            pProfiler->addEffectChainTime(pChain->profilerSlot(), timer.elapsed());
+        } else {
+            pChain->process(handle, pInOut, pScratchBuffer, numSamples,
+                            sampleRate, pGroupFeatures);
         }
     }
 }
@@ -7,6 +7,7 @@
 #include "engine/effects/message.h"
 #include "engine/effects/groupfeaturestate.h"
 
+class CallbackProfiler;
 class EngineEffectChain;
 
 class EngineEffectRack : public EffectsRequestHandler {
@@ -18,11 +19,16 @@ class EngineEffectRack : public EffectsRequestHandler {
         const EffectsRequest& message,
         EffectsResponsePipe* pResponsePipe);
 
+    // Applies the chains of the rack in order. See EngineEffectChain::process
+    // for pScratchBuffer and pGroupFeatures. If pProfiler is not NULL, the
+    // processing time of each chain is added to it.
     void process(const ChannelHandle& handle,
                  CSAMPLE* pInOut,
+                 CSAMPLE* pScratchBuffer,
                  const unsigned int numSamples,
                  const unsigned int sampleRate,
-                 const GroupFeatureState& groupFeatures);
+                 GroupFeatureState* pGroupFeatures,
+                 CallbackProfiler* pProfiler = NULL);
 
     int number() const {
         return m_iRackNumber;
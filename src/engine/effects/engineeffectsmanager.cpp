@@ -3,19 +3,61 @@
 #include "engine/effects/engineeffectrack.h"
 #include "engine/effects/engineeffectchain.h"
 #include "engine/effects/engineeffect.h"
+#include "engine/enginethreadpool.h"
+#include "sampleutil.h"
+#include "util/assert.h"
+#include "util/compatibility.h"
+#include "util/defs.h"
+#include "util/math.h"
+
+// static
+const int EngineEffectsManager::kMaxProcessingThreads = 16;
 
 EngineEffectsManager::EngineEffectsManager(EffectsResponsePipe* pResponsePipe)
-        : m_pResponsePipe(pResponsePipe) {
+        : m_pResponsePipe(pResponsePipe),
+          m_pCallbackProfiler(NULL),
+          m_pJobs(NULL),
+          m_jobNumSamples(0),
+          m_jobSampleRate(0) {
     // Try to prevent memory allocation.
     m_racks.reserve(256);
     m_chains.reserve(256);
     m_effects.reserve(256);
+
+    // The callback thread, see reserveScratchBuffers() for more.
+    reserveScratchBuffers(1);
 }
 
 EngineEffectsManager::~EngineEffectsManager() {
+    for (int i = 0; i < m_scratchBuffers.size(); ++i) {
+        SampleUtil::free(m_scratchBuffers[i]);
+    }
+}
+
+void EngineEffectsManager::reserveScratchBuffers(int numThreads) {
+    DEBUG_ASSERT_AND_HANDLE(numThreads <= kMaxProcessingThreads) {
+        numThreads = kMaxProcessingThreads;
+    }
+    // Nothing processes effects yet, so the free buffers can be replaced.
+    int freeBuffers = load_atomic(m_freeScratchBuffers);
+    while (m_scratchBuffers.size() < numThreads) {
+        freeBuffers |= 1 << m_scratchBuffers.size();
+        m_scratchBuffers.append(SampleUtil::alloc(MAX_BUFFER_LEN));
+    }
+    m_freeScratchBuffers.fetchAndStoreRelease(freeBuffers);
 }
 
 void EngineEffectsManager::onCallbackStart() {
+    // All channels had the chance to ramp in the previous callback, so enable
+    // and disable ramps are complete now. This must happen before the requests
+    // below start new ramps.
+    for (int i = 0; i < m_chains.size(); ++i) {
+        m_chains[i]->advanceEnableState();
+    }
+    for (int i = 0; i < m_effects.size(); ++i) {
+        m_effects[i]->advanceEnableState();
+    }
+
     EffectsRequest* request = NULL;
     while (m_pResponsePipe->readMessages(&request, 1) > 0) {
         EffectsResponse response(*request);
@@ -98,6 +140,7 @@ void EngineEffectsManager::onCallbackStart() {
                 break;
             case EffectsRequest::SET_EFFECT_PARAMETERS:
             case EffectsRequest::SET_PARAMETER_PARAMETERS:
+            case EffectsRequest::ADD_EFFECT_CHANNEL_STATE:
                 if (!m_effects.contains(request->pTargetEffect)) {
                     if (kEffectDebugOutput) {
                         qDebug() << debugString()
@@ -135,8 +178,83 @@ void EngineEffectsManager::process(const ChannelHandle& handle,
                                    const unsigned int numSamples,
                                    const unsigned int sampleRate,
                                    const GroupFeatureState& groupFeatures) {
-    foreach (EngineEffectRack* pRack, m_racks) {
-        pRack->process(handle, pInOut, numSamples, sampleRate, groupFeatures);
+    if (m_racks.isEmpty()) {
+        return;
+    }
+    // The racks update the silence while the buffer passes through them.
+    GroupFeatureState features(groupFeatures);
+    if (!features.has_silence) {
+        features.has_silence = true;
+        features.silence = SampleUtil::isSilent(pInOut, numSamples);
+    }
+    const int scratchIndex = acquireScratchBuffer();
+    if (scratchIndex < 0) {
+        // Leave the channel dry rather than wait in the callback.
+        return;
+    }
+    CSAMPLE* pScratchBuffer = m_scratchBuffers[scratchIndex];
+    for (int i = 0; i < m_racks.size(); ++i) {
+        m_racks.at(i)->process(handle, pInOut, pScratchBuffer, numSamples,
+                               sampleRate, &features, m_pCallbackProfiler);
+    }
+    releaseScratchBuffer(scratchIndex);
+}
+
+void EngineEffectsManager::processChannels(EngineThreadPool* pThreadPool,
+                                           const ChannelEffectsJob* pJobs,
+                                           int count,
+                                           const unsigned int numSamples,
+                                           const unsigned int sampleRate) {
+    m_pJobs = pJobs;
+    m_jobNumSamples = numSamples;
+    m_jobSampleRate = sampleRate;
+    // Each thread needs a scratch buffer.
+    DEBUG_ASSERT_AND_HANDLE(pThreadPool->numWorkers() < m_scratchBuffers.size()) {
+        for (int i = 0; i < count; ++i) {
+            processChannelJob(this, i);
+        }
+        m_pJobs = NULL;
+        return;
+    }
+    pThreadPool->runJobs(&EngineEffectsManager::processChannelJob, this, count);
+    m_pJobs = NULL;
+}
+
+// static
+void EngineEffectsManager::processChannelJob(void* pContext, int jobIndex) {
+    EngineEffectsManager* pManager = static_cast<EngineEffectsManager*>(pContext);
+    const ChannelEffectsJob& job = pManager->m_pJobs[jobIndex];
+    pManager->process(job.handle, job.pInOut, pManager->m_jobNumSamples,
+                      pManager->m_jobSampleRate, job.groupFeatures);
+}
+
+int EngineEffectsManager::acquireScratchBuffer() {
+    while (true) {
+        const int freeBuffers = load_atomic(m_freeScratchBuffers);
+        // There is a buffer for each thread that processes effects, so the
+        // loop only repeats if another thread claimed or released one at the
+        // same time.
+        DEBUG_ASSERT_AND_HANDLE(freeBuffers != 0) {
+            return -1;
+        }
+        int index = 0;
+        while ((freeBuffers & (1 << index)) == 0) {
+            ++index;
+        }
+        if (m_freeScratchBuffers.testAndSetAcquire(
+                freeBuffers, freeBuffers & ~(1 << index))) {
+            return index;
+        }
+    }
+}
+
+void EngineEffectsManager::releaseScratchBuffer(int index) {
+    while (true) {
+        const int freeBuffers = load_atomic(m_freeScratchBuffers);
+        if (m_freeScratchBuffers.testAndSetRelease(
+                freeBuffers, freeBuffers | (1 << index))) {
+            return;
+        }
     }
 }
 
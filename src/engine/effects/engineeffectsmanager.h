@@ -1,7 +1,9 @@
 #ifndef ENGINEEFFECTSMANAGER_H
 #define ENGINEEFFECTSMANAGER_H
 
+#include <QAtomicInt>
 #include <QScopedPointer>
+#include <QVarLengthArray>
 
 #include "util/types.h"
 #include "util/fifo.h"
@@ -9,17 +11,42 @@
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/channelhandle.h"
 
+class CallbackProfiler;
 class EngineEffectRack;
 class EngineEffectChain;
 class EngineEffect;
+class EngineThreadPool;
+
+// The effects of one channel in a batch for EngineEffectsManager::processChannels.
+struct ChannelEffectsJob {
+    ChannelHandle handle;
+    CSAMPLE* pInOut;
+    GroupFeatureState groupFeatures;
+};
 
 class EngineEffectsManager : public EffectsRequestHandler {
   public:
+    // The most threads that may process effects at the same time, the
+    // callback thread included. There is a scratch buffer for each.
+    static const int kMaxProcessingThreads;
+
     EngineEffectsManager(EffectsResponsePipe* pResponsePipe);
     virtual ~EngineEffectsManager();
 
+    // Allocates a scratch buffer for each of numThreads threads that process
+    // effects at the same time, the callback thread included. Must be called
+    // before the threads start processing. processChannels() processes the
+    // channels serially if its pool has more threads than buffers.
+    void reserveScratchBuffers(int numThreads);
+
     void onCallbackStart();
 
+    // Records the processing time of each effect chain in pProfiler. Only call
+    // this while the callback is inactive.
+    void setCallbackProfiler(CallbackProfiler* pProfiler) {
+        m_pCallbackProfiler = pProfiler;
+    }
+
     // Take a buffer of numSamples samples of audio from a channel, provided as
     // pInput, and apply each EffectChain enabled for this channel to it,
     // putting the resulting output in pOutput. If pInput is equal to pOutput,
@@ -27,12 +54,27 @@ class EngineEffectsManager : public EffectsRequestHandler {
     // represented as stereo interleaved samples. There are numSamples total
     // samples, so numSamples/2 left channel samples and numSamples/2 right
     // channel samples.
+    //
+    // May be called for different channels concurrently (e.g. by the channel
+    // jobs of EngineMaster). The racks and chains of one channel are applied
+    // in order since each works on the output of the previous one. All state
+    // the chains and effects keep per channel is only touched by the call for
+    // that channel, and state shared by all channels (the enable ramps of
+    // chains and effects) only changes in onCallbackStart(), so the output
+    // does not depend on the order or concurrency of the calls.
     virtual void process(const ChannelHandle& handle,
                          CSAMPLE* pInOut,
                          const unsigned int numSamples,
                          const unsigned int sampleRate,
                          const GroupFeatureState& groupFeatures);
 
+    // Calls process() for each of the count jobs. The jobs are distributed
+    // over pThreadPool, so they must be for different channels.
+    void processChannels(EngineThreadPool* pThreadPool,
+                         const ChannelEffectsJob* pJobs, int count,
+                         const unsigned int numSamples,
+                         const unsigned int sampleRate);
+
     bool processEffectsRequest(
         const EffectsRequest& message,
         EffectsResponsePipe* pResponsePipe);
@@ -45,10 +87,30 @@ class EngineEffectsManager : public EffectsRequestHandler {
     bool addEffectRack(EngineEffectRack* pRack);
     bool removeEffectRack(EngineEffectRack* pRack);
 
+    // Lock-free claiming of one of the preallocated scratch buffers the
+    // chains of a channel mix through. Returns -1 if all are in use, which
+    // means more threads process effects than kMaxProcessingThreads allows.
+    int acquireScratchBuffer();
+    void releaseScratchBuffer(int index);
+
+    // EngineThreadPool job for m_pJobs[jobIndex].
+    static void processChannelJob(void* pContext, int jobIndex);
+
     QScopedPointer<EffectsResponsePipe> m_pResponsePipe;
+    CallbackProfiler* m_pCallbackProfiler;
     QList<EngineEffectRack*> m_racks;
     QList<EngineEffectChain*> m_chains;
     QList<EngineEffect*> m_effects;
+
+    // One scratch buffer per thread that may process effects at the same
+    // time. Bit i of m_freeScratchBuffers is set while buffer i is unused.
+    QVarLengthArray<CSAMPLE*, 16> m_scratchBuffers;
+    QAtomicInt m_freeScratchBuffers;
+
+    // The batch of the running processChannels call.
+    const ChannelEffectsJob* m_pJobs;
+    unsigned int m_jobNumSamples;
+    unsigned int m_jobSampleRate;
 };
 
 
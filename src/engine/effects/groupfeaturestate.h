@@ -24,7 +24,9 @@ struct GroupFeatureState {
               has_file_key(false),
               file_key(mixxx::track::io::key::INVALID),
               has_key(false),
-              key(mixxx::track::io::key::INVALID) {
+              key(mixxx::track::io::key::INVALID),
+              has_silence(false),
+              silence(false) {
     }
 
     // The current player position (if it is a player with the concept of a
@@ -70,6 +72,15 @@ struct GroupFeatureState {
     // The effective musical key of this group (pitch-shifted).
     bool has_key;
     mixxx::track::io::key::ChromaticKey key;
+
+    // Whether the buffer that is processed is silent, see
+    // SampleUtil::isSilent(). Unlike the RMS volume this is up to date: It is
+    // determined once per callback when the effects of the group start and
+    // follows the buffer through the effects, so each effect sees whether its
+    // own input is silent. Groups that know their buffer is silent, e.g.
+    // because they just cleared it, may set it up front.
+    bool has_silence;
+    bool silence;
 };
 
 #endif /* GROUPFEATURESTATE_H */
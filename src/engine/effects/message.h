@@ -13,6 +13,7 @@ const bool kEffectDebugOutput = false;
 class EngineEffectRack;
 class EngineEffectChain;
 class EngineEffect;
+class EffectChannelState;
 
 struct EffectsRequest {
     enum MessageType {
@@ -34,6 +35,7 @@ struct EffectsRequest {
         // Messages for EngineEffect
         SET_EFFECT_PARAMETERS,
         SET_PARAMETER_PARAMETERS,
+        ADD_EFFECT_CHANNEL_STATE,
 
         // Must come last.
         NUM_REQUEST_TYPES
@@ -59,6 +61,7 @@ struct EffectsRequest {
         CLEAR_STRUCT(SetEffectChainParameters);
         CLEAR_STRUCT(SetEffectParameters);
         CLEAR_STRUCT(SetParameterParameters);
+        CLEAR_STRUCT(AddEffectChannelState);
 #undef CLEAR_STRUCT
     }
 
@@ -80,6 +83,7 @@ struct EffectsRequest {
         EngineEffectChain* pTargetChain;
         // Used by:
         // - SET_EFFECT_PARAMETER
+        // - ADD_EFFECT_CHANNEL_STATE
         EngineEffect* pTargetEffect;
     };
 
@@ -118,13 +122,19 @@ struct EffectsRequest {
         struct {
             int iParameter;
         } SetParameterParameters;
+        struct {
+            // Owned by the request until the EngineEffect accepts it. If the
+            // request fails, the main thread deletes it with the request.
+            EffectChannelState* pState;
+        } AddEffectChannelState;
     };
 
     ////////////////////////////////////////////////////////////////////////////
     // Message-specific, non-POD values that can't be part of the above union.
     ////////////////////////////////////////////////////////////////////////////
 
-    // Used by ENABLE_EFFECT_CHAIN_FOR_CHANNEL and DISABLE_EFFECT_CHAIN_FOR_CHANNEL.
+    // Used by ENABLE_EFFECT_CHAIN_FOR_CHANNEL, DISABLE_EFFECT_CHAIN_FOR_CHANNEL
+    // and ADD_EFFECT_CHANNEL_STATE.
     ChannelHandle channel;
 
     // Used by SET_EFFECT_PARAMETER.
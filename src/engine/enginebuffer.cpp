@@ -13,6 +13,7 @@
 #include "engine/enginechannel.h"
 #include "engine/enginebufferscalest.h"
 #include "engine/enginebufferscalerubberband.h"
+#include "engine/enginebufferscalerubberbandthreaded.h"
 #include "engine/enginebufferscalelinear.h"
 #include "engine/sync/enginesync.h"
 #include "engine/engineworkerscheduler.h"
@@ -30,6 +31,7 @@
 #include "engine/enginemaster.h"
 #include "util/timer.h"
 #include "util/math.h"
+#include "util/performancetimer.h"
 #include "util/defs.h"
 #include "track/beatfactory.h"
 #include "track/keyutils.h"
@@ -45,6 +47,14 @@
 
 const double kLinearScalerElipsis = 1.00058; // 2^(0.01/12): changes < 1 cent allows a linear scaler
 const int kSamplesPerFrame = 2; // Engine buffer uses Stereo frames only
+// The input kept for the keylock scaler while keylock is off. This covers the
+// latency of SoundTouch and RubberBand at 48 kHz, so either can take over
+// without rereading the track.
+const int kShadowHistoryFrames = 8192;
+// When keylock is enabled the history is fed to the keylock scaler in steps
+// of at most this many frames per callback, on top of the new input. The
+// vinyl scaler keeps playing until the history is used up.
+const int kShadowPrimeFramesPerCallback = 2048;
 
 EngineBuffer::EngineBuffer(QString group, ConfigObject<ConfigValue>* _config,
                            EngineChannel* pChannel, EngineMaster* pMixingEngine)
@@ -76,6 +86,12 @@ EngineBuffer::EngineBuffer(QString group, ConfigObject<ConfigValue>* _config,
           m_pRepeat(NULL),
           m_startButton(NULL),
           m_endButton(NULL),
+          m_pScaleShadow(NULL),
+          m_bShadowHistoryOnly(false),
+          m_bShadowPriming(false),
+          m_pShadowHistory(SampleUtil::alloc(kShadowHistoryFrames * kSamplesPerFrame)),
+          m_iShadowHistoryWrite(0),
+          m_iShadowHistorySamples(0),
           m_bScalerOverride(false),
           m_iSeekQueued(NO_SEEK),
           m_iEnableSyncQueued(SYNC_REQUEST_NONE),
@@ -187,6 +203,11 @@ EngineBuffer::EngineBuffer(QString group, ConfigObject<ConfigValue>* _config,
     m_pKeylockEngine->connectValueChanged(SLOT(slotKeylockEngineChanged(double)),
                                           Qt::DirectConnection);
 
+    m_pVinylInterpolation = new ControlObjectSlave(
+            "[Master]", "vinyl_interpolation", this);
+    m_pVinylInterpolation->connectValueChanged(
+            SLOT(slotVinylInterpolationChanged(double)), Qt::DirectConnection);
+
     m_pTrackSamples = new ControlObject(ConfigKey(m_group, "track_samples"));
     m_pTrackSampleRate = new ControlObject(ConfigKey(m_group, "track_samplerate"));
 
@@ -255,11 +276,9 @@ EngineBuffer::EngineBuffer(QString group, ConfigObject<ConfigValue>* _config,
     m_pScaleLinear = new EngineBufferScaleLinear(m_pReadAheadManager);
     m_pScaleST = new EngineBufferScaleST(m_pReadAheadManager);
     m_pScaleRB = new EngineBufferScaleRubberBand(m_pReadAheadManager);
-    if (m_pKeylockEngine->get() == SOUNDTOUCH) {
-        m_pScaleKeylock = m_pScaleST;
-    } else {
-        m_pScaleKeylock = m_pScaleRB;
-    }
+    m_pWorkerScheduler = NULL;
+    slotKeylockEngineChanged(m_pKeylockEngine->get());
+    slotVinylInterpolationChanged(m_pVinylInterpolation->get());
     m_pScaleVinyl = m_pScaleLinear;
     m_pScale = m_pScaleVinyl;
     m_pScale->clear();
@@ -311,12 +330,14 @@ EngineBuffer::~EngineBuffer() {
     delete m_pScaleLinear;
     delete m_pScaleST;
     delete m_pScaleRB;
+    delete load_atomic_pointer(m_pScaleRBThreaded);
 
     delete m_pKeylock;
     delete m_pEject;
 
     SampleUtil::free(m_pDitherBuffer);
     SampleUtil::free(m_pCrossfadeBuffer);
+    SampleUtil::free(m_pShadowHistory);
 
     qDeleteAll(m_engineControls);
 }
@@ -340,10 +361,40 @@ void EngineBuffer::enableIndependentPitchTempoScaling(bool bEnable,
 
     // m_pScaleKeylock and m_pScaleVinyl could change out from under us,
     // so cache it.
-    EngineBufferScale* keylock_scale = m_pScaleKeylock;
+    EngineBufferScale* keylock_scale =
+            load_atomic_pointer_acquire(m_pScaleKeylock);
     EngineBufferScale* vinyl_scale = m_pScaleVinyl;
 
-    if (bEnable && m_pScale != keylock_scale) {
+    if (bEnable && m_pScale != keylock_scale && m_pScaleShadow == keylock_scale &&
+            m_bShadowHistoryOnly) {
+        // Keylock has just been enabled. Stay with the vinyl scaler until
+        // the history has been fed to the keylock scaler, which takes a few
+        // callbacks if the history is long.
+        primeShadowScaler();
+    }
+
+    if (bEnable && m_pScale != keylock_scale && m_pScaleShadow == keylock_scale) {
+        if (m_bShadowHistoryOnly) {
+            return;
+        }
+        // The keylock scaler has been fed the same input as the vinyl
+        // scaler, so it continues where the reads of the vinyl scaler end.
+        // Fade out the vinyl scaler without seeking back, feed the faded out
+        // input into the keylock scaler and take over without a clear().
+        // Unlike readToCrossfadeBuffer(), the position is advanced past the
+        // faded out input, since that is where the keylock scaler continues.
+        if (m_speed_old != 0.0) {
+            CSAMPLE* fadeout = m_pScale->getScaled(iBufferSize);
+            SampleUtil::copy(m_pCrossfadeBuffer, fadeout, iBufferSize);
+            advancePlayposition(m_pScale->getSamplesRead());
+            m_bCrossfadeReady = true;
+        }
+        processShadowScaler();
+        m_pScaleShadow = NULL;
+        m_pReadAheadManager->setTapEnabled(false);
+        m_pScale = keylock_scale;
+        m_bScalerChanged = true;
+    } else if (bEnable && m_pScale != keylock_scale) {
         if (m_speed_old != 0.0) {
             // Crossfade if we are not paused.
             // If we start from zero a ramping gain is
@@ -365,6 +416,140 @@ void EngineBuffer::enableIndependentPitchTempoScaling(bool bEnable,
     }
 }
 
+void EngineBuffer::updateShadowScaler(bool bEnable, bool bHistoryOnly,
+                                      double baserate, double speed,
+                                      double pitchRatio) {
+    EngineBufferScale* pShadow =
+            bEnable ? load_atomic_pointer_acquire(m_pScaleKeylock) : NULL;
+    if (pShadow != m_pScaleShadow) {
+        // The new shadow scaler is cleared with the first tapped samples,
+        // because the tap starts discontinuous.
+        m_pScaleShadow = pShadow;
+        m_bShadowHistoryOnly = bHistoryOnly;
+        m_bShadowPriming = false;
+        m_iShadowHistorySamples = 0;
+        m_pReadAheadManager->setTapEnabled(pShadow != NULL);
+    } else if (pShadow != NULL && bHistoryOnly) {
+        if (!m_bShadowHistoryOnly) {
+            m_iShadowHistorySamples = 0;
+            m_bShadowHistoryOnly = true;
+        }
+        // Keylock was disabled again before priming has finished. The rest
+        // of the history stays valid, priming starts over if needed.
+        m_bShadowPriming = false;
+    } else if (pShadow != NULL && m_bShadowHistoryOnly) {
+        // Keylock was enabled while the vinyl scaler stays in use.
+        primeShadowScaler();
+    }
+    if (m_pScaleShadow != NULL) {
+        // The shadow scaler only needs to be warm, not exact. Keep it within
+        // the speed range of keylock, where it has preallocated its buffers.
+        double tempoRatio = math_clamp(fabs(speed), 0.1, 1.9);
+        m_pScaleShadow->setScaleParameters(baserate, &tempoRatio, &pitchRatio);
+    }
+}
+
+void EngineBuffer::processShadowScaler() {
+    if (m_pScaleShadow == NULL) {
+        return;
+    }
+    int numSamples = 0;
+    bool discontinuous = false;
+    const CSAMPLE* pSamples = m_pReadAheadManager->takeTappedSamples(
+            &numSamples, &discontinuous);
+    if (m_bShadowHistoryOnly) {
+        if (discontinuous) {
+            m_iShadowHistorySamples = 0;
+            if (m_bShadowPriming) {
+                m_pScaleShadow->clear();
+            }
+        }
+        appendShadowHistory(pSamples, numSamples);
+        if (m_bShadowPriming) {
+            // Feed more than arrives, so the history is used up eventually
+            feedShadowHistory(numSamples +
+                              kShadowPrimeFramesPerCallback * kSamplesPerFrame);
+        }
+        return;
+    }
+    if (discontinuous) {
+        // After a seek or when starting to shadow
+        m_pScaleShadow->clear();
+    }
+    if (numSamples > 0) {
+        m_pScaleShadow->processShadow(pSamples, numSamples);
+    }
+}
+
+void EngineBuffer::primeShadowScaler() {
+    if (m_bShadowPriming) {
+        return;
+    }
+    m_bShadowPriming = true;
+    m_pScaleShadow->clear();
+    // A scaler that reports its latency after clear() does not need more
+    // history than that.
+    const int latencySamples = static_cast<int>(
+            ceil(m_pScaleShadow->getLatencyFrames())) * kSamplesPerFrame;
+    if (latencySamples > 0) {
+        m_iShadowHistorySamples = math_min(m_iShadowHistorySamples,
+                                           latencySamples);
+    }
+    feedShadowHistory(kShadowPrimeFramesPerCallback * kSamplesPerFrame);
+}
+
+void EngineBuffer::feedShadowHistory(int maxSamples) {
+    const int capacity = kShadowHistoryFrames * kSamplesPerFrame;
+    const int numSamples = math_min(m_iShadowHistorySamples, maxSamples);
+    const int start = (m_iShadowHistoryWrite - m_iShadowHistorySamples +
+                       capacity) % capacity;
+    const int firstPart = math_min(numSamples, capacity - start);
+    if (firstPart > 0) {
+        m_pScaleShadow->processShadow(m_pShadowHistory + start, firstPart);
+    }
+    if (numSamples > firstPart) {
+        m_pScaleShadow->processShadow(m_pShadowHistory,
+                                      numSamples - firstPart);
+    }
+    m_iShadowHistorySamples -= numSamples;
+    if (m_iShadowHistorySamples == 0) {
+        // Primed, from now on the input goes to the scaler directly.
+        m_bShadowPriming = false;
+        m_bShadowHistoryOnly = false;
+    }
+}
+
+void EngineBuffer::appendShadowHistory(const CSAMPLE* pSamples,
+                                       int numSamples) {
+    const int capacity = kShadowHistoryFrames * kSamplesPerFrame;
+    if (numSamples > capacity) {
+        // Only the end of the input is kept anyway
+        pSamples += numSamples - capacity;
+        numSamples = capacity;
+    }
+    const int firstPart = math_min(numSamples, capacity - m_iShadowHistoryWrite);
+    SampleUtil::copy(m_pShadowHistory + m_iShadowHistoryWrite, pSamples,
+                     firstPart);
+    SampleUtil::copy(m_pShadowHistory, pSamples + firstPart,
+                     numSamples - firstPart);
+    m_iShadowHistoryWrite = (m_iShadowHistoryWrite + numSamples) % capacity;
+    m_iShadowHistorySamples = math_min(m_iShadowHistorySamples + numSamples,
+                                       capacity);
+}
+
+void EngineBuffer::advancePlayposition(double samplesRead) {
+    if (m_bScalerOverride) {
+        // If testing, we don't have a real log so we fake the position.
+        m_filepos_play += samplesRead;
+    } else {
+        // Adjust filepos_play by the amount we processed. TODO(XXX) what
+        // happens if samplesRead is a fraction ?
+        m_filepos_play =
+                m_pReadAheadManager->getEffectiveVirtualPlaypositionFromLog(
+                        static_cast<int>(m_filepos_play), samplesRead);
+    }
+}
+
 double EngineBuffer::getBpm()
 {
     return m_pBpmControl->getBpm();
@@ -696,9 +881,43 @@ void EngineBuffer::slotKeylockEngineChanged(double dIndex) {
     int iEngine = static_cast<int>(dIndex);
     KeylockEngine engine = static_cast<KeylockEngine>(iEngine);
     if (engine == SOUNDTOUCH) {
-        m_pScaleKeylock = m_pScaleST;
+        m_pScaleKeylock.fetchAndStoreRelease(m_pScaleST);
+    } else if (engine == RUBBERBAND_THREADED) {
+        EngineBufferScaleRubberBandThreaded* pScale =
+                load_atomic_pointer(m_pScaleRBThreaded);
+        if (pScale == NULL) {
+            // Set up completely before the engine thread can see it. The
+            // release store publishes the setup to the engine thread.
+            pScale = new EngineBufferScaleRubberBandThreaded(m_pReadAheadManager);
+            pScale->setScheduler(m_pWorkerScheduler);
+            pScale->setSampleRate(static_cast<int>(m_pSampleRate->get()));
+            m_pScaleRBThreaded.fetchAndStoreRelease(pScale);
+        }
+        m_pScaleKeylock.fetchAndStoreRelease(pScale);
     } else {
-        m_pScaleKeylock = m_pScaleRB;
+        m_pScaleKeylock.fetchAndStoreRelease(m_pScaleRB);
+    }
+}
+
+void EngineBuffer::slotVinylInterpolationChanged(double dIndex) {
+    int iInterpolation = static_cast<int>(dIndex);
+    if (iInterpolation < 0 ||
+            iInterpolation >= EngineBufferScaleLinear::INTERPOLATION_COUNT) {
+        iInterpolation = EngineBufferScaleLinear::LINEAR;
+    }
+    // The scaler picks it up with the next callback.
+    m_pScaleLinear->setInterpolation(
+            static_cast<EngineBufferScaleLinear::Interpolation>(iInterpolation));
+}
+
+void EngineBuffer::preProcess(const int iBufferSize) {
+    Q_UNUSED(iBufferSize);
+    // Sync requests change the master selection and the sync mode of other
+    // decks, so they are handled here and not in process, which may run in
+    // parallel with other decks.
+    if (!load_atomic(m_iTrackLoading) && m_pause.tryLock()) {
+        processSyncRequests();
+        m_pause.unlock();
     }
 }
 
@@ -729,6 +948,11 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
         m_pScaleLinear->setSampleRate(sample_rate);
         m_pScaleST->setSampleRate(sample_rate);
         m_pScaleRB->setSampleRate(sample_rate);
+        EngineBufferScaleRubberBandThreaded* pScaleRBThreaded =
+                load_atomic_pointer_acquire(m_pScaleRBThreaded);
+        if (pScaleRBThreaded != NULL) {
+            pScaleRBThreaded->setSampleRate(sample_rate);
+        }
         m_iSampleRate = sample_rate;
     }
 
@@ -750,13 +974,14 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
         double pitchRatio = pitchTempoRatio.pitchRatio;
         double tempoRatio = pitchTempoRatio.tempoRatio;
         const bool keylock_enabled = pitchTempoRatio.keylock;
+        // pitchRatio is overridden below if the vinyl scaler is used
+        const double keylockPitchRatio = pitchRatio;
 
         bool is_scratching = false;
         bool is_reverse = false;
 
         // Update the slipped position and seek if it was disabled.
         processSlip(iBufferSize);
-        processSyncRequests();
         processSeek();
 
         // speed is the ratio between track-time and real-time
@@ -926,6 +1151,16 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
             rate = m_rate_old;
         }
 
+        // Keylock is enabled but handed over to the vinyl scaler for
+        // scratching, seeking or very slow speeds. Keep the keylock scaler
+        // warm in the background, so switching back is cheap and does not
+        // need to refill it in a single callback. While keylock is off only
+        // the recent input is kept, so enabling keylock neither seeks back
+        // nor rereads the track.
+        updateShadowScaler(speed != 0.0 && m_pScale == m_pScaleVinyl,
+                           !keylock_enabled,
+                           baserate, speed, keylockPitchRatio);
+
         bool at_start = m_filepos_play <= 0;
         bool at_end = m_filepos_play >= m_trackSamplesOld;
         bool backwards = rate < 0;
@@ -958,8 +1193,12 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
             }
 
             // Perform scaling of Reader buffer into buffer.
+            PerformanceTimer scaleTimer;
+            scaleTimer.start();
             CSAMPLE* output = m_pScale->getScaled(iBufferSize);
+            m_pScale->addProcessingTime(scaleTimer.elapsed(), iBufferSize);
             double samplesRead = m_pScale->getSamplesRead();
+            processShadowScaler();
 
             //qDebug() << "sourceSamples used " << iSourceSamples
             //         <<" samplesRead " << samplesRead
@@ -970,16 +1209,7 @@ void EngineBuffer::process(CSAMPLE* pOutput, const int iBufferSize) {
             // Copy scaled audio into pOutput
             SampleUtil::copy(pOutput, output, iBufferSize);
 
-            if (m_bScalerOverride) {
-                // If testing, we don't have a real log so we fake the position.
-                m_filepos_play += samplesRead;
-            } else {
-                // Adjust filepos_play by the amount we processed. TODO(XXX) what
-                // happens if samplesRead is a fraction ?
-                m_filepos_play =
-                        m_pReadAheadManager->getEffectiveVirtualPlaypositionFromLog(
-                                static_cast<int>(m_filepos_play), samplesRead);
-            }
+            advancePlayposition(samplesRead);
         } else {
             SampleUtil::clear(pOutput, iBufferSize);
         }
@@ -1278,7 +1508,7 @@ void EngineBuffer::hintReader(const double dRate) {
         Hint hint;
         hint.length = 2048; //default length please
         hint.sample = m_dSlipRate >= 0 ? m_dSlipPosition : m_dSlipPosition - 2048;
-        hint.priority = 1;
+        hint.priority = HINT_PRIORITY_IMMINENT;
         m_hintList.append(hint);
     }
 
@@ -1312,6 +1542,12 @@ void EngineBuffer::addControl(EngineControl* pControl) {
 
 void EngineBuffer::bindWorkers(EngineWorkerScheduler* pWorkerScheduler) {
     m_pReader->setScheduler(pWorkerScheduler);
+    m_pWorkerScheduler = pWorkerScheduler;
+    EngineBufferScaleRubberBandThreaded* pScaleRBThreaded =
+            load_atomic_pointer(m_pScaleRBThreaded);
+    if (pScaleRBThreaded != NULL) {
+        pScaleRBThreaded->setScheduler(pWorkerScheduler);
+    }
 }
 
 bool EngineBuffer::isTrackLoaded() {
@@ -1361,9 +1597,11 @@ void EngineBuffer::setReader(CachingReader* pReader) {
 void EngineBuffer::setScalerForTest(EngineBufferScale* pScaleVinyl,
                                     EngineBufferScale* pScaleKeylock) {
     m_pScaleVinyl = pScaleVinyl;
-    m_pScaleKeylock = pScaleKeylock;
+    m_pScaleKeylock.fetchAndStoreRelease(pScaleKeylock);
     m_pScale = m_pScaleVinyl;
     m_pScale->clear();
+    m_pScaleShadow = NULL;
+    m_pReadAheadManager->setTapEnabled(false);
     m_bScalerChanged = true;
     // This bool is permanently set and can't be undone.
     m_bScalerOverride = true;
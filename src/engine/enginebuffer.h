@@ -20,6 +20,7 @@
 
 #include <QMutex>
 #include <QAtomicInt>
+#include <QAtomicPointer>
 #include <gtest/gtest_prod.h>
 
 #include "util/types.h"
@@ -61,6 +62,7 @@ class EngineBufferScale;
 class EngineBufferScaleLinear;
 class EngineBufferScaleST;
 class EngineBufferScaleRubberBand;
+class EngineBufferScaleRubberBandThreaded;
 class EngineSync;
 class EngineWorkerScheduler;
 class VisualPlayPosition;
@@ -113,6 +115,7 @@ class EngineBuffer : public EngineObject {
     enum KeylockEngine {
         SOUNDTOUCH,
         RUBBERBAND,
+        RUBBERBAND_THREADED,
         KEYLOCK_ENGINE_COUNT,
     };
 
@@ -137,7 +140,10 @@ class EngineBuffer : public EngineObject {
     void requestEnableSync(bool enabled);
     void requestSyncMode(SyncMode mode);
 
-    // The process methods all run in the audio callback.
+    // The process methods all run in the audio callback. preProcess and
+    // postProcess are called serially for all decks, process may run in
+    // parallel with other decks.
+    void preProcess(const int iBufferSize);
     void process(CSAMPLE* pOut, const int iBufferSize);
     void processSlip(int iBufferSize);
     void postProcess(const int iBufferSize);
@@ -167,6 +173,8 @@ class EngineBuffer : public EngineObject {
             return tr("Soundtouch (faster)");
         case RUBBERBAND:
             return tr("Rubberband (better)");
+        case RUBBERBAND_THREADED:
+            return tr("Rubberband in background thread (best, adds latency)");
         default:
             return tr("Unknown (bad value)");
         }
@@ -184,6 +192,7 @@ class EngineBuffer : public EngineObject {
     void slotControlSeekExact(double);
     void slotControlSlip(double);
     void slotKeylockEngineChanged(double);
+    void slotVinylInterpolationChanged(double);
 
     // Request that the EngineBuffer load a track. Since the process is
     // asynchronous, EngineBuffer will emit a trackLoaded signal when the load
@@ -214,6 +223,25 @@ class EngineBuffer : public EngineObject {
     void enableIndependentPitchTempoScaling(bool bEnable,
                                             const int iBufferSize);
 
+    // Feeds the keylock scaler with the input of the vinyl scaler while
+    // bEnable is set, so it can take over without a clear(). With
+    // bHistoryOnly the input is only kept in a history of the last
+    // kShadowHistoryFrames frames, which is fed to the keylock scaler once
+    // it is needed.
+    void updateShadowScaler(bool bEnable, bool bHistoryOnly, double baserate,
+                            double speed, double pitchRatio);
+    // Passes the samples the active scaler has read to the shadow scaler.
+    void processShadowScaler();
+    // Starts to feed the history to the shadow scaler, at most
+    // kShadowPrimeFramesPerCallback frames per callback, and switches to full
+    // shadowing once it is used up.
+    void primeShadowScaler();
+    // Feeds up to maxSamples of the oldest history to the shadow scaler.
+    void feedShadowHistory(int maxSamples);
+    void appendShadowHistory(const CSAMPLE* pSamples, int numSamples);
+    // Advances m_filepos_play by the input m_pScale has read.
+    void advancePlayposition(double samplesRead);
+
     void updateIndicators(double rate, int iBufferSize);
 
     void hintReader(const double rate);
@@ -336,6 +364,7 @@ class EngineBuffer : public EngineObject {
     ControlPotmeter* m_playposSlider;
     ControlObjectSlave* m_pSampleRate;
     ControlObjectSlave* m_pKeylockEngine;
+    ControlObjectSlave* m_pVinylInterpolation;
     ControlPushButton* m_pKeylock;
 
     // This ControlObjectSlaves is created as parent to this and deleted by
@@ -359,16 +388,35 @@ class EngineBuffer : public EngineObject {
     FRIEND_TEST(EngineBufferTest, ResetPitchAdjustUsesLinear);
     FRIEND_TEST(EngineBufferTest, VinylScalerRampZero);
     FRIEND_TEST(EngineBufferTest, ReadFadeOut);
+    FRIEND_TEST(EngineBufferTest, KeylockScalerStaysWarmWhileScratching);
+    FRIEND_TEST(EngineBufferTest, EnablingKeylockAccountsForFadeOut);
+    FRIEND_TEST(EngineBufferTest, EnablingKeylockPrimesOverSeveralCallbacks);
     EngineBufferScale* m_pScaleVinyl;
     // The keylock engine is configurable, so it could flip flop between
-    // ScaleST and ScaleRB during a single callback.
-    EngineBufferScale* volatile m_pScaleKeylock;
+    // ScaleST and ScaleRB(Threaded) during a single callback. Published by the
+    // main thread with release semantics, read once per use by the engine.
+    QAtomicPointer<EngineBufferScale> m_pScaleKeylock;
 
     // Object used for vinyl-style interpolation scaling of the audio
     EngineBufferScaleLinear* m_pScaleLinear;
     // Objects used for pitch-indep time stretch (key lock) scaling of the audio
     EngineBufferScaleST* m_pScaleST;
     EngineBufferScaleRubberBand* m_pScaleRB;
+    // Created by the main thread when RUBBERBAND_THREADED is first selected,
+    // since it runs a thread per deck. Published like m_pScaleKeylock.
+    QAtomicPointer<EngineBufferScaleRubberBandThreaded> m_pScaleRBThreaded;
+    EngineWorkerScheduler* m_pWorkerScheduler;
+    // The inactive keylock scaler that is fed the input of m_pScale, or NULL
+    EngineBufferScale* m_pScaleShadow;
+    // While keylock is off the shadow scaler only collects its input in
+    // m_pShadowHistory, which costs a copy instead of a time stretch.
+    bool m_bShadowHistoryOnly;
+    // Set while the history is fed to the shadow scaler, see
+    // primeShadowScaler().
+    bool m_bShadowPriming;
+    CSAMPLE* m_pShadowHistory;
+    int m_iShadowHistoryWrite;
+    int m_iShadowHistorySamples;
 
     // Indicates whether the scaler has changed since the last process()
     bool m_bScalerChanged;
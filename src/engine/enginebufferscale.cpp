@@ -17,8 +17,16 @@
 
 #include "engine/enginebufferscale.h"
 #include "util/defs.h"
+#include "util/performancetimer.h"
 #include "sampleutil.h"
 
+namespace {
+
+// The weight of the most recent call in the average of getCpuLoad()
+const double kCpuLoadSmoothing = 0.1;
+
+} // anonymous namespace
+
 EngineBufferScale::EngineBufferScale()
         : m_iSampleRate(44100),
           m_dBaseRate(1.0),
@@ -26,7 +34,8 @@ EngineBufferScale::EngineBufferScale()
           m_dTempoRatio(1.0),
           m_dPitchRatio(1.0),
           m_buffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
-          m_samplesRead(0) {
+          m_samplesRead(0),
+          m_dCpuLoad(0.0) {
 }
 
 EngineBufferScale::~EngineBufferScale() {
@@ -36,3 +45,21 @@ EngineBufferScale::~EngineBufferScale() {
 double EngineBufferScale::getSamplesRead() {
     return m_samplesRead;
 }
+
+void EngineBufferScale::processShadow(const CSAMPLE* pInput,
+                                      unsigned long iNumSamples) {
+    PerformanceTimer timer;
+    timer.start();
+    shadowInput(pInput, iNumSamples);
+    addProcessingTime(timer.elapsed(), iNumSamples);
+}
+
+void EngineBufferScale::addProcessingTime(qint64 nanos,
+                                          unsigned long buf_size) {
+    if (m_iSampleRate <= 0 || buf_size == 0) {
+        return;
+    }
+    // The duration of buf_size interleaved stereo samples
+    const double bufferNanos = buf_size * 1e9 / (2.0 * m_iSampleRate);
+    m_dCpuLoad += (nanos / bufferNanos - m_dCpuLoad) * kCpuLoadSmoothing;
+}
@@ -76,7 +76,38 @@ class EngineBufferScale : public QObject {
     /** Scale buffer */
     virtual CSAMPLE* getScaled(unsigned long buf_size) = 0;
 
+    // Feeds input that was read for another scaler, and discards the output.
+    // This keeps the internal state of an inactive scaler in sync with the
+    // track, so it can take over without clear() and without refilling its
+    // buffers in a single callback. pInput holds iNumSamples interleaved
+    // stereo samples in playback order.
+    void processShadow(const CSAMPLE* pInput, unsigned long iNumSamples);
+
+    // Returns the delay between the input that is read from the
+    // ReadAheadManager and the output of getScaled() in output frames.
+    virtual double getLatencyFrames() const {
+        return 0.0;
+    }
+
+    // Returns the time spent in getScaled() and processShadow() relative to
+    // the duration of the processed audio, averaged over the last calls.
+    // 1.0 means that the scaler alone uses up the whole real-time budget.
+    double getCpuLoad() const {
+        return m_dCpuLoad;
+    }
+
+    // Accounts the time one getScaled() call of buf_size samples took. Called
+    // by the owner of the scaler.
+    void addProcessingTime(qint64 nanos, unsigned long buf_size);
+
   protected:
+    // Implements processShadow(). Scalers without internal state ignore the
+    // input.
+    virtual void shadowInput(const CSAMPLE* pInput, unsigned long iNumSamples) {
+        Q_UNUSED(pInput);
+        Q_UNUSED(iNumSamples);
+    }
+
     int m_iSampleRate;
     double m_dBaseRate;
     bool m_bSpeedAffectsPitch;
@@ -86,6 +117,9 @@ class EngineBufferScale : public QObject {
     CSAMPLE* m_buffer;
     /** New playpos after call to scale */
     double m_samplesRead;
+
+  private:
+    double m_dCpuLoad;
 };
 
 #endif
@@ -1,12 +1,24 @@
 
 #include <QtDebug>
 
+#include <string.h>
+
 #include "engine/enginebufferscalelinear.h"
+#include "engine/interpolationkernels.h"
 #include "sampleutil.h"
 #include "track/keyutils.h"
+#include "util/compatibility.h"
 #include "util/math.h"
 #include "util/assert.h"
 
+namespace {
+
+// The capacity of m_pKernelBuffer in frames. Like m_bufferInt, plus room for
+// the history of the kernel.
+const int kKernelBufferFrames = kiLinearScaleReadAheadLength / 2 + kSincMaxTaps;
+
+} // anonymous namespace
+
 EngineBufferScaleLinear::EngineBufferScaleLinear(ReadAheadManager *pReadAheadManager)
     : EngineBufferScale(),
       m_bBackwards(false),
@@ -15,11 +27,23 @@ EngineBufferScaleLinear::EngineBufferScaleLinear(ReadAheadManager *pReadAheadMan
       m_dOldRate(1.0),
       m_pReadAheadManager(pReadAheadManager),
       m_dCurrentFrame(0.0),
-      m_dNextFrame(0.0)
+      m_dNextFrame(0.0),
+      m_requestedInterpolation(LINEAR),
+      m_interpolation(LINEAR),
+      m_iKernelTaps(kCubicTaps),
+      m_iKernelHistory(kCubicTaps / 2 - 1),
+      m_pKernelBuffer(SampleUtil::alloc(kKernelBufferFrames * 2)),
+      m_iKernelBufferFrames(0),
+      m_dKernelPosition(0.0)
 {
     for (int i=0; i<2; i++)
         m_floorSampleOld[i] = 0.0f;
 
+    // Make sure the tables are built here and not in the callback.
+    CSAMPLE dummy[kSincTaps * 2] = { 0 };
+    interpolateSinc(dummy, 0.0, 0, dummy);
+    resetKernelBuffer();
+
     m_bufferInt = new CSAMPLE[kiLinearScaleReadAheadLength];
     m_bufferIntSize = 0;
 
@@ -34,6 +58,11 @@ EngineBufferScaleLinear::~EngineBufferScaleLinear()
 {
     //df.close();
     delete [] m_bufferInt;
+    SampleUtil::free(m_pKernelBuffer);
+}
+
+void EngineBufferScaleLinear::setInterpolation(Interpolation interpolation) {
+    m_requestedInterpolation.fetchAndStoreRelease(interpolation);
 }
 
 void EngineBufferScaleLinear::setScaleParameters(double base_rate,
@@ -55,17 +84,61 @@ void EngineBufferScaleLinear::clear() {
     m_dNextFrame = 0;
     m_floorSampleOld[0] = 0;
     m_floorSampleOld[1] = 0;
+    resetKernelBuffer();
 }
 
-// laurent de soras - punked from musicdsp.org (mad props)
-inline float hermite4(float frac_pos, float xm1, float x0, float x1, float x2)
-{
-    const float c = (x1 - xm1) * 0.5f;
-    const float v = x0 - x1;
-    const float w = c + v;
-    const float a = w + v + (x2 - x0) * 0.5f;
-    const float b_neg = w + a;
-    return ((((a * frac_pos) - b_neg) * frac_pos + c) * frac_pos + x0);
+void EngineBufferScaleLinear::resetKernelBuffer() {
+    // Start with silence as history.
+    SampleUtil::clear(m_pKernelBuffer, m_iKernelHistory * 2);
+    m_iKernelBufferFrames = m_iKernelHistory;
+    m_dKernelPosition = m_iKernelHistory;
+}
+
+void EngineBufferScaleLinear::applyInterpolation() {
+    const Interpolation interpolation = static_cast<Interpolation>(
+            load_atomic(m_requestedInterpolation));
+    if (interpolation == m_interpolation) {
+        return;
+    }
+
+    // Hand over the frames that have been read but not yet played, so we
+    // stay in sync with the ReadAheadManager. The fractional position and
+    // the history are lost, which may click once.
+    const CSAMPLE* pPending;
+    int pendingFrames;
+    if (m_interpolation == LINEAR) {
+        const int first = static_cast<int>(ceil(m_dNextFrame));
+        pPending = &m_bufferInt[first * 2];
+        pendingFrames = math_max(0, m_bufferIntSize / 2 - first);
+    } else {
+        const int first = static_cast<int>(ceil(m_dKernelPosition));
+        pPending = &m_pKernelBuffer[first * 2];
+        pendingFrames = math_max(0, m_iKernelBufferFrames - first);
+    }
+
+    m_interpolation = interpolation;
+    if (interpolation == LINEAR) {
+        pendingFrames = math_min(pendingFrames,
+                                 kiLinearScaleReadAheadLength / 2);
+        SampleUtil::copy(m_bufferInt, pPending, pendingFrames * 2);
+        m_bufferIntSize = pendingFrames * 2;
+        m_dNextFrame = 0;
+        m_floorSampleOld[0] = 0;
+        m_floorSampleOld[1] = 0;
+    } else {
+        m_iKernelTaps = interpolation == CUBIC ? kCubicTaps : kSincTaps;
+        // Keep the history of the widest sinc kernel, so the band can change
+        // with the rate from one buffer to the next.
+        m_iKernelHistory = interpolation == CUBIC ?
+                kCubicTaps / 2 - 1 : kSincMaxTaps / 2 - 1;
+        const int history = m_iKernelHistory;
+        // pPending may point into m_pKernelBuffer.
+        memmove(&m_pKernelBuffer[history * 2], pPending,
+                pendingFrames * 2 * sizeof(CSAMPLE));
+        SampleUtil::clear(m_pKernelBuffer, history * 2);
+        m_iKernelBufferFrames = history + pendingFrames;
+        m_dKernelPosition = history;
+    }
 }
 
 /** Determine if we're changing directions (scratching) and then perform
@@ -75,6 +148,7 @@ CSAMPLE* EngineBufferScaleLinear::getScaled(unsigned long buf_size) {
         m_dOldRate = m_dRate;  // If cleared, don't interpolate rate.
         m_bClear = false;
     }
+    applyInterpolation();
     float rate_add_old = m_dOldRate;  //Smoothly interpolate to new playback rate
     float rate_add_new = m_dRate;
     int samples_read = 0;
@@ -84,6 +158,24 @@ CSAMPLE* EngineBufferScaleLinear::getScaled(unsigned long buf_size) {
         return m_buffer;
     }
 
+    if (m_interpolation != LINEAR) {
+        if (rate_add_new * rate_add_old < 0) {
+            // Like below, half a buffer to zero and half a buffer back.
+            m_dOldRate = rate_add_old;
+            m_dRate = 0.0;
+            do_scale_kernel(m_buffer, buf_size / 2, &samples_read);
+            reverseKernelBuffer(rate_add_new, &samples_read);
+            m_dOldRate = 0.0;
+            m_dRate = rate_add_new;
+            do_scale_kernel(&m_buffer[buf_size / 2], buf_size / 2,
+                            &samples_read);
+        } else {
+            do_scale_kernel(m_buffer, buf_size, &samples_read);
+        }
+        m_samplesRead = samples_read;
+        return m_buffer;
+    }
+
     if (rate_add_new * rate_add_old < 0) {
         //calculate half buffer going one way, and half buffer going
         //the other way.
@@ -354,3 +446,146 @@ CSAMPLE* EngineBufferScaleLinear::do_scale(CSAMPLE* buf,
 
     return buf;
 }
+
+void EngineBufferScaleLinear::reverseKernelBuffer(double rate,
+                                                  int* samples_read) {
+    const int halfTaps = m_iKernelHistory + 1;
+    const int frame = static_cast<int>(floor(m_dKernelPosition));
+    const double frac = m_dKernelPosition - frame;
+
+    // Read the frames after the position again in the new direction, so the
+    // ReadAheadManager continues right before the position.
+    int extra_samples = (m_iKernelBufferFrames - frame - 1) * 2;
+    while (extra_samples > 0) {
+        const int read_size = m_pReadAheadManager->getNextSamples(
+                rate, m_bufferInt,
+                math_min(extra_samples, kiLinearScaleReadAheadLength));
+        if (read_size == 0) {
+            break;
+        }
+        *samples_read += read_size;
+        extra_samples -= read_size;
+    }
+
+    // The frames after the position are the history in the new direction.
+    CSAMPLE history[kSincMaxTaps];
+    for (int i = 0; i < halfTaps; ++i) {
+        const int source = frame + halfTaps - i;
+        if (source < m_iKernelBufferFrames) {
+            history[i * 2] = m_pKernelBuffer[source * 2];
+            history[i * 2 + 1] = m_pKernelBuffer[source * 2 + 1];
+        } else {
+            history[i * 2] = 0;
+            history[i * 2 + 1] = 0;
+        }
+    }
+    SampleUtil::copy(m_pKernelBuffer, history, halfTaps * 2);
+    m_iKernelBufferFrames = halfTaps;
+    m_dKernelPosition = halfTaps - frac;
+}
+
+bool EngineBufferScaleLinear::fillKernelBuffer(double rate,
+                                               double framesAhead,
+                                               int* samples_read) {
+    const int halfTaps = m_iKernelTaps / 2;
+
+    // Drop the frames that are not needed as history anymore.
+    const int drop = static_cast<int>(floor(m_dKernelPosition)) - m_iKernelHistory;
+    if (drop > 0) {
+        memmove(m_pKernelBuffer, &m_pKernelBuffer[drop * 2],
+                (m_iKernelBufferFrames - drop) * 2 * sizeof(CSAMPLE));
+        m_iKernelBufferFrames -= drop;
+        m_dKernelPosition -= drop;
+    }
+
+    // Read what is left to play in this buffer at once, like do_scale.
+    const int frames_needed = static_cast<int>(
+            ceil(m_dKernelPosition + framesAhead)) + halfTaps + 1 -
+            m_iKernelBufferFrames;
+    const int samples_to_read = 2 * math_min(
+            math_max(1, frames_needed),
+            kKernelBufferFrames - m_iKernelBufferFrames);
+    if (samples_to_read <= 0) {
+        return false;
+    }
+    const int read_size = m_pReadAheadManager->getNextSamples(
+            rate, &m_pKernelBuffer[m_iKernelBufferFrames * 2], samples_to_read);
+    *samples_read += read_size;
+    m_iKernelBufferFrames += read_size / 2;
+    return read_size > 0;
+}
+
+/** Stretch a specified buffer worth of audio using the kernel of
+    m_interpolation */
+CSAMPLE* EngineBufferScaleLinear::do_scale_kernel(CSAMPLE* buf,
+                                                  int buf_size,
+                                                  int* samples_read) {
+    const float rate_old = m_dOldRate;
+    const float rate_new = m_dRate;
+    const float rate_diff = rate_new - rate_old;
+
+    // Update the old base rate because we only need to
+    // interpolate/ramp up the pitch changes once.
+    m_dOldRate = m_dRate;
+
+    // Guard against buf_size == 0
+    if (buf_size == 0) {
+        return buf;
+    }
+
+    // Lower the cutoff of the sinc kernel when speeding up, so nothing
+    // above the Nyquist frequency of the output aliases.
+    const int sincBand = sincBandForRate(
+            math_max(fabs(rate_old), fabs(rate_new)));
+    if (m_interpolation == SINC) {
+        m_iKernelTaps = sincTapsOfBand(sincBand);
+    }
+    const int halfTaps = m_iKernelTaps / 2;
+    const int frames = buf_size / 2;
+    bool last_read_failed = false;
+
+    int i = 0;
+    while (i < buf_size) {
+        // If the kernel reaches past the buffer, load some more
+        while (static_cast<int>(floor(m_dKernelPosition)) + halfTaps >=
+               m_iKernelBufferFrames) {
+            // The sum of the ramped rate over the remaining frames
+            const int j = i / 2;
+            const double framesAhead = fabs(
+                    (frames - j) * rate_old + rate_diff *
+                    (static_cast<double>(frames) * (frames - 1) -
+                     static_cast<double>(j) * (j - 1)) / (2.0 * frames));
+            if (fillKernelBuffer(rate_new == 0 ? rate_old : rate_new,
+                                 framesAhead, samples_read)) {
+                last_read_failed = false;
+            } else if (last_read_failed) {
+                break;
+            } else {
+                last_read_failed = true;
+            }
+        }
+
+        if (last_read_failed) {
+            break;
+        }
+
+        const int frame = static_cast<int>(floor(m_dKernelPosition));
+        const double frac = m_dKernelPosition - frame;
+        const CSAMPLE* pFrames = &m_pKernelBuffer[(frame - halfTaps + 1) * 2];
+        if (m_interpolation == CUBIC) {
+            interpolateCubic(pFrames, static_cast<CSAMPLE>(frac), &buf[i]);
+        } else {
+            interpolateSinc(pFrames, frac, sincBand, &buf[i]);
+        }
+
+        // Smooth any changes in the playback rate over one buf_size
+        // samples, like do_scale.
+        const double rate_add = fabs((i * rate_diff / buf_size) + rate_old);
+        m_dKernelPosition += rate_add;
+        i += 2;
+    }
+
+    SampleUtil::clear(&buf[i], buf_size - i);
+
+    return buf;
+}
@@ -18,6 +18,8 @@
 #ifndef ENGINEBUFFERSCALELINEAR_H
 #define ENGINEBUFFERSCALELINEAR_H
 
+#include <QAtomicInt>
+
 #include "engine/enginebufferscale.h"
 #include "engine/readaheadmanager.h"
 
@@ -32,9 +34,22 @@ const int kiLinearScaleReadAheadLength = 10240;
 
 class EngineBufferScaleLinear : public EngineBufferScale  {
   public:
+    enum Interpolation {
+        LINEAR,
+        // 4-point Hermite
+        CUBIC,
+        // Windowed sinc of 16 taps, widened up to 64 taps when speeding up
+        SINC,
+        INTERPOLATION_COUNT
+    };
+
     EngineBufferScaleLinear(ReadAheadManager *pReadAheadManager);
     virtual ~EngineBufferScaleLinear();
 
+    // Selects the interpolation for the next call of getScaled(). Can be
+    // called from any thread.
+    void setInterpolation(Interpolation interpolation);
+
     CSAMPLE* getScaled(unsigned long buf_size);
     void clear();
 
@@ -45,6 +60,14 @@ class EngineBufferScaleLinear : public EngineBufferScale  {
   private:
     CSAMPLE* do_scale(CSAMPLE* buf, int buf_size,
                       int *samples_read);
+    // Like do_scale, with the kernel of m_interpolation instead of linear
+    // interpolation.
+    CSAMPLE* do_scale_kernel(CSAMPLE* buf, int buf_size,
+                             int *samples_read);
+    bool fillKernelBuffer(double rate, double framesAhead, int *samples_read);
+    void reverseKernelBuffer(double rate, int *samples_read);
+    void resetKernelBuffer();
+    void applyInterpolation();
 
     /** Holds playback direction */
     bool m_bBackwards;
@@ -60,6 +83,19 @@ class EngineBufferScaleLinear : public EngineBufferScale  {
     ReadAheadManager* m_pReadAheadManager;
     double m_dCurrentFrame;
     double m_dNextFrame;
+
+    QAtomicInt m_requestedInterpolation;
+    Interpolation m_interpolation;
+    // The taps of the current kernel. For SINC, they depend on the rate.
+    int m_iKernelTaps;
+    // The number of frames kept before the position, enough for the widest
+    // kernel of m_interpolation.
+    int m_iKernelHistory;
+    // Holds the frames around the position for CUBIC and SINC, starting
+    // with m_iKernelHistory frames before it.
+    CSAMPLE* m_pKernelBuffer;
+    int m_iKernelBufferFrames;
+    double m_dKernelPosition;
 };
 
 #endif
@@ -129,6 +129,31 @@ void EngineBufferScaleRubberBand::clear() {
     m_pRubberBand->reset();
 }
 
+double EngineBufferScaleRubberBand::getLatencyFrames() const {
+    return m_pRubberBand->getLatency();
+}
+
+void EngineBufferScaleRubberBand::shadowInput(const CSAMPLE* pInput,
+                                              unsigned long iNumSamples) {
+    if (m_dBaseRate == 0 || m_dTempoRatio == 0) {
+        return;
+    }
+    const int iNumChannels = 2;
+    unsigned long remaining_frames = iNumSamples / iNumChannels;
+    while (remaining_frames > 0) {
+        // Never pass more than the max process size we have promised
+        const unsigned long frames =
+                math_min<unsigned long>(remaining_frames, kRubberBandBlockSize);
+        deinterleaveAndProcess(pInput, frames, false);
+        pInput += frames * iNumChannels;
+        remaining_frames -= frames;
+        // Discard the output, m_buffer_back is free while we are inactive
+        while (retrieveAndDeinterleave(m_buffer_back,
+                                       MAX_BUFFER_LEN / iNumChannels) > 0) {
+        }
+    }
+}
+
 size_t EngineBufferScaleRubberBand::retrieveAndDeinterleave(CSAMPLE* pBuffer,
                                                             size_t frames) {
     size_t frames_available = m_pRubberBand->available();
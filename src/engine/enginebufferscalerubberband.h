@@ -28,8 +28,13 @@ class EngineBufferScaleRubberBand : public EngineBufferScale {
     // Flush buffer.
     void clear();
 
+    virtual double getLatencyFrames() const;
+
     // Reset RubberBand library with new samplerate.
     void initializeRubberBand(int iSampleRate);
+  protected:
+    virtual void shadowInput(const CSAMPLE* pInput, unsigned long iNumSamples);
+
   private:
     void deinterleaveAndProcess(const CSAMPLE* pBuffer, size_t frames, bool flush);
     size_t retrieveAndDeinterleave(CSAMPLE* pBuffer, size_t frames);
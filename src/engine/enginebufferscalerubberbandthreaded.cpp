@@ -0,0 +1,340 @@
+#include <QtDebug>
+
+#include "engine/enginebufferscalerubberbandthreaded.h"
+
+#include "engine/readaheadmanager.h"
+#include "sampleutil.h"
+#include "util/counter.h"
+#include "util/defs.h"
+#include "util/math.h"
+
+namespace {
+
+// The FIFOs hold about 0.7 seconds at 44.1 kHz.
+const int kFifoSamples = 1 << 17;
+const int kMessageFifoSize = 256;
+// Must be a power of 2.
+const int kHistoryFrames = 1 << 16;
+// The number of buffers the worker is kept ahead of playback.
+const int kLeadBuffers = 3;
+
+} // anonymous namespace
+
+EngineBufferScaleRubberBandThreaded::EngineBufferScaleRubberBandThreaded(
+    ReadAheadManager* pReadAheadManager)
+        : m_messageFIFO(kMessageFifoSize),
+          m_inputFIFO(kFifoSamples),
+          m_outputFIFO(kFifoSamples),
+          m_worker(&m_messageFIFO, &m_inputFIFO, &m_outputFIFO),
+          m_bBackwards(false),
+          m_dTimeRatio(1.0),
+          m_dPitchScale(1.0),
+          m_iGeneration(0),
+          m_bResetPending(false),
+          m_bResetAcknowledged(true),
+          m_bCleared(true),
+          m_outputSamplesRead(0),
+          m_iFramesToDrop(0),
+          m_iFallbackFrames(0),
+          m_pHistory(SampleUtil::alloc(kHistoryFrames * 2)),
+          m_iHistoryFrames(0),
+          m_dInputPosition(0.0),
+          m_buffer_back(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_pReadAheadManager(pReadAheadManager) {
+    m_worker.start(QThread::HighPriority);
+}
+
+EngineBufferScaleRubberBandThreaded::~EngineBufferScaleRubberBandThreaded() {
+    m_worker.quitWait();
+    SampleUtil::free(m_buffer_back);
+    SampleUtil::free(m_pHistory);
+}
+
+void EngineBufferScaleRubberBandThreaded::setScheduler(
+        EngineWorkerScheduler* pScheduler) {
+    m_worker.setScheduler(pScheduler);
+}
+
+void EngineBufferScaleRubberBandThreaded::setScaleParameters(
+        double base_rate, double* pTempoRatio, double* pPitchRatio) {
+    // Negative speed means we are going backwards. pitch does not affect
+    // the playback direction.
+    m_bBackwards = *pTempoRatio < 0;
+
+    // See EngineBufferScaleRubberBand::setScaleParameters().
+    const double kMinSeekSpeed = 1.0 / 128.0;
+    double speed_abs = fabs(*pTempoRatio);
+    if (speed_abs < kMinSeekSpeed) {
+        // Let the caller know we ignored their speed.
+        speed_abs = *pTempoRatio = 0;
+    }
+
+    // The worker applies both with the next input it receives.
+    double pitchScale = fabs(base_rate * *pPitchRatio);
+    if (pitchScale > 0) {
+        m_dPitchScale = pitchScale;
+    }
+    double timeRatioInverse = base_rate * speed_abs;
+    if (timeRatioInverse > 0) {
+        m_dTimeRatio = 1.0 / timeRatioInverse;
+    }
+
+    // Used by other methods so we need to keep them up to date.
+    m_dBaseRate = base_rate;
+    m_dTempoRatio = speed_abs;
+    m_dPitchRatio = *pPitchRatio;
+}
+
+void EngineBufferScaleRubberBandThreaded::setSampleRate(int iSampleRate) {
+    m_iSampleRate = iSampleRate;
+    // The worker recreates the stretcher, so this does not allocate in the
+    // callback.
+    if (writeMessage(RubberBandWorkerMessage::SET_SAMPLE_RATE, 0)) {
+        wakeWorker();
+    }
+    m_bCleared = false;
+    clear();
+}
+
+void EngineBufferScaleRubberBandThreaded::clear() {
+    if (m_bCleared) {
+        return;
+    }
+    ++m_iGeneration;
+    m_worker.requestGeneration(m_iGeneration);
+    m_bResetPending = true;
+    m_bResetAcknowledged = false;
+    m_bCleared = true;
+    m_iFramesToDrop = 0;
+    m_iFallbackFrames = 0;
+    m_iHistoryFrames = 0;
+    m_dInputPosition = 0.0;
+    if (writeMessage(RubberBandWorkerMessage::RESET, 0)) {
+        m_bResetPending = false;
+        wakeWorker();
+    }
+}
+
+int EngineBufferScaleRubberBandThreaded::getReadyFrames() const {
+    if (m_bResetPending ||
+            m_worker.getResetGeneration() != m_iGeneration) {
+        return 0;
+    }
+    int readySamples = m_outputFIFO.readAvailable();
+    if (!m_bResetAcknowledged) {
+        readySamples -= static_cast<int>(
+                static_cast<unsigned int>(m_worker.getSamplesWrittenAtReset()) -
+                m_outputSamplesRead);
+    }
+    return math_max(0, readySamples / 2 - m_iFramesToDrop);
+}
+
+double EngineBufferScaleRubberBandThreaded::getLatencyFrames() const {
+    return m_worker.getLatencyFrames() + m_outputFIFO.readAvailable() / 2;
+}
+
+void EngineBufferScaleRubberBandThreaded::shadowInput(const CSAMPLE* pInput,
+                                                      unsigned long iNumSamples) {
+    Q_UNUSED(pInput);
+    Q_UNUSED(iNumSamples);
+    // Stretching in the background would only fill the output FIFO with
+    // audio that is never played. Start over from the tapped position
+    // instead, the interpolation covers the first buffers after the switch.
+    clear();
+}
+
+bool EngineBufferScaleRubberBandThreaded::writeMessage(
+        RubberBandWorkerMessage::Type type, int numSamples) {
+    RubberBandWorkerMessage message;
+    message.type = type;
+    message.generation = m_iGeneration;
+    message.numSamples = numSamples;
+    message.timeRatio = m_dTimeRatio;
+    message.pitchScale = m_dPitchScale;
+    message.sampleRate = m_iSampleRate;
+    if (m_messageFIFO.write(&message, 1) != 1) {
+        Counter counter("EngineBufferScaleRubberBandThreaded message overflow");
+        counter.increment();
+        return false;
+    }
+    return true;
+}
+
+void EngineBufferScaleRubberBandThreaded::wakeWorker() {
+    if (!m_worker.workReady()) {
+        m_worker.wake();
+    }
+}
+
+int EngineBufferScaleRubberBandThreaded::skipOutput(int samples) {
+    samples = math_min(samples, m_outputFIFO.readAvailable());
+    if (samples > 0) {
+        m_outputFIFO.releaseReadRegions(samples);
+        m_outputSamplesRead += samples;
+    }
+    return samples;
+}
+
+bool EngineBufferScaleRubberBandThreaded::discardStaleOutput() {
+    if (m_bResetPending) {
+        if (!writeMessage(RubberBandWorkerMessage::RESET, 0)) {
+            return false;
+        }
+        m_bResetPending = false;
+        wakeWorker();
+    }
+    if (!m_bResetAcknowledged) {
+        if (m_worker.getResetGeneration() != m_iGeneration) {
+            // The worker may publish the reset and write new output at any
+            // time, so we must not touch the FIFO until it has.
+            return false;
+        }
+        const unsigned int staleSamples =
+                static_cast<unsigned int>(m_worker.getSamplesWrittenAtReset()) -
+                m_outputSamplesRead;
+        skipOutput(static_cast<int>(staleSamples));
+        m_bResetAcknowledged = true;
+    }
+    if (m_iFramesToDrop > 0) {
+        m_iFramesToDrop -= skipOutput(m_iFramesToDrop * 2) / 2;
+    }
+    return true;
+}
+
+void EngineBufferScaleRubberBandThreaded::feedWorker(int frames, double ratio) {
+    if (m_bResetPending) {
+        return;
+    }
+    const int iNumChannels = 2;
+
+    // The output frames we can expect without new input. Stale output is
+    // not counted before the reset has been acknowledged.
+    double expectedFrames =
+            static_cast<double>(m_inputFIFO.readAvailable() / iNumChannels) /
+            ratio;
+    if (m_bResetAcknowledged) {
+        expectedFrames +=
+                m_outputFIFO.readAvailable() / iNumChannels - m_iFramesToDrop;
+    }
+    // In any case the history must cover this buffer, in case the worker is
+    // late for longer than the lead.
+    const double missingInputFrames = math_max(
+            ((kLeadBuffers + 1) * frames - expectedFrames) * ratio,
+            m_dInputPosition + (frames + 1) * ratio + 1 - m_iHistoryFrames);
+    if (missingInputFrames <= 0) {
+        return;
+    }
+
+    // Keep half of the history for the frames that are still in flight.
+    const qint64 historyFree = kHistoryFrames / 2 -
+            (m_iHistoryFrames - static_cast<qint64>(m_dInputPosition));
+    int remainingFrames = static_cast<int>(math_min<double>(
+            ceil(missingInputFrames),
+            math_min<qint64>(historyFree,
+                             m_inputFIFO.writeAvailable() / iNumChannels)));
+
+    bool bWritten = false;
+    while (remainingFrames > 0 && m_messageFIFO.writeAvailable() > 0) {
+        const int samplesRead = m_pReadAheadManager->getNextSamples(
+                // The value doesn't matter here. All that matters is we
+                // are going forward or backward.
+                (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
+                m_buffer_back,
+                math_min<int>(remainingFrames * iNumChannels, MAX_BUFFER_LEN));
+        const int framesRead = samplesRead / iNumChannels;
+        if (framesRead <= 0) {
+            break;
+        }
+        m_inputFIFO.write(m_buffer_back, framesRead * iNumChannels);
+        writeMessage(RubberBandWorkerMessage::PROCESS,
+                     framesRead * iNumChannels);
+
+        // Copy into the history, wrapping around at its end.
+        const int offset = static_cast<int>(
+                m_iHistoryFrames & (kHistoryFrames - 1));
+        const int firstFrames = math_min(framesRead, kHistoryFrames - offset);
+        SampleUtil::copy(m_pHistory + offset * iNumChannels, m_buffer_back,
+                         firstFrames * iNumChannels);
+        SampleUtil::copy(m_pHistory, m_buffer_back + firstFrames * iNumChannels,
+                         (framesRead - firstFrames) * iNumChannels);
+
+        m_iHistoryFrames += framesRead;
+        remainingFrames -= framesRead;
+        m_bCleared = false;
+        bWritten = true;
+    }
+    if (bWritten) {
+        wakeWorker();
+    }
+}
+
+void EngineBufferScaleRubberBandThreaded::interpolateFromHistory(
+        CSAMPLE* pOutput, int frames, double position, double ratio) {
+    // Align with the output of the worker, which is delayed by the latency
+    // of the stretcher.
+    position -= m_worker.getLatencyFrames() * ratio;
+    const qint64 oldestFrame =
+            math_max<qint64>(0, m_iHistoryFrames - kHistoryFrames);
+    for (int i = 0; i < frames; ++i) {
+        const double framePosition = position + i * ratio;
+        const qint64 frame = static_cast<qint64>(floor(framePosition));
+        if (frame < oldestFrame || frame + 1 >= m_iHistoryFrames) {
+            pOutput[i * 2] = 0;
+            pOutput[i * 2 + 1] = 0;
+            continue;
+        }
+        const CSAMPLE frac = static_cast<CSAMPLE>(framePosition - frame);
+        const CSAMPLE* pFirst =
+                m_pHistory + (frame & (kHistoryFrames - 1)) * 2;
+        const CSAMPLE* pSecond =
+                m_pHistory + ((frame + 1) & (kHistoryFrames - 1)) * 2;
+        pOutput[i * 2] = pFirst[0] + frac * (pSecond[0] - pFirst[0]);
+        pOutput[i * 2 + 1] = pFirst[1] + frac * (pSecond[1] - pFirst[1]);
+    }
+}
+
+CSAMPLE* EngineBufferScaleRubberBandThreaded::getScaled(unsigned long buf_size) {
+    m_samplesRead = 0.0;
+
+    if (m_dBaseRate == 0 || m_dTempoRatio == 0) {
+        SampleUtil::clear(m_buffer, buf_size);
+        m_samplesRead = buf_size;
+        return m_buffer;
+    }
+
+    const int iNumChannels = 2;
+    const int frames = buf_size / iNumChannels;
+    // The input frames per output frame
+    const double ratio = m_dBaseRate * m_dTempoRatio;
+
+    const bool bOutputValid = discardStaleOutput();
+    feedWorker(frames, ratio);
+
+    int received_frames = 0;
+    if (bOutputValid && m_iFramesToDrop == 0) {
+        received_frames =
+                m_outputFIFO.read(m_buffer, frames * iNumChannels) / iNumChannels;
+        m_outputSamplesRead += received_frames * iNumChannels;
+    }
+
+    if (received_frames < frames) {
+        // The worker is late. Play the input like the linear scaler and drop
+        // the output of the worker for these frames once it arrives.
+        const int missing_frames = frames - received_frames;
+        interpolateFromHistory(m_buffer + received_frames * iNumChannels,
+                               missing_frames,
+                               m_dInputPosition + received_frames * ratio,
+                               ratio);
+        m_iFramesToDrop += missing_frames;
+        m_iFallbackFrames += missing_frames;
+        Counter counter("EngineBufferScaleRubberBandThreaded::getScaled fallback");
+        counter.increment();
+    }
+
+    m_dInputPosition += frames * ratio;
+
+    // Like EngineBufferScaleRubberBand, the virtual samples consumed to
+    // produce the scaled buffer.
+    m_samplesRead = ratio * frames * iNumChannels;
+    return m_buffer;
+}
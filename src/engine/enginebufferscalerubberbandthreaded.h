@@ -0,0 +1,101 @@
+#ifndef ENGINEBUFFERSCALERUBBERBANDTHREADED_H
+#define ENGINEBUFFERSCALERUBBERBANDTHREADED_H
+
+#include "engine/enginebufferscale.h"
+#include "engine/rubberbandworker.h"
+#include "util/fifo.h"
+
+class EngineWorkerScheduler;
+class ReadAheadManager;
+
+// Time-stretches with librubberband on a RubberBandWorker thread a few
+// buffers ahead of playback. getScaled() reads the input for the worker from
+// the ReadAheadManager and only copies already stretched audio. If the worker
+// falls behind, the missing frames are linearly interpolated from the input
+// like EngineBufferScaleLinear does, and the late output is dropped when it
+// arrives. This class is not thread safe.
+class EngineBufferScaleRubberBandThreaded : public EngineBufferScale {
+    Q_OBJECT
+  public:
+    EngineBufferScaleRubberBandThreaded(ReadAheadManager* pReadAheadManager);
+    virtual ~EngineBufferScaleRubberBandThreaded();
+
+    // Without a scheduler the worker is woken up directly.
+    void setScheduler(EngineWorkerScheduler* pScheduler);
+
+    virtual void setScaleParameters(double base_rate,
+                                    double* pTempoRatio,
+                                    double* pPitchRatio);
+
+    virtual void setSampleRate(int iSampleRate);
+
+    // Read and scale buf_size samples from the provided RAMAN.
+    CSAMPLE* getScaled(unsigned long buf_size);
+
+    // Flush buffer.
+    void clear();
+
+    virtual double getLatencyFrames() const;
+
+    // The number of frames that were interpolated because the worker was
+    // late, since the last clear().
+    int getFallbackFrames() const {
+        return m_iFallbackFrames;
+    }
+
+    // The number of stretched frames the worker has ready for the next
+    // getScaled() calls. Output from before the last clear() is not counted.
+    int getReadyFrames() const;
+
+  protected:
+    virtual void shadowInput(const CSAMPLE* pInput, unsigned long iNumSamples);
+
+  private:
+    bool writeMessage(RubberBandWorkerMessage::Type type, int numSamples);
+    void wakeWorker();
+    int skipOutput(int samples);
+    // Returns false if the output FIFO still holds output from before the
+    // last clear().
+    bool discardStaleOutput();
+    void feedWorker(int frames, double ratio);
+    void interpolateFromHistory(CSAMPLE* pOutput, int frames,
+                                double position, double ratio);
+
+    FIFO<RubberBandWorkerMessage> m_messageFIFO;
+    FIFO<CSAMPLE> m_inputFIFO;
+    FIFO<CSAMPLE> m_outputFIFO;
+    RubberBandWorker m_worker;
+
+    // Holds the playback direction
+    bool m_bBackwards;
+    double m_dTimeRatio;
+    double m_dPitchScale;
+
+    // The generation of the last clear() and whether its RESET message is
+    // still to be written or still to be processed.
+    int m_iGeneration;
+    bool m_bResetPending;
+    bool m_bResetAcknowledged;
+    // Nothing has been written to the worker since the last clear().
+    bool m_bCleared;
+
+    // The total number of samples read from the output FIFO. Wraps around.
+    unsigned int m_outputSamplesRead;
+    // Frames of worker output that have been replaced by interpolation.
+    int m_iFramesToDrop;
+    int m_iFallbackFrames;
+
+    // A copy of the input sent to the worker since the last clear() in
+    // playback order, for the interpolation.
+    CSAMPLE* m_pHistory;
+    qint64 m_iHistoryFrames;
+    // The input frame at the start of the next output buffer.
+    double m_dInputPosition;
+
+    CSAMPLE* m_buffer_back;
+
+    // The read-ahead manager that we use to fetch samples
+    ReadAheadManager* m_pReadAheadManager;
+};
+
+#endif /* ENGINEBUFFERSCALERUBBERBANDTHREADED_H */
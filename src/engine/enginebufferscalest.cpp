@@ -113,6 +113,38 @@ void EngineBufferScaleST::clear() {
     m_pSoundTouch->clear();
 }
 
+double EngineBufferScaleST::getLatencyFrames() const {
+    if (m_dBaseRate == 0 || m_dTempoRatio == 0) {
+        return 0.0;
+    }
+    // SoundTouch has no fixed latency. The delay is the unprocessed input,
+    // converted to output frames, plus the output that is ready.
+    return m_pSoundTouch->numUnprocessedSamples() /
+            (m_dBaseRate * m_dTempoRatio) + m_pSoundTouch->numSamples();
+}
+
+void EngineBufferScaleST::shadowInput(const CSAMPLE* pInput,
+                                      unsigned long iNumSamples) {
+    if (m_dBaseRate == 0 || m_dTempoRatio == 0 || m_dPitchRatio == 0) {
+        return;
+    }
+    const int iNumChannels = 2;
+    unsigned long remaining_frames = iNumSamples / iNumChannels;
+    while (remaining_frames > 0) {
+        // Pass the same chunks as getScaled() so SoundTouch never needs to
+        // grow its buffers.
+        const unsigned long frames = math_min<unsigned long>(
+                remaining_frames, kiSoundTouchReadAheadLength);
+        m_pSoundTouch->putSamples(pInput, frames);
+        pInput += frames * iNumChannels;
+        remaining_frames -= frames;
+        // Discard the output, buffer_back is free while we are inactive
+        while (m_pSoundTouch->receiveSamples(
+                buffer_back, kiSoundTouchReadAheadLength) > 0) {
+        }
+    }
+}
+
 CSAMPLE* EngineBufferScaleST::getScaled(unsigned long buf_size) {
     m_samplesRead = 0.0;
 
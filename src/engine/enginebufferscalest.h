@@ -55,6 +55,11 @@ class EngineBufferScaleST : public EngineBufferScale {
     // Flush buffer.
     void clear();
 
+    virtual double getLatencyFrames() const;
+
+  protected:
+    virtual void shadowInput(const CSAMPLE* pInput, unsigned long iNumSamples);
+
   private:
     // Holds the playback direction.
     bool m_bBackwards;
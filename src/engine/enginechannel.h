@@ -60,6 +60,10 @@ class EngineChannel : public EngineObject {
     void setTalkover(bool enabled);
     virtual bool isTalkoverEnabled() const;
 
+    // Called serially for every active channel before any channel is
+    // processed. Channels may be processed in parallel, so state shared
+    // between channels must only be touched here or in postProcess.
+    virtual void preProcess(const int iBufferSize) = 0;
     virtual void process(CSAMPLE* pOut, const int iBufferSize) = 0;
     virtual void postProcess(const int iBuffersize) = 0;
 
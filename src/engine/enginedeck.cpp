@@ -110,6 +110,10 @@ void EngineDeck::process(CSAMPLE* pOut, const int iBufferSize) {
     m_pVUMeter->process(pOut, iBufferSize);
 }
 
+void EngineDeck::preProcess(const int iBufferSize) {
+    m_pBuffer->preProcess(iBufferSize);
+}
+
 void EngineDeck::postProcess(const int iBufferSize) {
     m_pBuffer->postProcess(iBufferSize);
 }
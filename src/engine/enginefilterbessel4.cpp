@@ -9,7 +9,6 @@ EngineFilterBessel4Low::EngineFilterBessel4Low(int sampleRate,
 
 void EngineFilterBessel4Low::setFrequencyCorners(int sampleRate,
                                                  double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs("LpBe4", sampleRate, freqCorner1);
 }
 
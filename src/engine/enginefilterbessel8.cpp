@@ -9,7 +9,6 @@ EngineFilterBessel8Low::EngineFilterBessel8Low(int sampleRate,
 
 void EngineFilterBessel8Low::setFrequencyCorners(int sampleRate,
                                                  double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs("LpBe8", sampleRate, freqCorner1);
 }
 
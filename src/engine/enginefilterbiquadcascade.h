@@ -0,0 +1,146 @@
+#ifndef ENGINEFILTERBIQUADCASCADE_H
+#define ENGINEFILTERBIQUADCASCADE_H
+
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "util/types.h"
+
+// The coefficients of one second order section
+// H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+// First order sections have b2 = a2 = 0.
+struct BiquadCoefficients {
+    double b0;
+    double b1;
+    double b2;
+    double a1;
+    double a2;
+};
+
+// A cascade of NUM_STAGES biquads in transposed direct form II that filters
+// both channels of an interleaved stereo buffer at once. With SSE2 the left
+// and right channel are the two lanes of one register, so each frame costs
+// the same as a single channel of the direct form II code it replaces.
+//
+// The transposed direct form keeps its state in the scale of the output,
+// which makes it robust against the large internal gain of low frequency
+// sections and allows to move the coefficients without resetting the state:
+// Since the stability region of a biquad is convex, all coefficients on the
+// line between two stable biquads are stable as well.
+template<int NUM_STAGES>
+class EngineFilterBiquadCascade {
+  public:
+    // The number of frames that are processed with the same coefficients
+    // while ramping.
+    static const int kRampFrames = 16;
+
+    EngineFilterBiquadCascade() {
+        memset(m_coefs, 0, sizeof(m_coefs));
+        reset();
+    }
+
+    void reset() {
+        memset(m_state, 0, sizeof(m_state));
+    }
+
+    void setCoefficients(const BiquadCoefficients* pCoefs) {
+        memcpy(m_coefs, pCoefs, sizeof(m_coefs));
+    }
+
+    // Filters numFrames interleaved stereo frames. pIn may be equal to pOut.
+    void process(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames) {
+        processBlock(pIn, pOut, numFrames);
+    }
+
+    // Filters like process() while moving the coefficients linearly from the
+    // current ones to pTarget. The coefficients are updated every kRampFrames
+    // and are equal to pTarget for the last frames of the buffer.
+    void processRamping(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames,
+                        const BiquadCoefficients* pTarget) {
+        BiquadCoefficients start[NUM_STAGES];
+        memcpy(start, m_coefs, sizeof(start));
+        for (int frame = 0; frame < numFrames; frame += kRampFrames) {
+            const int frames = math_min(kRampFrames, numFrames - frame);
+            const double ratio =
+                    static_cast<double>(frame + frames) / numFrames;
+            for (int i = 0; i < NUM_STAGES; ++i) {
+                m_coefs[i].b0 = start[i].b0 + (pTarget[i].b0 - start[i].b0) * ratio;
+                m_coefs[i].b1 = start[i].b1 + (pTarget[i].b1 - start[i].b1) * ratio;
+                m_coefs[i].b2 = start[i].b2 + (pTarget[i].b2 - start[i].b2) * ratio;
+                m_coefs[i].a1 = start[i].a1 + (pTarget[i].a1 - start[i].a1) * ratio;
+                m_coefs[i].a2 = start[i].a2 + (pTarget[i].a2 - start[i].a2) * ratio;
+            }
+            processBlock(pIn + frame * 2, pOut + frame * 2, frames);
+        }
+        setCoefficients(pTarget);
+    }
+
+  private:
+#ifdef __SSE2__
+    void processBlock(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames) {
+        __m128d b0[NUM_STAGES];
+        __m128d b1[NUM_STAGES];
+        __m128d b2[NUM_STAGES];
+        __m128d a1[NUM_STAGES];
+        __m128d a2[NUM_STAGES];
+        __m128d s1[NUM_STAGES];
+        __m128d s2[NUM_STAGES];
+        for (int i = 0; i < NUM_STAGES; ++i) {
+            b0[i] = _mm_set1_pd(m_coefs[i].b0);
+            b1[i] = _mm_set1_pd(m_coefs[i].b1);
+            b2[i] = _mm_set1_pd(m_coefs[i].b2);
+            a1[i] = _mm_set1_pd(m_coefs[i].a1);
+            a2[i] = _mm_set1_pd(m_coefs[i].a2);
+            s1[i] = _mm_loadu_pd(m_state[i][0]);
+            s2[i] = _mm_loadu_pd(m_state[i][1]);
+        }
+        for (int frame = 0; frame < numFrames; ++frame) {
+            // Load one float frame into the lower half and widen it.
+            __m128d x = _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(
+                    reinterpret_cast<const double*>(pIn + frame * 2))));
+            for (int i = 0; i < NUM_STAGES; ++i) {
+                const __m128d y = _mm_add_pd(_mm_mul_pd(b0[i], x), s1[i]);
+                s1[i] = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(b1[i], x),
+                                              _mm_mul_pd(a1[i], y)),
+                                   s2[i]);
+                s2[i] = _mm_sub_pd(_mm_mul_pd(b2[i], x),
+                                   _mm_mul_pd(a2[i], y));
+                x = y;
+            }
+            _mm_storel_pi(reinterpret_cast<__m64*>(pOut + frame * 2),
+                          _mm_cvtpd_ps(x));
+        }
+        for (int i = 0; i < NUM_STAGES; ++i) {
+            _mm_storeu_pd(m_state[i][0], s1[i]);
+            _mm_storeu_pd(m_state[i][1], s2[i]);
+        }
+    }
+#else
+    void processBlock(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames) {
+        for (int frame = 0; frame < numFrames; ++frame) {
+            double x[2] = { pIn[frame * 2], pIn[frame * 2 + 1] };
+            for (int i = 0; i < NUM_STAGES; ++i) {
+                const BiquadCoefficients& c = m_coefs[i];
+                double (&s)[2][2] = m_state[i];
+                for (int ch = 0; ch < 2; ++ch) {
+                    const double y = c.b0 * x[ch] + s[0][ch];
+                    s[0][ch] = c.b1 * x[ch] - c.a1 * y + s[1][ch];
+                    s[1][ch] = c.b2 * x[ch] - c.a2 * y;
+                    x[ch] = y;
+                }
+            }
+            pOut[frame * 2] = static_cast<CSAMPLE>(x[0]);
+            pOut[frame * 2 + 1] = static_cast<CSAMPLE>(x[1]);
+        }
+    }
+#endif
+
+    BiquadCoefficients m_coefs[NUM_STAGES];
+    // Per stage: the first and second state of the left and right channel
+    double m_state[NUM_STAGES][2][2];
+};
+
+#endif // ENGINEFILTERBIQUADCASCADE_H
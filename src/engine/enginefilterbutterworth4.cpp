@@ -7,7 +7,6 @@ EngineFilterButterworth4Low::EngineFilterButterworth4Low(int sampleRate, double
 
 void EngineFilterButterworth4Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs("LpBu4", sampleRate, freqCorner1);
 }
 
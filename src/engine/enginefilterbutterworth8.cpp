@@ -6,7 +6,6 @@ EngineFilterButterworth8Low::EngineFilterButterworth8Low(int sampleRate, double
 
 void EngineFilterButterworth8Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs("LpBu8", sampleRate, freqCorner1);
 }
 
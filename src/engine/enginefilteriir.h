@@ -3,6 +3,7 @@
 
 #include <string.h>
 
+#include "engine/enginefilterbiquadcascade.h"
 #include "engine/engineobject.h"
 #include "sampleutil.h"
 #define MIXXX
@@ -32,6 +33,40 @@ class EngineFilterIIRBase : public EngineObjectConstIn {
 // length of the 3rd argument to fid_design_coef
 #define FIDSPEC_LENGTH 40
 
+// The number of biquads that implement an EngineFilterIIR<SIZE, PASS>
+template<unsigned int SIZE, enum IIRPass PASS>
+struct IIRBiquadCount {
+    static const int value = SIZE / 2;
+};
+
+template<>
+struct IIRBiquadCount<5, IIR_BP> {
+    static const int value = 1;
+};
+
+template<>
+struct IIRBiquadCount<4, IIR_LPMO> {
+    static const int value = 4;
+};
+
+template<>
+struct IIRBiquadCount<4, IIR_HPMO> {
+    static const int value = 4;
+};
+
+// Converts numStages second order sections with a common numerator from the
+// coefficient layout of fid_design_coef(), without the leading gain.
+inline void fidlibSectionsToBiquads(const double* coef, int numStages,
+        double b1, double b2, BiquadCoefficients* pBiquads) {
+    for (int i = 0; i < numStages; ++i) {
+        pBiquads[i].b0 = 1.0;
+        pBiquads[i].b1 = b1;
+        pBiquads[i].b2 = b2;
+        pBiquads[i].a1 = coef[i * 2 + 1];
+        pBiquads[i].a2 = coef[i * 2];
+    }
+}
+
 template<unsigned int SIZE, enum IIRPass PASS>
 class EngineFilterIIR : public EngineFilterIIRBase {
   public:
@@ -40,6 +75,7 @@ class EngineFilterIIR : public EngineFilterIIRBase {
               m_doStart(false),
               m_startFromDry(false) {
         memset(m_coef, 0, sizeof(m_coef));
+        memset(m_biquads, 0, sizeof(m_biquads));
         pauseFilter();
     }
 
@@ -66,13 +102,14 @@ class EngineFilterIIR : public EngineFilterIIRBase {
         pauseFilterInner();
     }
 
+    // Converts m_coef into biquads and ramps to them during the next
+    // process() call
     void initBuffers() {
-        // Copy the current buffers into the old buffers
-        memcpy(m_oldBuf1, m_buf1, sizeof(m_buf1));
-        memcpy(m_oldBuf2, m_buf2, sizeof(m_buf2));
-        // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        toBiquads(m_coef, m_biquads);
+        // Apply the gain at the first stage, like fidlib does
+        m_biquads[0].b0 *= m_coef[0];
+        m_biquads[0].b1 *= m_coef[0];
+        m_biquads[0].b2 *= m_coef[0];
         m_doRamping = true;
     }
 
@@ -84,8 +121,6 @@ class EngineFilterIIR : public EngineFilterIIRBase {
             // Copy to dynamic-ish memory to prevent fidlib API breakage.
             strcpy(spec_d, spec);
 
-            // Copy the old coefficients into m_oldCoef
-            memcpy(m_oldCoef, m_coef, sizeof(m_coef));
 
             m_coef[0] = fid_design_coef(m_coef + 1, SIZE,
                     spec_d, sampleRate, freq0, freq1, adj);
@@ -133,8 +168,6 @@ class EngineFilterIIR : public EngineFilterIIRBase {
             strcpy(spec1_d, spec1);
             strcpy(spec2_d, spec2);
 
-            // Copy the old coefficients into m_oldCoef
-            memcpy(m_oldCoef, m_coef, sizeof(m_coef));
             m_coef[0] = fid_design_coef(m_coef + 1, n_coef1,
                     spec1, sampleRate, freq01, freq11, adj1) *
                         fid_design_coef(m_coef + 1 + n_coef1, SIZE - n_coef1,
@@ -183,6 +216,7 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     }
 
     virtual void assumeSettled() {
+        m_cascade.setCoefficients(m_biquads);
         m_doRamping = false;
         m_doStart = false;
     }
@@ -190,376 +224,183 @@ class EngineFilterIIR : public EngineFilterIIRBase {
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput,
                          const int iBufferSize) {
         if (!m_doRamping) {
-            for (int i = 0; i < iBufferSize; i += 2) {
-                pOutput[i] = processSample(m_coef, m_buf1, pIn[i]);
-                pOutput[i+1] = processSample(m_coef, m_buf2, pIn[i + 1]);
-            }
+            m_cascade.process(pIn, pOutput, iBufferSize / 2);
+        } else if (!m_doStart) {
+            // Move the running filter to the new coefficients. Its state
+            // stays valid, so there is no need for a second filter to
+            // cross fade from.
+            m_cascade.processRamping(pIn, pOutput, iBufferSize / 2,
+                    m_biquads);
+            m_doRamping = false;
         } else {
-            double cross_mix = 0.0;
-            double cross_inc = 4.0 / static_cast<double>(iBufferSize);
-            for (int i = 0; i < iBufferSize; i += 2) {
-                // Do a linear cross fade between the output of the old
-                // Filter and the new filter.
-                // The new filter is settled for Input = 0 and it sees
-                // all frequencies of the rectangular start impulse.
-                // Since the group delay, after which the start impulse
-                // has passed is unknown here, we just what the half
-                // iBufferSize until we use the samples of the new filter.
-                // In one of the previous version we have faded the Input
-                // of the new filter but it turns out that this produces
-                // a gain drop due to the filter delay which is more
-                // conspicuous than the settling noise.
-                double old1;
-                double old2;
-                if (!m_doStart) {
-                    // Process old filter, but only if we do not do a fresh start
-                    old1 = processSample(m_oldCoef, m_oldBuf1, pIn[i]);
-                    old2 = processSample(m_oldCoef, m_oldBuf2, pIn[i + 1]);
-                } else {
-                    if (m_startFromDry) {
-                        old1 = pIn[i];
-                        old2 = pIn[i + 1];
-                    } else {
-                        old1 = 0;
-                        old2 = 0;
-                    }
-                }
-                double new1 = processSample(m_coef, m_buf1, pIn[i]);
-                double new2 = processSample(m_coef, m_buf2, pIn[i + 1]);
-
-                if (i < iBufferSize / 2) {
-                    pOutput[i] = old1;
-                    pOutput[i + 1] = old2;
-                } else {
-                    pOutput[i] = new1 * cross_mix +
-                                 old1 * (1.0 - cross_mix);
-                    pOutput[i + 1] = new2  * cross_mix +
-                                     old2 * (1.0 - cross_mix);
-                    cross_mix += cross_inc;
-                }
-            }
+            processStart(pIn, pOutput, iBufferSize);
             m_doRamping = false;
             m_doStart = false;
         }
     }
 
   protected:
-    inline double processSample(double* coef, double* buf, double val);
+    // Converts the coefficients of fid_design_coef() into biquads. The gain
+    // at coef[0] is left out.
+    static inline void toBiquads(const double* coef,
+            BiquadCoefficients* pBiquads);
+
     inline void pauseFilterInner() {
-        // Set the current buffers to 0
-        memset(m_buf1, 0, sizeof(m_buf1));
-        memset(m_buf2, 0, sizeof(m_buf2));
+        // Set the current state to 0
+        m_cascade.reset();
         m_doRamping = true;
         m_doStart = true;
     }
 
-    double m_coef[SIZE + 1];
-    // Old coefficients needed for ramping
-    double m_oldCoef[SIZE + 1];
-
-    // Channel 1 state
-    double m_buf1[SIZE];
-    // Old channel 1 buffer needed for ramping
-    double m_oldBuf1[SIZE];
+    // Starts the paused filter with a linear cross fade from dry or 0.
+    void processStart(const CSAMPLE* pIn, CSAMPLE* pOutput,
+                      const int iBufferSize) {
+        // The new filter is settled for Input = 0 and it sees
+        // all frequencies of the rectangular start impulse.
+        // Since the group delay, after which the start impulse
+        // has passed is unknown here, we just what the half
+        // iBufferSize until we use the samples of the new filter.
+        // In one of the previous version we have faded the Input
+        // of the new filter but it turns out that this produces
+        // a gain drop due to the filter delay which is more
+        // conspicuous than the settling noise.
+        const int kChunkFrames = 64;
+        CSAMPLE filtered[kChunkFrames * 2];
+        m_cascade.setCoefficients(m_biquads);
+        const int numFrames = iBufferSize / 2;
+        const double cross_inc = 4.0 / static_cast<double>(iBufferSize);
+        double cross_mix = 0.0;
+        for (int frame = 0; frame < numFrames; frame += kChunkFrames) {
+            const int frames = math_min(kChunkFrames, numFrames - frame);
+            const CSAMPLE* pChunkIn = pIn + frame * 2;
+            CSAMPLE* pChunkOut = pOutput + frame * 2;
+            m_cascade.process(pChunkIn, filtered, frames);
+            for (int i = 0; i < frames * 2; i += 2) {
+                const double old1 = m_startFromDry ? pChunkIn[i] : 0;
+                const double old2 = m_startFromDry ? pChunkIn[i + 1] : 0;
+                if (frame * 2 + i < iBufferSize / 2) {
+                    pChunkOut[i] = old1;
+                    pChunkOut[i + 1] = old2;
+                } else {
+                    pChunkOut[i] = filtered[i] * cross_mix +
+                                   old1 * (1.0 - cross_mix);
+                    pChunkOut[i + 1] = filtered[i + 1] * cross_mix +
+                                       old2 * (1.0 - cross_mix);
+                    cross_mix += cross_inc;
+                }
+            }
+        }
+    }
 
-    // Channel 2 state
-    double m_buf2[SIZE];
-    // Old channel 2 buffer needed for ramping
-    double m_oldBuf2[SIZE];
+    double m_coef[SIZE + 1];
+    // The target coefficients of m_cascade
+    BiquadCoefficients m_biquads[IIRBiquadCount<SIZE, PASS>::value];
+    // The filter state of both channels
+    EngineFilterBiquadCascade<IIRBiquadCount<SIZE, PASS>::value> m_cascade;
 
     // Flag set to true if ramping needs to be done
     bool m_doRamping;
-    // Flag set to true if old filter is invalid
+    // Flag set to true if the filter state is invalid
     bool m_doStart;
     // Flag set to true if this is a chained filter
     bool m_startFromDry;
 };
 
+// The sections of fidlib's low pass filters have the numerator
+// 1 + 2 z^-1 + z^-2, high pass sections 1 - 2 z^-1 + z^-2 and band pass
+// biquads 1 - z^-2. Band pass filters of higher order are a cascade of high
+// and low pass sections.
+
 template<>
-inline double EngineFilterIIR<2, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += buf[0] + buf[0];
-    fir += iir;
-    buf[1] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<2, IIR_LP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 1, 2.0, 1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = -tmp;
-    iir -= coef[2] * buf[0];
-    fir += iir;
-    buf[1] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<2, IIR_BP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 1, 0.0, -1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<2, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += -buf[0] - buf[0];
-    fir += iir;
-    buf[1] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<2, IIR_HP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 1, -2.0, 1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += buf[0] + buf[0];
-    fir += iir;
-    tmp = buf[1]; buf[1] = iir; val = fir;
-    iir = val;
-    iir -= coef[3] * tmp; fir = tmp;
-    iir -= coef[4] * buf[2]; fir += buf[2] + buf[2];
-    fir += iir;
-    buf[3] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<4, IIR_LP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 2, 2.0, 1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-    buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += -buf[0] - buf[0];
-    fir += iir;
-    tmp = buf[1]; buf[1] = iir; val= fir;
-    iir = val;
-    iir -= coef[3] * tmp; fir = tmp;
-    iir -= coef[4] * buf[2]; fir += -buf[2] - buf[2];
-    fir += iir;
-    tmp = buf[3]; buf[3] = iir; val= fir;
-    iir = val;
-    iir -= coef[5] * tmp; fir = tmp;
-    iir -= coef[6] * buf[4]; fir += buf[4] + buf[4];
-    fir += iir;
-    tmp = buf[5]; buf[5] = iir; val= fir;
-    iir = val;
-    iir -= coef[7] * tmp; fir = tmp;
-    iir -= coef[8] * buf[6]; fir += buf[6] + buf[6];
-    fir += iir;
-    buf[7] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<4, IIR_HP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 2, -2.0, 1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<4, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-    iir= val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += -buf[0] - buf[0];
-    fir += iir;
-    tmp = buf[1]; buf[1] = iir; val = fir;
-    iir = val;
-    iir -= coef[3] * tmp; fir = tmp;
-    iir -= coef[4] * buf[2]; fir += -buf[2] - buf[2];
-    fir += iir;
-    buf[3] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<8, IIR_LP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 4, 2.0, 1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_LP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-    buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += buf[0] + buf[0];
-    fir += iir;
-    tmp = buf[1]; buf[1] = iir; val = fir;
-    iir = val;
-    iir -= coef[3] * tmp; fir = tmp;
-    iir -= coef[4] * buf[2]; fir += buf[2] + buf[2];
-    fir += iir;
-    tmp = buf[3]; buf[3] = iir; val = fir;
-    iir = val;
-    iir -= coef[5] * tmp; fir = tmp;
-    iir -= coef[6] * buf[4]; fir += buf[4] + buf[4];
-    fir += iir;
-    tmp = buf[5]; buf[5] = iir; val = fir;
-    iir = val;
-    iir -= coef[7] * tmp; fir = tmp;
-    iir -= coef[8] * buf[6]; fir += buf[6] + buf[6];
-    fir += iir;
-    buf[7] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<8, IIR_BP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 2, -2.0, 1.0, pBiquads);
+    fidlibSectionsToBiquads(coef + 5, 2, 2.0, 1.0, pBiquads + 2);
 }
 
 template<>
-inline double EngineFilterIIR<16, IIR_BP>::processSample(double* coef,
-                                                         double* buf,
-                                                         double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-    buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
-    buf[7] = buf[8]; buf[8] = buf[9]; buf[9] = buf[10]; buf[10] = buf[11];
-    buf[11] = buf[12]; buf[12] = buf[13]; buf[13] = buf[14]; buf[14] = buf[15];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += -buf[0] - buf[0];
-    fir += iir;
-    tmp = buf[1]; buf[1] = iir; val = fir;
-    iir = val;
-    iir -= coef[3] * tmp; fir = tmp;
-    iir -= coef[4] * buf[2]; fir += -buf[2] - buf[2];
-    fir += iir;
-    tmp = buf[3]; buf[3] = iir; val = fir;
-    iir = val;
-    iir -= coef[5] * tmp; fir = tmp;
-    iir -= coef[6] * buf[4]; fir += -buf[4] - buf[4];
-    fir += iir;
-    tmp = buf[5]; buf[5] = iir; val = fir;
-    iir = val;
-    iir -= coef[7] * tmp; fir = tmp;
-    iir -= coef[8] * buf[6]; fir += -buf[6] - buf[6];
-    fir += iir;
-    tmp = buf[7]; buf[7]= iir; val= fir;
-    iir = val;
-    iir -= coef[9] * tmp; fir = tmp;
-    iir -= coef[10] * buf[8]; fir += buf[8] + buf[8];
-    fir += iir;
-    tmp = buf[9]; buf[9] = iir; val = fir;
-    iir = val;
-    iir -= coef[11] * tmp; fir = tmp;
-    iir -= coef[12] * buf[10]; fir += buf[10] + buf[10];
-    fir += iir;
-    tmp = buf[11]; buf[11] = iir; val = fir;
-    iir = val;
-    iir -= coef[13] * tmp; fir = tmp;
-    iir -= coef[14] * buf[12]; fir += buf[12] + buf[12];
-    fir += iir;
-    tmp = buf[13]; buf[13] = iir; val = fir;
-    iir = val;
-    iir -= coef[15] * tmp; fir = tmp;
-    iir -= coef[16] * buf[14]; fir += buf[14] + buf[14];
-    fir += iir;
-    buf[15] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<8, IIR_HP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 4, -2.0, 1.0, pBiquads);
 }
 
 template<>
-inline double EngineFilterIIR<8, IIR_HP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-    buf[3] = buf[4]; buf[4] = buf[5]; buf[5] = buf[6]; buf[6] = buf[7];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = tmp;
-    iir -= coef[2] * buf[0]; fir += -buf[0] - buf[0];
-    fir += iir;
-    tmp = buf[1]; buf[1] = iir; val = fir;
-    iir = val;
-    iir -= coef[3] * tmp; fir = tmp;
-    iir -= coef[4] * buf[2]; fir += -buf[2] - buf[2];
-    fir += iir;
-    tmp = buf[3]; buf[3] = iir; val = fir;
-    iir = val;
-    iir -= coef[5] * tmp; fir = tmp;
-    iir -= coef[6] * buf[4]; fir += -buf[4] - buf[4];
-    fir += iir;
-    tmp = buf[5]; buf[5] = iir; val = fir;
-    iir = val;
-    iir -= coef[7] * tmp; fir = tmp;
-    iir -= coef[8] * buf[6]; fir += -buf[6] - buf[6];
-    fir += iir;
-    buf[7] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<16, IIR_BP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    fidlibSectionsToBiquads(coef + 1, 4, -2.0, 1.0, pBiquads);
+    fidlibSectionsToBiquads(coef + 9, 4, 2.0, 1.0, pBiquads + 4);
 }
 
-// IIR_LP and IIR_HP use the same processSample routine
+// The shelving and peaking biquads of fidlib have an individual numerator
 template<>
-inline double EngineFilterIIR<5, IIR_BP>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-    double tmp, fir, iir;
-    tmp = buf[0]; buf[0] = buf[1];
-    iir = val * coef[0];
-    iir -= coef[1] * tmp; fir = coef[2] * tmp;
-    iir -= coef[3] * buf[0]; fir += coef[4] * buf[0];
-    fir += coef[5] * iir;
-    buf[1] = iir; val = fir;
-    return val;
+inline void EngineFilterIIR<5, IIR_BP>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    pBiquads[0].b0 = coef[5];
+    pBiquads[0].b1 = coef[4];
+    pBiquads[0].b2 = coef[2];
+    pBiquads[0].a1 = coef[3];
+    pBiquads[0].a2 = coef[1];
 }
 
+// The Moog like filters are cascades of first order sections
 template<>
-inline double EngineFilterIIR<4, IIR_LPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
-   tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-   iir= val * coef[0];
-   iir -= coef[1]*tmp; fir= tmp;
-   fir += iir;
-   tmp= buf[0]; buf[0]= iir; val= fir;
-   iir= val;
-   iir -= coef[2]*tmp; fir= tmp;
-   fir += iir;
-   tmp= buf[1]; buf[1]= iir; val= fir;
-   iir= val;
-   iir -= coef[3]*tmp; fir= tmp;
-   fir += iir;
-   tmp= buf[2]; buf[2]= iir; val= fir;
-   iir= val;
-   iir -= coef[4]*tmp; fir= tmp;
-   fir += iir;
-   buf[3]= iir; val= fir;
-   return val;
+inline void EngineFilterIIR<4, IIR_LPMO>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    for (int i = 0; i < 4; ++i) {
+        pBiquads[i].b0 = 1.0;
+        pBiquads[i].b1 = 1.0;
+        pBiquads[i].b2 = 0.0;
+        pBiquads[i].a1 = coef[i + 1];
+        pBiquads[i].a2 = 0.0;
+    }
 }
 
-
 template<>
-inline double EngineFilterIIR<4, IIR_HPMO>::processSample(double* coef,
-                                                        double* buf,
-                                                        double val) {
-   double tmp, fir, iir;
-   tmp= buf[0]; buf[0] = buf[1]; buf[1] = buf[2]; buf[2] = buf[3];
-   iir= val * coef[0];
-   iir -= coef[1]*tmp; fir= -tmp;
-   fir += iir;
-   tmp= buf[0]; buf[0]= iir; val= fir;
-   iir= val;
-   iir -= coef[2]*tmp; fir= -tmp;
-   fir += iir;
-   tmp= buf[1]; buf[1]= iir; val= fir;
-   iir= val;
-   iir -= coef[3]*tmp; fir= -tmp;
-   fir += iir;
-   tmp= buf[2]; buf[2]= iir; val= fir;
-   iir= val;
-   iir -= coef[4]*tmp; fir= -tmp;
-   fir += iir;
-   buf[3]= iir; val= fir;
-   return val;
+inline void EngineFilterIIR<4, IIR_HPMO>::toBiquads(const double* coef,
+        BiquadCoefficients* pBiquads) {
+    for (int i = 0; i < 4; ++i) {
+        pBiquads[i].b0 = 1.0;
+        pBiquads[i].b1 = -1.0;
+        pBiquads[i].b2 = 0.0;
+        pBiquads[i].a1 = coef[i + 1];
+        pBiquads[i].a2 = 0.0;
+    }
 }
+
 #endif // ENGINEFILTERIIR_H
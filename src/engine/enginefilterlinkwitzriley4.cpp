@@ -7,7 +7,6 @@ EngineFilterLinkwtzRiley4Low::EngineFilterLinkwtzRiley4Low(int sampleRate, doubl
 
 void EngineFilterLinkwtzRiley4Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs2(sampleRate, 2,
             "LpBu2", freqCorner1, 0, 0,
             "LpBu2", freqCorner1, 0, 0);
@@ -7,7 +7,6 @@ EngineFilterLinkwtzRiley8Low::EngineFilterLinkwtzRiley8Low(int sampleRate, doubl
 
 void EngineFilterLinkwtzRiley8Low::setFrequencyCorners(int sampleRate,
                                              double freqCorner1) {
-    // Copy the old coefficients into m_oldCoef
     setCoefs2(sampleRate, 4,
             "LpBu4", freqCorner1, 0, 0,
             "LpBu4", freqCorner1, 0, 0);
@@ -2,6 +2,8 @@
 #include <QtDebug>
 #include <QList>
 #include <QPair>
+#include <QStringList>
+#include <QTimer>
 
 #include "controlpushbutton.h"
 #include "configobject.h"
@@ -11,6 +13,7 @@
 #include "engine/enginebuffer.h"
 #include "engine/enginemaster.h"
 #include "engine/engineworkerscheduler.h"
+#include "engine/enginethreadpool.h"
 #include "engine/enginedeck.h"
 #include "engine/enginebuffer.h"
 #include "engine/enginechannel.h"
@@ -23,9 +26,12 @@
 #include "sampleutil.h"
 #include "engine/effects/engineeffectsmanager.h"
 #include "effects/effectsmanager.h"
+#include "util/performancetimer.h"
+#include "util/realtimeallocationdetector.h"
 #include "util/timer.h"
 #include "util/trace.h"
 #include "util/defs.h"
+#include "util/math.h"
 #include "playermanager.h"
 #include "engine/channelmixer.h"
 
@@ -36,6 +42,7 @@ EngineMaster::EngineMaster(ConfigObject<ConfigValue>* _config,
                            bool bRampingGain)
         : m_pEngineEffectsManager(pEffectsManager ? pEffectsManager->getEngineEffectsManager() : NULL),
           m_bRampingGain(bRampingGain),
+          m_iProcessBufferSize(0),
           m_masterGainOld(0.0),
           m_headphoneMasterGainOld(0.0),
           m_headphoneGainOld(1.0),
@@ -50,6 +57,23 @@ EngineMaster::EngineMaster(ConfigObject<ConfigValue>* _config,
     m_pWorkerScheduler = new EngineWorkerScheduler(this);
     m_pWorkerScheduler->start(QThread::HighPriority);
 
+    // Number of additional threads that process channels in parallel with the
+    // callback thread. 0 (the default) processes all channels serially.
+    int numChannelThreads = _config->getValueString(
+            ConfigKey(group, "channel_processing_threads"), "0").toInt();
+    // The effects of the channels are processed on the same threads, each
+    // with its own scratch buffer of the EngineEffectsManager.
+    numChannelThreads = math_clamp(numChannelThreads, 0, math_min(
+            EngineThreadPool::maxUsefulWorkers(),
+            EngineEffectsManager::kMaxProcessingThreads - 1));
+    m_pChannelThreadPool = new EngineThreadPool(
+            numChannelThreads, "EngineMaster::processChannels worker %1");
+
+    if (m_pEngineEffectsManager) {
+        m_pEngineEffectsManager->setCallbackProfiler(&m_callbackProfiler);
+        m_pEngineEffectsManager->reserveScratchBuffers(numChannelThreads + 1);
+    }
+
     if (pEffectsManager) {
         pEffectsManager->registerChannel(m_masterHandle);
         pEffectsManager->registerChannel(m_headphoneHandle);
@@ -69,6 +93,19 @@ EngineMaster::EngineMaster(ConfigObject<ConfigValue>* _config,
     m_pAudioLatencyUsage = new ControlPotmeter(ConfigKey(group, "audio_latency_usage"), 0.0, 0.25);
     m_pAudioLatencyOverload  = new ControlPotmeter(ConfigKey(group, "audio_latency_overload"), 0.0, 1.0);
 
+    // Logs the per-stage timing of the slowest callbacks and of the callbacks
+    // that caused an xrun.
+    m_pCallbackReport = new ControlPushButton(
+            ConfigKey(group, "audio_callback_report"));
+    connect(m_pCallbackReport, SIGNAL(valueChanged(double)),
+            this, SLOT(slotCallbackReport(double)),
+            Qt::DirectConnection);
+    // Drains the callback profiles regularly so the FIFO doesn't overflow.
+    m_pCallbackProfileTimer = new QTimer(this);
+    connect(m_pCallbackProfileTimer, SIGNAL(timeout()),
+            this, SLOT(slotCollectCallbackProfiles()));
+    m_pCallbackProfileTimer->start(kCallbackProfileCollectIntervalMillis);
+
     // Master rate
     m_pMasterRate = new ControlPotmeter(ConfigKey(group, "rate"), -1.0, 1.0);
 
@@ -153,6 +190,11 @@ EngineMaster::EngineMaster(ConfigObject<ConfigValue>* _config,
                                          true, false, true);
     m_pKeylockEngine->set(_config->getValueString(
             ConfigKey(group, "keylock_engine")).toDouble());
+    // EngineBufferScaleLinear::Interpolation, defaults to linear
+    m_pVinylInterpolation = new ControlObject(
+            ConfigKey(group, "vinyl_interpolation"), true, false, true);
+    m_pVinylInterpolation->set(_config->getValueString(
+            ConfigKey(group, "vinyl_interpolation")).toDouble());
 
     m_pMasterEnabled = new ControlObject(ConfigKey(group, "enabled"),
             true, false, true);  // persist = true
@@ -168,6 +210,7 @@ EngineMaster::EngineMaster(ConfigObject<ConfigValue>* _config,
 EngineMaster::~EngineMaster() {
     qDebug() << "in ~EngineMaster()";
     delete m_pKeylockEngine;
+    delete m_pVinylInterpolation;
     delete m_pCrossfader;
     delete m_pBalance;
     delete m_pHeadMix;
@@ -193,6 +236,7 @@ EngineMaster::~EngineMaster() {
     delete m_pAudioLatencyOverloadCount;
     delete m_pAudioLatencyUsage;
     delete m_pAudioLatencyOverload;
+    delete m_pCallbackReport;
 
     delete m_pMasterEnabled;
     delete m_pMasterMonoMixdown;
@@ -207,6 +251,7 @@ EngineMaster::~EngineMaster() {
     }
 
     delete m_pWorkerScheduler;
+    delete m_pChannelThreadPool;
 
     for (int i = 0; i < m_channels.size(); ++i) {
         ChannelInfo* pChannelInfo = m_channels[i];
@@ -305,13 +350,49 @@ void EngineMaster::processChannels(int iBufferSize) {
         }
     }
 
-    // Now that the list is built and ordered, do the processing.
-    for (int i = activeChannelsStartIndex;
-             i < m_activeChannels.size(); ++i) {
-        ChannelInfo* pChannelInfo = m_activeChannels[i];
-        EngineChannel* pChannel = pChannelInfo->m_pChannel;
-        pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
+    // Handle the sync requests serially before any channel is processed, the
+    // current master first. They change the master selection and the sync
+    // mode of other channels, which must not happen while the channels are
+    // processed in parallel.
+    for (int i = activeChannelsStartIndex; i < m_activeChannels.size(); ++i) {
+        m_activeChannels[i]->m_pChannel->preProcess(iBufferSize);
+    }
+    EngineChannel* pNewMasterChannel = m_pMasterSync->getMaster();
+    if (pNewMasterChannel != pMasterChannel) {
+        // Move the new master into the first place.
+        if (activeChannelsStartIndex == 0) {
+            m_activeChannels.append(m_activeChannels[0]);
+            m_activeChannels[0] = NULL;
+            activeChannelsStartIndex = 1;
+        }
+        for (int i = 1; i < m_activeChannels.size(); ++i) {
+            if (m_activeChannels[i]->m_pChannel == pNewMasterChannel) {
+                // The order of the other channels does not matter.
+                m_activeChannels[0] = m_activeChannels[i];
+                m_activeChannels[i] = m_activeChannels[m_activeChannels.size() - 1];
+                m_activeChannels.resize(m_activeChannels.size() - 1);
+                activeChannelsStartIndex = 0;
+                break;
+            }
+        }
+    }
+
+    // Now that the list is built and ordered, do the processing. The sync
+    // master has to be processed before all other channels since they follow
+    // its rate and beat distance. The remaining channels are independent of
+    // each other and are processed in parallel if worker threads are enabled.
+    // This includes the effect chains of each channel, which the channel
+    // applies in rack order as the last step of its processing.
+    m_iProcessBufferSize = iBufferSize;
+    if (activeChannelsStartIndex == 0) {
+        ChannelInfo* pChannelInfo = m_activeChannels[0];
+        PerformanceTimer timer;
+        timer.start();
+        pChannelInfo->m_pChannel->process(pChannelInfo->m_pBuffer, iBufferSize);
+        m_callbackProfiler.addChannelTime(pChannelInfo->m_index, timer.elapsed());
     }
+    m_pChannelThreadPool->runJobs(&EngineMaster::processChannelJob, this,
+                                  m_activeChannels.size() - 1);
 
     // After all the engines have been processed, trigger post-processing
     // which ensures that all channels are updating certain values at the
@@ -323,6 +404,19 @@ void EngineMaster::processChannels(int iBufferSize) {
     }
 }
 
+// static
+void EngineMaster::processChannelJob(void* pContext, int jobIndex) {
+    EngineMaster* pMaster = static_cast<EngineMaster*>(pContext);
+    // Job 0 is the first channel after the sync master slot.
+    ChannelInfo* pChannelInfo = pMaster->m_activeChannels[jobIndex + 1];
+    PerformanceTimer timer;
+    timer.start();
+    pChannelInfo->m_pChannel->process(pChannelInfo->m_pBuffer,
+                                      pMaster->m_iProcessBufferSize);
+    pMaster->m_callbackProfiler.addChannelTime(pChannelInfo->m_index,
+                                               timer.elapsed());
+}
+
 void EngineMaster::process(const int iBufferSize) {
     static bool haveSetName = false;
     if (!haveSetName) {
@@ -335,16 +429,21 @@ void EngineMaster::process(const int iBufferSize) {
     bool headphoneEnabled = m_pHeadphoneEnabled->get();
 
     unsigned int iSampleRate = static_cast<int>(m_pMasterSampleRate->get());
+    m_callbackProfiler.beginCallback(iBufferSize / 2, iSampleRate);
     if (m_pEngineEffectsManager) {
         m_pEngineEffectsManager->onCallbackStart();
     }
+    m_callbackProfiler.lap(CallbackProfile::STAGE_EFFECTS_REQUESTS);
 
     // Update internal master sync rate.
     m_pMasterSync->onCallbackStart(iSampleRate, iBufferSize);
+    m_callbackProfiler.lap(CallbackProfile::STAGE_SYNC);
     // Prepare each channel for output
     processChannels(iBufferSize);
+    m_callbackProfiler.lap(CallbackProfile::STAGE_CHANNELS);
     // Do internal master sync post-processing
     m_pMasterSync->onCallbackEnd(iSampleRate, iBufferSize);
+    m_callbackProfiler.lap(CallbackProfile::STAGE_SYNC);
 
     // Compute headphone mix
     // Head phone left/right mix
@@ -372,6 +471,7 @@ void EngineMaster::process(const int iBufferSize) {
                 &m_channelHeadphoneGainCache,
                 m_pHead, iBufferSize);
     }
+    m_callbackProfiler.lap(CallbackProfile::STAGE_HEADPHONE_MIX);
 
     // Mix all the talkover enabled channels together.
     if (m_bRampingGain) {
@@ -391,6 +491,7 @@ void EngineMaster::process(const int iBufferSize) {
     if (m_pTalkoverDucking->getMode() != EngineTalkoverDucking::OFF) {
         m_pTalkoverDucking->processKey(m_pTalkover, iBufferSize);
     }
+    m_callbackProfiler.lap(CallbackProfile::STAGE_TALKOVER_MIX);
 
     // Calculate the crossfader gains for left and right side of the crossfader
     double c1_gain, c2_gain;
@@ -422,20 +523,22 @@ void EngineMaster::process(const int iBufferSize) {
                     m_pOutputBusBuffers[o], iBufferSize);
         }
     }
+    m_callbackProfiler.lap(CallbackProfile::STAGE_BUS_MIX);
 
-    // Process master channel effects
+    // Process bus effects. The three busses are independent of each other, so
+    // they are processed in parallel like the channels.
     if (m_pEngineEffectsManager) {
-        GroupFeatureState busFeatures;
-        m_pEngineEffectsManager->process(m_busLeftHandle.handle(),
-                                         m_pOutputBusBuffers[EngineChannel::LEFT],
-                                         iBufferSize, iSampleRate, busFeatures);
-        m_pEngineEffectsManager->process(m_busCenterHandle.handle(),
-                                         m_pOutputBusBuffers[EngineChannel::CENTER],
-                                         iBufferSize, iSampleRate, busFeatures);
-        m_pEngineEffectsManager->process(m_busRightHandle.handle(),
-                                         m_pOutputBusBuffers[EngineChannel::RIGHT],
-                                         iBufferSize, iSampleRate, busFeatures);
+        ChannelEffectsJob busJobs[3];
+        busJobs[0].handle = m_busLeftHandle.handle();
+        busJobs[0].pInOut = m_pOutputBusBuffers[EngineChannel::LEFT];
+        busJobs[1].handle = m_busCenterHandle.handle();
+        busJobs[1].pInOut = m_pOutputBusBuffers[EngineChannel::CENTER];
+        busJobs[2].handle = m_busRightHandle.handle();
+        busJobs[2].pInOut = m_pOutputBusBuffers[EngineChannel::RIGHT];
+        m_pEngineEffectsManager->processChannels(
+                m_pChannelThreadPool, busJobs, 3, iBufferSize, iSampleRate);
     }
+    m_callbackProfiler.lap(CallbackProfile::STAGE_BUS_EFFECTS);
 
     if (masterEnabled) {
         // Mix the three channels together. We already mixed the busses together
@@ -468,6 +571,7 @@ void EngineMaster::process(const int iBufferSize) {
                                              iBufferSize, iSampleRate,
                                              masterFeatures);
         }
+        m_callbackProfiler.lap(CallbackProfile::STAGE_MASTER_EFFECTS);
 
         // Apply master gain after effects.
         CSAMPLE master_gain = m_pMasterGain->get();
@@ -491,6 +595,7 @@ void EngineMaster::process(const int iBufferSize) {
 
         // Perform balancing on main out
         SampleUtil::applyAlternatingGain(m_pMaster, balleft, balright, iBufferSize);
+        m_callbackProfiler.lap(CallbackProfile::STAGE_MASTER_OUTPUT);
 
         // Submit master samples to the side chain to do shoutcasting, recording,
         // etc. (cpu intensive non-realtime tasks)
@@ -505,12 +610,14 @@ void EngineMaster::process(const int iBufferSize) {
             }
             m_pSideChain->writeSamples(pSidechain, iBufferSize);
         }
+        m_callbackProfiler.lap(CallbackProfile::STAGE_SIDECHAIN);
 
         // Update VU meter (it does not return anything). Needs to be here so that
         // master balance and talkover is reflected in the VU meter.
         if (m_pVumeter != NULL) {
             m_pVumeter->process(pSidechain, iBufferSize);
         }
+        m_callbackProfiler.lap(CallbackProfile::STAGE_VUMETER);
 
         // Add master to headphone with appropriate gain
         if (headphoneEnabled) {
@@ -561,6 +668,7 @@ void EngineMaster::process(const int iBufferSize) {
     if (m_pMasterMonoMixdown->get()) {
         SampleUtil::mixStereoToMono(m_pMaster, m_pMaster, iBufferSize);
     }
+    m_callbackProfiler.lap(CallbackProfile::STAGE_HEADPHONE_OUTPUT);
 
     if (masterEnabled) {
         m_pMasterDelay->process(m_pMaster, iBufferSize);
@@ -571,9 +679,12 @@ void EngineMaster::process(const int iBufferSize) {
         m_pHeadDelay->process(m_pHead, iBufferSize);
     }
 
+    m_callbackProfiler.lap(CallbackProfile::STAGE_DELAY);
+
     // We're close to the end of the callback. Wake up the engine worker
     // scheduler so that it runs the workers.
     m_pWorkerScheduler->runWorkers();
+    m_callbackProfiler.endCallback();
 }
 
 void EngineMaster::addChannel(EngineChannel* pChannel) {
@@ -591,6 +702,7 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     pChannelInfo->m_pBuffer = SampleUtil::alloc(MAX_BUFFER_LEN);
     SampleUtil::clear(pChannelInfo->m_pBuffer, MAX_BUFFER_LEN);
     m_channels.append(pChannelInfo);
+    m_callbackProfiler.setChannelName(pChannelInfo->m_index, group);
     const GainCache gainCacheDefault = {0, false};
     m_channelHeadphoneGainCache.append(gainCacheDefault);
     m_channelTalkoverGainCache.append(gainCacheDefault);
@@ -612,6 +724,28 @@ void EngineMaster::addChannel(EngineChannel* pChannel) {
     }
 }
 
+void EngineMaster::slotCallbackReport(double v) {
+    if (v <= 0.0) {
+        return;
+    }
+    foreach (const QString& line, m_callbackProfiler.report().split("\n")) {
+        qDebug() << qPrintable(line);
+    }
+}
+
+void EngineMaster::slotCollectCallbackProfiles() {
+    m_callbackProfiler.collect();
+
+    size_t lastSize = 0;
+    const int allocations =
+            RealtimeAllocationDetector::takeAllocationCount(&lastSize);
+    if (allocations > 0) {
+        qWarning() << "WARNING: The engine threads allocated memory"
+                   << allocations << "times, the last allocation was"
+                   << lastSize << "bytes";
+    }
+}
+
 EngineChannel* EngineMaster::getChannel(const QString& group) {
     for (int i = 0; i < m_channels.size(); ++i) {
         ChannelInfo* pChannelInfo = m_channels[i];
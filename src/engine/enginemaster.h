@@ -23,6 +23,7 @@
 
 #include "controlobject.h"
 #include "controlpushbutton.h"
+#include "engine/callbackprofiler.h"
 #include "engine/engineobject.h"
 #include "engine/enginechannel.h"
 #include "engine/channelhandle.h"
@@ -45,11 +46,17 @@ class GuiTick;
 class EngineSync;
 class EngineTalkoverDucking;
 class EngineDelay;
+class EngineThreadPool;
+class QTimer;
 
 // The number of channels to pre-allocate in various structures in the
 // engine. Prevents memory allocation in EngineMaster::addChannel.
 static const int kPreallocatedChannels = 64;
 
+// How often the main thread moves the profiles of the engine callbacks into
+// the CallbackProfiler statistics.
+static const int kCallbackProfileCollectIntervalMillis = 250;
+
 class EngineMaster : public QObject, public AudioSource {
     Q_OBJECT
   public:
@@ -134,6 +141,11 @@ class EngineMaster : public QObject, public AudioSource {
         return m_pSideChain;
     }
 
+    // The per-stage timing of the callbacks. Thread safe.
+    CallbackProfiler* getCallbackProfiler() {
+        return &m_callbackProfiler;
+    }
+
     struct ChannelInfo {
         ChannelInfo(int index)
                 : m_pChannel(NULL),
@@ -252,6 +264,10 @@ class EngineMaster : public QObject, public AudioSource {
                              sizeof(long double)];
     };
 
+  private slots:
+    void slotCallbackReport(double v);
+    void slotCollectCallbackProfiles();
+
   protected:
     // The master buffer is protected so it can be accessed by test subclasses.
     CSAMPLE* m_pMaster;
@@ -267,9 +283,14 @@ class EngineMaster : public QObject, public AudioSource {
     // respective output.
     void processChannels(int iBufferSize);
 
+    // EngineThreadPool job that processes m_activeChannels[jobIndex + 1].
+    static void processChannelJob(void* pContext, int jobIndex);
+
     ChannelHandleFactory m_channelHandleFactory;
     EngineEffectsManager* m_pEngineEffectsManager;
     bool m_bRampingGain;
+    // The buffer size of the current callback for processChannelJob.
+    int m_iProcessBufferSize;
 
     // List of channels added to the engine.
     QVarLengthArray<ChannelInfo*, kPreallocatedChannels> m_channels;
@@ -292,6 +313,9 @@ class EngineMaster : public QObject, public AudioSource {
     CSAMPLE* m_pTalkover;
 
     EngineWorkerScheduler* m_pWorkerScheduler;
+    // Processes non-sync-master channels in parallel. Has no worker threads
+    // unless enabled with [Master],channel_processing_threads.
+    EngineThreadPool* m_pChannelThreadPool;
     EngineSync* m_pMasterSync;
 
     ControlObject* m_pMasterGain;
@@ -303,6 +327,9 @@ class EngineMaster : public QObject, public AudioSource {
     ControlPotmeter* m_pMasterRate;
     ControlPotmeter* m_pAudioLatencyUsage;
     ControlPotmeter* m_pAudioLatencyOverload;
+    ControlPushButton* m_pCallbackReport;
+    QTimer* m_pCallbackProfileTimer;
+    CallbackProfiler m_callbackProfiler;
     EngineTalkoverDucking* m_pTalkoverDucking;
     EngineDelay* m_pMasterDelay;
     EngineDelay* m_pHeadDelay;
@@ -319,6 +346,7 @@ class EngineMaster : public QObject, public AudioSource {
     ControlPushButton* m_pXFaderReverse;
     ControlPushButton* m_pHeadSplitEnabled;
     ControlObject* m_pKeylockEngine;
+    ControlObject* m_pVinylInterpolation;
 
     PflGainCalculator m_headphoneGain;
     TalkoverGainCalculator m_talkoverGain;
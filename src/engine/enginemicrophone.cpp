@@ -93,6 +93,11 @@ void EngineMicrophone::process(CSAMPLE* pOut, const int iBufferSize) {
         // This is out of date by a callback but some effects will want the RMS
         // volume.
         m_vuMeter.collectFeatures(&features);
+        if (!sampleBuffer) {
+            // We just cleared the buffer
+            features.has_silence = true;
+            features.silence = true;
+        }
         m_pEngineEffectsManager->process(getHandle(), pOut, iBufferSize,
                                          m_pSampleRate->get(), features);
     }
@@ -28,6 +28,7 @@ class EngineMicrophone : public EngineChannel, public AudioDestination {
     bool isActive();
 
     // Called by EngineMaster whenever is requesting a new buffer of audio.
+    virtual void preProcess(const int iBufferSize) { Q_UNUSED(iBufferSize) }
     virtual void process(CSAMPLE* pOutput, const int iBufferSize);
     virtual void postProcess(const int iBufferSize) { Q_UNUSED(iBufferSize) }
 
@@ -0,0 +1,251 @@
+#include <math.h>
+#include <string.h>
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "engine/engineoversampler.h"
+#include "sampleutil.h"
+#include "util/assert.h"
+
+namespace {
+
+// The transition bands of both stages. The first stage passes 0.45 of the
+// original rate. The second stage only has to suppress the images of that
+// band, which leaves it a much wider transition band.
+const double kFirstStageTransition = 0.025;
+const double kSecondStageTransition = 0.1375;
+
+const double kPi = 3.14159265358979323846;
+
+double computeAccNum(double q, int order, int c) {
+    double acc = 0;
+    double term;
+    int sign = 1;
+    int i = 0;
+    do {
+        term = pow(q, i * (i + 1)) * sin((i * 2 + 1) * c * kPi / order) * sign;
+        acc += term;
+        sign = -sign;
+        ++i;
+    } while (fabs(term) > 1e-100);
+    return acc;
+}
+
+double computeAccDen(double q, int order, int c) {
+    double acc = 0;
+    double term;
+    int sign = -1;
+    int i = 1;
+    do {
+        term = pow(q, i * i) * cos(i * 2 * c * kPi / order) * sign;
+        acc += term;
+        sign = -sign;
+        ++i;
+    } while (fabs(term) > 1e-100);
+    return acc;
+}
+
+} // anonymous namespace
+
+const int EngineHalfbandStage::kNumCoefs;
+
+EngineHalfbandStage::EngineHalfbandStage(double transition) {
+    double coefs[kNumCoefs];
+    designCoefficients(coefs, kNumCoefs, transition);
+    for (int i = 0; i < kNumCoefs / 2; ++i) {
+        m_coefs[i][0] = m_coefs[i][1] = static_cast<float>(coefs[i * 2]);
+        m_coefs[i][2] = m_coefs[i][3] = static_cast<float>(coefs[i * 2 + 1]);
+    }
+    reset();
+}
+
+void EngineHalfbandStage::reset() {
+    memset(m_x, 0, sizeof(m_x));
+    memset(m_y, 0, sizeof(m_y));
+}
+
+// static
+double EngineHalfbandStage::designCoefficients(double* pCoefs, int numCoefs,
+                                               double transition) {
+    // The elliptic filter prototype
+    double k = tan((1 - transition * 4) * kPi / 4);
+    k *= k;
+    const double kksqrt = pow(1 - k * k, 0.25);
+    const double e = 0.5 * (1 - kksqrt) / (1 + kksqrt);
+    const double e4 = e * e * e * e;
+    const double q = e * (1 + e4 * (2 + e4 * (15 + 150 * e4)));
+
+    const int order = numCoefs * 2 + 1;
+    for (int i = 0; i < numCoefs; ++i) {
+        const int c = i + 1;
+        const double num = computeAccNum(q, order, c) * pow(q, 0.25);
+        const double den = computeAccDen(q, order, c) + 0.5;
+        const double ww = num / den;
+        const double wwsq = ww * ww;
+        const double x = sqrt((1 - wwsq * k) * (1 - wwsq / k)) / (1 + wwsq);
+        pCoefs[i] = (1 - x) / (1 + x);
+    }
+
+    const double a = 4 * pow(q, order / 2.0);
+    return -10 * log10(a / (1 + a));
+}
+
+#ifdef __SSE__
+void EngineHalfbandStage::upsample(const CSAMPLE* pIn, CSAMPLE* pOut,
+                                   int numFrames) {
+    __m128 coefs[kNumCoefs / 2];
+    __m128 x[kNumCoefs / 2];
+    __m128 y[kNumCoefs / 2];
+    for (int i = 0; i < kNumCoefs / 2; ++i) {
+        coefs[i] = _mm_loadu_ps(m_coefs[i]);
+        x[i] = _mm_loadu_ps(m_x[i]);
+        y[i] = _mm_loadu_ps(m_y[i]);
+    }
+    for (int frame = 0; frame < numFrames; ++frame) {
+        // Both chains filter the same frame
+        __m128 in = _mm_loadl_pi(_mm_setzero_ps(),
+                reinterpret_cast<const __m64*>(pIn + frame * 2));
+        in = _mm_movelh_ps(in, in);
+        for (int i = 0; i < kNumCoefs / 2; ++i) {
+            const __m128 out = _mm_add_ps(
+                    _mm_mul_ps(_mm_sub_ps(in, y[i]), coefs[i]), x[i]);
+            x[i] = in;
+            y[i] = out;
+            in = out;
+        }
+        // The even chain gives the first frame, the odd chain the second.
+        _mm_storeu_ps(pOut + frame * 4, in);
+    }
+    for (int i = 0; i < kNumCoefs / 2; ++i) {
+        _mm_storeu_ps(m_x[i], x[i]);
+        _mm_storeu_ps(m_y[i], y[i]);
+    }
+}
+
+void EngineHalfbandStage::downsample(const CSAMPLE* pIn, CSAMPLE* pOut,
+                                     int numFrames) {
+    __m128 coefs[kNumCoefs / 2];
+    __m128 x[kNumCoefs / 2];
+    __m128 y[kNumCoefs / 2];
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (int i = 0; i < kNumCoefs / 2; ++i) {
+        coefs[i] = _mm_loadu_ps(m_coefs[i]);
+        x[i] = _mm_loadu_ps(m_x[i]);
+        y[i] = _mm_loadu_ps(m_y[i]);
+    }
+    for (int frame = 0; frame < numFrames; ++frame) {
+        // The even chain filters the second frame, the odd chain the first.
+        __m128 in = _mm_loadu_ps(pIn + frame * 4);
+        in = _mm_shuffle_ps(in, in, _MM_SHUFFLE(1, 0, 3, 2));
+        for (int i = 0; i < kNumCoefs / 2; ++i) {
+            const __m128 out = _mm_add_ps(
+                    _mm_mul_ps(_mm_sub_ps(in, y[i]), coefs[i]), x[i]);
+            x[i] = in;
+            y[i] = out;
+            in = out;
+        }
+        const __m128 sum = _mm_add_ps(in, _mm_movehl_ps(in, in));
+        _mm_storel_pi(reinterpret_cast<__m64*>(pOut + frame * 2),
+                      _mm_mul_ps(sum, half));
+    }
+    for (int i = 0; i < kNumCoefs / 2; ++i) {
+        _mm_storeu_ps(m_x[i], x[i]);
+        _mm_storeu_ps(m_y[i], y[i]);
+    }
+}
+#else
+void EngineHalfbandStage::upsample(const CSAMPLE* pIn, CSAMPLE* pOut,
+                                   int numFrames) {
+    for (int frame = 0; frame < numFrames; ++frame) {
+        float in[4] = { pIn[frame * 2], pIn[frame * 2 + 1],
+                        pIn[frame * 2], pIn[frame * 2 + 1] };
+        for (int i = 0; i < kNumCoefs / 2; ++i) {
+            for (int lane = 0; lane < 4; ++lane) {
+                const float out = (in[lane] - m_y[i][lane]) * m_coefs[i][lane]
+                        + m_x[i][lane];
+                m_x[i][lane] = in[lane];
+                m_y[i][lane] = out;
+                in[lane] = out;
+            }
+        }
+        memcpy(pOut + frame * 4, in, sizeof(in));
+    }
+}
+
+void EngineHalfbandStage::downsample(const CSAMPLE* pIn, CSAMPLE* pOut,
+                                     int numFrames) {
+    for (int frame = 0; frame < numFrames; ++frame) {
+        float in[4] = { pIn[frame * 4 + 2], pIn[frame * 4 + 3],
+                        pIn[frame * 4], pIn[frame * 4 + 1] };
+        for (int i = 0; i < kNumCoefs / 2; ++i) {
+            for (int lane = 0; lane < 4; ++lane) {
+                const float out = (in[lane] - m_y[i][lane]) * m_coefs[i][lane]
+                        + m_x[i][lane];
+                m_x[i][lane] = in[lane];
+                m_y[i][lane] = out;
+                in[lane] = out;
+            }
+        }
+        pOut[frame * 2] = (in[0] + in[2]) * 0.5f;
+        pOut[frame * 2 + 1] = (in[1] + in[3]) * 0.5f;
+    }
+}
+#endif
+
+const int EngineOversampler::kMaxFactor;
+const int EngineOversampler::kBlockFrames;
+
+EngineOversampler::EngineOversampler(int factor)
+        : m_factor(factor) {
+    DEBUG_ASSERT(factor == 1 || factor == 2 || factor == 4);
+    m_pUpStages[0] = new EngineHalfbandStage(kFirstStageTransition);
+    m_pUpStages[1] = new EngineHalfbandStage(kSecondStageTransition);
+    m_pDownStages[0] = new EngineHalfbandStage(kFirstStageTransition);
+    m_pDownStages[1] = new EngineHalfbandStage(kSecondStageTransition);
+}
+
+EngineOversampler::~EngineOversampler() {
+    for (int i = 0; i < 2; ++i) {
+        delete m_pUpStages[i];
+        delete m_pDownStages[i];
+    }
+}
+
+void EngineOversampler::reset() {
+    for (int i = 0; i < 2; ++i) {
+        m_pUpStages[i]->reset();
+        m_pDownStages[i]->reset();
+    }
+}
+
+void EngineOversampler::upsample(const CSAMPLE* pIn, CSAMPLE* pOut,
+                                 int numFrames) {
+    if (m_factor == 2) {
+        m_pUpStages[0]->upsample(pIn, pOut, numFrames);
+    } else if (m_factor == 4) {
+        for (int frame = 0; frame < numFrames; frame += kBlockFrames) {
+            const int frames = math_min(kBlockFrames, numFrames - frame);
+            m_pUpStages[0]->upsample(pIn + frame * 2, m_block, frames);
+            m_pUpStages[1]->upsample(m_block, pOut + frame * 2 * 4, frames * 2);
+        }
+    } else if (pIn != pOut) {
+        SampleUtil::copy(pOut, pIn, numFrames * 2);
+    }
+}
+
+void EngineOversampler::downsample(const CSAMPLE* pIn, CSAMPLE* pOut,
+                                   int numFrames) {
+    if (m_factor == 2) {
+        m_pDownStages[0]->downsample(pIn, pOut, numFrames);
+    } else if (m_factor == 4) {
+        for (int frame = 0; frame < numFrames; frame += kBlockFrames) {
+            const int frames = math_min(kBlockFrames, numFrames - frame);
+            m_pDownStages[1]->downsample(pIn + frame * 2 * 4, m_block, frames * 2);
+            m_pDownStages[0]->downsample(m_block, pOut + frame * 2, frames);
+        }
+    } else if (pIn != pOut) {
+        SampleUtil::copy(pOut, pIn, numFrames * 2);
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef ENGINEOVERSAMPLER_H
+#define ENGINEOVERSAMPLER_H
+
+#include "util/types.h"
+
+// One halfband stage of EngineOversampler: A polyphase IIR halfband filter
+// made of two chains of first order allpass filters in z^-2, which run at the
+// lower of both sample rates. When doubling the rate, each input frame is
+// filtered by both chains, the outputs are the two new frames. When halving
+// the rate, each chain filters one of two input frames and the output is their
+// mean. The filter is not linear phase, but its delay is only a few frames
+// and it costs four multiplications per frame and channel.
+//
+// See: Valenzuela, Constantinides, "Digital signal processing schemes for
+// efficient interpolation and decimation", IEE Proceedings 1983, and Laurent
+// de Soras' HIIR library for the coefficient design.
+//
+// With SSE, the left and right channel of both chains are the four lanes of
+// one register.
+class EngineHalfbandStage {
+  public:
+    // The number of allpass coefficients, half of them in each chain
+    static const int kNumCoefs = 8;
+
+    // transition is the width of the transition band relative to the higher
+    // sample rate, between 0 and 0.25. The passband ends at (0.25 -
+    // transition) of the higher rate, which is mirrored to the stopband.
+    explicit EngineHalfbandStage(double transition);
+
+    void reset();
+
+    // Doubles the rate of numFrames interleaved stereo frames from pIn into
+    // numFrames * 2 frames at pOut.
+    void upsample(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames);
+    // Halves the rate of numFrames * 2 interleaved stereo frames from pIn into
+    // numFrames frames at pOut.
+    void downsample(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames);
+
+    // Computes the coefficients of the two allpass chains of a halfband
+    // filter. The even coefficients belong to the chain that is applied to the
+    // first of two frames at the higher rate. Returns the stopband attenuation
+    // in dB.
+    static double designCoefficients(double* pCoefs, int numCoefs,
+                                     double transition);
+
+  private:
+    // Per allpass filter of both chains: The coefficients, the last input and
+    // the last output in the lanes left and right of the even chain, left and
+    // right of the odd chain.
+    float m_coefs[kNumCoefs / 2][4];
+    float m_x[kNumCoefs / 2][4];
+    float m_y[kNumCoefs / 2][4];
+};
+
+// Raises the sample rate of an interleaved stereo signal by a factor of 2 or 4
+// and brings it back down, for processing that creates harmonics above the
+// Nyquist frequency of the original rate, which would alias otherwise. The
+// passband reaches up to 0.45 of the original rate (19.8 kHz at 44.1 kHz)
+// and images and aliases are attenuated by more than 100 dB. 4x cascades two
+// halfband stages.
+//
+// An EngineOversampler keeps the state of one signal, so upsample() and
+// downsample() have to be called alternately for consecutive buffers of it.
+class EngineOversampler {
+  public:
+    static const int kMaxFactor = 4;
+
+    // factor is 1, 2 or 4. A factor of 1 just copies.
+    explicit EngineOversampler(int factor);
+    virtual ~EngineOversampler();
+
+    int factor() const {
+        return m_factor;
+    }
+
+    void reset();
+
+    // Writes numFrames * factor() frames at the higher rate to pOut.
+    void upsample(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames);
+    // Reads numFrames * factor() frames at the higher rate from pIn and
+    // writes numFrames frames to pOut. pIn may be equal to pOut.
+    void downsample(const CSAMPLE* pIn, CSAMPLE* pOut, int numFrames);
+
+  private:
+    // The number of frames at the original rate that pass the stages of a 4x
+    // oversampler at once
+    static const int kBlockFrames = 128;
+
+    const int m_factor;
+    // Stage 0 converts between the original rate and twice that rate, stage 1
+    // between twice and four times.
+    EngineHalfbandStage* m_pUpStages[2];
+    EngineHalfbandStage* m_pDownStages[2];
+    // Frames at twice the original rate between the stages of 4x
+    CSAMPLE m_block[kBlockFrames * 2 * 2];
+};
+
+#endif // ENGINEOVERSAMPLER_H
@@ -0,0 +1,208 @@
+#include <QtDebug>
+
+#ifdef __LINUX__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "engine/enginethreadpool.h"
+#include "control/controlnotifier.h"
+#include "util/assert.h"
+#include "util/compatibility.h"
+#include "util/math.h"
+#include "util/realtimeallocationdetector.h"
+#include "util/timer.h"
+
+namespace {
+
+const int kIndexBits = 9;
+const int kIndexMask = (1 << kIndexBits) - 1;
+const int kCountShift = kIndexBits;
+const int kGenerationShift = 2 * kIndexBits;
+// Keep the generation positive so the packed state never becomes negative.
+const int kGenerationMask = (1 << (31 - kGenerationShift)) - 1;
+
+// How often an idle worker checks the wake counter before it goes to sleep,
+// a few microseconds. Channels are dispatched in several batches per
+// callback, so a worker that just finished one usually catches the next.
+const int kSpinsBeforeSleep = 10000;
+
+inline int packBatchState(int generation, int count, int nextIndex) {
+    return (generation << kGenerationShift) | (count << kCountShift) | nextIndex;
+}
+
+#ifdef __LINUX__
+// The futex calls take the address of the int in the QAtomicInt.
+static_assert(sizeof(QAtomicInt) == sizeof(int),
+              "QAtomicInt must only hold an int");
+
+inline void futexWait(QAtomicInt* pWord, int expected) {
+    syscall(SYS_futex, reinterpret_cast<int*>(pWord), FUTEX_WAIT_PRIVATE,
+            expected, NULL, NULL, 0);
+}
+
+inline void futexWake(QAtomicInt* pWord, int count) {
+    syscall(SYS_futex, reinterpret_cast<int*>(pWord), FUTEX_WAKE_PRIVATE,
+            count, NULL, NULL, 0);
+}
+#else
+// How long a sleeping worker waits before it checks the wake counter again
+const unsigned long kPollIntervalMicros = 100;
+#endif
+
+}  // anonymous namespace
+
+EngineThreadPool::EngineThreadPool(int numWorkers, const char* statKey)
+        : m_function(NULL),
+          m_pContext(NULL),
+          m_batchState(0),
+          m_pendingJobs(0),
+          m_generation(0),
+          m_wakeCounter(0),
+          m_sleepingWorkers(0),
+          m_quit(0) {
+    for (int i = 0; i < numWorkers; ++i) {
+        EngineThreadPoolWorker* pWorker =
+                new EngineThreadPoolWorker(this, statKey, i);
+        m_workers.append(pWorker);
+        pWorker->start(QThread::TimeCriticalPriority);
+    }
+}
+
+EngineThreadPool::~EngineThreadPool() {
+    m_quit.fetchAndStoreOrdered(1);
+    wakeWorkers(m_workers.size());
+    for (int i = 0; i < m_workers.size(); ++i) {
+        m_workers[i]->wait();
+        delete m_workers[i];
+    }
+}
+
+// static
+int EngineThreadPool::maxUsefulWorkers() {
+    return math_max(0, QThread::idealThreadCount() - 1);
+}
+
+void EngineThreadPool::runJobs(JobFunction function, void* pContext, int count) {
+    if (count <= 0) {
+        return;
+    }
+    DEBUG_ASSERT_AND_HANDLE(count <= kEngineThreadPoolMaxJobs) {
+        count = kEngineThreadPoolMaxJobs;
+    }
+
+    if (m_workers.isEmpty() || count == 1) {
+        for (int i = 0; i < count; ++i) {
+            function(pContext, i);
+        }
+        return;
+    }
+
+    // No worker can be in the middle of a job at this point since the previous
+    // batch has completed, so it is safe to swap out the job function. The
+    // ordered store of the batch state publishes it to the workers.
+    m_function = function;
+    m_pContext = pContext;
+    m_pendingJobs.fetchAndStoreOrdered(count);
+    m_generation = (m_generation + 1) & kGenerationMask;
+    m_batchState.fetchAndStoreOrdered(packBatchState(m_generation, count, 0));
+
+    // Wake up as many workers as can help. Workers that wake up after the
+    // batch is done find nothing to claim and go back to sleep.
+    wakeWorkers(math_min(count - 1, m_workers.size()));
+
+    processJobs();
+
+    // Spin until the jobs claimed by the workers are done. This is expected to
+    // be short since we only get here once every job has been claimed.
+    while (load_atomic(m_pendingJobs) > 0) {
+    }
+}
+
+void EngineThreadPool::wakeWorkers(int count) {
+    // Both sides use ordered read-modify-writes, so either a worker that goes
+    // to sleep sees the new counter or we see the worker sleeping.
+    m_wakeCounter.fetchAndAddOrdered(1);
+#ifdef __LINUX__
+    if (m_sleepingWorkers.fetchAndAddOrdered(0) > 0) {
+        futexWake(&m_wakeCounter, count);
+    }
+#else
+    Q_UNUSED(count);
+#endif
+}
+
+int EngineThreadPool::processJobs() {
+    int jobsRun = 0;
+    while (true) {
+        const int state = load_atomic(m_batchState);
+        const int nextIndex = state & kIndexMask;
+        const int count = (state >> kCountShift) & kIndexMask;
+        if (nextIndex >= count) {
+            break;
+        }
+        if (!m_batchState.testAndSetOrdered(state, state + 1)) {
+            // Another thread claimed this job; try the next one.
+            continue;
+        }
+        // The batch can't complete before this job is done, so m_function and
+        // m_pContext are still the ones of the batch we claimed from.
+        m_function(m_pContext, nextIndex);
+        m_pendingJobs.deref();
+        ++jobsRun;
+    }
+    return jobsRun;
+}
+
+EngineThreadPoolWorker::EngineThreadPoolWorker(EngineThreadPool* pPool,
+                                               const char* statKey,
+                                               int workerNumber)
+        : m_pPool(pPool),
+          m_statKey(statKey),
+          m_workerNumber(workerNumber) {
+    setObjectName(QString("EngineThreadPoolWorker %1").arg(workerNumber));
+}
+
+EngineThreadPoolWorker::~EngineThreadPoolWorker() {
+}
+
+void EngineThreadPoolWorker::run() {
+    // Jobs set controls just like the callback thread does.
+    ControlNotifier::registerRealtimeThread();
+    RealtimeAllocationDetector::markRealtimeThread();
+    // A batch that started before this point is processed by the others.
+    int wakeCounter = load_atomic(m_pPool->m_wakeCounter);
+    while (true) {
+        wakeCounter = waitForWake(wakeCounter);
+        if (load_atomic(m_pPool->m_quit)) {
+            break;
+        }
+        ScopedTimer t(m_statKey.constData(), m_workerNumber);
+        if (m_pPool->processJobs() == 0) {
+            t.cancel();
+        }
+    }
+}
+
+int EngineThreadPoolWorker::waitForWake(int lastWakeCounter) {
+    for (int i = 0; i < kSpinsBeforeSleep; ++i) {
+        const int wakeCounter = load_atomic(m_pPool->m_wakeCounter);
+        if (wakeCounter != lastWakeCounter) {
+            return wakeCounter;
+        }
+    }
+    m_pPool->m_sleepingWorkers.fetchAndAddOrdered(1);
+    int wakeCounter;
+    while ((wakeCounter = m_pPool->m_wakeCounter.fetchAndAddOrdered(0)) ==
+            lastWakeCounter) {
+#ifdef __LINUX__
+        // Returns right away if the counter changed in the meantime.
+        futexWait(&m_pPool->m_wakeCounter, lastWakeCounter);
+#else
+        QThread::usleep(kPollIntervalMicros);
+#endif
+    }
+    m_pPool->m_sleepingWorkers.fetchAndAddOrdered(-1);
+    return wakeCounter;
+}
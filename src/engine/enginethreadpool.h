@@ -0,0 +1,108 @@
+#ifndef ENGINETHREADPOOL_H
+#define ENGINETHREADPOOL_H
+
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QThread>
+#include <QVarLengthArray>
+
+#include "util.h"
+
+// The maximum number of jobs that can be dispatched to an EngineThreadPool in
+// one call to runJobs.
+const int kEngineThreadPoolMaxJobs = 256;
+
+class EngineThreadPoolWorker;
+
+// EngineThreadPool is a fixed set of pre-spawned worker threads that help the
+// audio callback thread process independent jobs (e.g. channels) in parallel.
+//
+// runJobs does not allocate and does not lock. Jobs are claimed by the workers
+// and the calling thread with an atomic compare-and-swap on a single batch
+// state word. The calling thread participates in processing and busy-waits
+// until the last job is done, so the workers never have to signal it.
+//
+// Idle workers spin on a wake counter for a while before they go to sleep.
+// runJobs only makes a system call if a worker sleeps: On Linux a futex wake
+// on the counter, which takes no lock. Other platforms have no such call, so
+// sleeping workers poll the counter instead and runJobs never wakes them.
+//
+// A pool with zero workers is valid and runs all jobs serially on the calling
+// thread in index order.
+class EngineThreadPool {
+  public:
+    // A job function is called once for every index in [0, count).
+    typedef void (*JobFunction)(void* pContext, int jobIndex);
+
+    // Spawns numWorkers threads. In developer mode the time each worker spends
+    // on a batch is reported to StatsManager under QString(statKey).arg(n)
+    // where n is the worker number.
+    EngineThreadPool(int numWorkers, const char* statKey);
+    virtual ~EngineThreadPool();
+
+    int numWorkers() const {
+        return m_workers.size();
+    }
+
+    // Calls function(pContext, i) for every i in [0, count) and returns once
+    // all calls have returned. Calls may happen concurrently on the worker
+    // threads and the calling thread. Must only be called from one thread at
+    // a time (i.e. the engine callback).
+    void runJobs(JobFunction function, void* pContext, int count);
+
+    // Returns the number of worker threads the current machine can make use
+    // of, i.e. one less than the number of cores since the calling thread
+    // processes jobs as well.
+    static int maxUsefulWorkers();
+
+  private:
+    // Claims and runs jobs of the current batch until none are left. Returns
+    // the number of jobs run.
+    int processJobs();
+
+    // Increments m_wakeCounter and wakes the sleeping workers.
+    void wakeWorkers(int count);
+
+    JobFunction m_function;
+    void* m_pContext;
+
+    // Bits 0-8 hold the index of the next unclaimed job, bits 9-17 the job
+    // count of the current batch and the remaining bits a batch generation
+    // counter so that a late worker can't claim a job of a batch that it did
+    // not observe.
+    QAtomicInt m_batchState;
+    // The number of jobs of the current batch that have not finished yet.
+    QAtomicInt m_pendingJobs;
+    int m_generation;
+
+    // Incremented for every batch that needs the workers
+    QAtomicInt m_wakeCounter;
+    // The number of workers that sleep rather than spin
+    QAtomicInt m_sleepingWorkers;
+    QAtomicInt m_quit;
+    QVarLengthArray<EngineThreadPoolWorker*, 16> m_workers;
+
+    friend class EngineThreadPoolWorker;
+    DISALLOW_COPY_AND_ASSIGN(EngineThreadPool);
+};
+
+class EngineThreadPoolWorker : public QThread {
+  public:
+    EngineThreadPoolWorker(EngineThreadPool* pPool, const char* statKey,
+                           int workerNumber);
+    virtual ~EngineThreadPoolWorker();
+
+  protected:
+    void run();
+
+  private:
+    // Returns the value of the wake counter of the pool once it differs from
+    // lastWakeCounter.
+    int waitForWake(int lastWakeCounter);
+
+    EngineThreadPool* m_pPool;
+    const QByteArray m_statKey;
+    const int m_workerNumber;
+};
+
+#endif /* ENGINETHREADPOOL_H */
@@ -0,0 +1,140 @@
+#include "engine/interpolationkernels.h"
+
+#include "sampleutil.h"
+#include "util/math.h"
+
+namespace {
+
+// A compromise between the width of the transition band and the stop band
+// attenuation for 16 taps.
+const double kKaiserBeta = 8.0;
+
+// The highest rate of each band of the sinc kernel. kSincTaps times the rate
+// must be an even number of taps.
+const double kSincBandRates[] = { 1.0, 1.125, 1.25, 1.5, 2.0, 3.0, kSincMaxRate };
+const int kSincBands = sizeof(kSincBandRates) / sizeof(kSincBandRates[0]);
+
+// The modified Bessel function of the first kind and order 0
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 50; ++k) {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+        if (term < sum * 1e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+class SincTable {
+  public:
+    SincTable(int taps, double cutoff)
+            : m_iTaps(taps),
+              m_pWeights(SampleUtil::alloc((kSincPhases + 1) * taps * 2)) {
+        const int halfTaps = taps / 2;
+        const double windowNorm = besselI0(kKaiserBeta);
+        for (int phase = 0; phase <= kSincPhases; ++phase) {
+            const double frac = static_cast<double>(phase) / kSincPhases;
+            double weights[kSincMaxTaps];
+            double sum = 0;
+            for (int tap = 0; tap < taps; ++tap) {
+                const double x = tap - (halfTaps - 1) - frac;
+                // Exact zero crossings keep the integer positions bit exact
+                const double scaledX = x * cutoff;
+                double sinc = 0.0;
+                if (scaledX == 0) {
+                    sinc = 1.0;
+                } else if (scaledX != floor(scaledX)) {
+                    sinc = sin(M_PI * scaledX) / (M_PI * scaledX);
+                }
+                const double ratio = x / halfTaps;
+                const double window = fabs(ratio) < 1.0 ?
+                        besselI0(kKaiserBeta * sqrt(1.0 - ratio * ratio)) /
+                                windowNorm :
+                        0.0;
+                weights[tap] = sinc * window;
+                sum += weights[tap];
+            }
+            // Normalize to unity gain at DC
+            CSAMPLE* pPhase = m_pWeights + phase * taps * 2;
+            for (int tap = 0; tap < taps; ++tap) {
+                pPhase[tap * 2] = pPhase[tap * 2 + 1] =
+                        static_cast<CSAMPLE>(weights[tap] / sum);
+            }
+        }
+    }
+
+    ~SincTable() {
+        SampleUtil::free(m_pWeights);
+    }
+
+    int taps() const {
+        return m_iTaps;
+    }
+
+    const CSAMPLE* weights(int phase) const {
+        return m_pWeights + phase * m_iTaps * 2;
+    }
+
+  private:
+    const int m_iTaps;
+    CSAMPLE* m_pWeights;
+};
+
+class SincTables {
+  public:
+    SincTables() {
+        for (int band = 0; band < kSincBands; ++band) {
+            m_pTables[band] = new SincTable(sincTapsOfBand(band),
+                                            1.0 / kSincBandRates[band]);
+        }
+    }
+
+    ~SincTables() {
+        for (int band = 0; band < kSincBands; ++band) {
+            delete m_pTables[band];
+        }
+    }
+
+    const SincTable& table(int band) const {
+        return *m_pTables[band];
+    }
+
+  private:
+    SincTable* m_pTables[kSincBands];
+};
+
+} // anonymous namespace
+
+int sincBandForRate(double rate) {
+    const double absRate = fabs(rate);
+    for (int band = 0; band < kSincBands - 1; ++band) {
+        if (absRate <= kSincBandRates[band]) {
+            return band;
+        }
+    }
+    return kSincBands - 1;
+}
+
+int sincTapsOfBand(int band) {
+    return static_cast<int>(kSincTaps * kSincBandRates[band]);
+}
+
+void interpolateSinc(const CSAMPLE* pFrames, double frac, int band,
+                     CSAMPLE* pOut) {
+    // Built on first use, which is in the constructor of
+    // EngineBufferScaleLinear and not in the callback.
+    static const SincTables s_tables;
+    const SincTable& table = s_tables.table(band);
+    const double phasePosition = frac * kSincPhases;
+    const int phase = math_min(static_cast<int>(phasePosition), kSincPhases - 1);
+    const CSAMPLE phaseFrac = static_cast<CSAMPLE>(phasePosition - phase);
+    CSAMPLE lower[2];
+    CSAMPLE upper[2];
+    applyInterpolationWeights(pFrames, table.weights(phase), table.taps(), lower);
+    applyInterpolationWeights(pFrames, table.weights(phase + 1), table.taps(), upper);
+    pOut[0] = lower[0] + phaseFrac * (upper[0] - lower[0]);
+    pOut[1] = lower[1] + phaseFrac * (upper[1] - lower[1]);
+}
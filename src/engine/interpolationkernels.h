@@ -0,0 +1,87 @@
+#ifndef INTERPOLATIONKERNELS_H
+#define INTERPOLATIONKERNELS_H
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "util/types.h"
+
+// Interpolation kernels for EngineBufferScaleLinear. A kernel of N taps
+// computes the frame at floor(position) + frac from the N frames starting at
+// floor(position) - N / 2 + 1. The weights are stored twice per tap, once
+// for each channel of an interleaved stereo frame, so that two frames are
+// weighted with a single SSE multiplication.
+
+const int kCubicTaps = 4;
+// The taps of the sinc kernel up to a rate of 1.
+const int kSincTaps = 16;
+// The taps of the widest sinc kernel, for kSincMaxRate and above.
+const int kSincMaxTaps = 64;
+const double kSincMaxRate = 4.0;
+// The number of fractional positions the sinc kernel is tabulated for.
+const int kSincPhases = 256;
+
+// The weights of the Catmull-Rom spline, i.e. 4-point Hermite interpolation.
+inline void cubicInterpolationWeights(CSAMPLE frac, CSAMPLE* pWeights) {
+    const CSAMPLE w0 = ((-0.5f * frac + 1.0f) * frac - 0.5f) * frac;
+    const CSAMPLE w1 = (1.5f * frac - 2.5f) * frac * frac + 1.0f;
+    const CSAMPLE w2 = ((-1.5f * frac + 2.0f) * frac + 0.5f) * frac;
+    const CSAMPLE w3 = (0.5f * frac - 0.5f) * frac * frac;
+    pWeights[0] = pWeights[1] = w0;
+    pWeights[2] = pWeights[3] = w1;
+    pWeights[4] = pWeights[5] = w2;
+    pWeights[6] = pWeights[7] = w3;
+}
+
+// Writes the weighted sum of the taps stereo frames at pFrames to pOut.
+// taps must be even.
+inline void applyInterpolationWeights(const CSAMPLE* pFrames,
+                                      const CSAMPLE* pWeights,
+                                      int taps, CSAMPLE* pOut) {
+#ifdef __SSE__
+    __m128 sum = _mm_setzero_ps();
+    for (int i = 0; i < taps * 2; i += 4) {
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(pFrames + i),
+                                         _mm_loadu_ps(pWeights + i)));
+    }
+    // Add the odd frames to the even frames
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi(reinterpret_cast<__m64*>(pOut), sum);
+#else
+    CSAMPLE left = 0;
+    CSAMPLE right = 0;
+    for (int i = 0; i < taps * 2; i += 2) {
+        left += pFrames[i] * pWeights[i];
+        right += pFrames[i + 1] * pWeights[i + 1];
+    }
+    pOut[0] = left;
+    pOut[1] = right;
+#endif
+}
+
+inline void interpolateCubic(const CSAMPLE* pFrames, CSAMPLE frac,
+                             CSAMPLE* pOut) {
+    CSAMPLE weights[kCubicTaps * 2];
+    cubicInterpolationWeights(frac, weights);
+    applyInterpolationWeights(pFrames, weights, kCubicTaps, pOut);
+}
+
+// The sinc kernel is tabulated in bands of rates. Up to a rate of 1 the
+// cutoff is at the Nyquist frequency. Above, it is lowered to 1 / rate of it,
+// so nothing aliases across the Nyquist frequency of the output, and the
+// kernel is widened by rate to keep the relative width of the transition
+// band. Returns the band with the lowest rate not below the absolute value
+// of rate. Above kSincMaxRate the cutoff stays at 1 / kSincMaxRate.
+int sincBandForRate(double rate);
+// The number of taps of the sinc kernel of band, from kSincTaps to
+// kSincMaxTaps.
+int sincTapsOfBand(int band);
+
+// Interpolates with the Kaiser windowed sinc kernel of band. The result is
+// blended from the two tabulated phases around frac. In band 0, frames at
+// integer positions are reproduced exactly.
+void interpolateSinc(const CSAMPLE* pFrames, double frac, int band,
+                     CSAMPLE* pOut);
+
+#endif // INTERPOLATIONKERNELS_H
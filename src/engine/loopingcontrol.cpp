@@ -361,28 +361,28 @@ double LoopingControl::getTrigger(const double dRate,
 void LoopingControl::hintReader(HintVector* pHintList) {
     Hint loop_hint;
     // If the loop is enabled, then this is high priority because we will loop
-    // sometime potentially very soon! The current audio itself is priority 1,
-    // but we will issue ourselves at priority 2.
+    // sometime potentially very soon! The current audio itself is
+    // HINT_PRIORITY_IMMINENT, but we will issue ourselves at HINT_PRIORITY_LOOP.
     if (m_bLoopingEnabled) {
         // If we're looping, hint the loop in and loop out, in case we reverse
         // into it. We could save information from process to tell which
         // direction we're going in, but that this is much simpler, and hints
         // aren't that bad to make anyway.
         if (m_iLoopStartSample >= 0) {
-            loop_hint.priority = 2;
+            loop_hint.priority = HINT_PRIORITY_LOOP;
             loop_hint.sample = m_iLoopStartSample;
             loop_hint.length = 0; // Let it issue the default length
             pHintList->append(loop_hint);
         }
         if (m_iLoopEndSample >= 0) {
-            loop_hint.priority = 10;
+            loop_hint.priority = HINT_PRIORITY_SPECULATIVE;
             loop_hint.sample = m_iLoopEndSample;
             loop_hint.length = -1; // Let it issue the default (backwards) length
             pHintList->append(loop_hint);
         }
     } else {
         if (m_iLoopStartSample >= 0) {
-            loop_hint.priority = 10;
+            loop_hint.priority = HINT_PRIORITY_SPECULATIVE;
             loop_hint.sample = m_iLoopStartSample;
             loop_hint.length = 0; // Let it issue the default length
             pHintList->append(loop_hint);
@@ -0,0 +1,199 @@
+#include <cstring>
+
+#include <QFile>
+#include <QRegExp>
+#include <QStringList>
+#include <QTextStream>
+#include <QtDebug>
+
+#include "engine/offlinerenderer.h"
+
+#include "controlobject.h"
+#include "engine/enginemaster.h"
+#include "engine/sidechain/enginesidechain.h"
+#include "util/defs.h"
+#include "util/math.h"
+#include "util/performancetimer.h"
+
+// static
+const int OfflineRenderer::kDefaultFramesPerBuffer = 1024;
+
+void OfflineRenderTimeline::addEvent(double seconds, const ConfigKey& key,
+                                     double value) {
+    // Insert behind all events at the same time
+    int i = m_events.size();
+    while (i > 0 && m_events[i - 1].seconds > seconds) {
+        --i;
+    }
+    m_events.insert(i, OfflineRenderEvent(seconds, key, value));
+}
+
+bool OfflineRenderTimeline::parse(QTextStream* pStream, QString* pError) {
+    int lineNumber = 0;
+    while (!pStream->atEnd()) {
+        const QString line = pStream->readLine().trimmed();
+        ++lineNumber;
+        if (line.isEmpty() || line.startsWith('#')) {
+            continue;
+        }
+        const QStringList fields = line.split(QRegExp("\\s+"));
+        bool secondsOk = false;
+        bool valueOk = false;
+        double seconds = 0.0;
+        double value = 0.0;
+        if (fields.size() == 4) {
+            seconds = fields[0].toDouble(&secondsOk);
+            value = fields[3].toDouble(&valueOk);
+        }
+        if (!secondsOk || !valueOk || seconds < 0.0) {
+            if (pError) {
+                *pError = QString("line %1: expected \"seconds group item value\"")
+                        .arg(lineNumber);
+            }
+            return false;
+        }
+        addEvent(seconds, ConfigKey(fields[1], fields[2]), value);
+    }
+    return true;
+}
+
+bool OfflineRenderTimeline::load(const QString& fileName, QString* pError) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        if (pError) {
+            *pError = QString("could not open %1").arg(fileName);
+        }
+        return false;
+    }
+    QTextStream stream(&file);
+    return parse(&stream, pError);
+}
+
+OfflineRenderFileSink::OfflineRenderFileSink(const QString& fileName,
+                                             int sampleRate)
+        : m_pSndfile(NULL) {
+    SF_INFO sfInfo;
+    memset(&sfInfo, 0, sizeof(sfInfo));
+    sfInfo.samplerate = sampleRate;
+    sfInfo.channels = 2;
+    sfInfo.format = SF_FORMAT_WAV | SF_FORMAT_FLOAT;
+#ifdef __WINDOWS__
+    // Pointer valid until string changed
+    LPCWSTR lpcwFilename = (LPCWSTR)fileName.utf16();
+    m_pSndfile = sf_wchar_open(lpcwFilename, SFM_WRITE, &sfInfo);
+#else
+    m_pSndfile = sf_open(fileName.toLocal8Bit().constData(), SFM_WRITE, &sfInfo);
+#endif
+    if (m_pSndfile == NULL) {
+        m_error = sf_strerror(NULL);
+        qWarning() << "OfflineRenderFileSink: could not open" << fileName
+                   << m_error;
+    }
+}
+
+OfflineRenderFileSink::~OfflineRenderFileSink() {
+    if (m_pSndfile != NULL) {
+        sf_close(m_pSndfile);
+    }
+}
+
+bool OfflineRenderFileSink::write(const CSAMPLE* pBuffer, int iFrames) {
+    if (m_pSndfile == NULL) {
+        return false;
+    }
+    if (sf_writef_float(m_pSndfile, pBuffer, iFrames) != iFrames) {
+        m_error = sf_strerror(m_pSndfile);
+        qWarning() << "OfflineRenderFileSink: write failed" << m_error;
+        return false;
+    }
+    return true;
+}
+
+OfflineRenderer::OfflineRenderer(EngineMaster* pEngineMaster, int sampleRate,
+                                 int framesPerBuffer)
+        : m_pEngineMaster(pEngineMaster),
+          m_sampleRate(sampleRate),
+          m_framesPerBuffer(math_clamp(framesPerBuffer, 1,
+                  static_cast<int>(MAX_BUFFER_LEN / 2))),
+          m_renderedFrames(0),
+          m_realtimeFactor(0.0) {
+    ControlObject::getControl(ConfigKey(m_pEngineMaster->getMasterGroup(),
+                                        "samplerate"))->set(m_sampleRate);
+}
+
+void OfflineRenderer::skipBuffer() {
+    // EngineMaster expects stereo samples.
+    m_pEngineMaster->process(m_framesPerBuffer * 2);
+    EngineSideChain* pSideChain = m_pEngineMaster->getSideChain();
+    if (pSideChain != NULL) {
+        pSideChain->waitUntilIdle();
+    }
+}
+
+SINT OfflineRenderer::frameForSeconds(double seconds) const {
+    return static_cast<SINT>(seconds * m_sampleRate + 0.5);
+}
+
+bool OfflineRenderer::render(const OfflineRenderTimeline& timeline,
+                             double durationSeconds,
+                             OfflineRenderSink* pSink) {
+    m_renderedFrames = 0;
+    m_realtimeFactor = 0.0;
+
+    // Look up all controls up front, so unknown ones are reported once.
+    const QList<OfflineRenderEvent>& events = timeline.events();
+    QList<ControlObject*> controls;
+    foreach (const OfflineRenderEvent& event, events) {
+        ControlObject* pControl = ControlObject::getControl(event.key, false);
+        if (pControl == NULL) {
+            qWarning() << "OfflineRenderer: ignoring unknown control"
+                       << event.key.group << event.key.item;
+        }
+        controls.append(pControl);
+    }
+
+    EngineSideChain* pSideChain = m_pEngineMaster->getSideChain();
+    const SINT totalFrames = frameForSeconds(durationSeconds);
+    int nextEvent = 0;
+    bool ok = true;
+
+    PerformanceTimer timer;
+    timer.start();
+    while (m_renderedFrames < totalFrames) {
+        while (nextEvent < events.size() &&
+                frameForSeconds(events[nextEvent].seconds) <= m_renderedFrames) {
+            if (controls[nextEvent] != NULL) {
+                controls[nextEvent]->set(events[nextEvent].value);
+            }
+            ++nextEvent;
+        }
+
+        SINT frames = math_min<SINT>(m_framesPerBuffer,
+                                     totalFrames - m_renderedFrames);
+        if (nextEvent < events.size()) {
+            frames = math_min(frames,
+                    frameForSeconds(events[nextEvent].seconds) - m_renderedFrames);
+        }
+
+        // EngineMaster expects stereo samples.
+        m_pEngineMaster->process(static_cast<int>(frames * 2));
+        if (pSideChain != NULL) {
+            pSideChain->waitUntilIdle();
+        }
+        m_renderedFrames += frames;
+
+        if (!pSink->write(m_pEngineMaster->getMasterBuffer(),
+                          static_cast<int>(frames))) {
+            ok = false;
+            break;
+        }
+    }
+
+    const qint64 elapsedNs = timer.elapsed();
+    if (elapsedNs > 0) {
+        m_realtimeFactor = (1e9 * m_renderedFrames / m_sampleRate) / elapsedNs;
+    }
+    qDebug() << "OfflineRenderer: rendered" << m_renderedFrames << "frames at"
+             << m_realtimeFactor << "times real-time";
+    return ok;
+}
@@ -0,0 +1,151 @@
+#ifndef OFFLINERENDERER_H
+#define OFFLINERENDERER_H
+
+#include <QList>
+#include <QString>
+
+#ifdef Q_OS_WIN
+//Enable unicode in libsndfile on Windows
+//(sf_open uses UTF-8 otherwise)
+#include <windows.h>
+#define ENABLE_SNDFILE_WINDOWS_PROTOTYPES 1
+#endif
+#include <sndfile.h>
+
+#include "configobject.h"
+#include "util.h"
+#include "util/types.h"
+
+class EngineMaster;
+class QTextStream;
+
+// A control change that is applied at a point in time of an offline render.
+struct OfflineRenderEvent {
+    OfflineRenderEvent(double seconds, const ConfigKey& key, double value)
+            : seconds(seconds),
+              key(key),
+              value(value) {
+    }
+
+    double seconds;
+    ConfigKey key;
+    double value;
+};
+
+// A script of control changes for the OfflineRenderer. In text form it has
+// one event per line:
+//
+//   # seconds group item value
+//   0.0 [Channel1] play 1
+//   30.5 [Master] crossfader -1
+//
+// Empty lines and lines starting with '#' are ignored.
+class OfflineRenderTimeline {
+  public:
+    // Adds an event. Events at the same time are applied in the order they
+    // were added.
+    void addEvent(double seconds, const ConfigKey& key, double value);
+
+    // Parses the text form and adds its events. Returns false and describes
+    // the first invalid line in pError if the text cannot be parsed.
+    bool parse(QTextStream* pStream, QString* pError);
+    bool load(const QString& fileName, QString* pError);
+
+    // Sorted by time
+    const QList<OfflineRenderEvent>& events() const {
+        return m_events;
+    }
+
+  private:
+    QList<OfflineRenderEvent> m_events;
+};
+
+// Receives the master output of an OfflineRenderer.
+class OfflineRenderSink {
+  public:
+    virtual ~OfflineRenderSink() { }
+    // pBuffer holds iFrames interleaved stereo frames. Returning false
+    // aborts the render.
+    virtual bool write(const CSAMPLE* pBuffer, int iFrames) = 0;
+};
+
+// Writes the master output to a 32 bit float WAV file.
+class OfflineRenderFileSink : public OfflineRenderSink {
+  public:
+    OfflineRenderFileSink(const QString& fileName, int sampleRate);
+    virtual ~OfflineRenderFileSink();
+
+    bool isOpen() const {
+        return m_pSndfile != NULL;
+    }
+    const QString& getError() const {
+        return m_error;
+    }
+
+    virtual bool write(const CSAMPLE* pBuffer, int iFrames);
+
+  private:
+    SNDFILE* m_pSndfile;
+    QString m_error;
+
+    DISALLOW_COPY_AND_ASSIGN(OfflineRenderFileSink);
+};
+
+// OfflineRenderer drives an EngineMaster without a sound card, as fast as the
+// CPU allows, and passes the master output to a sink. It takes the place of
+// SoundManager::onDeviceOutputCallback, so the whole engine runs like it does
+// with a sound device: decks, sync, effects and the sidechain (recording and
+// broadcasting). Use it for pre-rendering mixes and for regression and
+// performance tests of the engine.
+//
+// The events of the timeline are applied from the rendering thread between
+// two calls of EngineMaster::process. The engine buffer is split at the
+// event, so the change takes effect at the exact frame independent of the
+// buffer size.
+//
+// The decks still read their tracks through the CachingReader worker
+// threads. Enable [Master],caching_reader_whole_track for renders that have
+// to be reproducible, so seeks are served from memory.
+//
+// Mixxx renders offline instead of starting the GUI when it is started with
+// --render TIMELINE, see MixxxMainWindow::renderOffline().
+class OfflineRenderer {
+  public:
+    // The buffer size in frames if none is given
+    static const int kDefaultFramesPerBuffer;
+
+    // pEngineMaster must be set up completely (channels added and tracks
+    // loaded) and must not be driven by a sound device at the same time.
+    OfflineRenderer(EngineMaster* pEngineMaster, int sampleRate,
+                    int framesPerBuffer = kDefaultFramesPerBuffer);
+
+    // Renders durationSeconds of master output. Events at or after
+    // durationSeconds are not audible. Returns false if the sink aborted the
+    // render.
+    bool render(const OfflineRenderTimeline& timeline, double durationSeconds,
+                OfflineRenderSink* pSink);
+
+    // Processes one buffer and drops the output, so the decks can load their
+    // tracks before render() starts.
+    void skipBuffer();
+
+    // The number of frames rendered by the last call of render()
+    SINT getRenderedFrames() const {
+        return m_renderedFrames;
+    }
+    // How many times faster than real-time the last render was
+    double getRealtimeFactor() const {
+        return m_realtimeFactor;
+    }
+
+  private:
+    SINT frameForSeconds(double seconds) const;
+
+    EngineMaster* m_pEngineMaster;
+    const int m_sampleRate;
+    const int m_framesPerBuffer;
+    SINT m_renderedFrames;
+    double m_realtimeFactor;
+};
+
+#endif /* OFFLINERENDERER_H */
@@ -0,0 +1,174 @@
+#include "engine/partitionedconvolution.h"
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#include "sampleutil.h"
+#include "util/assert.h"
+#include "util/math.h"
+
+namespace {
+
+// Splits the spectrum of the complex signal left + i * right into the spectra
+// of left and right, scaled by 2. pSpectrum holds size complex values, the
+// bins up to size / 2 are written.
+void splitSpectrum(const CSAMPLE* pSpectrum, int size,
+                   CSAMPLE* pLeft, CSAMPLE* pRight) {
+    for (int k = 0; k <= size / 2; ++k) {
+        const int mirrored = (size - k) % size;
+        const CSAMPLE re = pSpectrum[k * 2];
+        const CSAMPLE im = pSpectrum[k * 2 + 1];
+        const CSAMPLE mirroredRe = pSpectrum[mirrored * 2];
+        const CSAMPLE mirroredIm = pSpectrum[mirrored * 2 + 1];
+        // left = X[k] + conj(X[size - k]), right = (X[k] - conj(X[size - k])) / i
+        pLeft[k * 2] = re + mirroredRe;
+        pLeft[k * 2 + 1] = im - mirroredIm;
+        pRight[k * 2] = im + mirroredIm;
+        pRight[k * 2 + 1] = mirroredRe - re;
+    }
+}
+
+// pAccumulator += pA * pB for bins complex values
+inline void multiplyAccumulate(const CSAMPLE* pA, const CSAMPLE* pB,
+                               CSAMPLE* pAccumulator, int bins) {
+    int k = 0;
+#ifdef __SSE__
+    const __m128 signs = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+    for (; k + 2 <= bins; k += 2) {
+        const __m128 a = _mm_loadu_ps(pA + k * 2);
+        const __m128 b = _mm_loadu_ps(pB + k * 2);
+        const __m128 aRe = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 aIm = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 bSwapped = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 product = _mm_add_ps(
+                _mm_mul_ps(aRe, b),
+                _mm_mul_ps(_mm_mul_ps(aIm, bSwapped), signs));
+        _mm_storeu_ps(pAccumulator + k * 2,
+                      _mm_add_ps(_mm_loadu_ps(pAccumulator + k * 2), product));
+    }
+#endif
+    for (; k < bins; ++k) {
+        const CSAMPLE aRe = pA[k * 2];
+        const CSAMPLE aIm = pA[k * 2 + 1];
+        const CSAMPLE bRe = pB[k * 2];
+        const CSAMPLE bIm = pB[k * 2 + 1];
+        pAccumulator[k * 2] += aRe * bRe - aIm * bIm;
+        pAccumulator[k * 2 + 1] += aRe * bIm + aIm * bRe;
+    }
+}
+
+} // anonymous namespace
+
+PartitionedImpulseResponse::PartitionedImpulseResponse(
+        const CSAMPLE* pImpulse, int impulseFrames, int blockFrames)
+        : m_blockFrames(blockFrames),
+          m_partitions(math_max(1, (impulseFrames + blockFrames - 1) / blockFrames)),
+          m_fft(blockFrames * 2),
+          m_pSpectra(SampleUtil::alloc(m_partitions * bins() * 4)) {
+    const int size = m_fft.size();
+    // Both the spectra of the input and of the impulse response are scaled
+    // by 2 when split and the inverse FFT is unnormalized.
+    const CSAMPLE scale = 1.0f / (4 * size);
+    CSAMPLE* pWork = SampleUtil::alloc(size * 2);
+    for (int partition = 0; partition < m_partitions; ++partition) {
+        // Overlap-save: The partition followed by a block of silence
+        const int firstFrame = partition * blockFrames;
+        const int frames = math_max(0,
+                math_min(blockFrames, impulseFrames - firstFrame));
+        SampleUtil::clear(pWork, size * 2);
+        if (frames > 0) {
+            SampleUtil::copy(pWork, pImpulse + firstFrame * 2, frames * 2);
+        }
+        m_fft.forward(pWork);
+        CSAMPLE* pLeft = m_pSpectra + partition * bins() * 4;
+        CSAMPLE* pRight = pLeft + bins() * 2;
+        splitSpectrum(pWork, size, pLeft, pRight);
+        for (int i = 0; i < bins() * 4; ++i) {
+            pLeft[i] *= scale;
+        }
+    }
+    SampleUtil::free(pWork);
+}
+
+PartitionedImpulseResponse::~PartitionedImpulseResponse() {
+    SampleUtil::free(m_pSpectra);
+}
+
+UniformPartitionedConvolution::UniformPartitionedConvolution(
+        const PartitionedImpulseResponse* pImpulse)
+        : m_pImpulse(pImpulse),
+          m_pInputWindow(SampleUtil::alloc(pImpulse->blockFrames() * 4)),
+          m_pWork(SampleUtil::alloc(pImpulse->fft().size() * 2)),
+          m_pDelayLine(SampleUtil::alloc(
+                  pImpulse->partitions() * pImpulse->bins() * 4)),
+          m_iDelayLinePosition(0),
+          m_pAccumulator(SampleUtil::alloc(pImpulse->bins() * 4)) {
+    reset();
+}
+
+UniformPartitionedConvolution::~UniformPartitionedConvolution() {
+    SampleUtil::free(m_pAccumulator);
+    SampleUtil::free(m_pDelayLine);
+    SampleUtil::free(m_pWork);
+    SampleUtil::free(m_pInputWindow);
+}
+
+void UniformPartitionedConvolution::reset() {
+    SampleUtil::clear(m_pInputWindow, blockFrames() * 4);
+    SampleUtil::clear(m_pDelayLine,
+                      m_pImpulse->partitions() * m_pImpulse->bins() * 4);
+    m_iDelayLinePosition = 0;
+}
+
+void UniformPartitionedConvolution::processBlock(const CSAMPLE* pInput,
+                                                 CSAMPLE* pOutput) {
+    const int blockSamples = blockFrames() * 2;
+    const int size = m_pImpulse->fft().size();
+    const int bins = m_pImpulse->bins();
+    const int partitions = m_pImpulse->partitions();
+
+    SampleUtil::copy(m_pInputWindow, m_pInputWindow + blockSamples,
+                     blockSamples);
+    SampleUtil::copy(m_pInputWindow + blockSamples, pInput, blockSamples);
+    SampleUtil::copy(m_pWork, m_pInputWindow, blockSamples * 2);
+    m_pImpulse->fft().forward(m_pWork);
+
+    CSAMPLE* pNewest = m_pDelayLine + m_iDelayLinePosition * bins * 4;
+    splitSpectrum(m_pWork, size, pNewest, pNewest + bins * 2);
+
+    CSAMPLE* pLeft = m_pAccumulator;
+    CSAMPLE* pRight = m_pAccumulator + bins * 2;
+    SampleUtil::clear(m_pAccumulator, bins * 4);
+    for (int partition = 0; partition < partitions; ++partition) {
+        // Partition p of the impulse response meets the input of p blocks ago
+        const int slot = (m_iDelayLinePosition - partition + partitions) % partitions;
+        const CSAMPLE* pInputSpectrum = m_pDelayLine + slot * bins * 4;
+        multiplyAccumulate(pInputSpectrum, m_pImpulse->leftSpectrum(partition),
+                           pLeft, bins);
+        multiplyAccumulate(pInputSpectrum + bins * 2,
+                           m_pImpulse->rightSpectrum(partition),
+                           pRight, bins);
+    }
+    m_iDelayLinePosition = (m_iDelayLinePosition + 1) % partitions;
+
+    // Join the spectra of both output channels into the spectrum of
+    // left + i * right: Y[k] = L[k] + i * R[k], Y[size - k] = conj(L[k]) +
+    // i * conj(R[k]).
+    for (int k = 0; k < bins; ++k) {
+        const CSAMPLE leftRe = pLeft[k * 2];
+        const CSAMPLE leftIm = pLeft[k * 2 + 1];
+        const CSAMPLE rightRe = pRight[k * 2];
+        const CSAMPLE rightIm = pRight[k * 2 + 1];
+        m_pWork[k * 2] = leftRe - rightIm;
+        m_pWork[k * 2 + 1] = leftIm + rightRe;
+        if (k > 0 && k < size / 2) {
+            m_pWork[(size - k) * 2] = leftRe + rightIm;
+            m_pWork[(size - k) * 2 + 1] = rightRe - leftIm;
+        }
+    }
+    m_pImpulse->fft().inverse(m_pWork);
+
+    // Overlap-save: Only the second block is free of circular aliasing.
+    SampleUtil::copy(pOutput, m_pWork + blockSamples, blockSamples);
+}
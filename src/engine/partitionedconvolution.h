@@ -0,0 +1,98 @@
+#ifndef PARTITIONEDCONVOLUTION_H
+#define PARTITIONEDCONVOLUTION_H
+
+#include "util.h"
+#include "util/fft.h"
+#include "util/types.h"
+
+// The spectra of the partitions of a stereo impulse response, prepared for a
+// uniformly partitioned overlap-save convolution with blockFrames frames per
+// block. It does not change after construction, so all channels that
+// convolve with the same impulse response share one.
+//
+// Both channels are transformed at once as the real and imaginary part of one
+// complex signal and split afterwards, using the symmetry of the spectrum of
+// a real signal. Only the bins up to the Nyquist frequency are stored.
+class PartitionedImpulseResponse {
+  public:
+    // pImpulse holds impulseFrames interleaved stereo frames.
+    PartitionedImpulseResponse(const CSAMPLE* pImpulse, int impulseFrames,
+                               int blockFrames);
+    virtual ~PartitionedImpulseResponse();
+
+    int blockFrames() const {
+        return m_blockFrames;
+    }
+
+    int partitions() const {
+        return m_partitions;
+    }
+
+    // The number of complex values per channel and partition
+    int bins() const {
+        return m_blockFrames + 1;
+    }
+
+    // The FFT of two blocks, which is shared with the convolutions.
+    const Fft& fft() const {
+        return m_fft;
+    }
+
+    const CSAMPLE* leftSpectrum(int partition) const {
+        return m_pSpectra + partition * bins() * 4;
+    }
+
+    const CSAMPLE* rightSpectrum(int partition) const {
+        return leftSpectrum(partition) + bins() * 2;
+    }
+
+  private:
+    const int m_blockFrames;
+    const int m_partitions;
+    const Fft m_fft;
+    // Per partition the left and then the right spectrum
+    CSAMPLE* m_pSpectra;
+
+    DISALLOW_COPY_AND_ASSIGN(PartitionedImpulseResponse);
+};
+
+// Convolves an interleaved stereo signal with a PartitionedImpulseResponse,
+// the left channel with the left and the right with the right channel of the
+// impulse response. The input is processed in blocks of blockFrames frames,
+// each costing one forward and one inverse FFT of two blocks plus one complex
+// multiplication per bin and partition. The result of a block is available as
+// soon as the block is complete, so the only latency is the buffering of the
+// input.
+class UniformPartitionedConvolution {
+  public:
+    explicit UniformPartitionedConvolution(
+            const PartitionedImpulseResponse* pImpulse);
+    virtual ~UniformPartitionedConvolution();
+
+    int blockFrames() const {
+        return m_pImpulse->blockFrames();
+    }
+
+    // Convolves the next blockFrames() frames. pInput may be equal to pOutput.
+    void processBlock(const CSAMPLE* pInput, CSAMPLE* pOutput);
+
+    // Forgets all input processed so far.
+    void reset();
+
+  private:
+    const PartitionedImpulseResponse* m_pImpulse;
+    // The previous and the current input block
+    CSAMPLE* m_pInputWindow;
+    // Two blocks of complex values for the FFT
+    CSAMPLE* m_pWork;
+    // The split spectra of the last partitions() input blocks, a ring buffer
+    // in the layout of the impulse response spectra
+    CSAMPLE* m_pDelayLine;
+    int m_iDelayLinePosition;
+    // The spectra of the left and the right output channel
+    CSAMPLE* m_pAccumulator;
+
+    DISALLOW_COPY_AND_ASSIGN(UniformPartitionedConvolution);
+};
+
+#endif // PARTITIONEDCONVOLUTION_H
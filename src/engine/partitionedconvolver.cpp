@@ -0,0 +1,259 @@
+#include "engine/partitionedconvolver.h"
+
+#include <QMutexLocker>
+#include <QtDebug>
+
+#include "sampleutil.h"
+#include "util/assert.h"
+#include "util/compatibility.h"
+#include "util/counter.h"
+#include "util/math.h"
+
+namespace {
+
+// The number of tail blocks the callback can queue for the worker
+const int kTailBlocksQueued = 4;
+
+// A tail block of 1024 frames lasts 21 ms at 48 kHz, and the worker has a
+// whole block of time for it.
+const int kWorkerPollMillis = 2;
+
+} // anonymous namespace
+
+const int PartitionedConvolverKernel::kHeadBlockFrames = 128;
+const int PartitionedConvolverKernel::kTailBlockFrames = 1024;
+const int PartitionedConvolverKernel::kHeadFrames = 2 * kTailBlockFrames;
+
+PartitionedConvolverKernel::PartitionedConvolverKernel(
+        const CSAMPLE* pImpulse, int impulseFrames)
+        : m_iImpulseFrames(impulseFrames),
+          m_head(pImpulse, math_min(impulseFrames, kHeadFrames),
+                 kHeadBlockFrames) {
+    if (impulseFrames > kHeadFrames) {
+        m_pTail.reset(new PartitionedImpulseResponse(
+                pImpulse + kHeadFrames * 2, impulseFrames - kHeadFrames,
+                kTailBlockFrames));
+    }
+}
+
+PartitionedConvolverWorker::PartitionedConvolverWorker()
+        : m_processRequested(0),
+          m_stop(0) {
+    start(QThread::HighPriority);
+}
+
+PartitionedConvolverWorker::~PartitionedConvolverWorker() {
+    m_stop = 1;
+    wait();
+}
+
+void PartitionedConvolverWorker::run() {
+    unsigned static id = 0; //the id of this thread, for debugging purposes
+    QThread::currentThread()->setObjectName(
+            QString("PartitionedConvolverWorker %1").arg(++id));
+
+    while (!load_atomic(m_stop)) {
+        if (!m_processRequested.fetchAndStoreAcquire(0)) {
+            msleep(kWorkerPollMillis);
+            continue;
+        }
+        QMutexLocker locker(&m_mutex);
+        foreach (PartitionedConvolver* pConvolver, m_convolvers) {
+            pConvolver->processTail();
+        }
+    }
+}
+
+void PartitionedConvolverWorker::addConvolver(PartitionedConvolver* pConvolver) {
+    QMutexLocker locker(&m_mutex);
+    m_convolvers.append(pConvolver);
+}
+
+void PartitionedConvolverWorker::removeConvolver(PartitionedConvolver* pConvolver) {
+    QMutexLocker locker(&m_mutex);
+    m_convolvers.removeAll(pConvolver);
+}
+
+PartitionedConvolver::PartitionedConvolver(
+        PartitionedConvolverKernelPointer pKernel,
+        PartitionedConvolverWorkerPointer pWorker)
+        : m_pKernel(pKernel),
+          m_pWorker(pWorker),
+          m_head(pKernel->head()),
+          m_pHeadInput(SampleUtil::alloc(
+                  PartitionedConvolverKernel::kHeadBlockFrames * 2)),
+          m_pHeadOutput(SampleUtil::alloc(
+                  PartitionedConvolverKernel::kHeadBlockFrames * 2)),
+          m_iHeadFrames(0),
+          m_pTailInput(SampleUtil::alloc(
+                  PartitionedConvolverKernel::kTailBlockFrames * 2)),
+          m_iTailInputFrames(0),
+          m_tailInputFIFO(kTailBlocksQueued *
+                          PartitionedConvolverKernel::kTailBlockFrames * 2),
+          // Room for the queued blocks and the two blocks that are ready
+          // before they are played.
+          m_tailOutputFIFO((kTailBlocksQueued + 2) *
+                           PartitionedConvolverKernel::kTailBlockFrames * 2),
+          m_iTailFramesBehind(-(latencyFrames() +
+                                PartitionedConvolverKernel::kHeadFrames)),
+          m_bTailResyncing(false),
+          m_tailResetRequested(0),
+          m_pTailBlock(SampleUtil::alloc(
+                  PartitionedConvolverKernel::kTailBlockFrames * 2)) {
+    SampleUtil::clear(m_pHeadOutput,
+                      PartitionedConvolverKernel::kHeadBlockFrames * 2);
+    if (m_pKernel->tail()) {
+        m_pTail.reset(new UniformPartitionedConvolution(m_pKernel->tail()));
+        if (m_pWorker) {
+            m_pWorker->addConvolver(this);
+        }
+    }
+}
+
+PartitionedConvolver::~PartitionedConvolver() {
+    if (m_pWorker) {
+        m_pWorker->removeConvolver(this);
+    }
+    SampleUtil::free(m_pTailBlock);
+    SampleUtil::free(m_pTailInput);
+    SampleUtil::free(m_pHeadOutput);
+    SampleUtil::free(m_pHeadInput);
+}
+
+void PartitionedConvolver::process(const CSAMPLE* pInput, CSAMPLE* pOutput,
+                                   int numFrames) {
+    const int headBlockFrames = PartitionedConvolverKernel::kHeadBlockFrames;
+    for (int frame = 0; frame < numFrames;) {
+        const int frames = math_min(numFrames - frame,
+                                    headBlockFrames - m_iHeadFrames);
+        const CSAMPLE* pIn = pInput + frame * 2;
+        CSAMPLE* pOut = pOutput + frame * 2;
+
+        // Take the input before it is overwritten by an in-place output.
+        SampleUtil::copy(m_pHeadInput + m_iHeadFrames * 2, pIn, frames * 2);
+        if (m_pTail) {
+            queueTailInput(pIn, frames);
+        }
+        SampleUtil::copy(pOut, m_pHeadOutput + m_iHeadFrames * 2, frames * 2);
+        if (m_pTail) {
+            addTailOutput(pOut, frames);
+        }
+
+        m_iHeadFrames += frames;
+        if (m_iHeadFrames == headBlockFrames) {
+            m_head.processBlock(m_pHeadInput, m_pHeadOutput);
+            m_iHeadFrames = 0;
+        }
+        frame += frames;
+    }
+}
+
+void PartitionedConvolver::queueTailInput(const CSAMPLE* pInput,
+                                          int numFrames) {
+    const int tailBlockFrames = PartitionedConvolverKernel::kTailBlockFrames;
+    // The tail block size is a multiple of the head block size, so a head
+    // block never spans two tail blocks.
+    DEBUG_ASSERT(m_iTailInputFrames + numFrames <= tailBlockFrames);
+    SampleUtil::copy(m_pTailInput + m_iTailInputFrames * 2, pInput,
+                     numFrames * 2);
+    m_iTailInputFrames += numFrames;
+    if (m_iTailInputFrames < tailBlockFrames) {
+        return;
+    }
+    m_iTailInputFrames = 0;
+
+    if (m_bTailResyncing) {
+        if (load_atomic(m_tailResetRequested)) {
+            // Still waiting for the worker.
+            if (m_pWorker) {
+                m_pWorker->requestProcessing();
+            }
+            return;
+        }
+        // The worker has dropped the queued input and reset the tail. Discard
+        // its stale output and start over with the block just completed, like
+        // the first block. Its output is due latency plus head frames after
+        // its start, which was tailBlockFrames - numFrames frames before the
+        // frames addTailOutput() is called for next.
+        m_tailOutputFIFO.releaseReadRegions(m_tailOutputFIFO.readAvailable());
+        m_iTailFramesBehind = -(latencyFrames() +
+                                PartitionedConvolverKernel::kHeadFrames -
+                                tailBlockFrames + numFrames);
+        m_bTailResyncing = false;
+    } else if (m_tailInputFIFO.writeAvailable() < tailBlockFrames * 2) {
+        // The worker has not even started on the queued blocks. Leaving out
+        // this block would misalign the tail of all blocks after it, so
+        // silence the tail until the worker has reset it.
+        m_bTailResyncing = true;
+        m_tailResetRequested.fetchAndStoreRelease(1);
+        if (m_pWorker) {
+            m_pWorker->requestProcessing();
+        }
+        Counter("PartitionedConvolver tail block dropped")++;
+        return;
+    }
+    m_tailInputFIFO.write(m_pTailInput, tailBlockFrames * 2);
+    if (m_pWorker) {
+        m_pWorker->requestProcessing();
+    }
+}
+
+void PartitionedConvolver::addTailOutput(CSAMPLE* pOutput, int numFrames) {
+    if (m_bTailResyncing) {
+        return;
+    }
+    if (m_iTailFramesBehind < 0) {
+        const int silentFrames = math_min(numFrames, -m_iTailFramesBehind);
+        m_iTailFramesBehind += silentFrames;
+        pOutput += silentFrames * 2;
+        numFrames -= silentFrames;
+    }
+    if (m_iTailFramesBehind > 0) {
+        // Drop the output that arrived too late to be played.
+        const int lateFrames = math_min(m_iTailFramesBehind,
+                                        m_tailOutputFIFO.readAvailable() / 2);
+        m_tailOutputFIFO.releaseReadRegions(lateFrames * 2);
+        m_iTailFramesBehind -= lateFrames;
+    }
+
+    int framesAdded = 0;
+    if (m_iTailFramesBehind == 0) {
+        CSAMPLE* pData1;
+        ring_buffer_size_t size1;
+        CSAMPLE* pData2;
+        ring_buffer_size_t size2;
+        const int samplesRead = m_tailOutputFIFO.aquireReadRegions(
+                numFrames * 2, &pData1, &size1, &pData2, &size2);
+        SampleUtil::addWithGain(pOutput, pData1, 1.0, size1);
+        if (size2 > 0) {
+            SampleUtil::addWithGain(pOutput + size1, pData2, 1.0, size2);
+        }
+        m_tailOutputFIFO.releaseReadRegions(samplesRead);
+        framesAdded = samplesRead / 2;
+    }
+
+    if (framesAdded < numFrames) {
+        m_iTailFramesBehind += numFrames - framesAdded;
+        Counter("PartitionedConvolver tail underflow")++;
+    }
+}
+
+void PartitionedConvolver::processTail() {
+    if (!m_pTail) {
+        return;
+    }
+    const int tailBlockSamples = PartitionedConvolverKernel::kTailBlockFrames * 2;
+    if (load_atomic(m_tailResetRequested)) {
+        m_tailInputFIFO.releaseReadRegions(m_tailInputFIFO.readAvailable());
+        m_pTail->reset();
+        // Publishes the reset and everything written to the output FIFO
+        // before, which the callback discards.
+        m_tailResetRequested.fetchAndStoreRelease(0);
+    }
+    while (m_tailInputFIFO.readAvailable() >= tailBlockSamples &&
+            m_tailOutputFIFO.writeAvailable() >= tailBlockSamples) {
+        m_tailInputFIFO.read(m_pTailBlock, tailBlockSamples);
+        m_pTail->processBlock(m_pTailBlock, m_pTailBlock);
+        m_tailOutputFIFO.write(m_pTailBlock, tailBlockSamples);
+    }
+}
@@ -0,0 +1,158 @@
+#ifndef PARTITIONEDCONVOLVER_H
+#define PARTITIONEDCONVOLVER_H
+
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QScopedPointer>
+#include <QSharedPointer>
+
+#include "engine/engineworker.h"
+#include "engine/partitionedconvolution.h"
+#include "util.h"
+#include "util/fifo.h"
+#include "util/types.h"
+
+class PartitionedConvolver;
+
+// The impulse response of a PartitionedConvolver, split into a head that is
+// convolved in the callback with short blocks and a tail that is convolved by
+// a PartitionedConvolverWorker with long blocks.
+class PartitionedConvolverKernel {
+  public:
+    static const int kHeadBlockFrames;
+    static const int kTailBlockFrames;
+    // The tail starts two tail blocks into the impulse response, so the worker
+    // has a full tail block of time for a block.
+    static const int kHeadFrames;
+
+    // pImpulse holds impulseFrames interleaved stereo frames.
+    PartitionedConvolverKernel(const CSAMPLE* pImpulse, int impulseFrames);
+
+    int impulseFrames() const {
+        return m_iImpulseFrames;
+    }
+
+    const PartitionedImpulseResponse* head() const {
+        return &m_head;
+    }
+
+    // NULL if the impulse response is not longer than the head.
+    const PartitionedImpulseResponse* tail() const {
+        return m_pTail.data();
+    }
+
+  private:
+    const int m_iImpulseFrames;
+    const PartitionedImpulseResponse m_head;
+    QScopedPointer<const PartitionedImpulseResponse> m_pTail;
+
+    DISALLOW_COPY_AND_ASSIGN(PartitionedConvolverKernel);
+};
+typedef QSharedPointer<const PartitionedConvolverKernel> PartitionedConvolverKernelPointer;
+
+// Convolves the tails of the PartitionedConvolvers that are registered with
+// it. Convolvers register and unregister themselves from the main thread.
+//
+// Effects have no EngineWorkerScheduler and may run on several engine threads
+// at once, so the callback only sets a flag that the worker polls. A tail
+// block lasts far longer than the poll interval.
+class PartitionedConvolverWorker : public EngineWorker {
+    Q_OBJECT
+  public:
+    PartitionedConvolverWorker();
+    // Stops the thread and waits for it to exit.
+    virtual ~PartitionedConvolverWorker();
+
+    virtual void run();
+
+    void addConvolver(PartitionedConvolver* pConvolver);
+    // Returns when the worker no longer touches pConvolver.
+    void removeConvolver(PartitionedConvolver* pConvolver);
+
+    // Makes the worker process the convolvers within the poll interval.
+    // Lock-free, called from the callback.
+    void requestProcessing() {
+        m_processRequested.fetchAndStoreRelease(1);
+    }
+
+  private:
+    // Held by the worker while it processes, so only the main thread ever
+    // contends for it.
+    QMutex m_mutex;
+    QList<PartitionedConvolver*> m_convolvers;
+    QAtomicInt m_processRequested;
+    QAtomicInt m_stop;
+};
+typedef QSharedPointer<PartitionedConvolverWorker> PartitionedConvolverWorkerPointer;
+
+// Convolves an interleaved stereo signal with a long impulse response in the
+// audio callback. The head of the impulse response is convolved in blocks of
+// kHeadBlockFrames, which is the latency of the convolver. The much longer
+// tail is convolved in blocks of kTailBlockFrames by the worker, which only
+// has to deliver a block before the head is over. The callback just queues
+// the input and adds the output of the worker.
+//
+// If the worker falls behind, the tail is left out until it has caught up, so
+// the callback never waits. If the worker falls so far behind that a tail block
+// can not be queued, the tail is reset and starts over with the next block,
+// since a missing block would misalign the rest of the tail.
+class PartitionedConvolver {
+  public:
+    // If pWorker is NULL, processTail() has to be called explicitly.
+    PartitionedConvolver(PartitionedConvolverKernelPointer pKernel,
+                         PartitionedConvolverWorkerPointer pWorker);
+    virtual ~PartitionedConvolver();
+
+    static int latencyFrames() {
+        return PartitionedConvolverKernel::kHeadBlockFrames;
+    }
+
+    int impulseFrames() const {
+        return m_pKernel->impulseFrames();
+    }
+
+    // Writes the convolution of numFrames frames delayed by latencyFrames()
+    // to pOutput. pInput may be equal to pOutput. Called from the callback.
+    void process(const CSAMPLE* pInput, CSAMPLE* pOutput, int numFrames);
+
+    // Convolves all tail blocks queued by process(). Called from the worker.
+    void processTail();
+
+  private:
+    void queueTailInput(const CSAMPLE* pInput, int numFrames);
+    void addTailOutput(CSAMPLE* pOutput, int numFrames);
+
+    const PartitionedConvolverKernelPointer m_pKernel;
+    const PartitionedConvolverWorkerPointer m_pWorker;
+
+    UniformPartitionedConvolution m_head;
+    CSAMPLE* m_pHeadInput;
+    // The convolution of the previous head block, which is played while the
+    // next block is collected.
+    CSAMPLE* m_pHeadOutput;
+    int m_iHeadFrames;
+
+    CSAMPLE* m_pTailInput;
+    int m_iTailInputFrames;
+    FIFO<CSAMPLE> m_tailInputFIFO;
+    FIFO<CSAMPLE> m_tailOutputFIFO;
+    // The number of frames the worker output lags behind the callback.
+    // Negative if the next frames of the tail are silent: at the start, which
+    // the head covers.
+    int m_iTailFramesBehind;
+    // Set while the tail is silent because a block was dropped, until the
+    // worker has reset the tail.
+    bool m_bTailResyncing;
+    // Set by the callback to make the worker drop the queued input and reset
+    // the tail, cleared by the worker when done.
+    QAtomicInt m_tailResetRequested;
+
+    // Only touched by the worker.
+    QScopedPointer<UniformPartitionedConvolution> m_pTail;
+    CSAMPLE* m_pTailBlock;
+
+    DISALLOW_COPY_AND_ASSIGN(PartitionedConvolver);
+};
+
+#endif // PARTITIONEDCONVOLVER_H
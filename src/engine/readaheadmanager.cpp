@@ -14,7 +14,11 @@ ReadAheadManager::ReadAheadManager()
           m_pRateControl(NULL),
           m_iCurrentPosition(0),
           m_pReader(NULL),
-          m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)) {
+          m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_bTapEnabled(false),
+          m_bTapDiscontinuous(true),
+          m_iTapSamples(0),
+          m_pTapBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)) {
     // For testing only: ReadAheadManagerMock
 }
 
@@ -24,7 +28,11 @@ ReadAheadManager::ReadAheadManager(CachingReader* pReader,
           m_pRateControl(NULL),
           m_iCurrentPosition(0),
           m_pReader(pReader),
-          m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)) {
+          m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
+          m_bTapEnabled(false),
+          m_bTapDiscontinuous(true),
+          m_iTapSamples(0),
+          m_pTapBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)) {
     DEBUG_ASSERT(m_pLoopingControl != NULL);
     DEBUG_ASSERT(m_pReader != NULL);
     SampleUtil::clear(m_pCrossFadeBuffer, MAX_BUFFER_LEN);
@@ -32,6 +40,7 @@ ReadAheadManager::ReadAheadManager(CachingReader* pReader,
 
 ReadAheadManager::~ReadAheadManager() {
     SampleUtil::free(m_pCrossFadeBuffer);
+    SampleUtil::free(m_pTapBuffer);
 }
 
 int ReadAheadManager::getNextSamples(double dRate, CSAMPLE* buffer,
@@ -123,6 +132,18 @@ int ReadAheadManager::getNextSamples(double dRate, CSAMPLE* buffer,
         SampleUtil::reverse(base_buffer, samples_read);
     }
 
+    if (m_bTapEnabled && samples_read > 0) {
+        if (m_iTapSamples + samples_read <= static_cast<int>(MAX_BUFFER_LEN)) {
+            SampleUtil::copy(m_pTapBuffer + m_iTapSamples, base_buffer,
+                             samples_read);
+            m_iTapSamples += samples_read;
+        } else {
+            // The consumer lost track, start over with the next read
+            m_iTapSamples = 0;
+            m_bTapDiscontinuous = true;
+        }
+    }
+
     //qDebug() << "read" << m_iCurrentPosition << samples_read;
     return samples_read;
 }
@@ -135,6 +156,8 @@ void ReadAheadManager::addRateControl(RateControl* pRateControl) {
 void ReadAheadManager::notifySeek(int iSeekPosition) {
     m_iCurrentPosition = iSeekPosition;
     m_readAheadLog.clear();
+    m_iTapSamples = 0;
+    m_bTapDiscontinuous = true;
 
     // TODO(XXX) notifySeek on the engine controls. EngineBuffer currently does
     // a fine job of this so it isn't really necessary but eventually I think
@@ -145,6 +168,21 @@ void ReadAheadManager::notifySeek(int iSeekPosition) {
     // }
 }
 
+void ReadAheadManager::setTapEnabled(bool enabled) {
+    m_bTapEnabled = enabled;
+    m_iTapSamples = 0;
+    m_bTapDiscontinuous = true;
+}
+
+const CSAMPLE* ReadAheadManager::takeTappedSamples(int* pNumSamples,
+                                                   bool* pDiscontinuous) {
+    *pNumSamples = m_iTapSamples;
+    *pDiscontinuous = m_bTapDiscontinuous;
+    m_iTapSamples = 0;
+    m_bTapDiscontinuous = false;
+    return m_pTapBuffer;
+}
+
 void ReadAheadManager::hintReader(double dRate, HintVector* pHintList) {
     bool in_reverse = dRate < 0;
     Hint current_position;
@@ -165,7 +203,7 @@ void ReadAheadManager::hintReader(double dRate, HintVector* pHintList) {
         return;
 
     // top priority, we need to read this data immediately
-    current_position.priority = 1;
+    current_position.priority = HINT_PRIORITY_IMMINENT;
     pHintList->append(current_position);
 }
 
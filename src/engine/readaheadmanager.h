@@ -63,6 +63,19 @@ class ReadAheadManager {
         m_pReader = pReader;
     }
 
+    // While the tap is enabled, all samples returned by getNextSamples() are
+    // also collected in a tap buffer, so that they can be fed into an
+    // inactive scaler. Enabling the tap starts with an empty, discontinuous
+    // tap.
+    void setTapEnabled(bool enabled);
+
+    // Returns the samples collected since the last call and sets
+    // *pNumSamples to their number. *pDiscontinuous is set if the samples do
+    // not directly follow the ones returned by the previous call, because of
+    // a seek or because the tap buffer overflowed. The returned buffer is
+    // valid until the next call of getNextSamples().
+    const CSAMPLE* takeTappedSamples(int* pNumSamples, bool* pDiscontinuous);
+
   private:
     // An entry in the read log indicates the virtual playposition the read
     // began at and the virtual playposition it ended at.
@@ -124,6 +137,11 @@ class ReadAheadManager {
     int m_iCurrentPosition;
     CachingReader* m_pReader;
     CSAMPLE* m_pCrossFadeBuffer;
+
+    bool m_bTapEnabled;
+    bool m_bTapDiscontinuous;
+    int m_iTapSamples;
+    CSAMPLE* m_pTapBuffer;
 };
 
 #endif // READAHEADMANGER_H
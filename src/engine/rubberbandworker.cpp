@@ -0,0 +1,198 @@
+#include <rubberband/RubberBandStretcher.h>
+
+#include <QtDebug>
+
+#include "engine/rubberbandworker.h"
+
+#include "sampleutil.h"
+#include "util/counter.h"
+#include "util/math.h"
+
+using RubberBand::RubberBandStretcher;
+
+namespace {
+
+// The worker is not bound to the callback deadline, so it processes four
+// times the block size of EngineBufferScaleRubberBand.
+const int kWorkerBlockFrames = 1024;
+
+} // anonymous namespace
+
+RubberBandWorker::RubberBandWorker(
+        FIFO<RubberBandWorkerMessage>* pMessageFIFO,
+        FIFO<CSAMPLE>* pInputFIFO,
+        FIFO<CSAMPLE>* pOutputFIFO)
+        : m_pMessageFIFO(pMessageFIFO),
+          m_pInputFIFO(pInputFIFO),
+          m_pOutputFIFO(pOutputFIFO),
+          m_pRubberBand(NULL),
+          m_dTimeRatio(1.0),
+          m_dPitchScale(1.0),
+          m_pInterleaved(SampleUtil::alloc(kWorkerBlockFrames * 2)),
+          m_samplesWritten(0),
+          m_requestedGeneration(0),
+          m_resetGeneration(0),
+          m_samplesWrittenAtReset(0),
+          m_latencyFrames(0),
+          m_stop(0) {
+    m_channels[0] = SampleUtil::alloc(kWorkerBlockFrames);
+    m_channels[1] = SampleUtil::alloc(kWorkerBlockFrames);
+    initializeRubberBand(44100);
+}
+
+RubberBandWorker::~RubberBandWorker() {
+    delete m_pRubberBand;
+    SampleUtil::free(m_pInterleaved);
+    SampleUtil::free(m_channels[0]);
+    SampleUtil::free(m_channels[1]);
+}
+
+void RubberBandWorker::run() {
+    unsigned static id = 0; //the id of this thread, for debugging purposes
+    QThread::currentThread()->setObjectName(
+            QString("RubberBandWorker %1").arg(++id));
+
+    RubberBandWorkerMessage message;
+    while (!load_atomic(m_stop)) {
+        if (m_pMessageFIFO->read(&message, 1) == 1) {
+            processMessage(message);
+        } else {
+            m_semaRun.acquire();
+        }
+    }
+}
+
+void RubberBandWorker::quitWait() {
+    m_stop = 1;
+    m_semaRun.release();
+    wait();
+}
+
+void RubberBandWorker::processMessage(const RubberBandWorkerMessage& message) {
+    switch (message.type) {
+    case RubberBandWorkerMessage::PROCESS:
+        if (message.generation != load_atomic(m_requestedGeneration)) {
+            // The engine has been cleared since, skip the stale input.
+            m_pInputFIFO->releaseReadRegions(message.numSamples);
+            return;
+        }
+        setParameters(message.timeRatio, message.pitchScale);
+        stretch(message.numSamples, message.generation);
+        break;
+    case RubberBandWorkerMessage::RESET:
+        m_pRubberBand->reset();
+        // Publish the position first, the engine reads it after it has seen
+        // the generation.
+        m_samplesWrittenAtReset.fetchAndStoreRelease(
+                static_cast<int>(m_samplesWritten));
+        m_resetGeneration.fetchAndStoreRelease(message.generation);
+        break;
+    case RubberBandWorkerMessage::SET_SAMPLE_RATE:
+        initializeRubberBand(message.sampleRate);
+        break;
+    }
+}
+
+void RubberBandWorker::initializeRubberBand(int iSampleRate) {
+    delete m_pRubberBand;
+    m_pRubberBand = new RubberBandStretcher(
+            iSampleRate, 2,
+            RubberBandStretcher::OptionProcessRealTime |
+            RubberBandStretcher::OptionPitchHighQuality);
+    m_pRubberBand->setMaxProcessSize(kWorkerBlockFrames);
+    // Preallocate like EngineBufferScaleRubberBand, although reallocations
+    // are harmless outside of the callback.
+    m_pRubberBand->setTimeRatio(2.0);
+    m_pRubberBand->setTimeRatio(m_dTimeRatio);
+    m_pRubberBand->setPitchScale(m_dPitchScale);
+    m_latencyFrames.fetchAndStoreRelease(
+            static_cast<int>(m_pRubberBand->getLatency()));
+}
+
+void RubberBandWorker::setParameters(double timeRatio, double pitchScale) {
+    if (pitchScale > 0 && pitchScale != m_dPitchScale) {
+        m_pRubberBand->setPitchScale(pitchScale);
+        m_dPitchScale = pitchScale;
+    }
+    if (timeRatio > 0 && timeRatio != m_dTimeRatio) {
+        m_pRubberBand->setTimeRatio(timeRatio);
+        m_dTimeRatio = timeRatio;
+        // See EngineBufferScaleRubberBand::setScaleParameters(). The engine
+        // keeps the requested ratio, the difference is far below audibility.
+        double timeRatioInverse = 1.0 / timeRatio;
+        while (m_pRubberBand->getInputIncrement() == 0) {
+            timeRatioInverse += 0.001;
+            m_pRubberBand->setTimeRatio(1.0 / timeRatioInverse);
+        }
+    }
+}
+
+void RubberBandWorker::stretch(int numSamples, int generation) {
+    while (numSamples > 0) {
+        if (generation != load_atomic(m_requestedGeneration)) {
+            // Cleared while we were waiting for output space.
+            m_pInputFIFO->releaseReadRegions(numSamples);
+            return;
+        }
+        const int frames = math_min(numSamples / 2, kWorkerBlockFrames);
+        const int samplesRead = m_pInputFIFO->read(m_pInterleaved, frames * 2);
+        DEBUG_ASSERT_AND_HANDLE(samplesRead == frames * 2) {
+            return;
+        }
+        numSamples -= samplesRead;
+        for (int i = 0; i < frames; ++i) {
+            m_channels[0][i] = m_pInterleaved[i * 2];
+            m_channels[1][i] = m_pInterleaved[i * 2 + 1];
+        }
+        m_pRubberBand->process((const float* const*)m_channels, frames, false);
+        retrieveOutput(generation);
+    }
+}
+
+bool RubberBandWorker::retrieveOutput(int generation) {
+    int available = m_pRubberBand->available();
+    while (available > 0) {
+        const int frames = m_pRubberBand->retrieve(
+                (float* const*)m_channels, math_min(available, kWorkerBlockFrames));
+        if (frames <= 0) {
+            break;
+        }
+        for (int i = 0; i < frames; ++i) {
+            m_pInterleaved[i * 2] = m_channels[0][i];
+            m_pInterleaved[i * 2 + 1] = m_channels[1][i];
+        }
+        int samplesWritten = 0;
+        while (true) {
+            const int written = m_pOutputFIFO->write(
+                    m_pInterleaved + samplesWritten, frames * 2 - samplesWritten);
+            m_samplesWritten += written;
+            samplesWritten += written;
+            if (samplesWritten == frames * 2) {
+                break;
+            }
+            // The engine keeps the output FIFO far from full. If it happens
+            // anyway, dropping output would shift all later output against
+            // the input, so wait for the engine to catch up instead.
+            if (!waitForOutputSpace(generation)) {
+                return false;
+            }
+        }
+        available = m_pRubberBand->available();
+    }
+    return true;
+}
+
+bool RubberBandWorker::waitForOutputSpace(int generation) {
+    Counter counter("RubberBandWorker output full");
+    counter.increment();
+    while (m_pOutputFIFO->writeAvailable() == 0) {
+        if (load_atomic(m_stop) ||
+                generation != load_atomic(m_requestedGeneration)) {
+            // The output is stale, the engine discards it with the next
+            // reset anyway.
+            return false;
+        }
+        msleep(1);
+    }
+    return true;
+}
@@ -0,0 +1,109 @@
+#ifndef RUBBERBANDWORKER_H
+#define RUBBERBANDWORKER_H
+
+#include <QAtomicInt>
+
+#include "engine/engineworker.h"
+#include "util/compatibility.h"
+#include "util/fifo.h"
+#include "util/types.h"
+
+namespace RubberBand {
+class RubberBandStretcher;
+}  // namespace RubberBand
+
+// A request from EngineBufferScaleRubberBandThreaded to its worker. Messages
+// are processed in the order they were written.
+struct RubberBandWorkerMessage {
+    enum Type {
+        // Stretch numSamples interleaved stereo samples from the input FIFO
+        // with timeRatio and pitchScale.
+        PROCESS,
+        // Drop the internal state of the stretcher. Published with
+        // getResetGeneration() when done.
+        RESET,
+        // Recreate the stretcher for sampleRate.
+        SET_SAMPLE_RATE
+    };
+
+    Type type;
+    int generation;
+    int numSamples;
+    double timeRatio;
+    double pitchScale;
+    int sampleRate;
+};
+
+// Runs a RubberBandStretcher outside of the audio callback. The engine writes
+// the input into the input FIFO followed by a PROCESS message, the worker
+// writes the stretched audio into the output FIFO. Since the worker is not
+// bound to the callback deadline it uses larger blocks and the high quality
+// pitch shifter.
+class RubberBandWorker : public EngineWorker {
+    Q_OBJECT
+  public:
+    RubberBandWorker(FIFO<RubberBandWorkerMessage>* pMessageFIFO,
+                     FIFO<CSAMPLE>* pInputFIFO,
+                     FIFO<CSAMPLE>* pOutputFIFO);
+    virtual ~RubberBandWorker();
+
+    virtual void run();
+
+    // Stops the thread and waits for it to exit.
+    void quitWait();
+
+    // Called by the engine before it writes a RESET message for generation.
+    // PROCESS messages of older generations are skipped from then on.
+    void requestGeneration(int generation) {
+        m_requestedGeneration.fetchAndStoreRelease(generation);
+    }
+
+    // The generation of the last RESET message that has been processed.
+    int getResetGeneration() const {
+        return load_atomic(m_resetGeneration);
+    }
+
+    // The total number of samples written to the output FIFO before the last
+    // RESET. Wraps around.
+    int getSamplesWrittenAtReset() const {
+        return load_atomic(m_samplesWrittenAtReset);
+    }
+
+    // The latency of the stretcher in output frames.
+    int getLatencyFrames() const {
+        return load_atomic(m_latencyFrames);
+    }
+
+  private:
+    void processMessage(const RubberBandWorkerMessage& message);
+    void initializeRubberBand(int iSampleRate);
+    void setParameters(double timeRatio, double pitchScale);
+    void stretch(int numSamples, int generation);
+    // Returns false if the output was dropped because generation is stale.
+    bool retrieveOutput(int generation);
+    // Waits until the output FIFO has room. Returns false if generation has
+    // become stale or the worker is stopped in the meantime.
+    bool waitForOutputSpace(int generation);
+
+    FIFO<RubberBandWorkerMessage>* m_pMessageFIFO;
+    FIFO<CSAMPLE>* m_pInputFIFO;
+    FIFO<CSAMPLE>* m_pOutputFIFO;
+
+    RubberBand::RubberBandStretcher* m_pRubberBand;
+    double m_dTimeRatio;
+    double m_dPitchScale;
+
+    CSAMPLE* m_pInterleaved;
+    CSAMPLE* m_channels[2];
+
+    // Only touched by the worker thread.
+    unsigned int m_samplesWritten;
+
+    QAtomicInt m_requestedGeneration;
+    QAtomicInt m_resetGeneration;
+    QAtomicInt m_samplesWrittenAtReset;
+    QAtomicInt m_latencyFrames;
+    QAtomicInt m_stop;
+};
+
+#endif /* RUBBERBANDWORKER_H */
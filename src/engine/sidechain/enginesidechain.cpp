@@ -38,6 +38,7 @@
 EngineSideChain::EngineSideChain(ConfigObject<ConfigValue>* pConfig)
         : m_pConfig(pConfig),
           m_bStopThread(false),
+          m_bIdle(true),
           m_sampleFifo(SIDECHAIN_BUFFER_SIZE),
           m_pWorkBuffer(SampleUtil::alloc(SIDECHAIN_BUFFER_SIZE)) {
     // We use HighPriority to prevent starvation by lower-priority processes (Qt
@@ -53,6 +54,7 @@ EngineSideChain::~EngineSideChain() {
     m_waitLock.lock();
     m_bStopThread = true;
     m_waitForSamples.wakeAll();
+    m_waitForIdle.wakeAll();
     m_waitLock.unlock();
 
     // Wait until the thread has finished.
@@ -89,6 +91,16 @@ void EngineSideChain::writeSamples(const CSAMPLE* newBuffer, int buffer_size) {
     }
 }
 
+void EngineSideChain::waitUntilIdle() {
+    QMutexLocker locker(&m_waitLock);
+    // The thread holds m_waitLock from signaling m_waitForIdle until it
+    // sleeps on m_waitForSamples, so neither wake up can get lost.
+    while ((m_sampleFifo.readAvailable() > 0 || !m_bIdle) && !m_bStopThread) {
+        m_waitForSamples.wakeAll();
+        m_waitForIdle.wait(&m_waitLock);
+    }
+}
+
 void EngineSideChain::run() {
     // the id of this thread, for debugging purposes //XXX copypasta (should
     // factor this out somehow), -kousu 2/2009
@@ -99,9 +111,12 @@ void EngineSideChain::run() {
     while (!m_bStopThread) {
         // Sleep until samples are available.
         m_waitLock.lock();
+        m_bIdle = true;
+        m_waitForIdle.wakeAll();
 
         Event::end("EngineSideChain");
         m_waitForSamples.wait(&m_waitLock);
+        m_bIdle = false;
         m_waitLock.unlock();
         Event::start("EngineSideChain");
 
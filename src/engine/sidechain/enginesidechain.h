@@ -41,6 +41,12 @@ class EngineSideChain : public QThread {
     // Thread-safe, blocking.
     void addSideChainWorker(SideChainWorker* pWorker);
 
+    // Thread-safe, blocking. Wakes up the sidechain thread and waits until it
+    // has processed all samples written so far. Used by the OfflineRenderer,
+    // which produces samples faster than real-time and would overrun the FIFO
+    // otherwise. Must not be called from the engine callback.
+    void waitUntilIdle();
+
   private:
     void run();
 
@@ -55,6 +61,10 @@ class EngineSideChain : public QThread {
     QMutex m_waitLock;
     // Allows sleeping until we have samples to process.
     QWaitCondition m_waitForSamples;
+    // Signaled whenever the thread has emptied the FIFO.
+    QWaitCondition m_waitForIdle;
+    // True while the thread is sleeping. Guarded by m_waitLock.
+    bool m_bIdle;
 
     // Sidechain workers registered with EngineSideChain.
     QMutex m_workerLock;
@@ -28,6 +28,10 @@ static const bool sDebug = false;
 // Column 0 is skipped when calculating the the columns of the view table
 static const int kIdColumn = 0;
 static const int kMaxSortColumns = 3;
+// The number of runs of inserted and removed rows up to which select() updates
+// the rows in place, so that the view keeps its selection and scroll position.
+// More changes reset the model.
+static const int kMaxRowChanges = 64;
 
 BaseSqlTableModel::BaseSqlTableModel(QObject* pParent,
                                      TrackCollection* pTrackCollection,
@@ -39,9 +43,7 @@ BaseSqlTableModel::BaseSqlTableModel(QObject* pParent,
           m_database(pTrackCollection->getDatabase()),
           m_previewDeckGroup(PlayerManager::groupForPreviewDeck(0)),
           m_bInitialized(false),
-          m_currentSearch(""),
-          m_trackSourceSortColumn(kIdColumn),
-          m_trackSourceSortOrder(Qt::AscendingOrder) {
+          m_currentSearch("") {
     connect(&PlayerInfo::instance(), SIGNAL(trackLoaded(QString, TrackPointer)),
             this, SLOT(trackLoaded(QString, TrackPointer)));
     connect(&m_trackDAO, SIGNAL(forceModelUpdate()),
@@ -200,56 +202,106 @@ void BaseSqlTableModel::select() {
     QTime time;
     time.start();
 
-    // Prepare query for id and all columns not in m_trackSource
-    QString queryString = QString("SELECT %1 FROM %2 %3")
-            .arg(m_tableColumnsJoined, m_tableName, m_tableOrderBy);
+    // A pending selectAsync() is outdated now.
+    cancelSelect();
+
+    SelectJobPointer pJob(createSelectJob());
+    if (!SelectThread::runJob(m_database, pJob.data())) {
+        return;
+    }
+    finishSelect(*pJob, time.elapsed());
+}
 
+void BaseSqlTableModel::selectAsync() {
+    if (!m_bInitialized) {
+        return;
+    }
     if (sDebug) {
-        qDebug() << this << "select() executing:" << queryString;
+        qDebug() << this << "selectAsync()";
     }
 
-    QSqlQuery query(m_database);
-    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
-    // won't allocate a giant in-memory table that we won't use at all.
-    query.setForwardOnly(true);
-    query.prepare(queryString);
+    cancelSelect();
 
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
+    SelectJobPointer pJob(createSelectJob());
+    // The connection of the SelectThread has to create the temporary views
+    // of this model itself.
+    QStringList tableNames;
+    tableNames << m_tableName;
+    if (m_trackSource) {
+        tableNames << m_trackSource->tableName();
+    }
+    if (!SelectThread::copyTemporaryViews(m_database, tableNames, pJob.data())) {
+        select();
         return;
     }
 
-    // Remove all the rows from the table. We wait to do this until after the
-    // table query has succeeded. See Bug #1090888.
-    // TODO(rryan) we could edit the table in place instead of clearing it?
-    if (!m_rowInfo.isEmpty()) {
-        beginRemoveRows(QModelIndex(), 0, m_rowInfo.size() - 1);
-        m_rowInfo.clear();
-        m_trackIdToRows.clear();
-        endRemoveRows();
+    SelectThread* pSelectThread = m_pTrackCollection->getSelectThread();
+    connect(pSelectThread, SIGNAL(jobFinished(SelectJobPointer)),
+            this, SLOT(slotSelectFinished(SelectJobPointer)),
+            Qt::UniqueConnection);
+    m_pPendingSelect = pJob;
+    m_pendingSelectTime.start();
+    pSelectThread->queueJob(pJob);
+}
+
+void BaseSqlTableModel::slotSelectFinished(SelectJobPointer pJob) {
+    // All models share the thread, so most jobs are not ours.
+    if (pJob != m_pPendingSelect) {
+        return;
     }
-    // sqlite does not set size and m_rowInfo was just cleared
-    //if (sDebug) {
-    //    qDebug() << "Rows returned" << rows << m_rowInfo.size();
-    //}
+    m_pPendingSelect.clear();
+    if (!pJob->succeeded) {
+        qDebug() << this << "selectAsync() failed, selecting on the GUI thread";
+        select();
+        return;
+    }
+    finishSelect(*pJob, m_pendingSelectTime.elapsed());
+}
+
+void BaseSqlTableModel::cancelSelect() {
+    if (m_pPendingSelect) {
+        m_pTrackCollection->getSelectThread()->cancelJob(m_pPendingSelect);
+        m_pPendingSelect.clear();
+    }
+}
+
+SelectJobPointer BaseSqlTableModel::createSelectJob() const {
+    SelectJobPointer pJob(new SelectJob());
+    // Prepare query for id and all columns not in m_trackSource
+    pJob->tableStatement = QString("SELECT %1 FROM %2 %3")
+            .arg(m_tableColumnsJoined, m_tableName, m_tableOrderBy);
+    pJob->numColumns = m_tableColumns.size();
+    if (m_trackSource) {
+        pJob->filterTable = m_trackSource->tableName();
+        pJob->filterIdColumn = m_trackSource->idColumn();
+        pJob->queryResultsGeneration =
+                m_trackSource->queryResultsGeneration();
+        pJob->pQueryResult = m_trackSource->findQueryResult(
+                m_currentSearch, m_currentSearchFilter,
+                &pJob->queryResultExact);
+        pJob->filterCondition = m_trackSource->filterCondition(
+                m_currentSearch, m_currentSearchFilter);
+    }
+    return pJob;
+}
+
+void BaseSqlTableModel::finishSelect(const SelectJob& job, int elapsed) {
+    QTime time;
+    time.start();
 
     QVector<RowInfo> rowInfo;
+    rowInfo.reserve(job.rows.size());
     QSet<TrackId> trackIds;
-    while (query.next()) {
-        TrackId trackId(query.value(kIdColumn));
+    for (const auto& row: job.rows) {
+        TrackId trackId(row.at(kIdColumn));
         trackIds.insert(trackId);
 
         RowInfo thisRowInfo;
         thisRowInfo.trackId = trackId;
         // save rows where this currently track id is located
         thisRowInfo.order = rowInfo.size();
-        // Get all the table columns and store them in the hash for this
-        // row-info section.
-
-        thisRowInfo.metadata.reserve(m_tableColumns.size());
-        for (int i = 0;  i < m_tableColumns.size(); ++i) {
-            thisRowInfo.metadata << query.value(i);
-        }
+        // All the table columns of this row
+        thisRowInfo.metadata = row;
         rowInfo.push_back(thisRowInfo);
     }
 
@@ -258,12 +310,14 @@ void BaseSqlTableModel::select() {
     }
 
     if (m_trackSource) {
-        m_trackSource->filterAndSort(trackIds, m_currentSearch,
-                                     m_currentSearchFilter,
-                                     m_trackSourceOrderBy,
-                                     m_trackSourceSortColumn,
-                                     m_trackSourceSortOrder,
-                                     &m_trackSortOrder);
+        m_trackSource->addQueryResult(trackIds, m_currentSearch,
+                                      m_currentSearchFilter,
+                                      job.matchingTrackIds,
+                                      job.queryResultsGeneration);
+        m_trackSource->sortFiltered(trackIds, job.matchingTrackIds,
+                                    m_currentSearch, m_currentSearchFilter,
+                                    m_trackSourceSortColumns,
+                                    &m_trackSortOrder);
 
         // Re-sort the track IDs since filterAndSort can change their order or mark
         // them for removal (by setting their row to -1).
@@ -272,7 +326,7 @@ void BaseSqlTableModel::select() {
             // If the sort is not a track column then we will sort only to
             // separate removed tracks (order == -1) from present tracks (order ==
             // 0). Otherwise we sort by the order that filterAndSort returned to us.
-            if (m_trackSourceOrderBy.isEmpty()) {
+            if (m_trackSourceSortColumns.isEmpty()) {
                 it->order = m_trackSortOrder.contains(it->trackId) ? 0 : -1;
             } else {
                 it->order = m_trackSortOrder.value(it->trackId, -1);
@@ -286,29 +340,161 @@ void BaseSqlTableModel::select() {
     // should not disturb that if we are only removing tracks.
     qStableSort(rowInfo.begin(), rowInfo.end());
 
-    m_trackIdToRows.clear();
     for (int i = 0; i < rowInfo.size(); ++i) {
-        const RowInfo& row = rowInfo[i];
-
-        if (row.order == -1) {
+        if (rowInfo[i].order == -1) {
             // We've reached the end of valid rows. Resize rowInfo to cut off
             // this and all further elements.
             rowInfo.resize(i);
             break;
         }
-        QLinkedList<int>& rows = m_trackIdToRows[row.trackId];
-        rows.push_back(i);
     }
 
     // We're done! Issue the update signals and replace the master maps.
-    if (!rowInfo.isEmpty()) {
-        beginInsertRows(QModelIndex(), 0, rowInfo.size() - 1);
+    replaceRows(rowInfo);
+
+    qDebug() << this << "select() took" << elapsed + time.elapsed() << "ms,"
+             << time.elapsed() << "ms on the GUI thread," << rowInfo.size()
+             << "rows";
+}
+
+void BaseSqlTableModel::replaceRows(const QVector<RowInfo>& rowInfo) {
+    // A row is identified by its track and the number of rows of the same
+    // track before it, since a playlist can contain a track more than once.
+    QHash<TrackId, QVector<int> > newRowsByTrack;
+    newRowsByTrack.reserve(rowInfo.size());
+    for (int i = 0; i < rowInfo.size(); ++i) {
+        newRowsByTrack[rowInfo.at(i).trackId].append(i);
+    }
+    QHash<TrackId, int> occurrences;
+    // The new row of each old row, -1 if it is removed
+    QVector<int> newRows(m_rowInfo.size());
+    QVector<bool> isKept(rowInfo.size(), false);
+    int removals = 0;
+    for (int i = 0; i < m_rowInfo.size(); ++i) {
+        const TrackId trackId = m_rowInfo.at(i).trackId;
+        const int newRow = newRowsByTrack.value(trackId).value(
+                occurrences[trackId]++, -1);
+        newRows[i] = newRow;
+        if (newRow >= 0) {
+            isKept[newRow] = true;
+        }
+        if (newRow < 0 && (i == 0 || newRows.at(i - 1) >= 0)) {
+            ++removals;
+        }
+    }
+    int insertions = 0;
+    for (int i = 0; i < rowInfo.size(); ++i) {
+        if (!isKept.at(i) && (i == 0 || isKept.at(i - 1))) {
+            ++insertions;
+        }
+    }
+
+    if (removals + insertions > kMaxRowChanges) {
+        // The views handle each change at a cost linear to the number of rows,
+        // so replace all rows at once.
+        beginResetModel();
+        m_rowInfo = rowInfo;
+        endResetModel();
+    } else {
+        // Remove the rows that are gone, the last ones first.
+        for (int end = m_rowInfo.size(); end > 0; ) {
+            if (newRows.at(end - 1) >= 0) {
+                --end;
+                continue;
+            }
+            int begin = end - 1;
+            while (begin > 0 && newRows.at(begin - 1) < 0) {
+                --begin;
+            }
+            beginRemoveRows(QModelIndex(), begin, end - 1);
+            m_rowInfo.remove(begin, end - begin);
+            endRemoveRows();
+            newRows.remove(begin, end - begin);
+            end = begin;
+        }
+
+        // Reorder the remaining rows if their order changed, e.g. by sorting.
+        bool ordered = true;
+        for (int i = 1; i < newRows.size(); ++i) {
+            if (newRows.at(i - 1) > newRows.at(i)) {
+                ordered = false;
+                break;
+            }
+        }
+        if (!ordered) {
+            emit(layoutAboutToBeChanged());
+            // The remaining row that goes to each new row, -1 for new rows
+            QVector<int> oldRows(rowInfo.size(), -1);
+            for (int i = 0; i < newRows.size(); ++i) {
+                oldRows[newRows.at(i)] = i;
+            }
+            QVector<RowInfo> reordered;
+            reordered.reserve(m_rowInfo.size());
+            QVector<int> reorderedRows(m_rowInfo.size());
+            for (int newRow = 0; newRow < oldRows.size(); ++newRow) {
+                const int oldRow = oldRows.at(newRow);
+                if (oldRow >= 0) {
+                    reorderedRows[oldRow] = reordered.size();
+                    reordered.append(m_rowInfo.at(oldRow));
+                }
+            }
+            m_rowInfo = reordered;
+            const QModelIndexList oldIndices = persistentIndexList();
+            QModelIndexList newIndices;
+            for (const auto& oldIndex: oldIndices) {
+                newIndices.append(index(reorderedRows.at(oldIndex.row()),
+                                        oldIndex.column()));
+            }
+            changePersistentIndexList(oldIndices, newIndices);
+            emit(layoutChanged());
+        }
+
+        // Insert the new rows. The rows before each are in place already.
+        for (int begin = 0; begin < rowInfo.size(); ) {
+            if (isKept.at(begin)) {
+                ++begin;
+                continue;
+            }
+            int end = begin + 1;
+            while (end < rowInfo.size() && !isKept.at(end)) {
+                ++end;
+            }
+            beginInsertRows(QModelIndex(), begin, end - 1);
+            m_rowInfo.insert(begin, end - begin, RowInfo());
+            for (int i = begin; i < end; ++i) {
+                m_rowInfo[i] = rowInfo.at(i);
+            }
+            endInsertRows();
+            begin = end;
+        }
+
+        // The rows that stayed may have new values.
+        DEBUG_ASSERT(m_rowInfo.size() == rowInfo.size());
+        const int lastColumn = columnCount() - 1;
+        for (int begin = 0; begin < rowInfo.size(); ) {
+            if (m_rowInfo.at(begin).metadata == rowInfo.at(begin).metadata) {
+                ++begin;
+                continue;
+            }
+            int end = begin + 1;
+            while (end < rowInfo.size() &&
+                    m_rowInfo.at(end).metadata != rowInfo.at(end).metadata) {
+                ++end;
+            }
+            for (int i = begin; i < end; ++i) {
+                m_rowInfo[i] = rowInfo.at(i);
+            }
+            emit(dataChanged(index(begin, 0), index(end - 1, lastColumn)));
+            begin = end;
+        }
         m_rowInfo = rowInfo;
-        endInsertRows();
     }
 
-    int elapsed = time.elapsed();
-    qDebug() << this << "select() took" << elapsed << "ms" << rowInfo.size();
+    m_trackIdToRows.clear();
+    for (int i = 0; i < m_rowInfo.size(); ++i) {
+        QLinkedList<int>& rows = m_trackIdToRows[m_rowInfo.at(i).trackId];
+        rows.push_back(i);
+    }
 }
 
 void BaseSqlTableModel::setTable(const QString& tableName,
@@ -318,6 +504,16 @@ void BaseSqlTableModel::setTable(const QString& tableName,
     if (sDebug) {
         qDebug() << this << "setTable" << tableName << tableColumns << idColumn;
     }
+
+    // The rows of another table are not updated in place by select().
+    cancelSelect();
+    if (!m_rowInfo.isEmpty()) {
+        beginResetModel();
+        m_rowInfo.clear();
+        m_trackIdToRows.clear();
+        endResetModel();
+    }
+
     m_tableName = tableName;
     m_idColumn = idColumn;
     m_tableColumns = tableColumns;
@@ -375,7 +571,7 @@ void BaseSqlTableModel::search(const QString& searchText, const QString& extraFi
         qDebug() << this << "search" << searchText;
     }
     setSearch(searchText, extraFilter);
-    select();
+    selectAsync();
 }
 
 void BaseSqlTableModel::setSort(int column, Qt::SortOrder order) {
@@ -421,10 +617,8 @@ void BaseSqlTableModel::setSort(int column, Qt::SortOrder order) {
     // do not need the history anyway.
 
     // reset the old order by clauses
-    m_trackSourceOrderBy.clear();
+    m_trackSourceSortColumns.clear();
     m_tableOrderBy.clear();
-    m_trackSourceSortColumn = 0;
-    m_trackSourceSortOrder = Qt::AscendingOrder;
 
     if (column > 0 && column < m_tableColumns.size()) {
         // Table sorting, no history
@@ -442,34 +636,13 @@ void BaseSqlTableModel::setSort(int column, Qt::SortOrder order) {
         for (int i = 0; i < m_sortColumns.size(); ++i) {
             SortColumn sc = m_sortColumns.at(i);
             // TrackSource Sorting, current sort + two from history
-            if (i == 0) {
-                m_trackSourceOrderBy.append("ORDER BY ");
-            } else {
-                // second cycle
-                m_trackSourceOrderBy.append(", ");
-            }
-            QString sort_field;
-            if (sc.m_column == kIdColumn) {
-                sort_field = m_trackSource->columnSortForFieldIndex(kIdColumn);
-            } else {
+            int ccColumn = kIdColumn;
+            if (sc.m_column != kIdColumn) {
                 // + 1 to skip id column
-                int ccColumn = sc.m_column - m_tableColumns.size() + 1;
-                sort_field = m_trackSource->columnSortForFieldIndex(ccColumn);
-                if (i == 0) {
-                    // first cycle: main sort criteria
-                    m_trackSourceSortColumn = ccColumn;
-                    m_trackSourceSortOrder = sc.m_order;
-                }
+                ccColumn = sc.m_column - m_tableColumns.size() + 1;
             }
-
-            m_trackSourceOrderBy.append(sort_field);
-
-    #ifdef __SQLITE3__
-            m_trackSourceOrderBy.append(" COLLATE localeAwareCompare");
-    #endif
-            m_trackSourceOrderBy.append((sc.m_order == Qt::AscendingOrder) ?
-                    " ASC" : " DESC");
-            //qDebug() << m_trackSourceOrderBy;
+            m_trackSourceSortColumns.append(
+                    BaseTrackCache::SortColumn(ccColumn, sc.m_order));
         }
     }
 }
@@ -479,7 +652,7 @@ void BaseSqlTableModel::sort(int column, Qt::SortOrder order) {
         qDebug() << this << "sort()" << column << order;
     }
     setSort(column, order);
-    select();
+    selectAsync();
 }
 
 int BaseSqlTableModel::rowCount(const QModelIndex& parent) const {
@@ -3,6 +3,7 @@
 #define BASESQLTABLEMODEL_H
 
 #include <QHash>
+#include <QTime>
 #include <QtSql>
 
 #include "library/basetrackcache.h"
@@ -10,6 +11,7 @@
 #include "library/trackcollection.h"
 #include "library/trackmodel.h"
 #include "library/columncache.h"
+#include "library/selectthread.h"
 #include "util.h"
 
 // BaseSqlTableModel is a custom-written SQL-backed table which aggressively
@@ -73,7 +75,13 @@ class BaseSqlTableModel : public QAbstractTableModel, public TrackModel {
     virtual QMimeData* mimeData(const QModelIndexList &indexes) const;
 
   public slots:
+    // Selects the rows of the table and returns once the model has them.
     void select();
+    // Queries the rows on the SelectThread of the TrackCollection and updates
+    // the model once they are there. The rows that stay in the table keep
+    // their persistent indices, so the view keeps its selection. Superseded
+    // selects are canceled. search() and sort() select this way.
+    void selectAsync();
 
   protected:
     // Returns the row of trackId in this result set. If trackId is not present,
@@ -100,6 +108,7 @@ class BaseSqlTableModel : public QAbstractTableModel, public TrackModel {
     virtual void tracksChanged(QSet<TrackId> trackIds);
     virtual void trackLoaded(QString group, TrackPointer pTrack);
     void refreshCell(int row, int column);
+    void slotSelectFinished(SelectJobPointer pJob);
 
   private:
     // A simple helper function for initializing header title and width.  Note
@@ -114,6 +123,12 @@ class BaseSqlTableModel : public QAbstractTableModel, public TrackModel {
     QString orderByClause() const;
     QSqlDatabase database() const;
 
+    SelectJobPointer createSelectJob() const;
+    void cancelSelect();
+    // Sorts and filters the rows the job selected and updates the model.
+    // elapsed is the time the job took so far, in ms.
+    void finishSelect(const SelectJob& job, int elapsed);
+
     struct RowInfo {
         TrackId trackId;
         int order;
@@ -140,6 +155,10 @@ class BaseSqlTableModel : public QAbstractTableModel, public TrackModel {
         Qt::SortOrder m_order;
     };
 
+    // Updates m_rowInfo to rowInfo by removing, moving and inserting rows,
+    // or by resetting the model if that takes too many steps.
+    void replaceRows(const QVector<RowInfo>& rowInfo);
+
     QVector<RowInfo> m_rowInfo;
 
     QString m_tableName;
@@ -156,10 +175,14 @@ class BaseSqlTableModel : public QAbstractTableModel, public TrackModel {
     QString m_currentSearch;
     QString m_currentSearchFilter;
     QVector<QHash<int, QVariant> > m_headerInfo;
-    QString m_trackSourceOrderBy;
     QString m_tableOrderBy;
-    int m_trackSourceSortColumn;
-    Qt::SortOrder m_trackSourceSortOrder;
+    // The columns of m_trackSource to sort by, current sort + two from history
+    QVector<BaseTrackCache::SortColumn> m_trackSourceSortColumns;
+    // The selectAsync() that runs
+    SelectJobPointer m_pPendingSelect;
+    QTime m_pendingSelectTime;
+
+    friend class BaseSqlTableModelTest;
 
     DISALLOW_COPY_AND_ASSIGN(BaseSqlTableModel);
 };
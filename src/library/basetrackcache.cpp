@@ -13,6 +13,9 @@ namespace {
 
 const bool sDebug = false;
 
+// The number of query results kept for refined searches
+const int kMaxQueryResults = 8;
+
 }  // namespace
 
 BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
@@ -26,8 +29,11 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
           m_columnCount(columns.size()),
           m_columnsJoined(columns.join(",")),
           m_columnCache(columns),
+          m_queryResultsGeneration(0),
           m_bIndexBuilt(false),
           m_bIsCaching(isCaching),
+          m_bSearchIndexEnabled(false),
+          m_trackIndex(columns.size()),
           m_trackDAO(pTrackCollection->getTrackDAO()),
           m_database(pTrackCollection->getDatabase()),
           m_pQueryParser(new SearchQueryParser(pTrackCollection->getDatabase())) {
@@ -46,6 +52,19 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
     for (int i = 0; i < m_searchColumns.size(); ++i) {
         m_searchColumnIndices[i] = m_columnCache.fieldIndex(m_searchColumns[i]);
     }
+
+    // Sort like the ORDER BY clauses of the columns do.
+    for (int i = 0; i < m_columnCount; ++i) {
+        const QString sort = m_columnCache.m_columnSortByIndex.value(i);
+        if (sort == ColumnCache::kSortNoCase) {
+            m_trackIndex.setCollation(i, ColumnarTrackIndex::COLLATE_NOCASE);
+        } else if (sort == ColumnCache::kSortInt) {
+            m_trackIndex.setCollation(i, ColumnarTrackIndex::COLLATE_INTEGER);
+        }
+    }
+
+    connect(this, SIGNAL(tracksChanged(QSet<TrackId>)),
+            this, SLOT(slotInvalidateQueryResults()));
 }
 
 BaseTrackCache::~BaseTrackCache() {
@@ -95,10 +114,15 @@ void BaseTrackCache::slotTracksRemoved(QSet<TrackId> trackIds) {
         qDebug() << this << "slotTracksRemoved" << trackIds.size();
     }
     for (const auto& trackId : trackIds) {
-        m_trackInfo.remove(trackId);
+        m_trackIndex.removeTrack(trackId);
     }
 }
 
+void BaseTrackCache::slotInvalidateQueryResults() {
+    m_queryResults.clear();
+    ++m_queryResultsGeneration;
+}
+
 void BaseTrackCache::slotTrackDirty(TrackId trackId) {
     if (sDebug) {
         qDebug() << this << "slotTrackDirty" << trackId;
@@ -124,7 +148,7 @@ void BaseTrackCache::slotTrackClean(TrackId trackId) {
 }
 
 bool BaseTrackCache::isCached(TrackId trackId) const {
-    return m_trackInfo.contains(trackId);
+    return m_trackIndex.contains(trackId);
 }
 
 void BaseTrackCache::ensureCached(TrackId trackId) {
@@ -137,6 +161,14 @@ void BaseTrackCache::ensureCached(QSet<TrackId> trackIds) {
 
 void BaseTrackCache::setSearchColumns(const QStringList& columns) {
     m_searchColumns = columns;
+    slotInvalidateQueryResults();
+}
+
+void BaseTrackCache::setSearchIndexEnabled(bool enabled) {
+    m_bSearchIndexEnabled = enabled;
+    if (!enabled) {
+        m_pQueryParser->setSearchIndex(NULL, QString());
+    }
 }
 
 TrackPointer BaseTrackCache::lookupCachedTrack(TrackId trackId) const {
@@ -161,13 +193,14 @@ bool BaseTrackCache::updateIndexWithTrackpointer(TrackPointer pTrack) {
 
     TrackId trackId(pTrack->getId());
     if (trackId.isValid()) {
-        // m_trackInfo[id] will insert a QVector<QVariant> into the
-        // m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        // prealocate memory for all columns at once
-        record.resize(numColumns);
+        const int row = m_trackIndex.insertTrack(trackId);
         for (int i = 0; i < numColumns; ++i) {
-            getTrackValueForColumn(pTrack, i, record[i]);
+            // Columns the track does not know keep their value.
+            QVariant value;
+            getTrackValueForColumn(pTrack, i, value);
+            if (value.isValid()) {
+                m_trackIndex.setValue(row, i, value);
+            }
         }
     }
     return true;
@@ -197,14 +230,9 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
 
     while (query.next()) {
         TrackId trackId(query.value(idColumn));
-
-        //m_trackInfo[id] will insert a QVector<QVariant> into the
-        //m_trackInfo HashTable with the key "id"
-        QVector<QVariant>& record = m_trackInfo[trackId];
-        record.resize(numColumns);
-
+        const int row = m_trackIndex.insertTrack(trackId);
         for (int i = 0; i < numColumns; ++i) {
-            record[i] = query.value(i);
+            m_trackIndex.setValue(row, i, query.value(i));
         }
     }
 
@@ -227,7 +255,7 @@ void BaseTrackCache::buildIndex() {
     // TODO(rryan) for very large tables, it probably makes more sense to NOT
     // clear the table, and keep track of what IDs we see, then delete the ones
     // we don't see.
-    m_trackInfo.clear();
+    m_trackIndex.clear();
 
     if (!updateIndexWithQuery(queryString)) {
         qDebug() << "buildIndex failed!";
@@ -354,12 +382,7 @@ QVariant BaseTrackCache::data(TrackId trackId, int column) const {
     // metadata. Currently the upper-levels will not delegate row-specific
     // columns to this method, but there should still be a check here I think.
     if (!result.isValid()) {
-        QHash<TrackId, QVector<QVariant> >::const_iterator it =
-                m_trackInfo.find(trackId);
-        if (it != m_trackInfo.end()) {
-            const QVector<QVariant>& fields = it.value();
-            result = fields.value(column, result);
-        }
+        result = m_trackIndex.value(trackId, column);
     }
     return result;
 }
@@ -367,78 +390,102 @@ QVariant BaseTrackCache::data(TrackId trackId, int column) const {
 void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
                                    QString searchQuery,
                                    QString extraFilter,
-                                   QString orderByClause,
-                                   const int sortColumn,
-                                   Qt::SortOrder sortOrder,
+                                   const QVector<SortColumn>& sortColumns,
                                    QHash<TrackId, int>* trackToIndex) {
     // Skip processing if there are no tracks to filter or sort.
     if (trackIds.size() == 0) {
         return;
     }
 
-    if (!m_bIndexBuilt) {
-        buildIndex();
+    const int generation = m_queryResultsGeneration;
+    bool exact = false;
+    const QueryResultPointer pResult(
+            findQueryResult(searchQuery, extraFilter, &exact));
+    QVector<TrackId> matchingTrackIds;
+    if (filterTrackIds(m_database, m_tableName, m_idColumn,
+                       filterCondition(searchQuery, extraFilter),
+                       trackIds, pResult.data(), exact, &matchingTrackIds)) {
+        addQueryResult(trackIds, searchQuery, extraFilter, matchingTrackIds,
+                       generation);
     }
+    sortFiltered(trackIds, matchingTrackIds, searchQuery, extraFilter,
+                 sortColumns, trackToIndex);
+}
 
-    if (sortColumn < 0 || sortColumn >= columnCount()) {
-        qDebug() << "ERROR: Invalid sort column provided to BaseTrackCache::filterAndSort";
-        return;
-    }
+QString BaseTrackCache::filterCondition(QString searchQuery,
+                                        QString extraFilter) const {
+    std::unique_ptr<QueryNode> pQuery(parseQuery(searchQuery, extraFilter));
+    return pQuery->toSql();
+}
 
+// static
+QString BaseTrackCache::filterStatement(const QString& tableName,
+                                        const QString& idColumn,
+                                        const QString& condition,
+                                        const QSet<TrackId>& trackIds) {
     QStringList idStrings;
-    // TODO(rryan) consider making this the data passed in and a separate
-    // QVector for output
-    QSet<TrackId> dirtyTracks;
     for (const auto& trackId: trackIds) {
         idStrings << trackId.toString();
-        if (m_dirtyTracks.contains(trackId)) {
-            dirtyTracks.insert(trackId);
-        }
     }
-
-    std::unique_ptr<QueryNode> pQuery(parseQuery(
-        searchQuery, extraFilter, idStrings));
-
-    QString filter = pQuery->toSql();
-    if (!filter.isEmpty()) {
-        filter.prepend("WHERE ");
+    QString where = QString("%1 in (%2)").arg(idColumn, idStrings.join(","));
+    if (!condition.isEmpty()) {
+        where = QString("(%1) AND %2").arg(condition, where);
     }
+    return QString("SELECT %1 FROM %2 WHERE %3")
+            .arg(idColumn, tableName, where);
+}
 
-    QString queryString = QString("SELECT %1 FROM %2 %3 %4")
-            .arg(m_idColumn, m_tableName, filter, orderByClause);
+void BaseTrackCache::sortFiltered(const QSet<TrackId>& trackIds,
+                                  const QVector<TrackId>& matchingTrackIds,
+                                  QString searchQuery,
+                                  QString extraFilter,
+                                  const QVector<SortColumn>& sortColumns,
+                                  QHash<TrackId, int>* trackToIndex) {
+    if (trackIds.size() == 0) {
+        return;
+    }
 
-    if (sDebug) {
-        qDebug() << this << "select() executing:" << queryString;
+    if (!m_bIndexBuilt) {
+        buildIndex();
     }
 
-    QSqlQuery query(m_database);
-    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
-    // won't allocate a giant in-memory table that we won't use at all.
-    query.setForwardOnly(true);
-    query.prepare(queryString);
+    for (const auto& sortColumn: sortColumns) {
+        if (sortColumn.column < 0 || sortColumn.column >= columnCount()) {
+            qDebug() << "ERROR: Invalid sort column provided to BaseTrackCache::filterAndSort";
+            return;
+        }
+    }
+    // The dirty tracks are insertion sorted by the primary sort column.
+    const int sortColumn = sortColumns.isEmpty() ? 0 : sortColumns.first().column;
+    const Qt::SortOrder sortOrder = sortColumns.isEmpty() ?
+            Qt::AscendingOrder : sortColumns.first().order;
 
-    if (!query.exec()) {
-        LOG_FAILED_QUERY(query);
+    QSet<TrackId> dirtyTracks;
+    for (const auto& trackId: trackIds) {
+        if (m_dirtyTracks.contains(trackId)) {
+            dirtyTracks.insert(trackId);
+        }
     }
 
-    int idColumn = query.record().indexOf(m_idColumn);
-    int rows = query.size();
+    std::unique_ptr<QueryNode> pQuery(parseQuery(searchQuery, extraFilter));
 
-    if (sDebug) {
-        qDebug() << "Rows returned:" << rows;
+    // SQLite only filters, the index sorts the result by the ranks it keeps
+    // for each column. If the index lacks one of the tracks, SQLite sorts.
+    m_trackOrder = matchingTrackIds;
+    if (!m_trackIndex.sort(&m_trackOrder, sortColumns)) {
+        qDebug() << "WARNING: BaseTrackCache::filterAndSort falls back to"
+                 << "sorting in SQLite";
+        queryTrackIds(m_database,
+                      filterStatement(m_tableName, m_idColumn,
+                                      pQuery->toSql(), trackIds) +
+                      " " + orderByClause(sortColumns),
+                      &m_trackOrder);
     }
 
-    m_trackOrder.resize(0); // keeps alocated memory
     trackToIndex->clear();
-    if (rows > 0) {
-        trackToIndex->reserve(rows);
-        m_trackOrder.reserve(rows);
-    }
-
-    while (query.next()) {
-        TrackId trackId(query.value(idColumn));
-        (*trackToIndex)[trackId] = m_trackOrder.size();
-        m_trackOrder.push_back(trackId);
+    trackToIndex->reserve(m_trackOrder.size());
+    for (int i = 0; i < m_trackOrder.size(); ++i) {
+        (*trackToIndex)[m_trackOrder[i]] = i;
     }
 
     // At this point, the original set of tracks have been divided into two
@@ -515,20 +562,178 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
     }
 }
 
-std::unique_ptr<QueryNode> BaseTrackCache::parseQuery(QString query, QString extraFilter,
-                                      QStringList idStrings) const {
-    QStringList queryFragments;
-    if (!extraFilter.isNull() && extraFilter != "") {
-        queryFragments << QString("(%1)").arg(extraFilter);
+QString BaseTrackCache::orderByClause(
+        const QVector<SortColumn>& sortColumns) const {
+    QStringList terms;
+    for (const auto& sortColumn: sortColumns) {
+        QString term = columnSortForFieldIndex(sortColumn.column);
+#ifdef __SQLITE3__
+        term.append(" COLLATE localeAwareCompare");
+#endif
+        term.append((sortColumn.order == Qt::AscendingOrder) ? " ASC" : " DESC");
+        terms << term;
+    }
+    if (terms.isEmpty()) {
+        return QString();
+    }
+    return "ORDER BY " + terms.join(", ");
+}
+
+// static
+bool BaseTrackCache::queryTrackIds(QSqlDatabase database,
+                                   const QString& statement,
+                                   QVector<TrackId>* pTrackIds) {
+    if (sDebug) {
+        qDebug() << "BaseTrackCache select() executing:" << statement;
+    }
+
+    QSqlQuery query(database);
+    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+    // won't allocate a giant in-memory table that we won't use at all.
+    query.setForwardOnly(true);
+    query.prepare(statement);
+
+    pTrackIds->resize(0); // keeps alocated memory
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+
+    int rows = query.size();
+
+    if (sDebug) {
+        qDebug() << "Rows returned:" << rows;
+    }
+
+    if (rows > 0) {
+        pTrackIds->reserve(rows);
+    }
+    while (query.next()) {
+        pTrackIds->push_back(TrackId(query.value(0)));
+    }
+    return true;
+}
+
+BaseTrackCache::QueryResultPointer BaseTrackCache::findQueryResult(
+        QString query, QString extraFilter, bool* pExact) {
+    *pExact = false;
+    query = SearchQueryParser::normalizeQuery(query);
+    int found = -1;
+    for (int i = 0; i < m_queryResults.size(); ++i) {
+        const QueryResult& result = *m_queryResults.at(i);
+        if (result.extraFilter != extraFilter) {
+            continue;
+        }
+        if (result.query == query) {
+            found = i;
+            *pExact = true;
+            break;
+        }
+        // A result that matched all tracks it searched does not save
+        // anything.
+        if (result.matchingTrackIds.size() == result.searchedTrackIds.size() ||
+                !m_pQueryParser->isRefinement(result.query, query)) {
+            continue;
+        }
+        if (found < 0 || result.matchingTrackIds.size() <
+                m_queryResults.at(found)->matchingTrackIds.size()) {
+            found = i;
+        }
+    }
+    if (found < 0) {
+        return QueryResultPointer();
+    }
+    m_queryResults.move(found, 0);
+    return m_queryResults.first();
+}
+
+void BaseTrackCache::addQueryResult(const QSet<TrackId>& trackIds,
+                                    QString query, QString extraFilter,
+                                    const QVector<TrackId>& matchingTrackIds,
+                                    int generation) {
+    if (generation != m_queryResultsGeneration) {
+        // The tracks changed while the query ran.
+        return;
+    }
+    QSharedPointer<QueryResult> pResult(new QueryResult());
+    pResult->query = SearchQueryParser::normalizeQuery(query);
+    pResult->extraFilter = extraFilter;
+    pResult->searchedTrackIds = trackIds;
+    pResult->matchingTrackIds = matchingTrackIds;
+
+    QList<QueryResultPointer>::iterator it = m_queryResults.begin();
+    while (it != m_queryResults.end()) {
+        if ((*it)->query == pResult->query &&
+                (*it)->extraFilter == pResult->extraFilter) {
+            it = m_queryResults.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // The searches of a model usually search the same tracks, which can
+    // share their set then.
+    for (const auto& pOtherResult: m_queryResults) {
+        if (pOtherResult->searchedTrackIds == trackIds) {
+            pResult->searchedTrackIds = pOtherResult->searchedTrackIds;
+            break;
+        }
     }
 
-    if (idStrings.size() > 0) {
-        queryFragments << QString("%1 in (%2)")
-                .arg(m_idColumn, idStrings.join(","));
+    m_queryResults.prepend(pResult);
+    while (m_queryResults.size() > kMaxQueryResults) {
+        m_queryResults.removeLast();
+    }
+}
+
+// static
+bool BaseTrackCache::filterTrackIds(QSqlDatabase database,
+                                    const QString& tableName,
+                                    const QString& idColumn,
+                                    const QString& condition,
+                                    const QSet<TrackId>& trackIds,
+                                    const QueryResult* pResult, bool exact,
+                                    QVector<TrackId>* pMatchingTrackIds) {
+    if (!pResult || !pResult->searchedTrackIds.contains(trackIds)) {
+        return queryTrackIds(database,
+                             filterStatement(tableName, idColumn, condition,
+                                             trackIds),
+                             pMatchingTrackIds);
+    }
+
+    // The tracks the result did not match do not match a refined query
+    // either.
+    QSet<TrackId> candidates;
+    pMatchingTrackIds->resize(0);
+    for (const auto& trackId: pResult->matchingTrackIds) {
+        if (trackIds.contains(trackId)) {
+            if (exact) {
+                pMatchingTrackIds->append(trackId);
+            } else {
+                candidates.insert(trackId);
+            }
+        }
     }
+    if (candidates.isEmpty()) {
+        return true;
+    }
+    return queryTrackIds(database,
+                         filterStatement(tableName, idColumn, condition,
+                                         candidates),
+                         pMatchingTrackIds);
+}
 
-    return m_pQueryParser->parseQuery(query, m_searchColumns,
-                                      queryFragments.join(" AND "));
+std::unique_ptr<QueryNode> BaseTrackCache::parseQuery(QString query,
+                                                      QString extraFilter) const {
+    QString extraFragment;
+    if (!extraFilter.isNull() && extraFilter != "") {
+        extraFragment = QString("(%1)").arg(extraFilter);
+    }
+    if (m_bSearchIndexEnabled) {
+        // The index is loaded on the first search. If that fails, the
+        // searches compare every row instead.
+        m_pQueryParser->setSearchIndex(m_trackDAO.getSearchIndex(), m_idColumn);
+    }
+    return m_pQueryParser->parseQuery(query, m_searchColumns, extraFragment);
 }
 
 int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
@@ -553,7 +758,7 @@ int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
         TrackId otherTrackId(trackIds[mid]);
 
         // This should not happen, but it's a recoverable error so we should only log it.
-        if (!m_trackInfo.contains(otherTrackId)) {
+        if (!m_trackIndex.contains(otherTrackId)) {
             qDebug() << "WARNING: track" << otherTrackId << "was not in index";
             //updateTrackInIndex(otherTrackId);
         }
@@ -8,6 +8,7 @@
 #include <QObject>
 #include <QSet>
 #include <QHash>
+#include <QSharedPointer>
 #include <QString>
 #include <QStringList>
 #include <QSqlDatabase>
@@ -15,6 +16,7 @@
 
 #include "library/dao/trackdao.h"
 #include "library/columncache.h"
+#include "library/columnartrackindex.h"
 #include "trackinfoobject.h"
 #include "util.h"
 #include "util/memory.h"
@@ -29,9 +31,25 @@ class TrackCollection;
 // waste of memory because all the table-models were caching the same data
 // (track properties). Furthermore, the base SQL tables of these table-models
 // involve complicated joins, which are very slow.
+//
+// The values are kept in a ColumnarTrackIndex, which also sorts the results
+// of filterAndSort(), so SQLite only has to filter.
 class BaseTrackCache : public QObject {
     Q_OBJECT
   public:
+    typedef ColumnarTrackIndex::SortColumn SortColumn;
+
+    // The tracks among searchedTrackIds that match a search query and extra
+    // filter, as filterStatement() returned them.
+    struct QueryResult {
+        // Normalized by SearchQueryParser::normalizeQuery()
+        QString query;
+        QString extraFilter;
+        QSet<TrackId> searchedTrackIds;
+        QVector<TrackId> matchingTrackIds;
+    };
+    typedef QSharedPointer<const QueryResult> QueryResultPointer;
+
     BaseTrackCache(TrackCollection* pTrackCollection,
                    const QString& tableName,
                    const QString& idColumn,
@@ -53,20 +71,83 @@ class BaseTrackCache : public QObject {
     QString columnNameForFieldIndex(int index) const;
     QString columnSortForFieldIndex(int index) const;
     int fieldIndex(ColumnCache::Column column) const;
+    // Filters trackIds by the search query and the extra SQL filter and
+    // sorts them by sortColumns, the first column is the primary one. The
+    // position of each remaining track is stored in trackToIndex.
     virtual void filterAndSort(const QSet<TrackId>& trackIds,
                                QString query, QString extraFilter,
-                               QString orderByClause,
-                               const int sortColumn,
-                               Qt::SortOrder sortOrder,
+                               const QVector<SortColumn>& sortColumns,
                                QHash<TrackId, int>* trackToIndex);
+
+    // filterAndSort() in steps, for running its query on another thread
+    // and database connection: filterCondition() parses the search into the
+    // condition of filterStatement(), which selects the ids of the tracks
+    // among trackIds that match it. sortFiltered() sorts the ids that
+    // statement returned and has to be called on the thread of the cache.
+    QString filterCondition(QString query, QString extraFilter) const;
+    static QString filterStatement(const QString& tableName,
+                                   const QString& idColumn,
+                                   const QString& condition,
+                                   const QSet<TrackId>& trackIds);
+    void sortFiltered(const QSet<TrackId>& trackIds,
+                      const QVector<TrackId>& matchingTrackIds,
+                      QString query, QString extraFilter,
+                      const QVector<SortColumn>& sortColumns,
+                      QHash<TrackId, int>* trackToIndex);
+    // Runs a statement that selects track ids only, like filterStatement().
+    static bool queryTrackIds(QSqlDatabase database, const QString& statement,
+                              QVector<TrackId>* pTrackIds);
+
+    // The results of the last queries, so that a search that refines one of
+    // them, e.g. by typing another character, only filters the tracks it
+    // matched. findQueryResult() returns the result of the same query if
+    // there is one, which sets *pExact, or the smallest one query refines.
+    // addQueryResult() ignores results of queries that started before the
+    // results were last invalidated, i.e. with another generation. Any
+    // change of the tracks invalidates all of them.
+    QueryResultPointer findQueryResult(QString query, QString extraFilter,
+                                       bool* pExact);
+    void addQueryResult(const QSet<TrackId>& trackIds,
+                        QString query, QString extraFilter,
+                        const QVector<TrackId>& matchingTrackIds,
+                        int generation);
+    int queryResultsGeneration() const {
+        return m_queryResultsGeneration;
+    }
+    // Stores the ids of filterStatement() in pMatchingTrackIds. If pResult
+    // searched all of trackIds, only the tracks it matched are filtered by
+    // condition, or none if exact is set. Can be called from any thread.
+    static bool filterTrackIds(QSqlDatabase database,
+                               const QString& tableName,
+                               const QString& idColumn,
+                               const QString& condition,
+                               const QSet<TrackId>& trackIds,
+                               const QueryResult* pResult, bool exact,
+                               QVector<TrackId>* pMatchingTrackIds);
+
+    const QString& tableName() const {
+        return m_tableName;
+    }
+    const QString& idColumn() const {
+        return m_idColumn;
+    }
+
     virtual bool isCached(TrackId trackId) const;
     virtual void ensureCached(TrackId trackId);
     virtual void ensureCached(QSet<TrackId> trackIds);
     virtual void setSearchColumns(const QStringList& columns);
+    // Lets free-text searches use the SearchIndex of the TrackDAO, which
+    // only indexes the tracks of the library. The table has to select them
+    // by their library id in the id column.
+    void setSearchIndexEnabled(bool enabled);
 
   signals:
     void tracksChanged(QSet<TrackId> trackIds);
 
+  public slots:
+    // Drops the results of findQueryResult().
+    void slotInvalidateQueryResults();
+
   private slots:
     void slotTracksAdded(QSet<TrackId> trackId);
     void slotTracksRemoved(QSet<TrackId> trackId);
@@ -84,8 +165,9 @@ class BaseTrackCache : public QObject {
     void getTrackValueForColumn(TrackPointer pTrack, int column,
                                 QVariant& trackValue) const;
 
-    std::unique_ptr<QueryNode> parseQuery(QString query, QString extraFilter,
-                          QStringList idStrings) const;
+    std::unique_ptr<QueryNode> parseQuery(QString query,
+                                          QString extraFilter) const;
+    QString orderByClause(const QVector<SortColumn>& sortColumns) const;
     int findSortInsertionPoint(TrackPointer pTrack,
                                const int sortColumn,
                                const Qt::SortOrder sortOrder,
@@ -114,11 +196,16 @@ class BaseTrackCache : public QObject {
 
     QVector<TrackId> m_trackOrder;
 
+    // The most recently used first
+    QList<QueryResultPointer> m_queryResults;
+    int m_queryResultsGeneration;
+
     QSet<TrackId> m_dirtyTracks;
 
     bool m_bIndexBuilt;
     bool m_bIsCaching;
-    QHash<TrackId, QVector<QVariant> > m_trackInfo;
+    bool m_bSearchIndexEnabled;
+    ColumnarTrackIndex m_trackIndex;
     TrackDAO& m_trackDAO;
     QSqlDatabase m_database;
     SearchQueryParser* m_pQueryParser;
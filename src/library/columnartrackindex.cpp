@@ -0,0 +1,463 @@
+#include <algorithm>
+
+#include "library/columnartrackindex.h"
+
+#include "util/assert.h"
+
+namespace {
+
+// The value of a cell as ORDER BY compares it: NULL, a number or text
+struct SortKey {
+    enum Class {
+        CLASS_NULL,
+        CLASS_NUMBER,
+        CLASS_TEXT,
+    };
+
+    SortKey()
+            : keyClass(CLASS_NULL),
+              number(0.0) {
+    }
+
+    Class keyClass;
+    double number;
+    QString text;
+};
+
+// Like SQLite's cast(text as integer): The integer at the start of the text,
+// 0 if there is none.
+qint64 leadingInteger(const QString& text) {
+    int i = 0;
+    while (i < text.size() && text.at(i).isSpace()) {
+        ++i;
+    }
+    bool negative = false;
+    if (i < text.size() && (text.at(i) == '-' || text.at(i) == '+')) {
+        negative = text.at(i) == '-';
+        ++i;
+    }
+    qint64 result = 0;
+    while (i < text.size() && text.at(i) >= '0' && text.at(i) <= '9') {
+        result = result * 10 + (text.at(i).unicode() - '0');
+        ++i;
+    }
+    return negative ? -result : result;
+}
+
+bool isNumber(const QVariant& value) {
+    switch (value.type()) {
+    case QVariant::Bool:
+    case QVariant::Int:
+    case QVariant::UInt:
+    case QVariant::LongLong:
+    case QVariant::ULongLong:
+    case QVariant::Double:
+        return true;
+    default:
+        return static_cast<QMetaType::Type>(value.type()) == QMetaType::Float;
+    }
+}
+
+SortKey sortKeyOf(const QVariant& value, ColumnarTrackIndex::Collation collation) {
+    SortKey key;
+    if (value.isNull()) {
+        return key;
+    }
+    switch (collation) {
+    case ColumnarTrackIndex::COLLATE_NOCASE:
+        key.keyClass = SortKey::CLASS_TEXT;
+        key.text = value.toString().toLower();
+        break;
+    case ColumnarTrackIndex::COLLATE_INTEGER:
+        key.keyClass = SortKey::CLASS_NUMBER;
+        if (isNumber(value)) {
+            // Truncates towards zero like the cast
+            key.number = static_cast<double>(static_cast<qint64>(value.toDouble()));
+        } else {
+            key.number = static_cast<double>(leadingInteger(value.toString()));
+        }
+        break;
+    default:
+        if (isNumber(value)) {
+            key.keyClass = SortKey::CLASS_NUMBER;
+            key.number = value.toDouble();
+        } else {
+            key.keyClass = SortKey::CLASS_TEXT;
+            key.text = value.toString();
+        }
+        break;
+    }
+    return key;
+}
+
+int compareSortKeys(const SortKey& key1, const SortKey& key2) {
+    if (key1.keyClass != key2.keyClass) {
+        return key1.keyClass < key2.keyClass ? -1 : 1;
+    }
+    switch (key1.keyClass) {
+    case SortKey::CLASS_NUMBER:
+        if (key1.number == key2.number) {
+            return 0;
+        }
+        return key1.number < key2.number ? -1 : 1;
+    case SortKey::CLASS_TEXT:
+        return QString::localeAwareCompare(key1.text, key2.text);
+    default:
+        return 0;
+    }
+}
+
+// Orders the indices of keys by the keys
+class SortKeyLessThan {
+  public:
+    explicit SortKeyLessThan(const QVector<SortKey>& keys)
+            : m_keys(keys) {
+    }
+
+    bool operator()(int index1, int index2) const {
+        return compareSortKeys(m_keys.at(index1), m_keys.at(index2)) < 0;
+    }
+
+  private:
+    const QVector<SortKey>& m_keys;
+};
+
+// Orders the tracks by their ranks in the sort columns, and by their
+// position if all ranks are equal.
+class RankLessThan {
+  public:
+    RankLessThan(const QVector<int>& ranks, int numSortColumns)
+            : m_ranks(ranks),
+              m_numSortColumns(numSortColumns) {
+    }
+
+    bool operator()(int index1, int index2) const {
+        const int* pRanks1 = m_ranks.constData() + index1 * m_numSortColumns;
+        const int* pRanks2 = m_ranks.constData() + index2 * m_numSortColumns;
+        for (int i = 0; i < m_numSortColumns; ++i) {
+            if (pRanks1[i] != pRanks2[i]) {
+                return pRanks1[i] < pRanks2[i];
+            }
+        }
+        return index1 < index2;
+    }
+
+  private:
+    const QVector<int>& m_ranks;
+    const int m_numSortColumns;
+};
+
+} // anonymous namespace
+
+ColumnarTrackIndex::ColumnarTrackIndex(int numColumns)
+        : m_columns(numColumns) {
+}
+
+ColumnarTrackIndex::~ColumnarTrackIndex() {
+}
+
+void ColumnarTrackIndex::setCollation(int column, Collation collation) {
+    m_columns[column].collation = collation;
+    m_columns[column].ranksValid = false;
+}
+
+void ColumnarTrackIndex::clear() {
+    for (int i = 0; i < m_columns.size(); ++i) {
+        const Collation collation = m_columns[i].collation;
+        m_columns[i] = Column();
+        m_columns[i].collation = collation;
+    }
+    m_rowForTrack.clear();
+    m_trackForRow.clear();
+    m_freeRows.clear();
+}
+
+int ColumnarTrackIndex::insertTrack(TrackId trackId) {
+    QHash<TrackId, int>::const_iterator it = m_rowForTrack.constFind(trackId);
+    if (it != m_rowForTrack.constEnd()) {
+        return it.value();
+    }
+
+    int row;
+    if (m_freeRows.isEmpty()) {
+        row = m_trackForRow.size();
+        m_trackForRow.append(trackId);
+        for (int i = 0; i < m_columns.size(); ++i) {
+            resizeColumn(&m_columns[i], row + 1);
+        }
+    } else {
+        row = m_freeRows.last();
+        m_freeRows.removeLast();
+        m_trackForRow[row] = trackId;
+    }
+    for (int i = 0; i < m_columns.size(); ++i) {
+        m_columns[i].nulls.setBit(row);
+        m_columns[i].ranksValid = false;
+    }
+    m_rowForTrack.insert(trackId, row);
+    return row;
+}
+
+void ColumnarTrackIndex::removeTrack(TrackId trackId) {
+    QHash<TrackId, int>::iterator it = m_rowForTrack.find(trackId);
+    if (it == m_rowForTrack.end()) {
+        return;
+    }
+    // The ranks of the other rows stay valid.
+    m_trackForRow[it.value()] = TrackId();
+    m_freeRows.append(it.value());
+    m_rowForTrack.erase(it);
+}
+
+// static
+ColumnarTrackIndex::Type ColumnarTrackIndex::typeOf(const QVariant& value) {
+    if (value.isNull()) {
+        return TYPE_NONE;
+    }
+    switch (value.type()) {
+    case QVariant::Bool:
+    case QVariant::Int:
+    case QVariant::UInt:
+    case QVariant::LongLong:
+    case QVariant::ULongLong:
+        return TYPE_INTEGER;
+    case QVariant::Double:
+        return TYPE_REAL;
+    case QVariant::String:
+        return TYPE_STRING;
+    default:
+        return TYPE_VARIANT;
+    }
+}
+
+void ColumnarTrackIndex::setValue(int row, int column, const QVariant& value) {
+    DEBUG_ASSERT(row >= 0 && row < m_trackForRow.size());
+    Column& col = m_columns[column];
+    col.ranksValid = false;
+
+    Type type = typeOf(value);
+    if (type == TYPE_NONE) {
+        col.nulls.setBit(row);
+        return;
+    }
+    col.nulls.clearBit(row);
+
+    if (col.type == TYPE_NONE) {
+        col.type = type;
+        col.variantType = value.type();
+        resizeColumn(&col, m_trackForRow.size());
+    } else if (col.type != type && col.type != TYPE_VARIANT) {
+        if (col.type == TYPE_INTEGER && type == TYPE_REAL) {
+            convertColumn(&col, TYPE_REAL);
+        } else if (col.type == TYPE_REAL && type == TYPE_INTEGER) {
+            // Stored as a real, which has the same value.
+        } else {
+            convertColumn(&col, TYPE_VARIANT);
+        }
+    }
+
+    switch (col.type) {
+    case TYPE_INTEGER:
+        if (value.type() != col.variantType) {
+            col.variantType = QVariant::LongLong;
+        }
+        col.integers[row] = value.toLongLong();
+        break;
+    case TYPE_REAL:
+        col.reals[row] = value.toDouble();
+        break;
+    case TYPE_STRING: {
+        const QString string = value.toString();
+        QHash<QString, int>::const_iterator it =
+                col.stringIndexByValue.constFind(string);
+        if (it == col.stringIndexByValue.constEnd()) {
+            it = col.stringIndexByValue.insert(string, col.strings.size());
+            col.strings.append(string);
+        }
+        col.stringIndices[row] = it.value();
+        break;
+    }
+    default:
+        col.variants[row] = value;
+        break;
+    }
+}
+
+QVariant ColumnarTrackIndex::value(TrackId trackId, int column) const {
+    QHash<TrackId, int>::const_iterator it = m_rowForTrack.constFind(trackId);
+    if (it == m_rowForTrack.constEnd() ||
+            column < 0 || column >= m_columns.size()) {
+        return QVariant();
+    }
+    return valueAt(m_columns.at(column), it.value());
+}
+
+QVariant ColumnarTrackIndex::valueAt(const Column& column, int row) const {
+    if (column.nulls.testBit(row)) {
+        // What the SQLite driver returns for NULL
+        return QVariant(QVariant::String);
+    }
+    switch (column.type) {
+    case TYPE_INTEGER: {
+        QVariant result(column.integers.at(row));
+        if (column.variantType != QVariant::LongLong) {
+            result.convert(column.variantType);
+        }
+        return result;
+    }
+    case TYPE_REAL:
+        return QVariant(column.reals.at(row));
+    case TYPE_STRING:
+        return QVariant(column.strings.at(column.stringIndices.at(row)));
+    case TYPE_VARIANT:
+        return column.variants.at(row);
+    default:
+        return QVariant(QVariant::String);
+    }
+}
+
+void ColumnarTrackIndex::resizeColumn(Column* pColumn, int rows) const {
+    pColumn->nulls.resize(rows);
+    switch (pColumn->type) {
+    case TYPE_INTEGER:
+        pColumn->integers.resize(rows);
+        break;
+    case TYPE_REAL:
+        pColumn->reals.resize(rows);
+        break;
+    case TYPE_STRING:
+        pColumn->stringIndices.resize(rows);
+        break;
+    case TYPE_VARIANT:
+        pColumn->variants.resize(rows);
+        break;
+    default:
+        break;
+    }
+}
+
+void ColumnarTrackIndex::convertColumn(Column* pColumn, Type type) const {
+    const int rows = m_trackForRow.size();
+    if (type == TYPE_REAL) {
+        DEBUG_ASSERT(pColumn->type == TYPE_INTEGER);
+        pColumn->reals.resize(rows);
+        for (int row = 0; row < rows; ++row) {
+            pColumn->reals[row] = static_cast<double>(pColumn->integers.at(row));
+        }
+        pColumn->integers.clear();
+    } else {
+        DEBUG_ASSERT(type == TYPE_VARIANT);
+        QVector<QVariant> variants(rows);
+        for (int row = 0; row < rows; ++row) {
+            if (!pColumn->nulls.testBit(row)) {
+                variants[row] = valueAt(*pColumn, row);
+            }
+        }
+        pColumn->variants = variants;
+        pColumn->integers.clear();
+        pColumn->reals.clear();
+        pColumn->stringIndices.clear();
+        pColumn->strings.clear();
+        pColumn->stringIndexByValue.clear();
+    }
+    pColumn->type = type;
+}
+
+void ColumnarTrackIndex::updateRanks(const Column& column) const {
+    const int rows = m_trackForRow.size();
+    // Dictionary encoded columns sort their distinct strings, all other
+    // columns their rows.
+    const bool dictionary = column.type == TYPE_STRING;
+    QVector<SortKey> keys;
+    QVector<int> order;
+    if (dictionary) {
+        keys.resize(column.strings.size());
+        for (int i = 0; i < keys.size(); ++i) {
+            keys[i] = sortKeyOf(QVariant(column.strings.at(i)), column.collation);
+        }
+        order.reserve(keys.size());
+        for (int i = 0; i < keys.size(); ++i) {
+            order.append(i);
+        }
+    } else {
+        keys.resize(rows);
+        order.reserve(rows);
+        for (int row = 0; row < rows; ++row) {
+            if (!m_trackForRow.at(row).isValid() || column.nulls.testBit(row)) {
+                continue;
+            }
+            keys[row] = sortKeyOf(valueAt(column, row), column.collation);
+            order.append(row);
+        }
+    }
+    std::sort(order.begin(), order.end(), SortKeyLessThan(keys));
+
+    // Equal values get the same rank. NULL has rank 0.
+    QVector<int> ranks(keys.size());
+    int rank = 0;
+    for (int i = 0; i < order.size(); ++i) {
+        if (i == 0 || compareSortKeys(keys.at(order.at(i - 1)),
+                                      keys.at(order.at(i))) != 0) {
+            ++rank;
+        }
+        ranks[order.at(i)] = rank;
+    }
+
+    column.ranks.resize(rows);
+    for (int row = 0; row < rows; ++row) {
+        if (column.nulls.testBit(row)) {
+            column.ranks[row] = 0;
+        } else if (dictionary) {
+            column.ranks[row] = ranks.at(column.stringIndices.at(row));
+        } else {
+            column.ranks[row] = ranks.at(row);
+        }
+    }
+    column.ranksValid = true;
+}
+
+bool ColumnarTrackIndex::sort(QVector<TrackId>* pTrackIds,
+                              const QVector<SortColumn>& sortColumns) const {
+    const int numTracks = pTrackIds->size();
+    const int numSortColumns = sortColumns.size();
+    if (numSortColumns == 0) {
+        return true;
+    }
+
+    QVector<int> rows(numTracks);
+    for (int i = 0; i < numTracks; ++i) {
+        QHash<TrackId, int>::const_iterator it =
+                m_rowForTrack.constFind(pTrackIds->at(i));
+        if (it == m_rowForTrack.constEnd()) {
+            return false;
+        }
+        rows[i] = it.value();
+    }
+
+    // The ranks of each track, negated for descending columns
+    QVector<int> trackRanks(numTracks * numSortColumns);
+    for (int j = 0; j < numSortColumns; ++j) {
+        const Column& column = m_columns.at(sortColumns.at(j).column);
+        if (!column.ranksValid) {
+            updateRanks(column);
+        }
+        const int sign = sortColumns.at(j).order == Qt::AscendingOrder ? 1 : -1;
+        for (int i = 0; i < numTracks; ++i) {
+            trackRanks[i * numSortColumns + j] = sign * column.ranks.at(rows.at(i));
+        }
+    }
+
+    QVector<int> order(numTracks);
+    for (int i = 0; i < numTracks; ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              RankLessThan(trackRanks, numSortColumns));
+
+    QVector<TrackId> sorted(numTracks);
+    for (int i = 0; i < numTracks; ++i) {
+        sorted[i] = pTrackIds->at(order.at(i));
+    }
+    *pTrackIds = sorted;
+    return true;
+}
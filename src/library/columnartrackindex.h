@@ -0,0 +1,139 @@
+#ifndef COLUMNARTRACKINDEX_H
+#define COLUMNARTRACKINDEX_H
+
+#include <QBitArray>
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+#include "track/trackid.h"
+
+// The values of all tracks of a table, stored column by column for
+// BaseTrackCache. Each column keeps its values in a typed array: Integers and
+// reals unboxed, strings dictionary encoded as an index into the distinct
+// strings of the column. Columns that mix strings with other values fall back
+// to an array of QVariants.
+//
+// For sorting, every column can compute the rank of each track, i.e. its
+// position among the distinct values of the column. The ranks are kept until
+// the column changes, so sorting a set of tracks compares integers only. For
+// dictionary encoded columns only the distinct strings are sorted, e.g. a few
+// thousand artists instead of every track.
+class ColumnarTrackIndex {
+  public:
+    // How the values of a column are compared when sorting. They mirror the
+    // ORDER BY expressions of ColumnCache::columnSortForFieldIndex() with the
+    // localeAwareCompare collation, so sorting in memory gives the order
+    // SQLite would give: NULL sorts before numbers, numbers before text.
+    enum Collation {
+        // The values as they are
+        COLLATE_DEFAULT,
+        // lower(value), compares all values as lowercase text
+        COLLATE_NOCASE,
+        // cast(value as integer), the leading integer of text
+        COLLATE_INTEGER,
+    };
+
+    struct SortColumn {
+        SortColumn()
+                : column(0),
+                  order(Qt::AscendingOrder) {
+        }
+        SortColumn(int column, Qt::SortOrder order)
+                : column(column),
+                  order(order) {
+        }
+        int column;
+        Qt::SortOrder order;
+    };
+
+    explicit ColumnarTrackIndex(int numColumns);
+    virtual ~ColumnarTrackIndex();
+
+    int columnCount() const {
+        return m_columns.size();
+    }
+
+    void setCollation(int column, Collation collation);
+
+    // Removes all tracks and forgets the types of the columns, but keeps their
+    // collations.
+    void clear();
+
+    int size() const {
+        return m_rowForTrack.size();
+    }
+
+    bool contains(TrackId trackId) const {
+        return m_rowForTrack.contains(trackId);
+    }
+
+    // Returns the row of the track, which is added with NULL values if it is
+    // not in the index yet. Rows of removed tracks are reused.
+    int insertTrack(TrackId trackId);
+    void removeTrack(TrackId trackId);
+
+    void setValue(int row, int column, const QVariant& value);
+
+    // Returns an invalid QVariant if the track is not in the index.
+    QVariant value(TrackId trackId, int column) const;
+
+    // Sorts the tracks by the sort columns, the first column is the primary
+    // one. Tracks that compare equal keep their order. Returns false and
+    // leaves pTrackIds unchanged if one of the tracks is not in the index.
+    bool sort(QVector<TrackId>* pTrackIds,
+              const QVector<SortColumn>& sortColumns) const;
+
+  private:
+    enum Type {
+        // No value was stored yet
+        TYPE_NONE,
+        TYPE_INTEGER,
+        TYPE_REAL,
+        TYPE_STRING,
+        TYPE_VARIANT,
+    };
+
+    struct Column {
+        Column()
+                : type(TYPE_NONE),
+                  variantType(QVariant::Invalid),
+                  collation(COLLATE_DEFAULT),
+                  ranksValid(false) {
+        }
+
+        Type type;
+        // The type integers and reals are returned as
+        QVariant::Type variantType;
+        Collation collation;
+        // Set for NULL values, whatever the type
+        QBitArray nulls;
+        QVector<qint64> integers;
+        QVector<double> reals;
+        // The index of the value in strings
+        QVector<int> stringIndices;
+        QVector<QString> strings;
+        QHash<QString, int> stringIndexByValue;
+        QVector<QVariant> variants;
+
+        // The rank of each row when sorting by this column in ascending
+        // order, 0 for NULL
+        mutable QVector<int> ranks;
+        mutable bool ranksValid;
+    };
+
+    static Type typeOf(const QVariant& value);
+    QVariant valueAt(const Column& column, int row) const;
+    void resizeColumn(Column* pColumn, int rows) const;
+    void convertColumn(Column* pColumn, Type type) const;
+    void updateRanks(const Column& column) const;
+
+    QVector<Column> m_columns;
+    QHash<TrackId, int> m_rowForTrack;
+    // The track of each row, invalid for rows of removed tracks
+    QVector<TrackId> m_trackForRow;
+    QVector<int> m_freeRows;
+};
+
+#endif // COLUMNARTRACKINDEX_H
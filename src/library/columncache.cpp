@@ -4,6 +4,11 @@
 #include "library/dao/playlistdao.h"
 #include "library/dao/cratedao.h"
 
+// static
+const char* ColumnCache::kSortNoCase = "lower(%1)";
+// static
+const char* ColumnCache::kSortInt = "cast(%1 as integer)";
+
 void ColumnCache::setColumns(const QStringList& columns) {
     m_columnsByIndex.clear();
     m_columnsByIndex.append(columns);
@@ -69,8 +74,8 @@ void ColumnCache::setColumns(const QStringList& columns) {
     m_columnIndexByEnum[COLUMN_CRATETRACKSTABLE_TRACKID] = fieldIndex(CRATETRACKSTABLE_TRACKID);
     m_columnIndexByEnum[COLUMN_CRATETRACKSTABLE_CRATEID] = fieldIndex(CRATETRACKSTABLE_CRATEID);
 
-    const QString sortInt("cast(%1 as integer)");
-    const QString sortNoCase("lower(%1)");
+    const QString sortInt(kSortInt);
+    const QString sortNoCase(kSortNoCase);
     m_columnSortByIndex.clear();
     // Add the columns that requires a special sort
     m_columnSortByIndex.insert(m_columnIndexByEnum[COLUMN_LIBRARYTABLE_ARTIST], sortNoCase);
@@ -66,6 +66,11 @@ class ColumnCache {
         NUM_COLUMNS
     };
 
+    // The special sort expressions of columnSortForFieldIndex(), in which %1
+    // is replaced by the column name
+    static const char* kSortNoCase;
+    static const char* kSortInt;
+
     ColumnCache() { }
     ColumnCache(const QStringList& columns) {
         setColumns(columns);
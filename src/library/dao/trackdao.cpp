@@ -64,6 +64,36 @@ TrackCacheItem::~TrackCacheItem() {
 // expensive.
 const int kRecentTracksCacheSize = 5;
 
+namespace {
+
+// The columns of the SearchIndex, the text columns a search can filter
+const QStringList kSearchIndexColumns = QStringList()
+        << LIBRARYTABLE_ARTIST
+        << LIBRARYTABLE_ALBUMARTIST
+        << LIBRARYTABLE_ALBUM
+        << LIBRARYTABLE_TITLE
+        << LIBRARYTABLE_GENRE
+        << LIBRARYTABLE_COMPOSER
+        << LIBRARYTABLE_GROUPING
+        << LIBRARYTABLE_COMMENT
+        << LIBRARYTABLE_LOCATION;
+
+// The values of a track in kSearchIndexColumns
+QStringList searchIndexValues(const TrackInfoObject& track) {
+    return QStringList()
+            << track.getArtist()
+            << track.getAlbumArtist()
+            << track.getAlbum()
+            << track.getTitle()
+            << track.getGenre()
+            << track.getComposer()
+            << track.getGrouping()
+            << track.getComment()
+            << track.getLocation();
+}
+
+} // anonymous namespace
+
 TrackDAO::TrackDAO(QSqlDatabase& database,
                    CueDAO& cueDao,
                    PlaylistDAO& playlistDao,
@@ -87,7 +117,9 @@ TrackDAO::TrackDAO(QSqlDatabase& database,
           m_pTransaction(NULL),
           m_trackLocationIdColumn(UndefinedRecordIndex),
           m_queryLibraryIdColumn(UndefinedRecordIndex),
-          m_queryLibraryMixxxDeletedColumn(UndefinedRecordIndex) {
+          m_queryLibraryMixxxDeletedColumn(UndefinedRecordIndex),
+          m_searchIndex(kSearchIndexColumns),
+          m_bSearchIndexLoaded(false) {
 }
 
 TrackDAO::~TrackDAO() {
@@ -332,10 +364,23 @@ void TrackDAO::slotTrackClean(TrackInfoObject* pTrack) {
 }
 
 void TrackDAO::databaseTrackAdded(TrackPointer pTrack) {
+    updateSearchIndex(*pTrack);
     emit(dbTrackAdded(pTrack));
 }
 
 void TrackDAO::databaseTracksMoved(QSet<TrackId> tracksMovedSetOld, QSet<TrackId> tracksMovedSetNew) {
+    if (m_bSearchIndexLoaded) {
+        // The old tracks took over the locations of the new ones, which are
+        // deleted.
+        for (const auto& trackId: tracksMovedSetNew) {
+            m_searchIndex.removeTrack(trackId);
+        }
+        if (!tracksMovedSetOld.isEmpty() &&
+                !loadSearchIndex(tracksMovedSetOld)) {
+            // Load it from scratch on the next search.
+            m_bSearchIndexLoaded = false;
+        }
+    }
     emit(tracksRemoved(tracksMovedSetNew));
     // results in a call of BaseTrackCache::updateTracksInIndex(trackIds);
     emit(tracksAdded(tracksMovedSetOld));
@@ -512,13 +557,35 @@ void TrackDAO::addTracksPrepare() {
             "WHERE location = :location");
 }
 
+bool TrackDAO::addTracksCommit() {
+    DEBUG_ASSERT_AND_HANDLE(m_pTransaction) {
+        return false;
+    }
+    const bool committed = m_pTransaction->commit();
+    if (committed) {
+        m_tracksCommittedSet.unite(m_tracksAddedSet);
+    } else {
+        // SQLite keeps the transaction open if the COMMIT fails, e.g. while
+        // another connection reads. Discard the tracks, their ids are not
+        // valid.
+        m_database.rollback();
+    }
+    m_tracksAddedSet.clear();
+    // Otherwise the next tracks would be added in autocommit mode.
+    if (!m_pTransaction->transaction()) {
+        qWarning() << "TrackDAO::addTracksCommit: could not start a new"
+                   << "transaction";
+    }
+    return committed;
+}
+
 void TrackDAO::addTracksFinish(bool rollback) {
     if (m_pTransaction) {
         if (rollback) {
             m_pTransaction->rollback();
-            m_tracksAddedSet.clear();
         } else {
             m_pTransaction->commit();
+            m_tracksCommittedSet.unite(m_tracksAddedSet);
         }
     }
     delete m_pQueryTrackLocationInsert;
@@ -532,8 +599,9 @@ void TrackDAO::addTracksFinish(bool rollback) {
     m_pQueryLibrarySelect = NULL;
     m_pTransaction = NULL;
 
-    emit(tracksAdded(m_tracksAddedSet));
     m_tracksAddedSet.clear();
+    emit(tracksAdded(m_tracksCommittedSet));
+    m_tracksCommittedSet.clear();
 }
 
 bool TrackDAO::addTracksAdd(TrackInfoObject* pTrack, bool unremove) {
@@ -638,6 +706,7 @@ bool TrackDAO::addTracksAdd(TrackInfoObject* pTrack, bool unremove) {
         m_analysisDao.saveTrackAnalyses(pTrack);
         m_cueDao.saveTrackCues(trackId, pTrack);
         pTrack->setDirty(false);
+        updateSearchIndex(*pTrack);
     }
     m_tracksAddedSet.insert(trackId);
     return true;
@@ -928,6 +997,10 @@ void TrackDAO::purgeTracks(const QList<TrackId>& trackIds) {
     m_crateDao.removeTracksFromCrates(trackIds);
     m_analysisDao.deleteAnalyses(trackIds);
 
+    for (const auto& trackId: trackIds) {
+        m_searchIndex.removeTrack(trackId);
+    }
+
     QSet<TrackId> tracksRemovedSet = QSet<TrackId>::fromList(trackIds);
     emit(tracksRemoved(tracksRemovedSet));
     // notify trackmodels that they should update their cache as well.
@@ -1527,6 +1600,7 @@ void TrackDAO::updateTrack(TrackInfoObject* pTrack) {
     m_analysisDao.saveTrackAnalyses(pTrack);
     m_cueDao.saveTrackCues(trackId, pTrack);
     transaction.commit();
+    updateSearchIndex(*pTrack);
 
     //qDebug() << "Update track in database took: " << time.elapsed() << "ms";
     //time.start();
@@ -2028,3 +2102,62 @@ TrackPointer TrackDAO::getOrAddTrack(const QString& trackLocation,
 
     return pTrack;
 }
+
+const SearchIndex* TrackDAO::getSearchIndex() {
+    if (!m_bSearchIndexLoaded) {
+        m_bSearchIndexLoaded = loadSearchIndex(QSet<TrackId>());
+        if (!m_bSearchIndexLoaded) {
+            m_searchIndex.clear();
+            return NULL;
+        }
+    }
+    return &m_searchIndex;
+}
+
+void TrackDAO::updateSearchIndex(const TrackInfoObject& track) {
+    // Until the index is loaded, there is nothing to keep up to date. This
+    // is the case for the instance of the library scanner.
+    if (m_bSearchIndexLoaded && track.getId().isValid()) {
+        m_searchIndex.setTrack(track.getId(), searchIndexValues(track));
+    }
+}
+
+bool TrackDAO::loadSearchIndex(const QSet<TrackId>& trackIds) {
+    ScopedTimer t("TrackDAO::loadSearchIndex");
+    QStringList columns;
+    for (const auto& column: kSearchIndexColumns) {
+        if (column == LIBRARYTABLE_LOCATION) {
+            columns << "track_locations." + TRACKLOCATIONSTABLE_LOCATION;
+        } else {
+            columns << "library." + column;
+        }
+    }
+    QString statement = QString(
+            "SELECT library.id,%1 FROM library INNER JOIN track_locations "
+            "ON library.location = track_locations.id").arg(columns.join(","));
+    if (trackIds.isEmpty()) {
+        m_searchIndex.clear();
+    } else {
+        QStringList idList;
+        for (const auto& trackId: trackIds) {
+            idList << trackId.toString();
+        }
+        statement += QString(" WHERE library.id in (%1)").arg(idList.join(","));
+    }
+
+    QSqlQuery query(m_database);
+    query.setForwardOnly(true);
+    if (!query.exec(statement)) {
+        LOG_FAILED_QUERY(query);
+        return false;
+    }
+    QStringList values;
+    while (query.next()) {
+        values.clear();
+        for (int i = 0; i < kSearchIndexColumns.size(); ++i) {
+            values << query.value(i + 1).toString();
+        }
+        m_searchIndex.setTrack(TrackId(query.value(0)), values);
+    }
+    return true;
+}
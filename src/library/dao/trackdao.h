@@ -14,6 +14,7 @@
 
 #include "configobject.h"
 #include "library/dao/dao.h"
+#include "library/searchindex.h"
 #include "trackinfoobject.h"
 #include "util.h"
 
@@ -120,6 +121,10 @@ class TrackDAO : public QObject, public virtual DAO {
     TrackId addTrack(const QFileInfo& fileInfo, bool unremove);
     void addTracksPrepare();
     bool addTracksAdd(TrackInfoObject* pTrack, bool unremove);
+    // Commits the tracks added so far and starts a new transaction for the
+    // next ones. Returns false if the commit failed, in which case the tracks
+    // added since the last commit are rolled back.
+    bool addTracksCommit();
     void addTracksFinish(bool rollback=false);
     QList<TrackId> addTracks(const QList<QFileInfo>& fileInfoList, bool unremove);
     void hideTracks(const QList<TrackId>& trackIds);
@@ -142,6 +147,12 @@ class TrackDAO : public QObject, public virtual DAO {
 
     void markTracksAsMixxxDeleted(const QString& dir);
 
+    // Returns the full-text index of the library, which is loaded from the
+    // database on the first call and kept up to date from then on. Returns
+    // NULL if loading it failed.
+    // WARNING: Only call this from the main thread instance of TrackDAO.
+    const SearchIndex* getSearchIndex();
+
     // Scanning related calls. Should be elsewhere or private somehow.
     void markTrackLocationsAsVerified(const QStringList& locations);
     void markTracksInDirectoriesAsVerified(const QStringList& directories);
@@ -200,6 +211,11 @@ class TrackDAO : public QObject, public virtual DAO {
 
     void writeMetadataToFile(TrackInfoObject* pTrack);
 
+    void updateSearchIndex(const TrackInfoObject& track);
+    // Reads the tracks among trackIds into the search index, or all tracks
+    // if trackIds is empty.
+    bool loadSearchIndex(const QSet<TrackId>& trackIds);
+
     QSqlDatabase& m_database;
     CueDAO& m_cueDao;
     PlaylistDAO& m_playlistDao;
@@ -230,7 +246,13 @@ class TrackDAO : public QObject, public virtual DAO {
     int m_queryLibraryIdColumn;
     int m_queryLibraryMixxxDeletedColumn;
 
+    // The tracks added in the current transaction
     QSet<TrackId> m_tracksAddedSet;
+    // The tracks added in earlier transactions since addTracksPrepare()
+    QSet<TrackId> m_tracksCommittedSet;
+
+    SearchIndex m_searchIndex;
+    bool m_bSearchIndexLoaded;
 
     DISALLOW_COPY_AND_ASSIGN(TrackDAO);
 };
@@ -4,6 +4,13 @@
 #include "library/coverartutils.h"
 #include "util/timer.h"
 
+namespace {
+
+// The number of new tracks handed over to the LibraryScanner at once
+const int kTracksPerBatch = 32;
+
+} // anonymous namespace
+
 ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
                                  const ScannerGlobalPointer scannerGlobal,
                                  const QString& dirPath,
@@ -21,6 +28,8 @@ ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
 
 void ImportFilesTask::run() {
     ScopedTimer timer("ImportFilesTask::run");
+    QStringList existingTracks;
+    QList<TrackPointer> newTracks;
     foreach (const QFileInfo& file, m_filesToImport) {
         // If a flag was raised telling us to cancel the library scan then stop.
         if (m_scannerGlobal->shouldCancel()) {
@@ -39,8 +48,19 @@ void ImportFilesTask::run() {
             // If the track is in the database, mark it as existing. This code gets
             // executed when other files in the same directory have changed (the
             // directory hash has changed).
-            emit(trackExists(filePath));
+            existingTracks.append(filePath);
         } else {
+            // Hand over the tracks read so far before waiting for the
+            // database, so that all readers cannot end up waiting for tracks
+            // they hold themselves.
+            if (!m_scannerGlobal->tryAcquireTrackInFlight()) {
+                emitNewTracks(&newTracks);
+                if (!m_scannerGlobal->acquireTrackInFlight()) {
+                    setSuccess(false);
+                    return;
+                }
+            }
+
             // Parse the track including cover art from metadata. This is a new
             // (never before seen) track so it is safe to parse cover art
             // without checking if we have cover art that is USER_SELECTED. If
@@ -59,10 +79,25 @@ void ImportFilesTask::run() {
                 }
             }
 
-            emit(addNewTrack(pTrack));
+            m_scannerGlobal->trackRead();
+            newTracks.append(pTrack);
+            if (newTracks.size() >= kTracksPerBatch) {
+                emitNewTracks(&newTracks);
+            }
         }
     }
+    if (!existingTracks.isEmpty()) {
+        emit(tracksExist(existingTracks));
+    }
+    emitNewTracks(&newTracks);
     // Insert or update the hash in the database.
     emit(directoryHashedAndScanned(m_dirPath, !m_prevHashExists, m_newHash));
     setSuccess(true);
 }
+
+void ImportFilesTask::emitNewTracks(QList<TrackPointer>* pTracks) {
+    if (!pTracks->isEmpty()) {
+        emit(addNewTracks(*pTracks));
+        pTracks->clear();
+    }
+}
@@ -25,7 +25,13 @@ class ImportFilesTask : public ScannerTask {
 
     virtual void run();
 
+    virtual bool readsMetadata() const {
+        return true;
+    }
+
   private:
+    void emitNewTracks(QList<TrackPointer>* pTracks);
+
     const QString m_dirPath;
     const bool m_prevHashExists;
     const int m_newHash;
@@ -32,8 +32,23 @@
 #include "library/scanner/scannerutil.h"
 #include "upgrade.h"
 
+namespace {
+
+// Walking the directories mostly waits for the file system, so a few threads
+// list directories at the same time. The metadata readers get a thread per
+// core.
 // TODO(rryan) make configurable
-const int kScannerThreadPoolSize = 1;
+const int kDirectoryWalkerThreads = 4;
+
+// The tracks that may be read but not yet written, see ScannerGlobal.
+const int kMaxTracksInFlight = 512;
+
+} // anonymous namespace
+
+// The new tracks are committed in transactions of this many tracks, which
+// keeps the journal small and lets other connections write in between.
+// static
+const int LibraryScanner::kTracksPerTransaction = 1000;
 
 LibraryScanner::LibraryScanner(QWidget* pParentWidget,
                                TrackCollection* collection,
@@ -58,11 +73,13 @@ LibraryScanner::LibraryScanner(QWidget* pParentWidget,
     // queue to our event loop.
     moveToThread(this);
     m_pool.moveToThread(this);
+    m_importPool.moveToThread(this);
 
     unsigned static id = 0; // the id of this LibraryScanner, for debugging purposes
     setObjectName(QString("LibraryScanner %1").arg(++id));
 
-    m_pool.setMaxThreadCount(kScannerThreadPoolSize);
+    m_pool.setMaxThreadCount(kDirectoryWalkerThreads);
+    m_importPool.setMaxThreadCount(qMax(1, QThread::idealThreadCount()));
 
     // Listen to signals from our public methods (invoked by other threads) and
     // connect them to our slots to run the command on the scanner thread.
@@ -90,6 +107,8 @@ LibraryScanner::LibraryScanner(QWidget* pParentWidget,
             pProgress, SLOT(slotUpdate(QString)));
     connect(this, SIGNAL(progressHashing(QString)),
             pProgress, SLOT(slotUpdate(QString)));
+    connect(this, SIGNAL(progressStats(int, int)),
+            pProgress, SLOT(slotUpdateStats(int, int)));
     connect(this, SIGNAL(scanStarted()),
             pProgress, SLOT(slotScanStarted()));
     connect(this, SIGNAL(scanFinished()),
@@ -184,7 +203,8 @@ void LibraryScanner::slotStartScan() {
 
     m_scannerGlobal = ScannerGlobalPointer(
             new ScannerGlobal(trackLocations, directoryHashes, extensionFilter,
-                              coverExtensionFilter, directoryBlacklist));
+                              coverExtensionFilter, directoryBlacklist,
+                              kMaxTracksInFlight));
 
     m_scannerGlobal->startTimer();
 
@@ -223,7 +243,8 @@ void LibraryScanner::slotStartScan() {
     qDebug() << "Recursively scanning library.";
 
     // Start scanning the library. This prepares insertion queries in TrackDAO
-    // (must be called before calling addTracksAdd) and begins a transaction.
+    // (must be called before calling addTracksAdd) and begins a transaction,
+    // which commitNewTracks() commits every kTracksPerTransaction tracks.
     m_trackDao.addTracksPrepare();
 
     // Queue up recursive scan tasks for every directory. When all tasks are
@@ -335,9 +356,16 @@ void LibraryScanner::slotFinishScan() {
     }
 
     // Finish adding the tracks -- rollback the transaction if the scan did not
-    // finish cleanly and the user did not cancel the transaction.
-    m_trackDao.addTracksFinish(!m_scannerGlobal->shouldCancel() &&
-                               !bScanFinishedCleanly);
+    // finish cleanly and the user did not cancel the transaction. The tracks
+    // of earlier transactions stay.
+    const bool rollback = !m_scannerGlobal->shouldCancel() &&
+            !bScanFinishedCleanly;
+    m_trackDao.addTracksFinish(rollback);
+    if (rollback) {
+        m_uncommittedTracks.clear();
+    } else {
+        emitCommittedTracks();
+    }
 
     QStringList verifiedTracks = m_scannerGlobal->verifiedTracks();
     QStringList verifiedDirectories = m_scannerGlobal->verifiedDirectories();
@@ -353,16 +381,20 @@ void LibraryScanner::slotFinishScan() {
     }
 
     // TODO(XXX) doesn't take into account verifyRemainingTracks.
+    const qint64 elapsed = m_scannerGlobal->timerElapsed();
     qDebug("Scan took: %lld ns. "
            "%d unchanged directories. "
            "%d changed/added directories. "
            "%d tracks verified from changed/added directories. "
-           "%d new tracks.",
-           m_scannerGlobal->timerElapsed(),
+           "%d files read. "
+           "%d new tracks, %.1f per second.",
+           elapsed,
            verifiedDirectories.size(),
            m_scannerGlobal->numScannedDirectories(),
            verifiedTracks.size(),
-           m_scannerGlobal->numAddedTracks());
+           m_scannerGlobal->numReadTracks(),
+           m_scannerGlobal->numAddedTracks(),
+           elapsed > 0 ? m_scannerGlobal->numAddedTracks() * 1e9 / elapsed : 0.0);
 
     m_scannerGlobal.clear();
     changeScannerState(FINISHED);
@@ -411,10 +443,11 @@ void LibraryScanner::cancel() {
         scanner->cancel();
     }
 
-    // Wait for the thread pool to empty. This is important because ScannerTasks
+    // Wait for the thread pools to empty. This is important because ScannerTasks
     // have pointers to the LibraryScanner and can cause a segfault if they run
     // after the LibraryScanner has been destroyed.
     m_pool.waitForDone();
+    m_importPool.waitForDone();
 }
 
 
@@ -442,10 +475,10 @@ void LibraryScanner::queueTask(ScannerTask* pTask) {
             this, SLOT(slotDirectoryHashedAndScanned(QString, bool, int)));
     connect(pTask, SIGNAL(directoryUnchanged(QString)),
             this, SLOT(slotDirectoryUnchanged(QString)));
-    connect(pTask, SIGNAL(trackExists(QString)),
-            this, SLOT(slotTrackExists(QString)));
-    connect(pTask, SIGNAL(addNewTrack(TrackPointer)),
-            this, SLOT(slotAddNewTrack(TrackPointer)));
+    connect(pTask, SIGNAL(tracksExist(QStringList)),
+            this, SLOT(slotTracksExist(QStringList)));
+    connect(pTask, SIGNAL(addNewTracks(QList<TrackPointer>)),
+            this, SLOT(slotAddNewTracks(QList<TrackPointer>)));
 
     // Progress signals.
     // Pass directly to the main thread
@@ -454,7 +487,11 @@ void LibraryScanner::queueTask(ScannerTask* pTask) {
     connect(pTask, SIGNAL(progressHashing(QString)),
             this, SIGNAL(progressHashing(QString)));
 
-    m_pool.start(pTask);
+    if (pTask->readsMetadata()) {
+        m_importPool.start(pTask);
+    } else {
+        m_pool.start(pTask);
+    }
 }
 
 void LibraryScanner::slotDirectoryHashedAndScanned(const QString& directoryPath,
@@ -486,29 +523,73 @@ void LibraryScanner::slotDirectoryUnchanged(const QString& directoryPath) {
     emit(progressHashing(directoryPath));
 }
 
-void LibraryScanner::slotTrackExists(const QString& trackPath) {
-    //qDebug() << "LibraryScanner::slotTrackExists" << trackPath;
-    ScopedTimer timer("LibraryScanner::slotTrackExists");
+void LibraryScanner::slotTracksExist(const QStringList& trackPaths) {
+    //qDebug() << "LibraryScanner::slotTracksExist" << trackPaths;
+    ScopedTimer timer("LibraryScanner::slotTracksExist");
     if (m_scannerGlobal) {
-        m_scannerGlobal->addVerifiedTrack(trackPath);
+        for (const auto& trackPath: trackPaths) {
+            m_scannerGlobal->addVerifiedTrack(trackPath);
+        }
     }
 }
 
-void LibraryScanner::slotAddNewTrack(TrackPointer pTrack) {
-    //qDebug() << "LibraryScanner::slotAddNewTrack" << pTrack;
-    ScopedTimer timer("LibraryScanner::addNewTrack");
-    // For statistics tracking.
+void LibraryScanner::slotAddNewTracks(const QList<TrackPointer>& tracks) {
+    //qDebug() << "LibraryScanner::slotAddNewTracks" << tracks.size();
+    ScopedTimer timer("LibraryScanner::addNewTracks");
     if (m_scannerGlobal) {
-        m_scannerGlobal->trackAdded();
+        // Let the readers go on.
+        m_scannerGlobal->releaseTracksInFlight(tracks.size());
+    }
+    for (const auto& pTrack: tracks) {
+        // For statistics tracking.
+        if (m_scannerGlobal) {
+            m_scannerGlobal->trackAdded();
+        }
+        if (m_trackDao.addTracksAdd(pTrack.data(), false)) {
+            m_uncommittedTracks.append(pTrack);
+        } else {
+            qWarning()
+                    << "Track (" + pTrack->getLocation() + ") could not be added";
+        }
+    }
+    if (m_uncommittedTracks.size() >= kTracksPerTransaction) {
+        commitNewTracks();
     }
-    if (m_trackDao.addTracksAdd(pTrack.data(), false)) {
-        // Successfully added. Signal the main instance of TrackDAO,
-        // that there is a new track in the database.
+}
+
+void LibraryScanner::commitNewTracks() {
+    ScopedTimer timer("LibraryScanner::commitNewTracks");
+    if (!m_trackDao.addTracksCommit()) {
+        qWarning() << "Committing" << m_uncommittedTracks.size()
+                   << "new tracks failed";
+        // The tracks were rolled back and are not announced. The scan is
+        // incomplete, so it must not clean up the library.
+        m_uncommittedTracks.clear();
+        if (m_scannerGlobal) {
+            m_scannerGlobal->clearScanFinishedCleanly();
+        }
+        return;
+    }
+    emitCommittedTracks();
+}
+
+void LibraryScanner::emitCommittedTracks() {
+    if (m_uncommittedTracks.isEmpty()) {
+        return;
+    }
+    // Signal the main instance of TrackDAO, that there are new tracks in the
+    // database. Its connection does not see them before they are committed.
+    for (const auto& pTrack: m_uncommittedTracks) {
         emit(trackAdded(pTrack));
-        emit(progressLoading(pTrack->getLocation()));
-    } else {
-        qWarning()
-                << "Track (" + pTrack->getLocation() + ") could not be added";
+    }
+    emit(progressLoading(m_uncommittedTracks.last()->getLocation()));
+    m_uncommittedTracks.clear();
+
+    if (m_scannerGlobal) {
+        const qint64 elapsed = m_scannerGlobal->timerElapsed();
+        const int numAddedTracks = m_scannerGlobal->numAddedTracks();
+        emit(progressStats(numAddedTracks, elapsed > 0 ?
+                static_cast<int>(numAddedTracks * 1000000000LL / elapsed) : 0));
     }
 }
 
@@ -59,6 +59,8 @@ class LibraryScanner : public QThread {
     // in progress.
     void scan();
 
+    static const int kTracksPerTransaction;
+
 
 
   public slots:
@@ -71,6 +73,8 @@ class LibraryScanner : public QThread {
     void progressHashing(QString);
     void progressLoading(QString path);
     void progressCoverArt(QString file);
+    // The number of new tracks so far and how many are added per second
+    void progressStats(int numAddedTracks, int tracksPerSecond);
     void trackAdded(TrackPointer pTrack);
     void tracksMoved(QSet<TrackId> oldTrackIds, QSet<TrackId> newTrackIds);
     void tracksChanged(QSet<TrackId> changedTrackIds);
@@ -94,8 +98,8 @@ class LibraryScanner : public QThread {
     void slotDirectoryHashedAndScanned(const QString& directoryPath,
                                    bool newDirectory, int hash);
     void slotDirectoryUnchanged(const QString& directoryPath);
-    void slotTrackExists(const QString& trackPath);
-    void slotAddNewTrack(TrackPointer pTrack);
+    void slotTracksExist(const QStringList& trackPaths);
+    void slotAddNewTracks(const QList<TrackPointer>& tracks);
 
   private:
     enum ScannerState {
@@ -122,6 +126,10 @@ class LibraryScanner : public QThread {
     void cleanUpScan(const QStringList& verifiedTracks,
             const QStringList& verifiedDirectories);
 
+    // Commits the new tracks and announces them once committed.
+    void commitNewTracks();
+    void emitCommittedTracks();
+
     // The library trackcollection. Do not touch this from the library scanner
     // thread.
     TrackCollection* m_pCollection;
@@ -129,8 +137,14 @@ class LibraryScanner : public QThread {
     // The library scanner thread's database connection.
     QSqlDatabase m_database;
 
-    // The pool of threads used for worker tasks.
+    // The pool of threads that walk the directories.
     QThreadPool m_pool;
+    // The pool of threads that read the metadata and cover art of new files,
+    // see ScannerTask::readsMetadata().
+    QThreadPool m_importPool;
+
+    // The tracks added to the database in the current transaction
+    QList<TrackPointer> m_uncommittedTracks;
 
     // The library scanner thread's DAOs.
     LibraryHashDAO m_libraryHashDao;
@@ -150,6 +164,8 @@ class LibraryScanner : public QThread {
     QSemaphore m_stateSema;
     // this is accessed main and LibraryScanner thread
     volatile ScannerState m_state;
+
+    friend class LibraryScannerCommitTest;
 };
 
 #endif
@@ -47,6 +47,11 @@ LibraryScannerDlg::LibraryScannerDlg(QWidget* parent, Qt::WindowFlags f)
     connect(this, SIGNAL(progress(QString)),
             pCurrent, SLOT(setText(QString)));
     pLayout->addWidget(pCurrent);
+
+    QLabel* pStats = new QLabel(this);
+    connect(this, SIGNAL(stats(QString)),
+            pStats, SLOT(setText(QString)));
+    pLayout->addWidget(pStats);
     setLayout(pLayout);
 }
 
@@ -79,6 +84,14 @@ void LibraryScannerDlg::slotUpdateCover(QString path) {
     }
 }
 
+void LibraryScannerDlg::slotUpdateStats(int numAddedTracks,
+                                        int tracksPerSecond) {
+    if (isVisible()) {
+        emit(stats(tr("%1 new tracks, %2 per second")
+                   .arg(numAddedTracks).arg(tracksPerSecond)));
+    }
+}
+
 void LibraryScannerDlg::slotCancel() {
     qDebug() << "Cancelling library scan...";
     m_bCancelled = true;
@@ -1,14 +1,17 @@
 #ifndef SCANNERGLOBAL_H
 #define SCANNERGLOBAL_H
 
+#include <QAtomicInt>
 #include <QSet>
 #include <QHash>
 #include <QRegExp>
 #include <QStringList>
 #include <QMutex>
 #include <QMutexLocker>
+#include <QSemaphore>
 #include <QSharedPointer>
 
+#include "util/compatibility.h"
 #include "util/task.h"
 #include "util/performancetimer.h"
 
@@ -18,7 +21,8 @@ class ScannerGlobal {
                   const QHash<QString, int>& directoryHashes,
                   const QRegExp& supportedExtensionsMatcher,
                   const QRegExp& supportedCoverExtensionsMatcher,
-                  const QStringList& directoriesBlacklist)
+                  const QStringList& directoriesBlacklist,
+                  int maxTracksInFlight)
             : m_trackLocations(trackLocations),
               m_directoryHashes(directoryHashes),
               m_supportedExtensionsMatcher(supportedExtensionsMatcher),
@@ -27,6 +31,7 @@ class ScannerGlobal {
               // Unless marked un-clean, we assume it will finish cleanly.
               m_scanFinishedCleanly(true),
               m_shouldCancel(false),
+              m_tracksInFlight(maxTracksInFlight),
               m_numAddedTracks(0),
               m_numScannedDirectories(0) {
     }
@@ -89,6 +94,29 @@ class ScannerGlobal {
         m_scanFinishedCleanly = false;
     }
 
+    // Tracks in flight are read by an ImportFilesTask but not yet written to
+    // the database. Their number is limited, so that the readers do not fill
+    // the memory with metadata and cover art while the database lags behind.
+    inline bool tryAcquireTrackInFlight() {
+        return m_tracksInFlight.tryAcquire();
+    }
+
+    // Waits until another track may be read. Returns false if the scan is
+    // cancelled meanwhile.
+    bool acquireTrackInFlight() {
+        while (!m_tracksInFlight.tryAcquire(1, 100)) {
+            if (shouldCancel()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Called once tracks in flight are written to the database.
+    void releaseTracksInFlight(int count) {
+        m_tracksInFlight.release(count);
+    }
+
     void addVerifiedDirectory(const QString& directory) {
         m_verifiedDirectories << directory;
     }
@@ -128,6 +156,13 @@ class ScannerGlobal {
         m_numScannedDirectories++;
     }
 
+    // Called from the threads of the ImportFilesTasks.
+    int numReadTracks() const {
+        return load_atomic(m_numReadTracks);
+    }
+    void trackRead() {
+        m_numReadTracks.ref();
+    }
 
   private:
     TaskWatcher m_watcher;
@@ -155,10 +190,13 @@ class ScannerGlobal {
     volatile bool m_scanFinishedCleanly;
     volatile bool m_shouldCancel;
 
+    QSemaphore m_tracksInFlight;
+
     // Stats tracking.
     PerformanceTimer m_timer;
     int m_numAddedTracks;
     int m_numScannedDirectories;
+    QAtomicInt m_numReadTracks;
 };
 
 typedef QSharedPointer<ScannerGlobal> ScannerGlobalPointer;
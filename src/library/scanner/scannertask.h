@@ -1,8 +1,10 @@
 #ifndef SCANNERTASK_H
 #define SCANNERTASK_H
 
+#include <QList>
 #include <QObject>
 #include <QRunnable>
+#include <QStringList>
 
 #include "trackinfoobject.h"
 #include "library/scanner/scannerglobal.h"
@@ -18,6 +20,12 @@ class ScannerTask : public QObject, public QRunnable {
 
     virtual void run() = 0;
 
+    // Tasks that read the metadata of files run on their own thread pool,
+    // so that they do not hold up walking the directories.
+    virtual bool readsMetadata() const {
+        return false;
+    }
+
   signals:
     void taskDone(bool success);
     void queueTask(ScannerTask* pTask);
@@ -26,8 +34,8 @@ class ScannerTask : public QObject, public QRunnable {
     void directoryHashed(const QString& directoryPath, bool newDirectory,
                          int hash);
     void directoryUnchanged(const QString& directoryPath);
-    void trackExists(const QString& filePath);
-    void addNewTrack(TrackPointer pTrack);
+    void tracksExist(const QStringList& filePaths);
+    void addNewTracks(const QList<TrackPointer>& tracks);
 
     // Feedback to GUI
     void progressLoading(const QString& fileName);
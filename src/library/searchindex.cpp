@@ -0,0 +1,234 @@
+#include <algorithm>
+
+#include "library/searchindex.h"
+
+#include "util/assert.h"
+
+namespace {
+
+// Stale postings are only dropped when there are enough of them to be worth
+// rebuilding all postings.
+const int kMinStalePostingsToCompact = 4096;
+
+} // anonymous namespace
+
+SearchIndex::SearchIndex(const QStringList& columns)
+        : m_columnNames(columns),
+          m_columns(columns.size()),
+          m_postingCount(0),
+          m_stalePostingCount(0) {
+    for (int i = 0; i < columns.size(); ++i) {
+        m_columnIndex.insert(columns.at(i), i);
+    }
+}
+
+SearchIndex::~SearchIndex() {
+}
+
+//static
+void SearchIndex::makeLatinLow(QChar* c, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (c[i].decompositionTag() != QChar::NoDecomposition) {
+            c[i] = c[i].decomposition()[0];
+        }
+        if (c[i].isUpper()) {
+            c[i] = c[i].toLower();
+        }
+    }
+}
+
+//static
+QString SearchIndex::latinLow(QString string) {
+    makeLatinLow(string.data(), string.length());
+    return string;
+}
+
+void SearchIndex::clear() {
+    m_columns = QVector<Column>(m_columnNames.size());
+    m_rowForTrack.clear();
+    m_trackForRow.clear();
+    m_freeRows.clear();
+    m_postingCount = 0;
+    m_stalePostingCount = 0;
+}
+
+void SearchIndex::setTrack(TrackId trackId, const QStringList& values) {
+    DEBUG_ASSERT_AND_HANDLE(trackId.isValid()) {
+        return;
+    }
+    DEBUG_ASSERT(values.size() == m_columns.size());
+
+    int row = m_rowForTrack.value(trackId, -1);
+    if (row < 0) {
+        if (m_freeRows.isEmpty()) {
+            row = m_trackForRow.size();
+            m_trackForRow.append(trackId);
+            for (int i = 0; i < m_columns.size(); ++i) {
+                m_columns[i].values.append(QString());
+            }
+        } else {
+            row = m_freeRows.takeLast();
+            m_trackForRow[row] = trackId;
+        }
+        m_rowForTrack.insert(trackId, row);
+    }
+
+    for (int i = 0; i < m_columns.size(); ++i) {
+        setValue(&m_columns[i], row, values.value(i));
+    }
+    compact();
+}
+
+void SearchIndex::removeTrack(TrackId trackId) {
+    const int row = m_rowForTrack.value(trackId, -1);
+    if (row < 0) {
+        return;
+    }
+    for (int i = 0; i < m_columns.size(); ++i) {
+        setValue(&m_columns[i], row, QString());
+    }
+    m_rowForTrack.remove(trackId);
+    m_trackForRow[row] = TrackId();
+    m_freeRows.append(row);
+    compact();
+}
+
+//static
+SearchIndex::Trigram SearchIndex::trigramAt(const QString& value, int i) {
+    return (static_cast<Trigram>(value.at(i).unicode()) << 32) |
+            (static_cast<Trigram>(value.at(i + 1).unicode()) << 16) |
+            static_cast<Trigram>(value.at(i + 2).unicode());
+}
+
+//static
+QVector<SearchIndex::Trigram> SearchIndex::trigrams(const QString& value) {
+    QVector<Trigram> result;
+    if (value.size() < kMinArgumentLength) {
+        return result;
+    }
+    result.reserve(value.size() - kMinArgumentLength + 1);
+    for (int i = 0; i + kMinArgumentLength <= value.size(); ++i) {
+        result.append(trigramAt(value, i));
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void SearchIndex::setValue(Column* pColumn, int row, const QString& value) {
+    const QString folded(latinLow(value));
+    if (pColumn->values.at(row) == folded) {
+        return;
+    }
+    const QVector<Trigram> oldTrigrams(trigrams(pColumn->values.at(row)));
+    const QVector<Trigram> newTrigrams(trigrams(folded));
+
+    // Only trigrams the old value did not contain are listed, the others are
+    // listed already. The ones the new value lacks turn stale.
+    QVector<Trigram>::const_iterator oldIt = oldTrigrams.constBegin();
+    QVector<Trigram>::const_iterator newIt = newTrigrams.constBegin();
+    while (oldIt != oldTrigrams.constEnd() || newIt != newTrigrams.constEnd()) {
+        if (newIt == newTrigrams.constEnd() ||
+                (oldIt != oldTrigrams.constEnd() && *oldIt < *newIt)) {
+            ++m_stalePostingCount;
+            ++oldIt;
+        } else if (oldIt == oldTrigrams.constEnd() || *newIt < *oldIt) {
+            pColumn->postings[*newIt].append(row);
+            ++m_postingCount;
+            ++newIt;
+        } else {
+            ++oldIt;
+            ++newIt;
+        }
+    }
+    pColumn->values[row] = folded;
+}
+
+void SearchIndex::compact() {
+    if (m_stalePostingCount < kMinStalePostingsToCompact ||
+            m_stalePostingCount * 2 < m_postingCount) {
+        return;
+    }
+    m_postingCount = 0;
+    m_stalePostingCount = 0;
+    for (int i = 0; i < m_columns.size(); ++i) {
+        Column& column = m_columns[i];
+        column.postings.clear();
+        for (int row = 0; row < column.values.size(); ++row) {
+            for (const auto& trigram: trigrams(column.values.at(row))) {
+                column.postings[trigram].append(row);
+                ++m_postingCount;
+            }
+        }
+    }
+}
+
+bool SearchIndex::search(const QStringList& columns, const QString& argument,
+                         QVector<TrackId>* pTrackIds, int maxTracks) const {
+    const QString folded(latinLow(argument));
+    if (folded.size() < kMinArgumentLength ||
+            folded.contains('%') || folded.contains('_')) {
+        return false;
+    }
+    QVector<const Column*> searchColumns;
+    for (const auto& column: columns) {
+        const int index = m_columnIndex.value(column, -1);
+        if (index < 0) {
+            return false;
+        }
+        searchColumns.append(&m_columns.at(index));
+    }
+
+    QVector<int> rows;
+    for (const auto* pColumn: searchColumns) {
+        if (!searchColumn(*pColumn, folded, maxTracks, &rows)) {
+            return false;
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+    if (maxTracks >= 0 && rows.size() > maxTracks) {
+        return false;
+    }
+
+    pTrackIds->clear();
+    pTrackIds->reserve(rows.size());
+    for (int row: rows) {
+        pTrackIds->append(m_trackForRow.at(row));
+    }
+    std::sort(pTrackIds->begin(), pTrackIds->end());
+    return true;
+}
+
+bool SearchIndex::searchColumn(const Column& column, const QString& argument,
+                               int maxRows, QVector<int>* pRows) const {
+    // Every matching value contains each trigram of the argument, so the
+    // rows listed for the rarest one are all candidates.
+    const QVector<int>* pCandidates = NULL;
+    for (int i = 0; i + kMinArgumentLength <= argument.size(); ++i) {
+        Postings::const_iterator it = column.postings.constFind(
+                trigramAt(argument, i));
+        if (it == column.postings.constEnd()) {
+            return true;
+        }
+        if (!pCandidates || it.value().size() < pCandidates->size()) {
+            pCandidates = &it.value();
+        }
+    }
+    DEBUG_ASSERT_AND_HANDLE(pCandidates) {
+        return true;
+    }
+    // The rows of one column are unique, so they can be counted before the
+    // rows of all columns are merged.
+    int matches = 0;
+    for (int row: *pCandidates) {
+        if (m_trackForRow.at(row).isValid() &&
+                column.values.at(row).contains(argument)) {
+            if (maxRows >= 0 && ++matches > maxRows) {
+                return false;
+            }
+            pRows->append(row);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,100 @@
+#ifndef SEARCHINDEX_H
+#define SEARCHINDEX_H
+
+#include <QChar>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "track/trackid.h"
+
+// An in-memory full-text index of the text columns of the library, for the
+// free-text searches of TextFilterNode. A search for an argument matches the
+// tracks with a value that contains it, like
+//   column LIKE '%argument%'
+// with the like() function of TrackCollection does: Both are folded with
+// makeLatinLow(), which drops diacritics and case.
+//
+// Each column keeps the folded value of every track and a trigram index, i.e.
+// the tracks whose value contains each sequence of three characters. A search
+// looks up the rarest trigram of the argument and only compares the values
+// of the tracks listed for it. Changing or removing a value leaves its old
+// trigrams listed, the comparison skips them. The lists are rebuilt once
+// more than half of their entries are stale.
+class SearchIndex {
+  public:
+    // Shorter arguments have no trigram to look up.
+    static const int kMinArgumentLength = 3;
+
+    explicit SearchIndex(const QStringList& columns);
+    virtual ~SearchIndex();
+
+    // Replaces each character by the first character of its decomposition,
+    // in lower case, e.g. "Ä" by "a". The length does not change.
+    static void makeLatinLow(QChar* c, int count);
+    static QString latinLow(QString string);
+
+    const QStringList& columns() const {
+        return m_columnNames;
+    }
+
+    void clear();
+
+    int size() const {
+        return m_rowForTrack.size();
+    }
+
+    bool contains(TrackId trackId) const {
+        return m_rowForTrack.contains(trackId);
+    }
+
+    // Sets the values of the track, in the order of columns().
+    void setTrack(TrackId trackId, const QStringList& values);
+    void removeTrack(TrackId trackId);
+
+    // Stores the tracks with a value in one of the columns that contains
+    // argument in pTrackIds, ordered by id. Returns false if the index cannot
+    // answer the search: When one of the columns is not indexed, the argument
+    // is shorter than kMinArgumentLength or contains the LIKE wildcards '%'
+    // and '_'. Also returns false as soon as more than maxTracks tracks
+    // match, unless maxTracks is negative.
+    bool search(const QStringList& columns, const QString& argument,
+                QVector<TrackId>* pTrackIds, int maxTracks = -1) const;
+
+  private:
+    typedef quint64 Trigram;
+    typedef QHash<Trigram, QVector<int> > Postings;
+
+    struct Column {
+        // The folded value of each row
+        QVector<QString> values;
+        // The rows listed for each trigram, possibly more than once and with
+        // values that no longer contain it
+        Postings postings;
+    };
+
+    static Trigram trigramAt(const QString& value, int i);
+    static QVector<Trigram> trigrams(const QString& value);
+
+    void setValue(Column* pColumn, int row, const QString& value);
+    // Returns false if more than maxRows rows of the column match.
+    bool searchColumn(const Column& column, const QString& argument,
+                      int maxRows, QVector<int>* pRows) const;
+    void compact();
+
+    QStringList m_columnNames;
+    QHash<QString, int> m_columnIndex;
+    QVector<Column> m_columns;
+
+    QHash<TrackId, int> m_rowForTrack;
+    // The track of each row, invalid for rows of removed tracks
+    QVector<TrackId> m_trackForRow;
+    QVector<int> m_freeRows;
+
+    // The number of entries in all postings, and how many of them are stale
+    int m_postingCount;
+    int m_stalePostingCount;
+};
+
+#endif // SEARCHINDEX_H
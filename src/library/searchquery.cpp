@@ -5,6 +5,19 @@
 #include "library/queryutil.h"
 #include "track/keyutils.h"
 #include "library/dao/trackdao.h"
+#include "util/math.h"
+
+namespace {
+
+// A search that matches more than this share of the library falls back to
+// LIKE. Otherwise a common term like "the" would list tens of thousands of
+// ids in the SQL, which is built on the GUI thread and copied into every
+// SelectJob and cache key.
+const int kMaxIndexedTrackShareDivisor = 50;
+// Small libraries may always list this many ids.
+const int kMinIndexedTrackLimit = 64;
+
+} // anonymous namespace
 
 QVariant getTrackValueForColumn(const TrackPointer& pTrack, const QString& column) {
     if (column == LIBRARYTABLE_ARTIST) {
@@ -147,7 +160,8 @@ bool TextFilterNode::match(const TrackPointer& pTrack) const {
             continue;
         }
 
-        if (value.toString().contains(m_argument, Qt::CaseInsensitive)) {
+        // Compare like the like() function of TrackCollection does.
+        if (SearchIndex::latinLow(value.toString()).contains(m_latinLowArgument)) {
             return true;
         }
     }
@@ -155,6 +169,21 @@ bool TextFilterNode::match(const TrackPointer& pTrack) const {
 }
 
 QString TextFilterNode::toSql() const {
+    if (m_pSearchIndex) {
+        const int maxTracks = math_max(kMinIndexedTrackLimit,
+                m_pSearchIndex->size() / kMaxIndexedTrackShareDivisor);
+        QVector<TrackId> trackIds;
+        if (m_pSearchIndex->search(m_sqlColumns, m_argument, &trackIds,
+                                   maxTracks)) {
+            QStringList ids;
+            ids.reserve(trackIds.size());
+            for (const auto& trackId: trackIds) {
+                ids << trackId.toString();
+            }
+            return QString("%1 IN (%2)").arg(m_idColumn, ids.join(","));
+        }
+    }
+
     FieldEscaper escaper(m_database);
     QString escapedArgument = escaper.escapeString("%" + m_argument + "%");
 
@@ -6,7 +6,8 @@ const char* kNegatePrefix = "-";
 const char* kFuzzyPrefix = "~";
 
 SearchQueryParser::SearchQueryParser(QSqlDatabase& database)
-        : m_database(database) {
+        : m_database(database),
+          m_pSearchIndex(NULL) {
     m_textFilters << "artist"
                   << "album_artist"
                   << "album"
@@ -57,6 +58,12 @@ SearchQueryParser::SearchQueryParser(QSqlDatabase& database)
 SearchQueryParser::~SearchQueryParser() {
 }
 
+void SearchQueryParser::setSearchIndex(const SearchIndex* pSearchIndex,
+                                       const QString& idColumn) {
+    m_pSearchIndex = pSearchIndex;
+    m_searchIndexIdColumn = idColumn;
+}
+
 QString SearchQueryParser::getTextArgument(QString argument,
                                            QStringList* tokens) const {
     // If the argument is empty, assume the user placed a space after an
@@ -119,7 +126,8 @@ void SearchQueryParser::parseTokens(QStringList tokens,
 
             if (!argument.isEmpty()) {
                 std::unique_ptr<QueryNode> pNode(std::make_unique<TextFilterNode>(
-                    m_database, m_fieldToSqlColumns[field], argument));
+                    m_database, m_fieldToSqlColumns[field], argument,
+                    m_pSearchIndex, m_searchIndexIdColumn));
                 if (negate) {
                     pNode = std::make_unique<NotNode>(std::move(pNode));
                 }
@@ -153,7 +161,8 @@ void SearchQueryParser::parseTokens(QStringList tokens,
                             KeyUtils::guessKeyFromText(argument);
                     if (key == mixxx::track::io::key::INVALID) {
                         pNode = std::make_unique<TextFilterNode>(
-                                m_database, m_fieldToSqlColumns[field], argument);
+                                m_database, m_fieldToSqlColumns[field], argument,
+                                m_pSearchIndex, m_searchIndexIdColumn);
                     } else {
                         pNode = std::make_unique<KeyFilterNode>(key, fuzzy);
                     }
@@ -179,7 +188,8 @@ void SearchQueryParser::parseTokens(QStringList tokens,
             if (!token.isEmpty()) {
                 std::unique_ptr<QueryNode> pNode(
                         std::make_unique<TextFilterNode>(
-                                m_database, searchColumns, token));
+                                m_database, searchColumns, token,
+                                m_pSearchIndex, m_searchIndexIdColumn));
                 if (negate) {
                     pNode = std::make_unique<NotNode>(std::move(pNode));
                 }
@@ -205,3 +215,81 @@ std::unique_ptr<QueryNode> SearchQueryParser::parseQuery(const QString& query,
 
     return std::move(pQuery);
 }
+
+//static
+QString SearchQueryParser::normalizeQuery(const QString& query) {
+    if (query.contains("\"")) {
+        // Quoted arguments keep their whitespace.
+        return query;
+    }
+    return query.split(" ", QString::SkipEmptyParts).join(" ");
+}
+
+bool SearchQueryParser::isRefinement(const QString& previousQuery,
+                                     const QString& query) const {
+    if (query == previousQuery) {
+        return true;
+    }
+    if (previousQuery.contains("\"") || query.contains("\"")) {
+        // A quote joins the following terms into one argument.
+        return false;
+    }
+
+    const QStringList previousTokens(
+            previousQuery.split(" ", QString::SkipEmptyParts));
+    const QStringList tokens(query.split(" ", QString::SkipEmptyParts));
+    if (tokens.size() < previousTokens.size()) {
+        return false;
+    }
+    // Added terms narrow the result. A filter without argument at the end
+    // of previousQuery may take one of them as its argument, but it matched
+    // all tracks before.
+    for (int i = 0; i < previousTokens.size(); ++i) {
+        if (tokens.at(i) == previousTokens.at(i)) {
+            continue;
+        }
+        // Only the last term may have changed, and not if it is the
+        // argument of the filter before it.
+        if (i != previousTokens.size() - 1 ||
+                (i > 0 && previousTokens.at(i - 1).endsWith(":"))) {
+            return false;
+        }
+        if (!isTermRefinement(previousTokens.at(i), tokens.at(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SearchQueryParser::isTermRefinement(const QString& previousToken,
+                                         const QString& token) const {
+    if (previousToken.startsWith(kNegatePrefix) ||
+            token.startsWith(kNegatePrefix)) {
+        // Negated terms match more tracks when they get longer.
+        return false;
+    }
+
+    if (!previousToken.contains(":")) {
+        // A term searched in all search columns. A value that contains the
+        // new term also contains the old one.
+        return !token.contains(":") &&
+                !previousToken.startsWith(kFuzzyPrefix) &&
+                !token.startsWith(kFuzzyPrefix) &&
+                token.contains(previousToken);
+    }
+
+    // The same for a text filter on a column, like artist:abc
+    QRegExp textFilterMatcher(m_textFilterMatcher);
+    if (textFilterMatcher.indexIn(previousToken) == -1) {
+        return false;
+    }
+    const QString field = textFilterMatcher.cap(1);
+    const QString previousArgument = textFilterMatcher.cap(2).trimmed();
+    if (textFilterMatcher.indexIn(token) == -1 ||
+            textFilterMatcher.cap(1) != field) {
+        return false;
+    }
+    // A filter without argument matched all tracks.
+    return previousArgument.isEmpty() ||
+            textFilterMatcher.cap(2).contains(previousArgument);
+}
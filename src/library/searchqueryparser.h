@@ -14,11 +14,29 @@ class SearchQueryParser {
     SearchQueryParser(QSqlDatabase& database);
     virtual ~SearchQueryParser();
 
+    // Lets free-text searches look up the tracks in pSearchIndex instead of
+    // comparing every row, see TextFilterNode. idColumn is the track id
+    // column of the table the queries filter. Passing NULL disables it.
+    void setSearchIndex(const SearchIndex* pSearchIndex,
+                        const QString& idColumn);
+
     std::unique_ptr<QueryNode> parseQuery(
             const QString& query,
             const QStringList& searchColumns,
             const QString& extraFilter) const;
 
+    // Returns query as parseQuery() splits it into terms, so that queries
+    // that only differ in whitespace compare equal.
+    static QString normalizeQuery(const QString& query);
+
+    // Returns true if every track query matches also matches previousQuery,
+    // e.g. because query appends characters to the last term or adds terms.
+    // Both queries have to be normalized. Queries that might not narrow the
+    // result are not refinements, like those with quotes or a changed
+    // negated or numeric term.
+    bool isRefinement(const QString& previousQuery,
+                      const QString& query) const;
+
   private:
     void parseTokens(QStringList tokens,
                      QStringList searchColumns,
@@ -27,7 +45,12 @@ class SearchQueryParser {
     QString getTextArgument(QString argument,
                             QStringList* tokens) const;
 
+    bool isTermRefinement(const QString& previousToken,
+                          const QString& token) const;
+
     QSqlDatabase m_database;
+    const SearchIndex* m_pSearchIndex;
+    QString m_searchIndexIdColumn;
     QStringList m_textFilters;
     QStringList m_numericFilters;
     QStringList m_specialFilters;
@@ -0,0 +1,268 @@
+#include <QMutexLocker>
+#include <QSet>
+#include <QSqlDriver>
+#include <QSqlQuery>
+#include <QtDebug>
+
+#include "library/selectthread.h"
+
+#ifdef __SQLITE3__
+#include <sqlite3.h>
+#include <string.h>
+#endif
+
+#include "library/basetrackcache.h"
+#include "library/queryutil.h"
+#include "library/trackcollection.h"
+#include "util/trace.h"
+
+namespace {
+
+const bool sDebug = false;
+
+const char* kConnectionName = "LIBRARY_SELECT";
+
+// How long a query waits for a writer on another connection to finish
+// before it fails
+const char* kConnectOptions = "QSQLITE_BUSY_TIMEOUT=1000";
+
+// The number of rows read between checks whether the job was canceled
+const int kRowsPerCancelCheck = 1024;
+
+} // anonymous namespace
+
+SelectThread::SelectThread(const QSqlDatabase& database)
+        : m_templateDatabase(database),
+          m_stop(false),
+          m_pHandle(NULL) {
+    qRegisterMetaType<SelectJobPointer>("SelectJobPointer");
+}
+
+SelectThread::~SelectThread() {
+    stop();
+    wait();
+}
+
+void SelectThread::queueJob(SelectJobPointer pJob) {
+    QMutexLocker locker(&m_mutex);
+    // Superseded jobs are canceled by their owner, so drop them instead of
+    // letting the queue grow while a slow query runs.
+    QQueue<SelectJobPointer> jobs;
+    for (const auto& pQueuedJob: m_jobs) {
+        if (!pQueuedJob->isCanceled()) {
+            jobs.enqueue(pQueuedJob);
+        }
+    }
+    jobs.enqueue(pJob);
+    m_jobs = jobs;
+    m_jobQueued.wakeAll();
+}
+
+void SelectThread::cancelJob(const SelectJobPointer& pJob) {
+    // Canceled first, so runJob() knows a failing query was interrupted.
+    pJob->cancel();
+    QMutexLocker locker(&m_mutex);
+    if (pJob == m_pRunningJob) {
+        interruptRunningJob();
+    }
+}
+
+void SelectThread::stop() {
+    QMutexLocker locker(&m_mutex);
+    for (const auto& pJob: m_jobs) {
+        pJob->cancel();
+    }
+    m_jobs.clear();
+    if (m_pRunningJob) {
+        m_pRunningJob->cancel();
+        interruptRunningJob();
+    }
+    m_stop = true;
+    m_jobQueued.wakeAll();
+}
+
+void SelectThread::interruptRunningJob() {
+#ifdef __SQLITE3__
+    // The next job can not start while m_mutex is held, and an interrupt
+    // without a running statement has no effect.
+    if (m_pHandle != NULL) {
+        sqlite3_interrupt(m_pHandle);
+    }
+#endif
+}
+
+SelectJobPointer SelectThread::dequeueJobBlocking() {
+    QMutexLocker locker(&m_mutex);
+    while (m_jobs.isEmpty() && !m_stop) {
+        m_jobQueued.wait(&m_mutex);
+    }
+    if (m_stop) {
+        m_pRunningJob.clear();
+    } else {
+        m_pRunningJob = m_jobs.dequeue();
+    }
+    return m_pRunningJob;
+}
+
+void SelectThread::run() {
+    {
+        QSqlDatabase database = QSqlDatabase::cloneDatabase(
+                m_templateDatabase, kConnectionName);
+        database.setConnectOptions(kConnectOptions);
+        // Open the database connection in this thread.
+        const bool open = database.open();
+        if (open) {
+#ifdef __SQLITE3__
+            TrackCollection::installSorting(database);
+            QVariant handle = database.driver()->handle();
+            if (handle.isValid() && strcmp(handle.typeName(), "sqlite3*") == 0) {
+                QMutexLocker locker(&m_mutex);
+                // handle.data() returns a pointer to the handle
+                m_pHandle = *static_cast<sqlite3**>(handle.data());
+            }
+#endif
+        } else {
+            qDebug() << "Failed to open database from select thread."
+                     << database.lastError();
+        }
+
+        while (true) {
+            SelectJobPointer pJob = dequeueJobBlocking();
+            if (!pJob) {
+                break;
+            }
+            if (pJob->isCanceled()) {
+                continue;
+            }
+            Trace trace("SelectThread job");
+            // A job that fails here is reported anyway, so that its owner
+            // can run it on its own connection instead.
+            if (open && createViews(database, *pJob)) {
+                runJob(database, pJob.data());
+            }
+            if (!pJob->isCanceled()) {
+                emit(jobFinished(pJob));
+            }
+        }
+
+        m_views.clear();
+        {
+            QMutexLocker locker(&m_mutex);
+            m_pHandle = NULL;
+        }
+        database.close();
+    }
+    QSqlDatabase::removeDatabase(kConnectionName);
+}
+
+bool SelectThread::createViews(QSqlDatabase database, const SelectJob& job) {
+    for (QHash<QString, QString>::const_iterator it = job.views.constBegin();
+         it != job.views.constEnd(); ++it) {
+        if (m_views.value(it.key()) == it.value()) {
+            continue;
+        }
+        QSqlQuery query(database);
+        if (m_views.contains(it.key())) {
+            // The view was dropped and created with another definition.
+            if (!query.exec(QString("DROP VIEW IF EXISTS %1").arg(it.key()))) {
+                LOG_FAILED_QUERY(query);
+                return false;
+            }
+            m_views.remove(it.key());
+        }
+        if (!query.exec(it.value())) {
+            LOG_FAILED_QUERY(query);
+            return false;
+        }
+        m_views.insert(it.key(), it.value());
+    }
+    return true;
+}
+
+// static
+bool SelectThread::runJob(QSqlDatabase database, SelectJob* pJob) {
+    pJob->succeeded = false;
+    pJob->rows.clear();
+    pJob->matchingTrackIds.clear();
+
+    if (sDebug) {
+        qDebug() << "SelectThread executing:" << pJob->tableStatement;
+    }
+
+    QSqlQuery query(database);
+    // This causes a memory savings since QSqlCachedResult (what QtSQLite uses)
+    // won't allocate a giant in-memory table that we won't use at all.
+    query.setForwardOnly(true);
+    query.prepare(pJob->tableStatement);
+    if (!query.exec()) {
+        if (!pJob->isCanceled()) {
+            LOG_FAILED_QUERY(query);
+        }
+        return false;
+    }
+
+    QSet<TrackId> trackIds;
+    while (query.next()) {
+        if (pJob->rows.size() % kRowsPerCancelCheck == 0 &&
+                pJob->isCanceled()) {
+            return false;
+        }
+        QVector<QVariant> row;
+        row.reserve(pJob->numColumns);
+        for (int i = 0; i < pJob->numColumns; ++i) {
+            row << query.value(i);
+        }
+        trackIds.insert(TrackId(row.first()));
+        pJob->rows.append(row);
+    }
+    // An interrupted query ends like a complete one.
+    if (pJob->isCanceled()) {
+        return false;
+    }
+
+    if (!pJob->filterTable.isEmpty() && !trackIds.isEmpty()) {
+        if (pJob->isCanceled()) {
+            return false;
+        }
+        if (!BaseTrackCache::filterTrackIds(
+                database, pJob->filterTable, pJob->filterIdColumn,
+                pJob->filterCondition, trackIds, pJob->pQueryResult.data(),
+                pJob->queryResultExact, &pJob->matchingTrackIds)) {
+            return false;
+        }
+    }
+
+    pJob->succeeded = !pJob->isCanceled();
+    return pJob->succeeded;
+}
+
+// static
+bool SelectThread::copyTemporaryViews(QSqlDatabase database,
+                                      const QStringList& tableNames,
+                                      SelectJob* pJob) {
+    QSqlQuery query(database);
+    query.prepare("SELECT type, sql FROM sqlite_temp_master WHERE name = :name");
+    for (const auto& tableName: tableNames) {
+        query.bindValue(":name", tableName);
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
+            return false;
+        }
+        if (!query.next()) {
+            // Not a temporary table or view
+            continue;
+        }
+        if (query.value(0).toString() != "view") {
+            return false;
+        }
+        // SQLite stores the statement without the TEMPORARY keyword.
+        QString statement = query.value(1).toString();
+        const QString createView("CREATE VIEW");
+        if (!statement.startsWith(createView, Qt::CaseInsensitive)) {
+            return false;
+        }
+        statement.replace(0, createView.size(), "CREATE TEMPORARY VIEW");
+        pJob->views.insert(tableName, statement);
+    }
+    return true;
+}
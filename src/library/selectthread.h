@@ -0,0 +1,140 @@
+#ifndef SELECTTHREAD_H
+#define SELECTTHREAD_H
+
+#include <QAtomicInt>
+#include <QHash>
+#include <QMetaType>
+#include <QMutex>
+#include <QQueue>
+#include <QSharedPointer>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+#include <QVariant>
+#include <QVector>
+#include <QWaitCondition>
+
+#include "library/basetrackcache.h"
+#include "track/trackid.h"
+#include "util.h"
+#include "util/compatibility.h"
+
+// The SQL queries of a BaseSqlTableModel::select() and their results.
+struct SelectJob {
+    SelectJob()
+            : numColumns(0),
+              queryResultExact(false),
+              queryResultsGeneration(0),
+              succeeded(false),
+              m_canceled(0) {
+    }
+
+    // Cancels the job from any thread. A canceled job stops at the next batch
+    // of rows and is not reported by SelectThread. Use
+    // SelectThread::cancelJob() to also interrupt its queries.
+    void cancel() {
+        m_canceled = 1;
+    }
+    bool isCanceled() const {
+        return load_atomic(m_canceled) != 0;
+    }
+
+    // The CREATE TEMPORARY VIEW statements of the temporary views the queries
+    // read, by name. A new database connection does not know them.
+    QHash<QString, QString> views;
+    // Selects the rows of the table, with numColumns columns and the track id
+    // in the first one.
+    QString tableStatement;
+    int numColumns;
+    // The track source that filters the tracks, see
+    // BaseTrackCache::filterStatement(). filterTable is empty for tables
+    // without a track source.
+    QString filterTable;
+    QString filterIdColumn;
+    QString filterCondition;
+    // A previous result of the search that narrows the tracks to filter,
+    // see BaseTrackCache::filterTrackIds().
+    BaseTrackCache::QueryResultPointer pQueryResult;
+    bool queryResultExact;
+    int queryResultsGeneration;
+
+    // The results
+    bool succeeded;
+    QVector<QVector<QVariant> > rows;
+    // The tracks of rows that match the filter condition
+    QVector<TrackId> matchingTrackIds;
+
+  private:
+    QAtomicInt m_canceled;
+
+    DISALLOW_COPY_AND_ASSIGN(SelectJob);
+};
+
+typedef QSharedPointer<SelectJob> SelectJobPointer;
+
+Q_DECLARE_METATYPE(SelectJobPointer)
+
+struct sqlite3;
+
+// Runs SelectJobs one after another on its own thread and database connection,
+// so that searching and sorting a large library does not block the GUI. The
+// connection is a clone of the one passed to the constructor, with the
+// collation and LIKE function of the TrackCollection installed.
+class SelectThread : public QThread {
+    Q_OBJECT
+  public:
+    explicit SelectThread(const QSqlDatabase& database);
+    virtual ~SelectThread();
+
+    // Queues the job from the GUI thread. jobFinished() is emitted once it
+    // ran, unless it was canceled.
+    void queueJob(SelectJobPointer pJob);
+    // Cancels the job and interrupts its query if it runs, so a superseded
+    // search does not hold up the next one.
+    void cancelJob(const SelectJobPointer& pJob);
+    // Cancels all jobs and stops the thread.
+    void stop();
+
+    // Runs the queries of the job on the calling thread, which has to be the
+    // thread of database. Returns false if a query fails or the job is
+    // canceled.
+    static bool runJob(QSqlDatabase database, SelectJob* pJob);
+
+    // Stores the CREATE statements of the temporary views among tableNames
+    // in pJob->views. Returns false if one of them is a temporary table,
+    // whose rows cannot be seen from another connection.
+    static bool copyTemporaryViews(QSqlDatabase database,
+                                   const QStringList& tableNames,
+                                   SelectJob* pJob);
+
+  signals:
+    void jobFinished(SelectJobPointer pJob);
+
+  protected:
+    void run();
+
+  private:
+    SelectJobPointer dequeueJobBlocking();
+    bool createViews(QSqlDatabase database, const SelectJob& job);
+    // Interrupts the queries on the connection of the thread. Must be called
+    // with m_mutex held.
+    void interruptRunningJob();
+
+    const QSqlDatabase m_templateDatabase;
+
+    QMutex m_mutex;
+    QWaitCondition m_jobQueued;
+    QQueue<SelectJobPointer> m_jobs;
+    // The job that runs, so that stop() can cancel it
+    SelectJobPointer m_pRunningJob;
+    bool m_stop;
+    // The SQLite handle of the connection of the thread while it is open,
+    // guarded by m_mutex
+    sqlite3* m_pHandle;
+
+    // The CREATE statements of the views on the connection of the thread
+    QHash<QString, QString> m_views;
+};
+
+#endif // SELECTTHREAD_H
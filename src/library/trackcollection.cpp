@@ -9,6 +9,7 @@
 
 #include "library/librarytablemodel.h"
 #include "library/schemamanager.h"
+#include "library/searchindex.h"
 #include "trackinfoobject.h"
 #include "util/xml.h"
 #include "util/assert.h"
@@ -47,6 +48,8 @@ TrackCollection::TrackCollection(ConfigObject<ConfigValue>* pConfig)
 
 TrackCollection::~TrackCollection() {
     qDebug() << "~TrackCollection()";
+    // Stops the thread before the database it reads is gone.
+    m_pSelectThread.reset();
     m_trackDao.finish();
 
     if (m_db.isOpen()) {
@@ -156,6 +159,14 @@ QSharedPointer<BaseTrackCache> TrackCollection::getTrackSource() {
     return m_defaultTrackSource;
 }
 
+SelectThread* TrackCollection::getSelectThread() {
+    if (!m_pSelectThread) {
+        m_pSelectThread.reset(new SelectThread(m_db));
+        m_pSelectThread->start();
+    }
+    return m_pSelectThread.data();
+}
+
 void TrackCollection::setTrackSource(QSharedPointer<BaseTrackCache> trackSource) {
     DEBUG_ASSERT_AND_HANDLE(m_defaultTrackSource.isNull()) {
         return;
@@ -271,14 +282,8 @@ void TrackCollection::sqliteLike(sqlite3_context *context,
 
 //static
 void TrackCollection::makeLatinLow(QChar* c, int count) {
-    for (int i = 0; i < count; ++i) {
-        if (c[i].decompositionTag() != QChar::NoDecomposition) {
-            c[i] = c[i].decomposition()[0];
-        }
-        if (c[i].isUpper()) {
-            c[i] = c[i].toLower();
-        }
-    }
+    // Shared with the SearchIndex, which has to fold text the same way.
+    SearchIndex::makeLatinLow(c, count);
 }
 
 //static
@@ -20,6 +20,7 @@
 
 #include <QtSql>
 #include <QList>
+#include <QScopedPointer>
 #include <QSharedPointer>
 #include <QSqlDatabase>
 
@@ -32,6 +33,7 @@
 #include "library/dao/analysisdao.h"
 #include "library/dao/directorydao.h"
 #include "library/dao/libraryhashdao.h"
+#include "library/selectthread.h"
 
 #ifdef __SQLITE3__
 typedef struct sqlite3_context sqlite3_context;
@@ -67,13 +69,22 @@ class TrackCollection : public QObject {
     void setTrackSource(QSharedPointer<BaseTrackCache> trackSource);
     void cancelLibraryScan();
 
+    // The thread that runs the queries of BaseSqlTableModel::selectAsync(),
+    // started on first use.
+    SelectThread* getSelectThread();
+
     ConfigObject<ConfigValue>* getConfig() {
         return m_pConfig;
     }
 
+#ifdef __SQLITE3__
+    // Installs the localeAwareCompare collation and the LIKE function of the
+    // library on a database connection.
+    static void installSorting(QSqlDatabase &db);
+#endif // __SQLITE3__
+
   protected:
 #ifdef __SQLITE3__
-    void installSorting(QSqlDatabase &db);
     static int sqliteLocaleAwareCompare(void* pArg,
                                         int len1, const void* data1,
                                         int len2, const void* data2);
@@ -104,6 +115,7 @@ class TrackCollection : public QObject {
     AnalysisDao m_analysisDao;
     LibraryHashDAO m_libraryHashDao;
     TrackDAO m_trackDao;
+    QScopedPointer<SelectThread> m_pSelectThread;
 };
 
 #endif // TRACKCOLLECTION_H
@@ -240,6 +240,18 @@ int main(int argc, char * argv[])
 \n\
     --locale LOCALE         Use a custom locale for loading translations\n\
                             (e.g 'fr')\n\
+\n\
+    --render TIMELINE       Renders the mix described by the timeline file\n\
+                            to a WAV file and exits, without a sound card.\n\
+                            Each line of the file sets a control:\n\
+                            SECONDS GROUP ITEM VALUE\n\
+                            The [FILE]s are loaded into the decks first.\n\
+\n\
+    --renderOutput FILE     The WAV file --render writes.\n\
+                            Default is mixxx-render.wav\n\
+\n\
+    --renderDuration SECS   How long --render renders. Default is one\n\
+                            second past the last event of the timeline.\n\
 \n\
     -f, --fullScreen        Starts Mixxx in full-screen mode\n\
 \n\
@@ -308,11 +320,17 @@ int main(int argc, char * argv[])
     int result = -1;
 
     if (!(ErrorDialogHandler::instance()->checkError())) {
-        qDebug() << "Displaying mixxx";
-        mixxx->show();
-
-        qDebug() << "Running Mixxx";
-        result = a.exec();
+        if (args.getRenderEnabled()) {
+            qDebug() << "Rendering offline";
+            result = mixxx->renderOffline(args);
+            mixxx->finalize();
+        } else {
+            qDebug() << "Displaying mixxx";
+            mixxx->show();
+
+            qDebug() << "Running Mixxx";
+            result = a.exec();
+        }
     } else {
         mixxx->finalize();
     }
@@ -16,6 +16,7 @@
 ***************************************************************************/
 
 #include <QtDebug>
+#include <QElapsedTimer>
 #include <QTranslator>
 #include <QMenu>
 #include <QMenuBar>
@@ -37,6 +38,7 @@
 #include "dlgdevelopertools.h"
 #include "engine/enginemaster.h"
 #include "engine/enginemicrophone.h"
+#include "engine/offlinerenderer.h"
 #include "effects/effectsmanager.h"
 #include "effects/native/nativebackend.h"
 #include "engine/engineaux.h"
@@ -91,6 +93,10 @@
 const int MixxxMainWindow::kMicrophoneCount = 4;
 // static
 const int MixxxMainWindow::kAuxiliaryCount = 4;
+// static
+const int MixxxMainWindow::kRenderTrackLoadTimeoutMillis = 30000;
+// static
+const double MixxxMainWindow::kRenderTailSeconds = 1.0;
 
 MixxxMainWindow::MixxxMainWindow(QApplication* pApp, const CmdlineArgs& args)
         : m_pWidgetParent(NULL),
@@ -156,6 +162,7 @@ void MixxxMainWindow::initalize(QApplication* pApp, const CmdlineArgs& args) {
     qRegisterMetaType<TrackId>("TrackId");
     qRegisterMetaType<QSet<TrackId>>("QSet<TrackId>");
     qRegisterMetaType<TrackPointer>("TrackPointer");
+    qRegisterMetaType<QList<TrackPointer>>("QList<TrackPointer>");
 
     ScopedTimer t("MixxxMainWindow::MixxxMainWindow");
     m_runtime_timer.start();
@@ -484,8 +491,13 @@ void MixxxMainWindow::initalize(QApplication* pApp, const CmdlineArgs& args) {
     slotNumDecksChanged(m_pNumDecks->get());
 
     // Try open player device If that fails, the preference panel is opened.
-    int setupDevices = m_pSoundManager->setupDevices();
-    unsigned int numDevices = m_pSoundManager->getConfig().getOutputs().count();
+    // An offline render drives the engine itself.
+    int setupDevices = OK;
+    unsigned int numDevices = 1;
+    if (!args.getRenderEnabled()) {
+        setupDevices = m_pSoundManager->setupDevices();
+        numDevices = m_pSoundManager->getConfig().getOutputs().count();
+    }
     // test for at least one out device, if none, display another dlg that
     // says "mixxx will barely work with no outs"
     while (setupDevices != OK || numDevices == 0) {
@@ -528,6 +540,68 @@ void MixxxMainWindow::initalize(QApplication* pApp, const CmdlineArgs& args) {
     // The old central widget is automatically disposed.
 }
 
+int MixxxMainWindow::renderOffline(const CmdlineArgs& args) {
+    OfflineRenderTimeline timeline;
+    QString error;
+    if (!timeline.load(args.getRenderTimelinePath(), &error)) {
+        qWarning() << "Could not load the render timeline" << error;
+        return 1;
+    }
+    double duration = args.getRenderDuration();
+    if (duration <= 0.0 && !timeline.events().isEmpty()) {
+        // The last event is applied at the end of the render otherwise
+        duration = timeline.events().last().seconds + kRenderTailSeconds;
+    }
+    if (duration <= 0.0) {
+        qWarning() << "Nothing to render, use --renderDuration SECONDS";
+        return 1;
+    }
+
+    const SoundManagerConfig config = m_pSoundManager->getConfig();
+    const int sampleRate = config.getSampleRate();
+    OfflineRenderer renderer(m_pEngine, sampleRate, config.getFramesPerBuffer());
+
+    // The decks load their tracks while the engine runs, and finish loading
+    // on this thread.
+    const QList<QString>& musicFiles = args.getMusicFiles();
+    QList<Deck*> loadingDecks;
+    for (int i = 0; i < (int)m_pPlayerManager->numDecks()
+            && i < musicFiles.count(); ++i) {
+        if (SoundSourceProxy::isFileNameSupported(musicFiles.at(i))) {
+            loadingDecks.append(m_pPlayerManager->getDeck(i + 1));
+        }
+    }
+    QElapsedTimer loadTimer;
+    loadTimer.start();
+    while (!loadingDecks.isEmpty()) {
+        if (loadingDecks.first()->getLoadedTrack()) {
+            loadingDecks.removeFirst();
+            continue;
+        }
+        if (loadTimer.elapsed() > kRenderTrackLoadTimeoutMillis) {
+            qWarning() << "Timed out loading the tracks to render";
+            return 1;
+        }
+        renderer.skipBuffer();
+        QCoreApplication::processEvents();
+    }
+
+    OfflineRenderFileSink sink(args.getRenderOutputPath(), sampleRate);
+    if (!sink.isOpen()) {
+        qWarning() << "Could not open" << args.getRenderOutputPath()
+                   << sink.getError();
+        return 1;
+    }
+    if (!renderer.render(timeline, duration, &sink)) {
+        qWarning() << "Rendering" << args.getRenderOutputPath() << "failed"
+                   << sink.getError();
+        return 1;
+    }
+    qDebug() << "Rendered" << duration << "seconds to"
+             << args.getRenderOutputPath();
+    return 0;
+}
+
 void MixxxMainWindow::finalize() {
     // TODO(rryan): Get rid of QTime here.
     QTime qTime;
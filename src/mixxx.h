@@ -71,6 +71,11 @@ class MixxxMainWindow : public QMainWindow {
     void initalize(QApplication *app, const CmdlineArgs& args);
     void finalize();
 
+    // Renders the timeline given with --render once the music files of the
+    // command line are loaded into the decks and writes the master output to
+    // --renderOutput. Returns the exit code of Mixxx.
+    int renderOffline(const CmdlineArgs& args);
+
     // initializes all QActions of the application
     void initActions();
     // creates the menu_bar and inserts the file Menu
@@ -332,6 +337,11 @@ class MixxxMainWindow : public QMainWindow {
 
     static const int kMicrophoneCount;
     static const int kAuxiliaryCount;
+    // How long renderOffline() waits for the decks to load their tracks
+    static const int kRenderTrackLoadTimeoutMillis;
+    // How long renderOffline() renders past the last event of the timeline if
+    // no duration is given, so the effect of the last event is audible
+    static const double kRenderTailSeconds;
 };
 
 #endif
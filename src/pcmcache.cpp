@@ -0,0 +1,344 @@
+#include <QDir>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QtAlgorithms>
+#include <QtDebug>
+
+#include <cstring>
+
+#include "pcmcache.h"
+#include "sources/audiosourcepcmcache.h"
+#include "util/math.h"
+
+namespace {
+
+const char* kFileSuffix = ".pcm";
+const char* kTempFileSuffix = ".pcm.tmp";
+
+// Returns the time of last use from the header of a cache file or 0 if the
+// file is unreadable, so it is evicted first.
+qint64 readLastUsed(const QString& fileName) {
+    QFile file(fileName);
+    Mixxx::PcmCacheFileHeader header;
+    if (!file.open(QIODevice::ReadOnly) ||
+            file.read(reinterpret_cast<char*>(&header), sizeof(header)) !=
+                    sizeof(header) ||
+            memcmp(header.magic, Mixxx::PcmCacheFileHeader::kMagic,
+                   sizeof(header.magic)) != 0 ||
+            header.version != Mixxx::PcmCacheFileHeader::kVersion) {
+        return 0;
+    }
+    return header.lastUsed;
+}
+
+// The size and the time of last use of the files of every cache directory,
+// shared by all PcmCache instances. The headers of a directory are only read
+// when it is used for the first time, after that the index is kept up to date
+// by the instances.
+class PcmCacheIndex {
+  public:
+    static PcmCacheIndex& instance() {
+        static PcmCacheIndex s_index;
+        return s_index;
+    }
+
+    // Records that fileName has just been written or opened for reading.
+    void touch(const QString& directory, const QString& fileName) {
+        QMutexLocker locker(&m_mutex);
+        Directory& dir = loadDirectory(directory);
+        CacheFile& file = dir.files[fileName];
+        dir.totalSize -= file.size;
+        file.size = QFileInfo(fileName).size();
+        dir.totalSize += file.size;
+        // Strictly increasing, so the order of use is kept even if files are
+        // used within the same millisecond.
+        dir.lastUsed = math_max(
+                QDateTime::currentDateTime().toMSecsSinceEpoch(),
+                dir.lastUsed + 1);
+        file.lastUsed = dir.lastUsed;
+    }
+
+    // Deletes the least recently used files of the directory until its total
+    // size is at most maxSizeBytes. keepFileName is never deleted.
+    void evict(const QString& directory, qint64 maxSizeBytes,
+               const QString& keepFileName) {
+        QMutexLocker locker(&m_mutex);
+        Directory& dir = loadDirectory(directory);
+        if (dir.totalSize <= maxSizeBytes) {
+            return;
+        }
+        QList<LruEntry> entries;
+        for (QHash<QString, CacheFile>::const_iterator it = dir.files.constBegin();
+                it != dir.files.constEnd(); ++it) {
+            LruEntry entry;
+            entry.fileName = it.key();
+            entry.lastUsed = it.value().lastUsed;
+            entries.append(entry);
+        }
+        qSort(entries);
+        for (int i = 0; i < entries.size() && dir.totalSize > maxSizeBytes; ++i) {
+            const QString& fileName = entries[i].fileName;
+            if (fileName == keepFileName) {
+                continue;
+            }
+            // Fails on some platforms while the file is still mapped by a
+            // reader. It will be deleted by one of the next evictions then.
+            // Files that have been deleted by someone else are forgotten.
+            if (QFile::remove(fileName) || !QFile::exists(fileName)) {
+                dir.totalSize -= dir.files.value(fileName).size;
+                dir.files.remove(fileName);
+            }
+        }
+    }
+
+  private:
+    struct CacheFile {
+        CacheFile()
+                : size(0),
+                  lastUsed(0) {
+        }
+        qint64 size;
+        qint64 lastUsed;
+    };
+
+    struct LruEntry {
+        QString fileName;
+        qint64 lastUsed;
+
+        bool operator<(const LruEntry& other) const {
+            return lastUsed < other.lastUsed;
+        }
+    };
+
+    struct Directory {
+        Directory()
+                : loaded(false),
+                  totalSize(0),
+                  lastUsed(0) {
+        }
+        bool loaded;
+        QHash<QString, CacheFile> files;
+        qint64 totalSize;
+        // The latest time of last use of all files
+        qint64 lastUsed;
+    };
+
+    // Reads the headers of all files on first use. Needs m_mutex.
+    Directory& loadDirectory(const QString& directory) {
+        Directory& dir = m_directories[directory];
+        if (dir.loaded) {
+            return dir;
+        }
+        dir.loaded = true;
+        const QFileInfoList fileInfos = QDir(directory).entryInfoList(
+                QStringList() << QString("*") + kFileSuffix, QDir::Files);
+        foreach (const QFileInfo& fileInfo, fileInfos) {
+            CacheFile file;
+            file.size = fileInfo.size();
+            file.lastUsed = readLastUsed(fileInfo.absoluteFilePath());
+            dir.files.insert(fileInfo.absoluteFilePath(), file);
+            dir.totalSize += file.size;
+            dir.lastUsed = math_max(dir.lastUsed, file.lastUsed);
+        }
+        return dir;
+    }
+
+    QMutex m_mutex;
+    QHash<QString, Directory> m_directories;
+};
+
+} // anonymous namespace
+
+// Holds about 20 tracks of 10 minutes at 44.1 kHz.
+// static
+const int PcmCache::kDefaultSizeMB = 4096;
+
+PcmCache::PcmCache(ConfigObject<ConfigValue>* pConfig)
+        : m_maxSizeBytes(0) {
+    if (pConfig == nullptr) {
+        return;
+    }
+    const bool enabled = pConfig->getValueString(
+            ConfigKey("[Master]", "pcm_cache_enabled"), "0").toInt() != 0;
+    if (!enabled) {
+        return;
+    }
+    m_directory = QDir(pConfig->getSettingsPath()).absoluteFilePath("pcmcache");
+    m_maxSizeBytes = static_cast<qint64>(pConfig->getValueString(
+            ConfigKey("[Master]", "pcm_cache_size_mb"),
+            QString::number(kDefaultSizeMB)).toInt()) * 1024 * 1024;
+}
+
+PcmCache::PcmCache(const QString& directory, qint64 maxSizeBytes)
+        : m_directory(directory),
+          m_maxSizeBytes(maxSizeBytes) {
+}
+
+// static
+QString PcmCache::keyForTrack(const TrackPointer& pTrack) {
+    if (!pTrack || !pTrack->getId().isValid()) {
+        return QString();
+    }
+    return pTrack->getId().toString();
+}
+
+QString PcmCache::fileNameForKey(const QString& key) const {
+    return QDir(m_directory).absoluteFilePath(key + kFileSuffix);
+}
+
+Mixxx::AudioSourcePointer PcmCache::openAudioSource(
+        const TrackPointer& pTrack) const {
+    const QString key(keyForTrack(pTrack));
+    if (!isEnabled() || key.isEmpty()) {
+        return Mixxx::AudioSourcePointer();
+    }
+    return openAudioSource(key, pTrack->getFileModifiedTime(),
+            QUrl::fromLocalFile(pTrack->getLocation()));
+}
+
+Mixxx::AudioSourcePointer PcmCache::openAudioSource(
+        const QString& key, const QDateTime& sourceModified,
+        const QUrl& url) const {
+    if (!isEnabled()) {
+        return Mixxx::AudioSourcePointer();
+    }
+    const QString fileName(fileNameForKey(key));
+    if (!QFile::exists(fileName)) {
+        return Mixxx::AudioSourcePointer();
+    }
+    QSharedPointer<Mixxx::AudioSourcePcmCache> pAudioSource(
+            new Mixxx::AudioSourcePcmCache(url));
+    if (pAudioSource->open(fileName, sourceModified.toMSecsSinceEpoch()) != OK) {
+        // Outdated or corrupt, it will be replaced by the next analysis.
+        return Mixxx::AudioSourcePointer();
+    }
+    PcmCacheIndex::instance().touch(m_directory, fileName);
+    return pAudioSource;
+}
+
+PcmCacheWriter* PcmCache::createWriter(const TrackPointer& pTrack,
+                                       SINT frameRate) const {
+    const QString key(keyForTrack(pTrack));
+    if (!isEnabled() || key.isEmpty()) {
+        return nullptr;
+    }
+    return createWriter(key, pTrack->getFileModifiedTime(), frameRate);
+}
+
+PcmCacheWriter* PcmCache::createWriter(const QString& key,
+                                       const QDateTime& sourceModified,
+                                       SINT frameRate) const {
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    if (!openAudioSource(key, sourceModified, QUrl()).isNull()) {
+        // Already cached
+        return nullptr;
+    }
+    if (!QDir().mkpath(m_directory)) {
+        qWarning() << "Failed to create PCM cache directory" << m_directory;
+        return nullptr;
+    }
+    PcmCacheWriter* pWriter = new PcmCacheWriter(
+            *this, fileNameForKey(key), sourceModified, frameRate);
+    if (pWriter->m_bFailed) {
+        delete pWriter;
+        return nullptr;
+    }
+    return pWriter;
+}
+
+void PcmCache::evict(const QString& keepFileName) const {
+    PcmCacheIndex::instance().evict(m_directory, m_maxSizeBytes, keepFileName);
+}
+
+PcmCacheWriter::PcmCacheWriter(const PcmCache& cache, const QString& fileName,
+                               const QDateTime& sourceModified, SINT frameRate)
+        : m_cache(cache),
+          m_fileName(fileName),
+          m_sourceModified(sourceModified.toMSecsSinceEpoch()),
+          m_frameRate(frameRate),
+          m_file(fileName.left(fileName.size() - static_cast<int>(strlen(kFileSuffix))) +
+                 kTempFileSuffix),
+          m_frameCount(0),
+          m_bFailed(false) {
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate) ||
+            !writeHeader()) {
+        qWarning() << "Failed to create PCM cache file" << m_file.fileName()
+                   << m_file.errorString();
+        abort();
+    }
+}
+
+PcmCacheWriter::~PcmCacheWriter() {
+    if (m_file.isOpen()) {
+        abort();
+    }
+}
+
+bool PcmCacheWriter::writeHeader() {
+    Mixxx::PcmCacheFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, Mixxx::PcmCacheFileHeader::kMagic, sizeof(header.magic));
+    header.version = Mixxx::PcmCacheFileHeader::kVersion;
+    header.channelCount = Mixxx::AudioSource::kChannelCountStereo;
+    header.frameRate = m_frameRate;
+    header.sampleSize = sizeof(CSAMPLE);
+    header.frameCount = m_frameCount;
+    header.sourceModified = m_sourceModified;
+    header.lastUsed = QDateTime::currentDateTime().toMSecsSinceEpoch();
+    return m_file.seek(0) &&
+            m_file.write(reinterpret_cast<const char*>(&header),
+                    sizeof(header)) == sizeof(header);
+}
+
+bool PcmCacheWriter::write(const CSAMPLE* pFrames, SINT frameCount) {
+    if (m_bFailed) {
+        return false;
+    }
+    const qint64 bytes = frameCount *
+            Mixxx::AudioSource::kChannelCountStereo * sizeof(CSAMPLE);
+    if (m_file.write(reinterpret_cast<const char*>(pFrames), bytes) != bytes) {
+        qWarning() << "Failed to write PCM cache file" << m_file.fileName()
+                   << m_file.errorString();
+        abort();
+        return false;
+    }
+    m_frameCount += frameCount;
+    return true;
+}
+
+bool PcmCacheWriter::commit(SINT frameCount) {
+    if (m_bFailed) {
+        return false;
+    }
+    if (m_frameCount != frameCount) {
+        qWarning() << "Discarding incomplete PCM cache file" << m_file.fileName()
+                   << m_frameCount << "of" << frameCount << "frames";
+        abort();
+        return false;
+    }
+    // The header is written again with the final frame count.
+    if (!writeHeader()) {
+        abort();
+        return false;
+    }
+    m_file.close();
+    QFile::remove(m_fileName);
+    if (!QFile::rename(m_file.fileName(), m_fileName)) {
+        qWarning() << "Failed to rename PCM cache file" << m_file.fileName();
+        abort();
+        return false;
+    }
+    PcmCacheIndex::instance().touch(m_cache.m_directory, m_fileName);
+    m_cache.evict(m_fileName);
+    return true;
+}
+
+void PcmCacheWriter::abort() {
+    m_bFailed = true;
+    m_file.close();
+    m_file.remove();
+}
@@ -0,0 +1,108 @@
+#ifndef PCMCACHE_H
+#define PCMCACHE_H
+
+#include <QDateTime>
+#include <QFile>
+#include <QString>
+
+#include "configobject.h"
+#include "trackinfoobject.h"
+#include "sources/audiosource.h"
+
+class PcmCacheWriter;
+
+// PcmCache stores the fully decoded audio of tracks on disk so that loading
+// and seeking does not have to go through the (possibly slow and inexact)
+// decoder again. The files are filled by the AnalyserQueue, which decodes the
+// whole track anyway, and are read through a memory mapped
+// Mixxx::AudioSourcePcmCache by the CachingReaderWorker.
+//
+// Files are named after the track id and are only valid as long as the
+// modification time of the track file matches. The total size of the cache
+// is bounded; if it is exceeded the least recently used files are deleted.
+//
+// The cache is disabled by default and configured with
+// [Master],pcm_cache_enabled and [Master],pcm_cache_size_mb.
+//
+// The class holds no state besides its configuration, so every thread that
+// needs it creates its own instance. The in-memory index of the cache files
+// that evict() uses is shared by all instances.
+class PcmCache {
+  public:
+    static const int kDefaultSizeMB;
+
+    explicit PcmCache(ConfigObject<ConfigValue>* pConfig);
+    PcmCache(const QString& directory, qint64 maxSizeBytes);
+
+    bool isEnabled() const {
+        return m_maxSizeBytes > 0;
+    }
+
+    // Returns an audio source that reads the cached samples of the track or
+    // a null pointer if the track is not cached.
+    Mixxx::AudioSourcePointer openAudioSource(const TrackPointer& pTrack) const;
+    Mixxx::AudioSourcePointer openAudioSource(
+            const QString& key, const QDateTime& sourceModified,
+            const QUrl& url) const;
+
+    // Returns a writer for the decoded samples of the track or nullptr if the
+    // cache is disabled or the track is already cached. The caller owns the
+    // writer.
+    PcmCacheWriter* createWriter(const TrackPointer& pTrack,
+                                 SINT frameRate) const;
+    PcmCacheWriter* createWriter(const QString& key,
+                                 const QDateTime& sourceModified,
+                                 SINT frameRate) const;
+
+    // Deletes the least recently used files until the cache fits into its
+    // size again. The file named keepFileName is never deleted. The sizes
+    // and times of last use are kept in memory, so only the first call per
+    // directory reads the headers of the files.
+    void evict(const QString& keepFileName = QString()) const;
+
+    // Returns the key of the track or an empty string if the track cannot
+    // be cached.
+    static QString keyForTrack(const TrackPointer& pTrack);
+
+  private:
+    QString fileNameForKey(const QString& key) const;
+
+    QString m_directory;
+    qint64 m_maxSizeBytes;
+
+    friend class PcmCacheWriter;
+};
+
+// Writes the decoded samples of a single track into a temporary file that
+// replaces the cache file on commit(). The file is discarded if the writer is
+// deleted without being committed.
+class PcmCacheWriter {
+  public:
+    ~PcmCacheWriter();
+
+    // Appends frameCount interleaved stereo frames.
+    bool write(const CSAMPLE* pFrames, SINT frameCount);
+
+    // Completes the cache file and makes it available for reading. Discards
+    // the file instead if not exactly frameCount frames have been written,
+    // e.g. because the decoder failed in the middle of the track.
+    bool commit(SINT frameCount);
+
+  private:
+    PcmCacheWriter(const PcmCache& cache, const QString& fileName,
+                   const QDateTime& sourceModified, SINT frameRate);
+    bool writeHeader();
+    void abort();
+
+    const PcmCache m_cache;
+    const QString m_fileName;
+    const qint64 m_sourceModified;
+    const SINT m_frameRate;
+    QFile m_file;
+    SINT m_frameCount;
+    bool m_bFailed;
+
+    friend class PcmCache;
+};
+
+#endif /* PCMCACHE_H */
@@ -4,6 +4,8 @@
 #include <cstdlib>
 
 #include "sampleutil.h"
+#include "sampleutil_kernels.h"
+#include "util/cpufeatures.h"
 #include "util/math.h"
 
 #ifdef __WINDOWS__
@@ -92,6 +94,349 @@ void SampleUtil::free(CSAMPLE* pBuffer) {
     }
 }
 
+namespace {
+
+// The scalar reference implementations of the SampleUtilKernels. They are
+// used if the CPU supports none of the SIMD instruction sets and are
+// auto-vectorized by the compiler for the target of the build.
+
+void scalarApplyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+void scalarApplyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN start_gain,
+        CSAMPLE_GAIN gain_delta, int iNumFrames) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumFrames; ++i) {
+        const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+        // a loop counter i += 2 prevents vectorizing.
+        pBuffer[i * 2] *= gain;
+        pBuffer[i * 2 + 1] *= gain;
+    }
+}
+
+void scalarCopyWithGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT pSrc,
+        CSAMPLE_GAIN gain, int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void scalarCopyWithRampingGain(CSAMPLE* _RESTRICT pDest,
+        const CSAMPLE* _RESTRICT pSrc, CSAMPLE_GAIN start_gain,
+        CSAMPLE_GAIN gain_delta, int iNumFrames) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumFrames; ++i) {
+        const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+        pDest[i * 2] = pSrc[i * 2] * gain;
+        pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
+    }
+}
+
+void scalarAddWithGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT pSrc,
+        CSAMPLE_GAIN gain, int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void scalarAddWithRampingGain(CSAMPLE* _RESTRICT pDest,
+        const CSAMPLE* _RESTRICT pSrc, CSAMPLE_GAIN start_gain,
+        CSAMPLE_GAIN gain_delta, int iNumFrames) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumFrames; ++i) {
+        const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
+        pDest[i * 2] += pSrc[i * 2] * gain;
+        pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
+    }
+}
+
+void scalarSumAbsPerChannel(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
+        CSAMPLE* pfPeakL, CSAMPLE* pfPeakR,
+        const CSAMPLE* pBuffer, int iNumFrames) {
+    CSAMPLE fAbsL = CSAMPLE_ZERO;
+    CSAMPLE fAbsR = CSAMPLE_ZERO;
+    CSAMPLE fPeakL = CSAMPLE_ZERO;
+    CSAMPLE fPeakR = CSAMPLE_ZERO;
+
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumFrames; ++i) {
+        CSAMPLE absl = fabs(pBuffer[i * 2]);
+        fAbsL += absl;
+        fPeakL = math_max(fPeakL, absl);
+        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
+        fAbsR += absr;
+        fPeakR = math_max(fPeakR, absr);
+    }
+
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    *pfPeakL = fPeakL;
+    *pfPeakR = fPeakR;
+}
+
+void scalarCopyClampBuffer(CSAMPLE* _RESTRICT pDest,
+        const CSAMPLE* _RESTRICT pSrc, int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = SampleUtil::clampSample(pSrc[i]);
+    }
+}
+
+void scalarConvertS16ToFloat32(CSAMPLE* _RESTRICT pDest,
+        const SAMPLE* _RESTRICT pSrc, int iNumSamples) {
+    // SAMPLE_MIN = -32768 is a valid low sample, whereas SAMPLE_MAX = 32767
+    // is the highest valid sample. Note that this means that although some
+    // sample values convert to -1.0, none will convert to +1.0.
+    DEBUG_ASSERT(-SAMPLE_MIN >= SAMPLE_MAX);
+    const CSAMPLE kConversionFactor = -SAMPLE_MIN;
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[i] = CSAMPLE(pSrc[i]) / kConversionFactor;
+    }
+}
+
+void scalarInterleaveBuffer(CSAMPLE* _RESTRICT pDest,
+        const CSAMPLE* _RESTRICT pSrc1, const CSAMPLE* _RESTRICT pSrc2,
+        int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void scalarDeinterleaveBuffer(CSAMPLE* pDest1, CSAMPLE* pDest2,
+        const CSAMPLE* pSrc, int iNumSamples) {
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+// The products are summed up in the order of the sources like in the
+// copyNWithGain() functions, so the results are the same.
+template<int kSources, bool kAdd>
+void scalarMixGroupWithGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain, int iNumSamples) {
+    // Local copies, pDest cannot be an alias of them.
+    const CSAMPLE* src[kSources];
+    CSAMPLE_GAIN gain[kSources];
+    for (int j = 0; j < kSources; ++j) {
+        src[j] = pSrc[j];
+        gain[j] = pGain[j];
+    }
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples; ++i) {
+        CSAMPLE sum = kAdd ? pDest[i] : CSAMPLE_ZERO;
+        for (int j = 0; j < kSources; ++j) {
+            sum += src[j][i] * gain[j];
+        }
+        pDest[i] = sum;
+    }
+}
+
+void scalarMixGroupWithGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain, int numSources, bool add,
+        int iNumSamples) {
+    switch (add ? numSources + kSampleUtilMixGroupSize : numSources) {
+    case 1:
+        scalarMixGroupWithGain<1, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 2:
+        scalarMixGroupWithGain<2, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 3:
+        scalarMixGroupWithGain<3, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 4:
+        scalarMixGroupWithGain<4, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 5:
+        scalarMixGroupWithGain<1, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 6:
+        scalarMixGroupWithGain<2, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 7:
+        scalarMixGroupWithGain<3, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 8:
+        scalarMixGroupWithGain<4, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    }
+}
+
+template<int kSources, bool kAdd>
+void scalarMixGroupWithRampingGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pStartGain, const CSAMPLE_GAIN* pGainDelta,
+        int firstFrame, int iNumFrames) {
+    const CSAMPLE* src[kSources];
+    CSAMPLE_GAIN start_gain[kSources];
+    CSAMPLE_GAIN gain_delta[kSources];
+    for (int j = 0; j < kSources; ++j) {
+        src[j] = pSrc[j];
+        start_gain[j] = pStartGain[j];
+        gain_delta[j] = pGainDelta[j];
+    }
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumFrames; ++i) {
+        const int frame = firstFrame + i;
+        CSAMPLE sumL = kAdd ? pDest[i * 2] : CSAMPLE_ZERO;
+        CSAMPLE sumR = kAdd ? pDest[i * 2 + 1] : CSAMPLE_ZERO;
+        for (int j = 0; j < kSources; ++j) {
+            const CSAMPLE_GAIN gain = start_gain[j] + gain_delta[j] * frame;
+            sumL += src[j][i * 2] * gain;
+            sumR += src[j][i * 2 + 1] * gain;
+        }
+        pDest[i * 2] = sumL;
+        pDest[i * 2 + 1] = sumR;
+    }
+}
+
+void scalarMixGroupWithRampingGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pStartGain, const CSAMPLE_GAIN* pGainDelta,
+        int numSources, bool add, int firstFrame, int iNumFrames) {
+    switch (add ? numSources + kSampleUtilMixGroupSize : numSources) {
+    case 1:
+        scalarMixGroupWithRampingGain<1, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 2:
+        scalarMixGroupWithRampingGain<2, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 3:
+        scalarMixGroupWithRampingGain<3, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 4:
+        scalarMixGroupWithRampingGain<4, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 5:
+        scalarMixGroupWithRampingGain<1, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 6:
+        scalarMixGroupWithRampingGain<2, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 7:
+        scalarMixGroupWithRampingGain<3, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 8:
+        scalarMixGroupWithRampingGain<4, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    }
+}
+
+const SampleUtilKernels kScalarKernels = {
+    &scalarApplyGain,
+    &scalarApplyRampingGain,
+    &scalarCopyWithGain,
+    &scalarCopyWithRampingGain,
+    &scalarAddWithGain,
+    &scalarAddWithRampingGain,
+    &scalarSumAbsPerChannel,
+    &scalarCopyClampBuffer,
+    &scalarConvertS16ToFloat32,
+    &scalarInterleaveBuffer,
+    &scalarDeinterleaveBuffer,
+    &scalarMixGroupWithGain,
+    &scalarMixGroupWithRampingGain,
+};
+
+const char* kIsaNames[SampleUtil::ISA_COUNT] = {
+    "scalar",
+    "SSE2",
+    "AVX2",
+    "AVX-512",
+    "NEON",
+};
+
+// Returns NULL if isa is not supported by the build or the CPU.
+const SampleUtilKernels* kernelsForIsa(SampleUtil::Isa isa) {
+    switch (isa) {
+    case SampleUtil::ISA_SCALAR:
+        return &kScalarKernels;
+    case SampleUtil::ISA_SSE2:
+        return CpuFeatures::hasSse2() ? sampleUtilKernelsSse2() : NULL;
+    case SampleUtil::ISA_AVX2:
+        return CpuFeatures::hasAvx2() ? sampleUtilKernelsAvx2() : NULL;
+    case SampleUtil::ISA_AVX512:
+        return CpuFeatures::hasAvx512f() ? sampleUtilKernelsAvx512() : NULL;
+    case SampleUtil::ISA_NEON:
+        return CpuFeatures::hasNeon() ? sampleUtilKernelsNeon() : NULL;
+    default:
+        return NULL;
+    }
+}
+
+// Statically initialized, so the scalar kernels are used if SampleUtil is
+// called by a static initializer that runs before s_isaSelector.
+const SampleUtilKernels* s_pKernels = &kScalarKernels;
+SampleUtil::Isa s_isa = SampleUtil::ISA_SCALAR;
+
+class IsaSelector {
+  public:
+    IsaSelector() {
+        // Preferred first
+        const SampleUtil::Isa isas[] = {
+            SampleUtil::ISA_AVX512,
+            SampleUtil::ISA_AVX2,
+            SampleUtil::ISA_NEON,
+            SampleUtil::ISA_SSE2,
+        };
+        for (unsigned int i = 0; i < sizeof(isas) / sizeof(isas[0]); ++i) {
+            if (SampleUtil::setIsa(isas[i])) {
+                return;
+            }
+        }
+    }
+};
+
+const IsaSelector s_isaSelector;
+
+} // anonymous namespace
+
+// static
+bool SampleUtil::isIsaSupported(Isa isa) {
+    return kernelsForIsa(isa) != NULL;
+}
+
+// static
+SampleUtil::Isa SampleUtil::getIsa() {
+    return s_isa;
+}
+
+// static
+bool SampleUtil::setIsa(Isa isa) {
+    const SampleUtilKernels* pKernels = kernelsForIsa(isa);
+    if (pKernels == NULL) {
+        return false;
+    }
+    s_pKernels = pKernels;
+    s_isa = isa;
+    return true;
+}
+
+// static
+const char* SampleUtil::isaName(Isa isa) {
+    if (isa < 0 || isa >= ISA_COUNT) {
+        return "unknown";
+    }
+    return kIsaNames[isa];
+}
+
 // static
 void SampleUtil::applyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain,
         int iNumSamples) {
@@ -102,10 +447,7 @@ void SampleUtil::applyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pBuffer[i] *= gain;
-    }
+    s_pKernels->applyGain(pBuffer, gain, iNumSamples);
 }
 
 // static
@@ -123,18 +465,10 @@ void SampleUtil::applyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN old_gain,
             / CSAMPLE_GAIN(iNumSamples / 2);
     if (gain_delta) {
         const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < iNumSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            // a loop counter i += 2 prevents vectorizing.
-            pBuffer[i * 2] *= gain;
-            pBuffer[i * 2 + 1] *= gain;
-        }
+        s_pKernels->applyRampingGain(pBuffer, start_gain, gain_delta,
+                iNumSamples / 2);
     } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < iNumSamples; ++i) {
-            pBuffer[i] *= old_gain;
-        }
+        s_pKernels->applyGain(pBuffer, old_gain, iNumSamples);
     }
 }
 
@@ -160,10 +494,7 @@ void SampleUtil::addWithGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] += pSrc[i] * gain;
-    }
+    s_pKernels->addWithGain(pDest, pSrc, gain, iNumSamples);
 }
 
 void SampleUtil::addWithRampingGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT pSrc,
@@ -177,17 +508,10 @@ void SampleUtil::addWithRampingGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RE
             / CSAMPLE_GAIN(iNumSamples / 2);
     if (gain_delta) {
         const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < iNumSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] += pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
-        }
+        s_pKernels->addWithRampingGain(pDest, pSrc, start_gain, gain_delta,
+                iNumSamples / 2);
     } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < iNumSamples; ++i) {
-            pDest[i] += pSrc[i] * old_gain;
-        }
+        s_pKernels->addWithGain(pDest, pSrc, old_gain, iNumSamples);
     }
 }
 
@@ -225,6 +549,92 @@ void SampleUtil::add3WithGain(CSAMPLE* pDest, const CSAMPLE* _RESTRICT pSrc1,
     }
 }
 
+namespace {
+
+// The output is mixed in blocks of 64 stereo frames (512 bytes) that stay in
+// the L1 cache while all sources are added. The sources are added in groups,
+// so each group costs only a single pass over the block.
+const int kMixBlockSamples = 128;
+
+} // anonymous namespace
+
+// static
+void SampleUtil::mixWithGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain, int numSources, int iNumSamples) {
+    for (int blockStart = 0; blockStart < iNumSamples;
+            blockStart += kMixBlockSamples) {
+        const int blockSamples = math_min(kMixBlockSamples,
+                iNumSamples - blockStart);
+        CSAMPLE* pDestBlock = pDest + blockStart;
+        const CSAMPLE* groupSrc[kSampleUtilMixGroupSize];
+        CSAMPLE_GAIN groupGain[kSampleUtilMixGroupSize];
+        int groupSize = 0;
+        bool add = false;
+        for (int i = 0; i < numSources; ++i) {
+            if (pGain[i] == CSAMPLE_GAIN_ZERO) {
+                continue;
+            }
+            groupSrc[groupSize] = pSrc[i] + blockStart;
+            groupGain[groupSize] = pGain[i];
+            if (++groupSize == kSampleUtilMixGroupSize) {
+                s_pKernels->mixGroupWithGain(pDestBlock, groupSrc, groupGain,
+                        groupSize, add, blockSamples);
+                groupSize = 0;
+                add = true;
+            }
+        }
+        if (groupSize > 0) {
+            s_pKernels->mixGroupWithGain(pDestBlock, groupSrc, groupGain,
+                    groupSize, add, blockSamples);
+        } else if (!add) {
+            clear(pDestBlock, blockSamples);
+        }
+    }
+}
+
+// static
+void SampleUtil::mixWithRampingGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pOldGain, const CSAMPLE_GAIN* pNewGain,
+        int numSources, int iNumSamples) {
+    for (int blockStart = 0; blockStart < iNumSamples;
+            blockStart += kMixBlockSamples) {
+        const int blockSamples = math_min(kMixBlockSamples,
+                iNumSamples - blockStart);
+        CSAMPLE* pDestBlock = pDest + blockStart;
+        const int firstFrame = blockStart / 2;
+        const CSAMPLE* groupSrc[kSampleUtilMixGroupSize];
+        CSAMPLE_GAIN groupStartGain[kSampleUtilMixGroupSize];
+        CSAMPLE_GAIN groupGainDelta[kSampleUtilMixGroupSize];
+        int groupSize = 0;
+        bool add = false;
+        for (int i = 0; i < numSources; ++i) {
+            if (pOldGain[i] == CSAMPLE_GAIN_ZERO &&
+                    pNewGain[i] == CSAMPLE_GAIN_ZERO) {
+                continue;
+            }
+            const CSAMPLE_GAIN gain_delta = (pNewGain[i] - pOldGain[i])
+                    / CSAMPLE_GAIN(iNumSamples / 2);
+            groupSrc[groupSize] = pSrc[i] + blockStart;
+            groupStartGain[groupSize] = pOldGain[i] + gain_delta;
+            groupGainDelta[groupSize] = gain_delta;
+            if (++groupSize == kSampleUtilMixGroupSize) {
+                s_pKernels->mixGroupWithRampingGain(pDestBlock, groupSrc,
+                        groupStartGain, groupGainDelta, groupSize, add,
+                        firstFrame, blockSamples / 2);
+                groupSize = 0;
+                add = true;
+            }
+        }
+        if (groupSize > 0) {
+            s_pKernels->mixGroupWithRampingGain(pDestBlock, groupSrc,
+                    groupStartGain, groupGainDelta, groupSize, add,
+                    firstFrame, blockSamples / 2);
+        } else if (!add) {
+            clear(pDestBlock, blockSamples);
+        }
+    }
+}
+
 // static
 void SampleUtil::copyWithGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT pSrc,
         CSAMPLE_GAIN gain, int iNumSamples) {
@@ -237,10 +647,7 @@ void SampleUtil::copyWithGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = pSrc[i] * gain;
-    }
+    s_pKernels->copyWithGain(pDest, pSrc, gain, iNumSamples);
 
     // OR! need to test which fares better
     // copy(pDest, pSrc, iNumSamples);
@@ -263,17 +670,10 @@ void SampleUtil::copyWithRampingGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _R
             / CSAMPLE_GAIN(iNumSamples / 2);
     if (gain_delta) {
         const CSAMPLE_GAIN start_gain = old_gain + gain_delta;
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < iNumSamples / 2; ++i) {
-            const CSAMPLE_GAIN gain = start_gain + gain_delta * i;
-            pDest[i * 2] = pSrc[i * 2] * gain;
-            pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
-        }
+        s_pKernels->copyWithRampingGain(pDest, pSrc, start_gain, gain_delta,
+                iNumSamples / 2);
     } else {
-        // note: LOOP VECTORIZED.
-        for (int i = 0; i < iNumSamples; ++i) {
-            pDest[i] = pSrc[i] * old_gain;
-        }
+        s_pKernels->copyWithGain(pDest, pSrc, old_gain, iNumSamples);
     }
 
     // OR! need to test which fares better
@@ -284,15 +684,7 @@ void SampleUtil::copyWithRampingGain(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _R
 // static
 void SampleUtil::convertS16ToFloat32(CSAMPLE* _RESTRICT pDest, const SAMPLE* _RESTRICT pSrc,
         int iNumSamples) {
-    // SAMPLE_MIN = -32768 is a valid low sample, whereas SAMPLE_MAX = 32767
-    // is the highest valid sample. Note that this means that although some
-    // sample values convert to -1.0, none will convert to +1.0.
-    DEBUG_ASSERT(-SAMPLE_MIN >= SAMPLE_MAX);
-    const CSAMPLE kConversionFactor = -SAMPLE_MIN;
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = CSAMPLE(pSrc[i]) / kConversionFactor;
-    }
+    s_pKernels->convertS16ToFloat32(pDest, pSrc, iNumSamples);
 }
 
 //static
@@ -308,61 +700,54 @@ void SampleUtil::convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
 // static
 SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
         const CSAMPLE* pBuffer, int iNumSamples) {
-    CSAMPLE fAbsL = CSAMPLE_ZERO;
-    CSAMPLE fAbsR = CSAMPLE_ZERO;
-    CSAMPLE clippedL = 0;
-    CSAMPLE clippedR = 0;
-
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples / 2; ++i) {
-        CSAMPLE absl = fabs(pBuffer[i * 2]);
-        fAbsL += absl;
-        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
-        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
-        fAbsR += absr;
-        // Replacing the code with a bool clipped will prevent vetorizing
-        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
-    }
+    CSAMPLE fPeakL;
+    CSAMPLE fPeakR;
+    s_pKernels->sumAbsPerChannel(pfAbsL, pfAbsR, &fPeakL, &fPeakR,
+            pBuffer, iNumSamples / 2);
 
-    *pfAbsL = fAbsL;
-    *pfAbsR = fAbsR;
     SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
-    if (clippedL > 0) {
+    if (fPeakL > CSAMPLE_PEAK) {
         clipping |= SampleUtil::CLIPPING_LEFT;
     }
-    if (clippedR > 0) {
+    if (fPeakR > CSAMPLE_PEAK) {
         clipping |= SampleUtil::CLIPPING_RIGHT;
     }
     return clipping;
 }
 
+// static
+bool SampleUtil::isSilent(const CSAMPLE* pBuffer, int iNumSamples) {
+    // Without a branch per sample the inner loop vectorizes.
+    const int kBlockSize = 64;
+    for (int i = 0; i < iNumSamples; i += kBlockSize) {
+        const int blockEnd = math_min(i + kBlockSize, iNumSamples);
+        int audible = 0;
+        for (int j = i; j < blockEnd; ++j) {
+            audible |= fabs(pBuffer[j]) >= CSAMPLE_SILENCE_THRESHOLD;
+        }
+        if (audible) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // static
 void SampleUtil::copyClampBuffer(CSAMPLE* _RESTRICT pDest, const _RESTRICT CSAMPLE* pSrc,
         int iNumSamples) {
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[i] = clampSample(pSrc[i]);
-    }
+    s_pKernels->copyClampBuffer(pDest, pSrc, iNumSamples);
 }
 
 // static
 void SampleUtil::interleaveBuffer(CSAMPLE* _RESTRICT pDest, const CSAMPLE* _RESTRICT pSrc1,
         const CSAMPLE* _RESTRICT pSrc2, int iNumSamples) {
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest[2 * i] = pSrc1[i];
-        pDest[2 * i + 1] = pSrc2[i];
-    }
+    s_pKernels->interleaveBuffer(pDest, pSrc1, pSrc2, iNumSamples);
 }
 
 // static
 void SampleUtil::deinterleaveBuffer(CSAMPLE* pDest1, CSAMPLE* pDest2,
         const CSAMPLE* pSrc, int iNumSamples) {
-    // note: LOOP VECTORIZED.
-    for (int i = 0; i < iNumSamples; ++i) {
-        pDest1[i] = pSrc[i * 2];
-        pDest2[i] = pSrc[i * 2 + 1];
-    }
+    s_pKernels->deinterleaveBuffer(pDest1, pDest2, pSrc, iNumSamples);
 }
 
 // static
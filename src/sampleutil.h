@@ -54,6 +54,27 @@ class SampleUtil {
     };
     Q_DECLARE_FLAGS(CLIP_STATUS, CLIP_FLAG);
 
+    // The instruction sets for which the functions with an explicit SIMD
+    // implementation are available. The best one supported by the CPU is
+    // selected at startup.
+    enum Isa {
+        ISA_SCALAR = 0,
+        ISA_SSE2,
+        ISA_AVX2,
+        ISA_AVX512,
+        ISA_NEON,
+        ISA_COUNT
+    };
+
+    // Returns true if the build and the CPU support isa
+    static bool isIsaSupported(Isa isa);
+    // Returns the instruction set currently in use
+    static Isa getIsa();
+    // Switches the instruction set. This is not thread safe and only meant
+    // for tests and benchmarks. Returns false if isa is not supported.
+    static bool setIsa(Isa isa);
+    static const char* isaName(Isa isa);
+
     // Allocated a buffer of CSAMPLE's with length size. Ensures that the buffer
     // is 16-byte aligned for SSE enhancement.
     static CSAMPLE* alloc(int size);
@@ -169,6 +190,19 @@ class SampleUtil {
             CSAMPLE_GAIN gain1, const CSAMPLE* pSrc2, CSAMPLE_GAIN gain2,
             const CSAMPLE* pSrc3, CSAMPLE_GAIN gain3, int iNumSamples);
 
+    // Overwrites pDest with the sum of numSources buffers, each multiplied by
+    // its gain. Sources with a gain of zero are skipped. The sum is built in
+    // blocks that stay in the L1 cache, so there is no limit on numSources.
+    // pDest must not be an alias of any of the sources.
+    static void mixWithGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+            const CSAMPLE_GAIN* pGain, int numSources, int iNumSamples);
+
+    // Like mixWithGain() but ramps the gain of each source from pOldGain to
+    // pNewGain like copyWithRampingGain()
+    static void mixWithRampingGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+            const CSAMPLE_GAIN* pOldGain, const CSAMPLE_GAIN* pNewGain,
+            int numSources, int iNumSamples);
+
     // Convert and normalize a buffer of SAMPLEs in the range [-SAMPLE_MAX, SAMPLE_MAX]
     // to a buffer of CSAMPLEs in the range [-1.0, 1.0].
     static void convertS16ToFloat32(CSAMPLE* pDest, const SAMPLE* pSrc,
@@ -186,6 +220,11 @@ class SampleUtil {
     static CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
             const CSAMPLE* pBuffer, int iNumSamples);
 
+    // Returns true if the magnitude of all samples in pBuffer is below
+    // CSAMPLE_SILENCE_THRESHOLD. Stops at the first block of samples that is
+    // not silent, so this is cheap for audible buffers.
+    static bool isSilent(const CSAMPLE* pBuffer, int iNumSamples);
+
     // Copies every sample in pSrc to pDest, limiting the values in pDest
     // to the valid range of CSAMPLE. If pDest and pSrc are aliases, will
     // not copy will only clamp. Returns true if any samples in pSrc were
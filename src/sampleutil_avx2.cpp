@@ -0,0 +1,98 @@
+// sampleutil_avx2.cpp
+// SampleUtil kernels using 256 bit AVX registers. The integer conversion
+// requires AVX2.
+
+#include "sampleutil_kernels.h"
+
+#ifdef SAMPLEUTIL_SIMD_X86
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace {
+
+struct Avx2 {
+    typedef __m256 Reg;
+    static const int kWidth = 8;
+
+    static inline Reg load(const CSAMPLE* p) {
+        return _mm256_loadu_ps(p);
+    }
+    static inline void store(CSAMPLE* p, Reg a) {
+        _mm256_storeu_ps(p, a);
+    }
+    static inline Reg set1(CSAMPLE a) {
+        return _mm256_set1_ps(a);
+    }
+    static inline Reg add(Reg a, Reg b) {
+        return _mm256_add_ps(a, b);
+    }
+    static inline Reg mul(Reg a, Reg b) {
+        return _mm256_mul_ps(a, b);
+    }
+    static inline Reg min(Reg a, Reg b) {
+        return _mm256_min_ps(a, b);
+    }
+    static inline Reg max(Reg a, Reg b) {
+        return _mm256_max_ps(a, b);
+    }
+    static inline Reg abs(Reg a) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+    }
+    static inline Reg loadS16(const SAMPLE* p) {
+        const __m128i s16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(s16));
+    }
+    static inline Reg frameOffsets() {
+        return _mm256_setr_ps(0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f);
+    }
+    static inline void interleave(CSAMPLE* p, Reg a, Reg b) {
+        // The unpack instructions work within each 128 bit lane:
+        // lo = { a0 b0 a1 b1 | a4 b4 a5 b5 }, hi = { a2 b2 a3 b3 | a6 b6 a7 b7 }
+        const __m256 lo = _mm256_unpacklo_ps(a, b);
+        const __m256 hi = _mm256_unpackhi_ps(a, b);
+        _mm256_storeu_ps(p, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(p + kWidth, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    static inline void deinterleave(const CSAMPLE* p, Reg* pA, Reg* pB) {
+        const __m256 lo = _mm256_loadu_ps(p);
+        const __m256 hi = _mm256_loadu_ps(p + kWidth);
+        // { p0 p2 p8 p10 | p4 p6 p12 p14 } -> { p0 p2 p4 p6 p8 p10 p12 p14 }
+        const __m256 even = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 odd = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        *pA = _mm256_castpd_ps(_mm256_permute4x64_pd(
+                _mm256_castps_pd(even), _MM_SHUFFLE(3, 1, 2, 0)));
+        *pB = _mm256_castpd_ps(_mm256_permute4x64_pd(
+                _mm256_castps_pd(odd), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+};
+
+} // anonymous namespace
+
+#include "sampleutil_simd.h"
+
+const SampleUtilKernels* sampleUtilKernelsAvx2() {
+    return simdKernels<Avx2>();
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else // SAMPLEUTIL_SIMD_X86
+
+#include <cstddef>
+
+const SampleUtilKernels* sampleUtilKernelsAvx2() {
+    return NULL;
+}
+
+#endif // SAMPLEUTIL_SIMD_X86
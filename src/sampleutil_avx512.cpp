@@ -0,0 +1,102 @@
+// sampleutil_avx512.cpp
+// SampleUtil kernels using 512 bit AVX-512 registers. Only AVX-512
+// Foundation instructions are used.
+
+#include "sampleutil_kernels.h"
+
+// AVX-512 intrinsics require Visual Studio 2017
+#if defined(SAMPLEUTIL_SIMD_X86) && (!defined(_MSC_VER) || _MSC_VER >= 1910)
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+
+namespace {
+
+struct Avx512 {
+    typedef __m512 Reg;
+    static const int kWidth = 16;
+
+    static inline Reg load(const CSAMPLE* p) {
+        return _mm512_loadu_ps(p);
+    }
+    static inline void store(CSAMPLE* p, Reg a) {
+        _mm512_storeu_ps(p, a);
+    }
+    static inline Reg set1(CSAMPLE a) {
+        return _mm512_set1_ps(a);
+    }
+    static inline Reg add(Reg a, Reg b) {
+        return _mm512_add_ps(a, b);
+    }
+    static inline Reg mul(Reg a, Reg b) {
+        return _mm512_mul_ps(a, b);
+    }
+    static inline Reg min(Reg a, Reg b) {
+        return _mm512_min_ps(a, b);
+    }
+    static inline Reg max(Reg a, Reg b) {
+        return _mm512_max_ps(a, b);
+    }
+    static inline Reg abs(Reg a) {
+        // _mm512_andnot_ps() requires AVX512DQ
+        return _mm512_castsi512_ps(_mm512_and_si512(
+                _mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff)));
+    }
+    static inline Reg loadS16(const SAMPLE* p) {
+        const __m256i s16 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        return _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(s16));
+    }
+    static inline Reg frameOffsets() {
+        return _mm512_setr_ps(0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f,
+                4.0f, 4.0f, 5.0f, 5.0f, 6.0f, 6.0f, 7.0f, 7.0f);
+    }
+    static inline void interleave(CSAMPLE* p, Reg a, Reg b) {
+        // Indices >= 16 select from b
+        const __m512i lo = _mm512_setr_epi32(
+                0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+        const __m512i hi = _mm512_setr_epi32(
+                8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+        _mm512_storeu_ps(p, _mm512_permutex2var_ps(a, lo, b));
+        _mm512_storeu_ps(p + kWidth, _mm512_permutex2var_ps(a, hi, b));
+    }
+    static inline void deinterleave(const CSAMPLE* p, Reg* pA, Reg* pB) {
+        const __m512i even = _mm512_setr_epi32(
+                0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i odd = _mm512_setr_epi32(
+                1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+        const __m512 lo = _mm512_loadu_ps(p);
+        const __m512 hi = _mm512_loadu_ps(p + kWidth);
+        *pA = _mm512_permutex2var_ps(lo, even, hi);
+        *pB = _mm512_permutex2var_ps(lo, odd, hi);
+    }
+};
+
+} // anonymous namespace
+
+#include "sampleutil_simd.h"
+
+const SampleUtilKernels* sampleUtilKernelsAvx512() {
+    return simdKernels<Avx512>();
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else // SAMPLEUTIL_SIMD_X86
+
+#include <cstddef>
+
+const SampleUtilKernels* sampleUtilKernelsAvx512() {
+    return NULL;
+}
+
+#endif // SAMPLEUTIL_SIMD_X86
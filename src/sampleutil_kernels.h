@@ -0,0 +1,74 @@
+// sampleutil_kernels.h
+// Table of the inner loops of SampleUtil that have hand written SIMD
+// implementations. SampleUtil handles the special cases (unity or zero gain,
+// ...) and calls the kernels of the instruction set that has been selected
+// at startup.
+
+#ifndef SAMPLEUTIL_KERNELS_H
+#define SAMPLEUTIL_KERNELS_H
+
+#include "util/types.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+// We need compilers that allow to use the intrinsics of an instruction set
+// in single functions without enabling it for the whole file.
+#if defined(__clang__) || defined(_MSC_VER) || \
+        (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define SAMPLEUTIL_SIMD_X86
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SAMPLEUTIL_SIMD_NEON
+#endif
+
+// The maximum number of sources of the mixGroup kernels
+const int kSampleUtilMixGroupSize = 4;
+
+// All ramping kernels process interleaved stereo frames. The gain of frame i
+// is startGain + gainDelta * i.
+struct SampleUtilKernels {
+    void (*applyGain)(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, int iNumSamples);
+    void (*applyRampingGain)(CSAMPLE* pBuffer, CSAMPLE_GAIN startGain,
+            CSAMPLE_GAIN gainDelta, int iNumFrames);
+    void (*copyWithGain)(CSAMPLE* pDest, const CSAMPLE* pSrc,
+            CSAMPLE_GAIN gain, int iNumSamples);
+    void (*copyWithRampingGain)(CSAMPLE* pDest, const CSAMPLE* pSrc,
+            CSAMPLE_GAIN startGain, CSAMPLE_GAIN gainDelta, int iNumFrames);
+    void (*addWithGain)(CSAMPLE* pDest, const CSAMPLE* pSrc,
+            CSAMPLE_GAIN gain, int iNumSamples);
+    void (*addWithRampingGain)(CSAMPLE* pDest, const CSAMPLE* pSrc,
+            CSAMPLE_GAIN startGain, CSAMPLE_GAIN gainDelta, int iNumFrames);
+    // Stores the sums and the peaks of the absolute values per channel.
+    void (*sumAbsPerChannel)(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
+            CSAMPLE* pfPeakL, CSAMPLE* pfPeakR,
+            const CSAMPLE* pBuffer, int iNumFrames);
+    void (*copyClampBuffer)(CSAMPLE* pDest, const CSAMPLE* pSrc,
+            int iNumSamples);
+    void (*convertS16ToFloat32)(CSAMPLE* pDest, const SAMPLE* pSrc,
+            int iNumSamples);
+    void (*interleaveBuffer)(CSAMPLE* pDest, const CSAMPLE* pSrc1,
+            const CSAMPLE* pSrc2, int iNumSamples);
+    void (*deinterleaveBuffer)(CSAMPLE* pDest1, CSAMPLE* pDest2,
+            const CSAMPLE* pSrc, int iNumSamples);
+    // Mixes 1 to kSampleUtilMixGroupSize sources into pDest. If add is false,
+    // pDest is overwritten. The products are summed up in the order of the
+    // sources.
+    void (*mixGroupWithGain)(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+            const CSAMPLE_GAIN* pGain, int numSources, bool add,
+            int iNumSamples);
+    // The gain of source j in frame firstFrame + i is
+    // pStartGain[j] + pGainDelta[j] * (firstFrame + i).
+    void (*mixGroupWithRampingGain)(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+            const CSAMPLE_GAIN* pStartGain, const CSAMPLE_GAIN* pGainDelta,
+            int numSources, bool add, int firstFrame, int iNumFrames);
+};
+
+// Each of these returns NULL if the instruction set is not available for
+// the target of the build. They do not check the CPU, see CpuFeatures.
+const SampleUtilKernels* sampleUtilKernelsSse2();
+const SampleUtilKernels* sampleUtilKernelsAvx2();
+const SampleUtilKernels* sampleUtilKernelsAvx512();
+const SampleUtilKernels* sampleUtilKernelsNeon();
+
+#endif /* SAMPLEUTIL_KERNELS_H */
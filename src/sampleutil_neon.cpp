@@ -0,0 +1,77 @@
+// sampleutil_neon.cpp
+// SampleUtil kernels using 128 bit NEON registers. NEON is used if the
+// build targets it, there is no runtime detection.
+
+#include "sampleutil_kernels.h"
+
+#ifdef SAMPLEUTIL_SIMD_NEON
+
+#include <arm_neon.h>
+
+namespace {
+
+struct Neon {
+    typedef float32x4_t Reg;
+    static const int kWidth = 4;
+
+    static inline Reg load(const CSAMPLE* p) {
+        return vld1q_f32(p);
+    }
+    static inline void store(CSAMPLE* p, Reg a) {
+        vst1q_f32(p, a);
+    }
+    static inline Reg set1(CSAMPLE a) {
+        return vdupq_n_f32(a);
+    }
+    static inline Reg add(Reg a, Reg b) {
+        return vaddq_f32(a, b);
+    }
+    static inline Reg mul(Reg a, Reg b) {
+        return vmulq_f32(a, b);
+    }
+    static inline Reg min(Reg a, Reg b) {
+        return vminq_f32(a, b);
+    }
+    static inline Reg max(Reg a, Reg b) {
+        return vmaxq_f32(a, b);
+    }
+    static inline Reg abs(Reg a) {
+        return vabsq_f32(a);
+    }
+    static inline Reg loadS16(const SAMPLE* p) {
+        return vcvtq_f32_s32(vmovl_s16(vld1_s16(p)));
+    }
+    static inline Reg frameOffsets() {
+        static const float kFrameOffsets[kWidth] = { 0.0f, 0.0f, 1.0f, 1.0f };
+        return vld1q_f32(kFrameOffsets);
+    }
+    static inline void interleave(CSAMPLE* p, Reg a, Reg b) {
+        float32x4x2_t ab;
+        ab.val[0] = a;
+        ab.val[1] = b;
+        vst2q_f32(p, ab);
+    }
+    static inline void deinterleave(const CSAMPLE* p, Reg* pA, Reg* pB) {
+        const float32x4x2_t ab = vld2q_f32(p);
+        *pA = ab.val[0];
+        *pB = ab.val[1];
+    }
+};
+
+} // anonymous namespace
+
+#include "sampleutil_simd.h"
+
+const SampleUtilKernels* sampleUtilKernelsNeon() {
+    return simdKernels<Neon>();
+}
+
+#else // SAMPLEUTIL_SIMD_NEON
+
+#include <cstddef>
+
+const SampleUtilKernels* sampleUtilKernelsNeon() {
+    return NULL;
+}
+
+#endif // SAMPLEUTIL_SIMD_NEON
@@ -0,0 +1,424 @@
+// sampleutil_simd.h
+// Generic implementation of the SampleUtilKernels on top of a small set of
+// vector operations. This file is included by the sampleutil_<isa>.cpp files
+// after they have enabled the instruction set for the following functions
+// and defined a struct V like this:
+//
+// struct V {
+//     typedef <vector type> Reg;
+//     static const int kWidth = <number of CSAMPLEs in a Reg>;
+//     static Reg load(const CSAMPLE* p);   // unaligned
+//     static void store(CSAMPLE* p, Reg a); // unaligned
+//     static Reg set1(CSAMPLE a);
+//     static Reg add(Reg a, Reg b);
+//     static Reg mul(Reg a, Reg b);
+//     static Reg min(Reg a, Reg b);
+//     static Reg max(Reg a, Reg b);
+//     static Reg abs(Reg a);
+//     // Loads kWidth SAMPLEs converted to CSAMPLE without scaling
+//     static Reg loadS16(const SAMPLE* p);
+//     // { 0, 0, 1, 1, 2, 2, ... }, the frame index of each stereo sample
+//     static Reg frameOffsets();
+//     // Stores { a0, b0, a1, b1, ... } to p[0] .. p[2 * kWidth - 1]
+//     static void interleave(CSAMPLE* p, Reg a, Reg b);
+//     // Inverse of interleave()
+//     static void deinterleave(const CSAMPLE* p, Reg* pA, Reg* pB);
+// };
+//
+// Everything is placed in an anonymous namespace, so each instruction set
+// gets its own instantiation. Only call functions from here that are defined
+// in the same region, an inline function from another header might have
+// been instantiated without the instruction set already.
+//
+// The ramping kernels must compute the gains like the scalar loops in
+// sampleutil.cpp: startGain + gainDelta * frameIndex. The results may only
+// differ by rounding, e.g. if the compiler contracts the scalar tail loops to
+// fused multiply-adds.
+
+#ifndef SAMPLEUTIL_SIMD_H
+#define SAMPLEUTIL_SIMD_H
+
+#include "sampleutil_kernels.h"
+
+namespace {
+
+template<typename V>
+void simdApplyGain(CSAMPLE* pBuffer, CSAMPLE_GAIN gain, int iNumSamples) {
+    const typename V::Reg vGain = V::set1(gain);
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        V::store(pBuffer + i, V::mul(V::load(pBuffer + i), vGain));
+    }
+    for (; i < iNumSamples; ++i) {
+        pBuffer[i] *= gain;
+    }
+}
+
+template<typename V>
+inline typename V::Reg simdFrameGains(typename V::Reg vStartGain,
+        typename V::Reg vGainDelta, typename V::Reg vFrameOffsets, int frame) {
+    const typename V::Reg vFrames = V::add(
+            V::set1(static_cast<CSAMPLE_GAIN>(frame)), vFrameOffsets);
+    return V::add(vStartGain, V::mul(vGainDelta, vFrames));
+}
+
+template<typename V>
+void simdApplyRampingGain(CSAMPLE* pBuffer, CSAMPLE_GAIN startGain,
+        CSAMPLE_GAIN gainDelta, int iNumFrames) {
+    const typename V::Reg vStartGain = V::set1(startGain);
+    const typename V::Reg vGainDelta = V::set1(gainDelta);
+    const typename V::Reg vFrameOffsets = V::frameOffsets();
+    const int kFramesPerReg = V::kWidth / 2;
+    int i = 0;
+    for (; i + kFramesPerReg <= iNumFrames; i += kFramesPerReg) {
+        const typename V::Reg vGain = simdFrameGains<V>(
+                vStartGain, vGainDelta, vFrameOffsets, i);
+        V::store(pBuffer + i * 2, V::mul(V::load(pBuffer + i * 2), vGain));
+    }
+    for (; i < iNumFrames; ++i) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+        pBuffer[i * 2] *= gain;
+        pBuffer[i * 2 + 1] *= gain;
+    }
+}
+
+template<typename V>
+void simdCopyWithGain(CSAMPLE* pDest, const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain, int iNumSamples) {
+    const typename V::Reg vGain = V::set1(gain);
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        V::store(pDest + i, V::mul(V::load(pSrc + i), vGain));
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+template<typename V>
+void simdCopyWithRampingGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc, CSAMPLE_GAIN startGain,
+        CSAMPLE_GAIN gainDelta, int iNumFrames) {
+    const typename V::Reg vStartGain = V::set1(startGain);
+    const typename V::Reg vGainDelta = V::set1(gainDelta);
+    const typename V::Reg vFrameOffsets = V::frameOffsets();
+    const int kFramesPerReg = V::kWidth / 2;
+    int i = 0;
+    for (; i + kFramesPerReg <= iNumFrames; i += kFramesPerReg) {
+        const typename V::Reg vGain = simdFrameGains<V>(
+                vStartGain, vGainDelta, vFrameOffsets, i);
+        V::store(pDest + i * 2, V::mul(V::load(pSrc + i * 2), vGain));
+    }
+    for (; i < iNumFrames; ++i) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+        pDest[i * 2] = pSrc[i * 2] * gain;
+        pDest[i * 2 + 1] = pSrc[i * 2 + 1] * gain;
+    }
+}
+
+template<typename V>
+void simdAddWithGain(CSAMPLE* pDest, const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain, int iNumSamples) {
+    const typename V::Reg vGain = V::set1(gain);
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        V::store(pDest + i, V::add(V::load(pDest + i),
+                V::mul(V::load(pSrc + i), vGain)));
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+template<typename V>
+void simdAddWithRampingGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc, CSAMPLE_GAIN startGain,
+        CSAMPLE_GAIN gainDelta, int iNumFrames) {
+    const typename V::Reg vStartGain = V::set1(startGain);
+    const typename V::Reg vGainDelta = V::set1(gainDelta);
+    const typename V::Reg vFrameOffsets = V::frameOffsets();
+    const int kFramesPerReg = V::kWidth / 2;
+    int i = 0;
+    for (; i + kFramesPerReg <= iNumFrames; i += kFramesPerReg) {
+        const typename V::Reg vGain = simdFrameGains<V>(
+                vStartGain, vGainDelta, vFrameOffsets, i);
+        V::store(pDest + i * 2, V::add(V::load(pDest + i * 2),
+                V::mul(V::load(pSrc + i * 2), vGain)));
+    }
+    for (; i < iNumFrames; ++i) {
+        const CSAMPLE_GAIN gain = startGain + gainDelta * i;
+        pDest[i * 2] += pSrc[i * 2] * gain;
+        pDest[i * 2 + 1] += pSrc[i * 2 + 1] * gain;
+    }
+}
+
+template<typename V>
+void simdSumAbsPerChannel(CSAMPLE* pfAbsL, CSAMPLE* pfAbsR,
+        CSAMPLE* pfPeakL, CSAMPLE* pfPeakR,
+        const CSAMPLE* pBuffer, int iNumFrames) {
+    // Even lanes hold the left, odd lanes the right channel
+    typename V::Reg vSum = V::set1(CSAMPLE_ZERO);
+    typename V::Reg vPeak = V::set1(CSAMPLE_ZERO);
+    const int kFramesPerReg = V::kWidth / 2;
+    int i = 0;
+    for (; i + kFramesPerReg <= iNumFrames; i += kFramesPerReg) {
+        const typename V::Reg vAbs = V::abs(V::load(pBuffer + i * 2));
+        vSum = V::add(vSum, vAbs);
+        vPeak = V::max(vPeak, vAbs);
+    }
+    CSAMPLE sums[V::kWidth];
+    CSAMPLE peaks[V::kWidth];
+    V::store(sums, vSum);
+    V::store(peaks, vPeak);
+    CSAMPLE fAbsL = CSAMPLE_ZERO;
+    CSAMPLE fAbsR = CSAMPLE_ZERO;
+    CSAMPLE fPeakL = CSAMPLE_ZERO;
+    CSAMPLE fPeakR = CSAMPLE_ZERO;
+    for (int lane = 0; lane < V::kWidth; lane += 2) {
+        fAbsL += sums[lane];
+        fAbsR += sums[lane + 1];
+        fPeakL = peaks[lane] > fPeakL ? peaks[lane] : fPeakL;
+        fPeakR = peaks[lane + 1] > fPeakR ? peaks[lane + 1] : fPeakR;
+    }
+    for (; i < iNumFrames; ++i) {
+        const CSAMPLE absl = pBuffer[i * 2] < 0 ? -pBuffer[i * 2] : pBuffer[i * 2];
+        const CSAMPLE absr = pBuffer[i * 2 + 1] < 0 ?
+                -pBuffer[i * 2 + 1] : pBuffer[i * 2 + 1];
+        fAbsL += absl;
+        fAbsR += absr;
+        fPeakL = absl > fPeakL ? absl : fPeakL;
+        fPeakR = absr > fPeakR ? absr : fPeakR;
+    }
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    *pfPeakL = fPeakL;
+    *pfPeakR = fPeakR;
+}
+
+template<typename V>
+void simdCopyClampBuffer(CSAMPLE* pDest,
+        const CSAMPLE* pSrc, int iNumSamples) {
+    const typename V::Reg vMin = V::set1(-CSAMPLE_PEAK);
+    const typename V::Reg vMax = V::set1(CSAMPLE_PEAK);
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        V::store(pDest + i, V::min(V::max(V::load(pSrc + i), vMin), vMax));
+    }
+    for (; i < iNumSamples; ++i) {
+        const CSAMPLE sample = pSrc[i] < -CSAMPLE_PEAK ? -CSAMPLE_PEAK : pSrc[i];
+        pDest[i] = sample > CSAMPLE_PEAK ? CSAMPLE_PEAK : sample;
+    }
+}
+
+template<typename V>
+void simdConvertS16ToFloat32(CSAMPLE* pDest,
+        const SAMPLE* pSrc, int iNumSamples) {
+    // 1 / 32768 is exact, so this matches the division of the scalar loop.
+    const CSAMPLE kConversionFactor = CSAMPLE_ONE / -SAMPLE_MIN;
+    const typename V::Reg vConversionFactor = V::set1(kConversionFactor);
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        V::store(pDest + i, V::mul(V::loadS16(pSrc + i), vConversionFactor));
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[i] = CSAMPLE(pSrc[i]) * kConversionFactor;
+    }
+}
+
+template<typename V>
+void simdInterleaveBuffer(CSAMPLE* pDest,
+        const CSAMPLE* pSrc1, const CSAMPLE* pSrc2,
+        int iNumSamples) {
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        V::interleave(pDest + i * 2, V::load(pSrc1 + i), V::load(pSrc2 + i));
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+template<typename V>
+void simdDeinterleaveBuffer(CSAMPLE* pDest1,
+        CSAMPLE* pDest2, const CSAMPLE* pSrc,
+        int iNumSamples) {
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        typename V::Reg a;
+        typename V::Reg b;
+        V::deinterleave(pSrc + i * 2, &a, &b);
+        V::store(pDest1 + i, a);
+        V::store(pDest2 + i, b);
+    }
+    for (; i < iNumSamples; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+template<typename V, int kSources, bool kAdd>
+void simdMixGroupWithGainN(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain, int iNumSamples) {
+    const CSAMPLE* src[kSources];
+    CSAMPLE_GAIN gain[kSources];
+    typename V::Reg vGain[kSources];
+    for (int j = 0; j < kSources; ++j) {
+        src[j] = pSrc[j];
+        gain[j] = pGain[j];
+        vGain[j] = V::set1(pGain[j]);
+    }
+    int i = 0;
+    for (; i + V::kWidth <= iNumSamples; i += V::kWidth) {
+        typename V::Reg vSum = kAdd ? V::load(pDest + i) : V::set1(CSAMPLE_ZERO);
+        for (int j = 0; j < kSources; ++j) {
+            vSum = V::add(vSum, V::mul(V::load(src[j] + i), vGain[j]));
+        }
+        V::store(pDest + i, vSum);
+    }
+    for (; i < iNumSamples; ++i) {
+        CSAMPLE sum = kAdd ? pDest[i] : CSAMPLE_ZERO;
+        for (int j = 0; j < kSources; ++j) {
+            sum += src[j][i] * gain[j];
+        }
+        pDest[i] = sum;
+    }
+}
+
+template<typename V>
+void simdMixGroupWithGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain, int numSources, bool add,
+        int iNumSamples) {
+    switch (add ? numSources + kSampleUtilMixGroupSize : numSources) {
+    case 1:
+        simdMixGroupWithGainN<V, 1, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 2:
+        simdMixGroupWithGainN<V, 2, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 3:
+        simdMixGroupWithGainN<V, 3, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 4:
+        simdMixGroupWithGainN<V, 4, false>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 5:
+        simdMixGroupWithGainN<V, 1, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 6:
+        simdMixGroupWithGainN<V, 2, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 7:
+        simdMixGroupWithGainN<V, 3, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    case 8:
+        simdMixGroupWithGainN<V, 4, true>(pDest, pSrc, pGain, iNumSamples);
+        break;
+    }
+}
+
+template<typename V, int kSources, bool kAdd>
+void simdMixGroupWithRampingGainN(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pStartGain, const CSAMPLE_GAIN* pGainDelta,
+        int firstFrame, int iNumFrames) {
+    const CSAMPLE* src[kSources];
+    CSAMPLE_GAIN startGain[kSources];
+    CSAMPLE_GAIN gainDelta[kSources];
+    typename V::Reg vStartGain[kSources];
+    typename V::Reg vGainDelta[kSources];
+    for (int j = 0; j < kSources; ++j) {
+        src[j] = pSrc[j];
+        startGain[j] = pStartGain[j];
+        gainDelta[j] = pGainDelta[j];
+        vStartGain[j] = V::set1(pStartGain[j]);
+        vGainDelta[j] = V::set1(pGainDelta[j]);
+    }
+    const typename V::Reg vFrameOffsets = V::frameOffsets();
+    const int kFramesPerReg = V::kWidth / 2;
+    int i = 0;
+    for (; i + kFramesPerReg <= iNumFrames; i += kFramesPerReg) {
+        typename V::Reg vSum = kAdd ?
+                V::load(pDest + i * 2) : V::set1(CSAMPLE_ZERO);
+        for (int j = 0; j < kSources; ++j) {
+            const typename V::Reg vGain = simdFrameGains<V>(
+                    vStartGain[j], vGainDelta[j], vFrameOffsets, firstFrame + i);
+            vSum = V::add(vSum, V::mul(V::load(src[j] + i * 2), vGain));
+        }
+        V::store(pDest + i * 2, vSum);
+    }
+    for (; i < iNumFrames; ++i) {
+        CSAMPLE sumL = kAdd ? pDest[i * 2] : CSAMPLE_ZERO;
+        CSAMPLE sumR = kAdd ? pDest[i * 2 + 1] : CSAMPLE_ZERO;
+        for (int j = 0; j < kSources; ++j) {
+            const CSAMPLE_GAIN gain = startGain[j] + gainDelta[j] * (firstFrame + i);
+            sumL += src[j][i * 2] * gain;
+            sumR += src[j][i * 2 + 1] * gain;
+        }
+        pDest[i * 2] = sumL;
+        pDest[i * 2 + 1] = sumR;
+    }
+}
+
+template<typename V>
+void simdMixGroupWithRampingGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pStartGain, const CSAMPLE_GAIN* pGainDelta,
+        int numSources, bool add, int firstFrame, int iNumFrames) {
+    switch (add ? numSources + kSampleUtilMixGroupSize : numSources) {
+    case 1:
+        simdMixGroupWithRampingGainN<V, 1, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 2:
+        simdMixGroupWithRampingGainN<V, 2, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 3:
+        simdMixGroupWithRampingGainN<V, 3, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 4:
+        simdMixGroupWithRampingGainN<V, 4, false>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 5:
+        simdMixGroupWithRampingGainN<V, 1, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 6:
+        simdMixGroupWithRampingGainN<V, 2, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 7:
+        simdMixGroupWithRampingGainN<V, 3, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    case 8:
+        simdMixGroupWithRampingGainN<V, 4, true>(pDest, pSrc, pStartGain,
+                pGainDelta, firstFrame, iNumFrames);
+        break;
+    }
+}
+
+template<typename V>
+const SampleUtilKernels* simdKernels() {
+    static const SampleUtilKernels kKernels = {
+        &simdApplyGain<V>,
+        &simdApplyRampingGain<V>,
+        &simdCopyWithGain<V>,
+        &simdCopyWithRampingGain<V>,
+        &simdAddWithGain<V>,
+        &simdAddWithRampingGain<V>,
+        &simdSumAbsPerChannel<V>,
+        &simdCopyClampBuffer<V>,
+        &simdConvertS16ToFloat32<V>,
+        &simdInterleaveBuffer<V>,
+        &simdDeinterleaveBuffer<V>,
+        &simdMixGroupWithGain<V>,
+        &simdMixGroupWithRampingGain<V>,
+    };
+    return &kKernels;
+}
+
+} // anonymous namespace
+
+#endif /* SAMPLEUTIL_SIMD_H */
@@ -0,0 +1,91 @@
+// sampleutil_sse2.cpp
+// SampleUtil kernels using 128 bit SSE2 registers. Required by 32 bit builds
+// that are not compiled for SSE2 and the baseline of all 64 bit x86 CPUs.
+
+#include "sampleutil_kernels.h"
+
+#ifdef SAMPLEUTIL_SIMD_X86
+
+#include <emmintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+namespace {
+
+struct Sse2 {
+    typedef __m128 Reg;
+    static const int kWidth = 4;
+
+    static inline Reg load(const CSAMPLE* p) {
+        return _mm_loadu_ps(p);
+    }
+    static inline void store(CSAMPLE* p, Reg a) {
+        _mm_storeu_ps(p, a);
+    }
+    static inline Reg set1(CSAMPLE a) {
+        return _mm_set1_ps(a);
+    }
+    static inline Reg add(Reg a, Reg b) {
+        return _mm_add_ps(a, b);
+    }
+    static inline Reg mul(Reg a, Reg b) {
+        return _mm_mul_ps(a, b);
+    }
+    static inline Reg min(Reg a, Reg b) {
+        return _mm_min_ps(a, b);
+    }
+    static inline Reg max(Reg a, Reg b) {
+        return _mm_max_ps(a, b);
+    }
+    static inline Reg abs(Reg a) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+    static inline Reg loadS16(const SAMPLE* p) {
+        const __m128i s16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        // Sign extend by moving each sample into the upper half of an int32
+        const __m128i s32 = _mm_srai_epi32(_mm_unpacklo_epi16(s16, s16), 16);
+        return _mm_cvtepi32_ps(s32);
+    }
+    static inline Reg frameOffsets() {
+        return _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+    }
+    static inline void interleave(CSAMPLE* p, Reg a, Reg b) {
+        _mm_storeu_ps(p, _mm_unpacklo_ps(a, b));
+        _mm_storeu_ps(p + kWidth, _mm_unpackhi_ps(a, b));
+    }
+    static inline void deinterleave(const CSAMPLE* p, Reg* pA, Reg* pB) {
+        const __m128 lo = _mm_loadu_ps(p);
+        const __m128 hi = _mm_loadu_ps(p + kWidth);
+        *pA = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        *pB = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
+
+} // anonymous namespace
+
+#include "sampleutil_simd.h"
+
+const SampleUtilKernels* sampleUtilKernelsSse2() {
+    return simdKernels<Sse2>();
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#else // SAMPLEUTIL_SIMD_X86
+
+#include <cstddef>
+
+const SampleUtilKernels* sampleUtilKernelsSse2() {
+    return NULL;
+}
+
+#endif // SAMPLEUTIL_SIMD_X86
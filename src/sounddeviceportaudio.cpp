@@ -31,19 +31,24 @@
 #include "soundmanagerutil.h"
 #include "controlobject.h"
 #include "visualplayposition.h"
+#include "util/realtimeallocationdetector.h"
 #include "util/timer.h"
 #include "util/trace.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 #include "sampleutil.h"
 #include "controlobjectslave.h"
+#include "control/controlnotifier.h"
 #include "util/performancetimer.h"
 #include "util/denormalsarezero.h"
+#include "util/compatibility.h"
 
 static const int kDriftReserve = 1; // Buffer for drift correction 1 full, 1 for r/w, 1 empty
 static const int kFifoSize = 2 * kDriftReserve + 1; // Buffer for drift correction 1 full, 1 for r/w, 1 empty
 
 // static
 volatile int SoundDevicePortAudio::m_underflowHappend = 0;
+// static
+QAtomicInt SoundDevicePortAudio::m_underflowCount;
 
 SoundDevicePortAudio::SoundDevicePortAudio(ConfigObject<ConfigValue> *config, SoundManager *sm,
                                            const PaDeviceInfo *deviceInfo, unsigned int devIndex)
@@ -57,6 +62,7 @@ SoundDevicePortAudio::SoundDevicePortAudio(ConfigObject<ConfigValue> *config, So
           m_inputDrift(false),
           m_bSetThreadPriority(false),
           m_underflowUpdateCount(0),
+          m_lastUnderflowCount(0),
           m_nsInAudioCb(0),
           m_framesSinceAudioLatencyUsageUpdate(0),
           m_syncBuffers(2) {
@@ -389,14 +395,14 @@ void SoundDevicePortAudio::readProcess() {
                 CSAMPLE* lastFrame = &dataPtr1[size1 - m_inputParams.channelCount];
                 if (err == paInputOverflowed) {
                     //qDebug() << "SoundDevicePortAudio::readProcess() Pa_ReadStream paInputOverflowed" << getInternalName();
-                    m_underflowHappend = 1;
+                    setUnderflowHappened();
                 }
                 if (size2 > 0) {
                     PaError err = Pa_ReadStream(pStream, dataPtr2, size2 / m_inputParams.channelCount);
                     lastFrame = &dataPtr2[size2 - m_inputParams.channelCount];
                     if (err == paInputOverflowed) {
                         //qDebug() << "SoundDevicePortAudio::readProcess() Pa_ReadStream paInputOverflowed" << getInternalName();
-                        m_underflowHappend = 1;
+                        setUnderflowHappened();
                     }
                 }
                 m_inputFifo->releaseWriteRegions(copyCount);
@@ -412,7 +418,7 @@ void SoundDevicePortAudio::readProcess() {
                             //qDebug()
                             //        << "SoundDevicePortAudio::readProcess() Pa_ReadStream paInputOverflowed"
                             //        << getInternalName();
-                            m_underflowHappend = 1;
+                            setUnderflowHappened();
                         }
                     } else {
                         m_inputDrift = true;
@@ -442,7 +448,7 @@ void SoundDevicePortAudio::readProcess() {
         int readCount = inChunkSize;
         if (inChunkSize > readAvailable) {
             readCount = readAvailable;
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "readProcess()" << (float)readAvailable / inChunkSize << "underflow";
         }
         if (readCount) {
@@ -481,7 +487,7 @@ void SoundDevicePortAudio::writeProcess() {
         int writeCount = outChunkSize;
         if (outChunkSize > writeAvailable) {
             writeCount = writeAvailable;
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "writeProcess():" << (float) writeAvailable / outChunkSize << "Overflow";
         }
         if (writeCount) {
@@ -521,7 +527,7 @@ void SoundDevicePortAudio::writeProcess() {
                     for (int i = 0; i < writeAvailable - copyCount; i += m_outputParams.channelCount) {
                         Pa_WriteStream(pStream, dataPtr1, 1);
                     }
-                    m_underflowHappend = 1;
+                    setUnderflowHappened();
                 } else if (writeAvailable > readAvailable + outChunkSize / 2) {
                     // try to keep PAs buffer filled up to 0.5 chunks
                     if (m_outputDrift) {
@@ -531,7 +537,7 @@ void SoundDevicePortAudio::writeProcess() {
                         PaError err = Pa_WriteStream(pStream, dataPtr1, 1);
                         if (err == paOutputUnderflowed) {
                             //qDebug() << "SoundDevicePortAudio::writeProcess() Pa_ReadStream paOutputUnderflowed";
-                            m_underflowHappend = 1;
+                            setUnderflowHappened();
                         }
                     } else {
                         //qDebug() << "SoundDevicePortAudio::writeProcess() OK" << (float)writeAvailable / outChunkSize << (float)readAvailable / outChunkSize;
@@ -552,13 +558,13 @@ void SoundDevicePortAudio::writeProcess() {
                 PaError err = Pa_WriteStream(pStream, dataPtr1, size1 / m_outputParams.channelCount);
                 if (err == paOutputUnderflowed) {
                     //qDebug() << "SoundDevicePortAudio::writeProcess() Pa_ReadStream paOutputUnderflowed" << getInternalName();
-                    m_underflowHappend = 1;
+                    setUnderflowHappened();
                 }
                 if (size2 > 0) {
                     PaError err = Pa_WriteStream(pStream, dataPtr2, size2 / m_outputParams.channelCount);
                     if (err == paOutputUnderflowed) {
                         //qDebug() << "SoundDevicePortAudio::writeProcess() Pa_WriteStream paOutputUnderflowed" << getInternalName();
-                        m_underflowHappend = 1;
+                        setUnderflowHappened();
                     }
                 }
                 m_outputFifo->releaseReadRegions(copyCount);
@@ -575,7 +581,7 @@ int SoundDevicePortAudio::callbackProcessDrift(const unsigned int framesPerBuffe
     Trace trace("SoundDevicePortAudio::callbackProcessDrift %1", getInternalName());
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
-        m_underflowHappend = 1;
+        setUnderflowHappened();
     }
 
     // Since we are on the non Clock reference device and may have an independent
@@ -637,11 +643,11 @@ int SoundDevicePortAudio::callbackProcessDrift(const unsigned int framesPerBuffe
         } else if (writeAvailable) {
             // Fifo Overflow
             m_inputFifo->write(in, writeAvailable);
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcessDrift write:" << (float) readAvailable / inChunkSize << "Overflow";
         } else {
             // Buffer full
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcessDrift write:" << (float) readAvailable / inChunkSize << "Buffer full";
         }
     }
@@ -683,12 +689,12 @@ int SoundDevicePortAudio::callbackProcessDrift(const unsigned int framesPerBuffe
             // underflow
             SampleUtil::clear(&out[readAvailable],
                     outChunkSize - readAvailable);
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Underflow";
         } else {
             // underflow
             SampleUtil::clear(out, outChunkSize);
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcess read:" << (float)readAvailable / outChunkSize << "Buffer empty";
         }
      }
@@ -703,7 +709,7 @@ int SoundDevicePortAudio::callbackProcess(const unsigned int framesPerBuffer,
     Trace trace("SoundDevicePortAudio::callbackProcess %1", getInternalName());
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
-        m_underflowHappend = 1;
+        setUnderflowHappened();
         //qDebug() << "callbackProcess read:" << "Underflow";
 
     }
@@ -716,11 +722,11 @@ int SoundDevicePortAudio::callbackProcess(const unsigned int framesPerBuffer,
         } else if (writeAvailable) {
             // Fifo Overflow
             m_inputFifo->write(in, writeAvailable);
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcess write:" << "Overflow";
         } else {
             // Buffer full
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcess write:" << "Buffer full";
         }
     }
@@ -736,12 +742,12 @@ int SoundDevicePortAudio::callbackProcess(const unsigned int framesPerBuffer,
             // underflow
             SampleUtil::clear(&out[readAvailable],
                     outChunkSize - readAvailable);
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcess read:" << "Underflow";
         } else {
             // underflow
             SampleUtil::clear(out, outChunkSize);
-            m_underflowHappend = 1;
+            setUnderflowHappened();
             //qDebug() << "callbackProcess read:" << "Buffer empty";
         }
      }
@@ -764,6 +770,10 @@ int SoundDevicePortAudio::callbackProcessClkRef(const unsigned int framesPerBuff
         QThread::currentThread()->setPriority(QThread::TimeCriticalPriority);
         m_bSetThreadPriority = true;
 
+        // Keep control change notifications of the engine out of Qt's event
+        // system.
+        ControlNotifier::registerRealtimeThread();
+
         // This disables the denormals calculations, to avoid a
         // performance penalty of ~20
         // https://bugs.launchpad.net/mixxx/+bug/1404401
@@ -782,12 +792,22 @@ int SoundDevicePortAudio::callbackProcessClkRef(const unsigned int framesPerBuff
              qDebug() << "SSE: Flush to zero mode already enabled";
         }
 #endif
+        // Must come last since the debug output above allocates.
+        RealtimeAllocationDetector::markRealtimeThread();
     }
 
     VisualPlayPosition::setTimeInfo(timeInfo);
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
-        m_underflowHappend = true;
+        setUnderflowHappened();
+    }
+
+    // Blame the underflows of all devices since the last callback on the
+    // previous engine callback.
+    const int underflowCount = load_atomic(m_underflowCount);
+    if (underflowCount != m_lastUnderflowCount) {
+        m_lastUnderflowCount = underflowCount;
+        m_pSoundManager->reportXrun();
     }
 
     if (m_underflowUpdateCount == 0) {
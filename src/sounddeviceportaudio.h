@@ -20,6 +20,7 @@
 
 #include <portaudio.h>
 
+#include <QAtomicInt>
 #include <QString>
 
 #include "sounddevice.h"
@@ -94,8 +95,19 @@ class SoundDevicePortAudio : public SoundDevice {
     ControlObjectSlave* m_pMasterAudioLatencyOverloadCount;
     ControlObjectSlave* m_pMasterAudioLatencyUsage;
     ControlObjectSlave* m_pMasterAudioLatencyOverload;
+    // Flags an underflow for the overload indicator and counts it for the
+    // CallbackProfiler.
+    static inline void setUnderflowHappened() {
+        m_underflowHappend = 1;
+        m_underflowCount.ref();
+    }
+
     int m_underflowUpdateCount;
     static volatile int m_underflowHappend;
+    // The number of underflows of all devices.
+    static QAtomicInt m_underflowCount;
+    // m_underflowCount when the last underflow was reported to SoundManager.
+    int m_lastUnderflowCount;
     qint64 m_nsInAudioCb;
     int m_framesSinceAudioLatencyUsageUpdate;
     int m_syncBuffers;
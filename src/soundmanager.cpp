@@ -483,6 +483,10 @@ void SoundManager::onDeviceOutputCallback(const unsigned int iFramesPerBuffer) {
     m_pMaster->process(iFramesPerBuffer*2);
 }
 
+void SoundManager::reportXrun() {
+    m_pMaster->getCallbackProfiler()->reportXrun();
+}
+
 void SoundManager::pushInputBuffers(const QList<AudioInputBuffer>& inputs,
                                     const unsigned int iFramesPerBuffer) {
    for (QList<AudioInputBuffer>::ConstIterator i = inputs.begin(),
@@ -93,6 +93,10 @@ class SoundManager : public QObject {
 
     void onDeviceOutputCallback(const unsigned int iFramesPerBuffer);
 
+    // Called by the clock reference device when a device reported an
+    // underflow or overflow since its last callback.
+    void reportXrun();
+
     // Used by SoundDevices to "push" any audio from their inputs that they have
     // into the mixing engine.
     void pushInputBuffers(const QList<AudioInputBuffer>& inputs,
@@ -0,0 +1,117 @@
+#include "sources/audiosourcepcmcache.h"
+
+#include <QDateTime>
+#include <QtDebug>
+
+#include <cstddef>
+#include <cstring>
+
+#include "util/math.h"
+
+namespace Mixxx {
+
+const char PcmCacheFileHeader::kMagic[8] = {'M', 'I', 'X', 'X', 'X', 'P', 'C', 'M'};
+const quint32 PcmCacheFileHeader::kVersion = 1;
+
+AudioSourcePcmCache::AudioSourcePcmCache(QUrl url)
+        : AudioSource(url),
+          m_pMappedFile(NULL),
+          m_pSampleData(NULL),
+          m_curFrameIndex(getMinFrameIndex()) {
+}
+
+AudioSourcePcmCache::~AudioSourcePcmCache() {
+    close();
+}
+
+Result AudioSourcePcmCache::open(const QString& fileName, qint64 sourceModified) {
+    DEBUG_ASSERT(!m_pMappedFile);
+    m_file.setFileName(fileName);
+    // Opened for writing only to update the time of last use.
+    if (!m_file.open(QIODevice::ReadWrite) && !m_file.open(QIODevice::ReadOnly)) {
+        return ERR;
+    }
+
+    PcmCacheFileHeader header;
+    if (m_file.read(reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header)) {
+        qWarning() << "Truncated PCM cache file:" << fileName;
+        close();
+        return ERR;
+    }
+    const qint64 dataSize = header.frameCount *
+            kChannelCountStereo * static_cast<qint64>(sizeof(CSAMPLE));
+    if (memcmp(header.magic, PcmCacheFileHeader::kMagic, sizeof(header.magic)) != 0 ||
+            header.version != PcmCacheFileHeader::kVersion ||
+            header.channelCount != kChannelCountStereo ||
+            header.sampleSize != sizeof(CSAMPLE) ||
+            !isValidFrameRate(header.frameRate) ||
+            !isValidFrameCount(header.frameCount) ||
+            m_file.size() < static_cast<qint64>(sizeof(header)) + dataSize) {
+        qWarning() << "Invalid PCM cache file:" << fileName;
+        close();
+        return ERR;
+    }
+    if (header.sourceModified != sourceModified) {
+        // The track has been modified since it has been cached.
+        close();
+        return ERR;
+    }
+
+    if (m_file.isWritable()) {
+        header.lastUsed = QDateTime::currentDateTime().toMSecsSinceEpoch();
+        m_file.seek(offsetof(PcmCacheFileHeader, lastUsed));
+        m_file.write(reinterpret_cast<const char*>(&header.lastUsed),
+                sizeof(header.lastUsed));
+        m_file.flush();
+    }
+
+    m_pMappedFile = m_file.map(0, sizeof(header) + dataSize);
+    if (!m_pMappedFile) {
+        // e.g. if the address space is exhausted on 32-bit systems
+        qWarning() << "Failed to map PCM cache file:" << fileName
+                << m_file.errorString();
+        close();
+        return ERR;
+    }
+    m_pSampleData = reinterpret_cast<const CSAMPLE*>(m_pMappedFile + sizeof(header));
+
+    setChannelCount(header.channelCount);
+    setFrameRate(header.frameRate);
+    setFrameCount(header.frameCount);
+    m_curFrameIndex = getMinFrameIndex();
+
+    return OK;
+}
+
+void AudioSourcePcmCache::close() {
+    if (m_pMappedFile) {
+        m_file.unmap(m_pMappedFile);
+        m_pMappedFile = NULL;
+        m_pSampleData = NULL;
+    }
+    m_file.close();
+}
+
+SINT AudioSourcePcmCache::seekSampleFrame(SINT frameIndex) {
+    DEBUG_ASSERT(isValidFrameIndex(frameIndex));
+    m_curFrameIndex = frameIndex;
+    return m_curFrameIndex;
+}
+
+SINT AudioSourcePcmCache::readSampleFrames(
+        SINT numberOfFrames, CSAMPLE* sampleBuffer) {
+    DEBUG_ASSERT(m_pSampleData);
+    const SINT framesToRead = math_min(numberOfFrames,
+            getMaxFrameIndex() - m_curFrameIndex);
+    if (framesToRead <= 0) {
+        return 0;
+    }
+    if (sampleBuffer) {
+        memcpy(sampleBuffer, m_pSampleData + frames2samples(m_curFrameIndex),
+                frames2samples(framesToRead) * sizeof(CSAMPLE));
+    }
+    m_curFrameIndex += framesToRead;
+    return framesToRead;
+}
+
+} // namespace Mixxx
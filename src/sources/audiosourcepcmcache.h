@@ -0,0 +1,58 @@
+#ifndef MIXXX_AUDIOSOURCEPCMCACHE_H
+#define MIXXX_AUDIOSOURCEPCMCACHE_H
+
+#include "sources/audiosource.h"
+
+#include <QFile>
+
+namespace Mixxx {
+
+// The header of a decoded PCM cache file. It is followed by getFrameCount()
+// frames of interleaved stereo CSAMPLEs. The header size is a multiple of 16
+// bytes so that the sample data of a mapped file is suitably aligned.
+struct PcmCacheFileHeader {
+    static const char kMagic[8];
+    static const quint32 kVersion;
+
+    char magic[8];
+    quint32 version;
+    quint32 channelCount;
+    quint32 frameRate;
+    quint32 sampleSize;
+    qint64 frameCount;
+    // The modification time of the source file in msecs since the epoch.
+    qint64 sourceModified;
+    // The time the file was written or last opened for reading in msecs
+    // since the epoch. PcmCache evicts the least recently used files first.
+    qint64 lastUsed;
+    char reserved[16];
+};
+
+// Reads decoded samples from a PCM cache file (see PcmCache) that is mapped
+// into memory. Seeking is exact and reading is a plain copy.
+class AudioSourcePcmCache: public AudioSource {
+public:
+    // url is the URL of the original track.
+    explicit AudioSourcePcmCache(QUrl url);
+    ~AudioSourcePcmCache();
+
+    // Maps the cache file. Fails if the file is corrupt or if it has been
+    // created from a source file with a different modification time.
+    Result open(const QString& fileName, qint64 sourceModified);
+    void close();
+
+    SINT seekSampleFrame(SINT frameIndex) override;
+
+    SINT readSampleFrames(SINT numberOfFrames,
+            CSAMPLE* sampleBuffer) override;
+
+private:
+    QFile m_file;
+    uchar* m_pMappedFile;
+    const CSAMPLE* m_pSampleData;
+    SINT m_curFrameIndex;
+};
+
+} // namespace Mixxx
+
+#endif // MIXXX_AUDIOSOURCEPCMCACHE_H
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <QPersistentModelIndex>
+#include <QScopedPointer>
+#include <QtDebug>
+
+#include "library/librarytablemodel.h"
+#include "test/librarytest.h"
+
+class BaseSqlTableModelTest : public LibraryTest {
+  protected:
+    BaseSqlTableModelTest()
+            : m_pModel(new LibraryTableModel(NULL, collection(),
+                                             "mixxx.db.model.library")) {
+    }
+
+    // Replaces the rows of the model with rows of the given track ids, as
+    // select() does. value becomes the value of the second column.
+    void replaceRows(const QList<int>& trackIds,
+                     const QString& value = QString()) {
+        QVector<BaseSqlTableModel::RowInfo> rowInfo;
+        for (int i = 0; i < trackIds.size(); ++i) {
+            BaseSqlTableModel::RowInfo row;
+            row.trackId = TrackId(trackIds.at(i));
+            row.order = i;
+            row.metadata << trackIds.at(i) << value;
+            rowInfo.append(row);
+        }
+        m_pModel->replaceRows(rowInfo);
+    }
+
+    QList<int> trackIds() const {
+        QList<int> trackIds;
+        for (const auto& row: m_pModel->m_rowInfo) {
+            trackIds.append(row.trackId.toInt());
+        }
+        return trackIds;
+    }
+
+    QList<int> rowsOfTrack(int trackId) const {
+        QList<int> rows;
+        for (int row: m_pModel->getTrackRows(TrackId(trackId))) {
+            rows.append(row);
+        }
+        return rows;
+    }
+
+    QPersistentModelIndex persistentIndex(int row) const {
+        return QPersistentModelIndex(m_pModel->index(row, 0));
+    }
+
+    static QList<int> range(int first, int last) {
+        QList<int> values;
+        for (int i = first; i <= last; ++i) {
+            values.append(i);
+        }
+        return values;
+    }
+
+    QScopedPointer<LibraryTableModel> m_pModel;
+};
+
+namespace {
+
+TEST_F(BaseSqlTableModelTest, ReorderedRowsKeepPersistentIndices) {
+    replaceRows(range(1, 5));
+    const QPersistentModelIndex second = persistentIndex(1);
+    const QPersistentModelIndex fourth = persistentIndex(3);
+
+    replaceRows(QList<int>() << 5 << 4 << 3 << 2 << 1);
+
+    EXPECT_EQ(QList<int>() << 5 << 4 << 3 << 2 << 1, trackIds());
+    ASSERT_TRUE(second.isValid());
+    EXPECT_EQ(3, second.row());
+    ASSERT_TRUE(fourth.isValid());
+    EXPECT_EQ(1, fourth.row());
+    EXPECT_EQ(QList<int>() << 0, rowsOfTrack(5));
+}
+
+TEST_F(BaseSqlTableModelTest, NarrowedSearchRemovesRows) {
+    replaceRows(range(1, 6));
+    const QPersistentModelIndex removed = persistentIndex(2);
+    const QPersistentModelIndex kept = persistentIndex(3);
+
+    replaceRows(QList<int>() << 2 << 4 << 6);
+
+    EXPECT_EQ(QList<int>() << 2 << 4 << 6, trackIds());
+    EXPECT_FALSE(removed.isValid());
+    ASSERT_TRUE(kept.isValid());
+    EXPECT_EQ(1, kept.row());
+    EXPECT_TRUE(rowsOfTrack(3).isEmpty());
+}
+
+TEST_F(BaseSqlTableModelTest, WidenedSearchInsertsRows) {
+    replaceRows(QList<int>() << 2 << 4);
+    const QPersistentModelIndex first = persistentIndex(0);
+    const QPersistentModelIndex second = persistentIndex(1);
+
+    replaceRows(range(1, 5));
+
+    EXPECT_EQ(range(1, 5), trackIds());
+    ASSERT_TRUE(first.isValid());
+    EXPECT_EQ(1, first.row());
+    ASSERT_TRUE(second.isValid());
+    EXPECT_EQ(3, second.row());
+    EXPECT_EQ(QList<int>() << 4, rowsOfTrack(5));
+}
+
+TEST_F(BaseSqlTableModelTest, DuplicateTracksAreMatchedInOrder) {
+    // A playlist can contain a track more than once.
+    replaceRows(QList<int>() << 1 << 2 << 1 << 3);
+    const QPersistentModelIndex firstOfTrack = persistentIndex(0);
+    const QPersistentModelIndex secondOfTrack = persistentIndex(2);
+    const QPersistentModelIndex removed = persistentIndex(1);
+    const QPersistentModelIndex last = persistentIndex(3);
+
+    replaceRows(QList<int>() << 1 << 3 << 1);
+
+    EXPECT_EQ(QList<int>() << 1 << 3 << 1, trackIds());
+    ASSERT_TRUE(firstOfTrack.isValid());
+    EXPECT_EQ(0, firstOfTrack.row());
+    ASSERT_TRUE(secondOfTrack.isValid());
+    EXPECT_EQ(2, secondOfTrack.row());
+    EXPECT_FALSE(removed.isValid());
+    ASSERT_TRUE(last.isValid());
+    EXPECT_EQ(1, last.row());
+    EXPECT_EQ(QList<int>() << 0 << 2, rowsOfTrack(1));
+}
+
+TEST_F(BaseSqlTableModelTest, ChangedValuesAreUpdated) {
+    replaceRows(range(1, 3), "old");
+    const QPersistentModelIndex second = persistentIndex(1);
+
+    replaceRows(range(1, 3), "new");
+
+    ASSERT_TRUE(second.isValid());
+    EXPECT_EQ(1, second.row());
+    for (const auto& row: m_pModel->m_rowInfo) {
+        EXPECT_EQ(QVariant("new"), row.metadata.at(1));
+    }
+}
+
+TEST_F(BaseSqlTableModelTest, ManyChangesResetTheModel) {
+    // Every other row is removed, more runs than replaceRows() moves one by
+    // one.
+    replaceRows(range(1, 400));
+    const QPersistentModelIndex index = persistentIndex(1);
+    QList<int> odd;
+    for (int i = 1; i <= 400; i += 2) {
+        odd.append(i);
+    }
+
+    replaceRows(odd);
+
+    EXPECT_EQ(odd, trackIds());
+    // A reset invalidates all persistent indices.
+    EXPECT_FALSE(index.isValid());
+    EXPECT_EQ(QList<int>() << 1, rowsOfTrack(3));
+}
+
+} // namespace
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+
+#include "engine/callbackprofiler.h"
+
+namespace {
+
+// With one frame per second the deadline is so long that every callback is
+// within the first histogram bucket.
+const int kRelaxedSampleRate = 1;
+// With one frame per nanosecond every callback is over twice its deadline.
+const int kImpossibleSampleRate = 1000000000;
+
+class CallbackProfilerTest : public testing::Test {
+  protected:
+    void runCallback(int sampleRate) {
+        m_profiler.beginCallback(1, sampleRate);
+        m_profiler.lap(CallbackProfile::STAGE_CHANNELS);
+        m_profiler.endCallback();
+    }
+
+    CallbackProfiler m_profiler;
+};
+
+TEST_F(CallbackProfilerTest, NoCallbacks) {
+    m_profiler.collect();
+    EXPECT_EQ(0u, m_profiler.callbackCount());
+    EXPECT_EQ(0u, m_profiler.lateCallbackCount());
+    EXPECT_TRUE(m_profiler.slowestCallbacks().isEmpty());
+    EXPECT_TRUE(m_profiler.xrunCallbacks().isEmpty());
+}
+
+TEST_F(CallbackProfilerTest, Histogram) {
+    for (int i = 0; i < 3; ++i) {
+        runCallback(kRelaxedSampleRate);
+    }
+    for (int i = 0; i < 2; ++i) {
+        runCallback(kImpossibleSampleRate);
+    }
+    m_profiler.collect();
+    EXPECT_EQ(5u, m_profiler.callbackCount());
+    EXPECT_EQ(3u, m_profiler.histogramBucket(0));
+    EXPECT_EQ(2u, m_profiler.histogramBucket(
+            CallbackProfiler::kHistogramBuckets - 1));
+    EXPECT_EQ(2u, m_profiler.lateCallbackCount());
+
+    m_profiler.reset();
+    EXPECT_EQ(0u, m_profiler.callbackCount());
+    EXPECT_EQ(0u, m_profiler.histogramBucket(0));
+}
+
+TEST_F(CallbackProfilerTest, SlowestCallbacksAreSorted) {
+    for (int i = 0; i < 3 * CallbackProfiler::kKeptCallbacks; ++i) {
+        runCallback(kRelaxedSampleRate);
+    }
+    m_profiler.collect();
+    QList<CallbackProfile> slowest = m_profiler.slowestCallbacks();
+    ASSERT_EQ(CallbackProfiler::kKeptCallbacks, slowest.size());
+    for (int i = 1; i < slowest.size(); ++i) {
+        EXPECT_GE(slowest[i - 1].callbackNanos, slowest[i].callbackNanos);
+    }
+}
+
+TEST_F(CallbackProfilerTest, XrunBlamesPreviousCallback) {
+    runCallback(kRelaxedSampleRate);
+    runCallback(kRelaxedSampleRate);
+    m_profiler.reportXrun();
+    runCallback(kRelaxedSampleRate);
+    runCallback(kRelaxedSampleRate);
+    m_profiler.collect();
+
+    QList<CallbackProfile> xruns = m_profiler.xrunCallbacks();
+    ASSERT_EQ(1, xruns.size());
+    EXPECT_EQ(1u, xruns[0].callbackNumber);
+}
+
+TEST_F(CallbackProfilerTest, ChannelAndEffectChainTimes) {
+    const int slot = CallbackProfiler::effectChainSlot("[CallbackProfilerTest1]");
+    ASSERT_GE(slot, 0);
+    EXPECT_EQ(slot, CallbackProfiler::effectChainSlot("[CallbackProfilerTest1]"));
+    EXPECT_NE(slot, CallbackProfiler::effectChainSlot("[CallbackProfilerTest2]"));
+
+    m_profiler.setChannelName(3, "[Channel4]");
+    m_profiler.beginCallback(1, kRelaxedSampleRate);
+    m_profiler.addChannelTime(3, 1000);
+    m_profiler.addChannelTime(kCallbackProfilerMaxChannels, 1000);
+    m_profiler.addEffectChainTime(slot, 200);
+    m_profiler.addEffectChainTime(slot, 300);
+    m_profiler.endCallback();
+    // The effect chain time doesn't leak into the next callback.
+    runCallback(kRelaxedSampleRate);
+    m_profiler.collect();
+
+    QList<CallbackProfile> slowest = m_profiler.slowestCallbacks();
+    ASSERT_EQ(2, slowest.size());
+    const CallbackProfile& first = slowest[0].callbackNumber == 0 ?
+            slowest[0] : slowest[1];
+    const CallbackProfile& second = slowest[0].callbackNumber == 0 ?
+            slowest[1] : slowest[0];
+    EXPECT_EQ(1000, first.channelNanos[3]);
+    EXPECT_EQ(500, first.effectChainNanos[slot]);
+    EXPECT_EQ(0, second.channelNanos[3]);
+    EXPECT_EQ(0, second.effectChainNanos[slot]);
+
+    QString report = m_profiler.report();
+    EXPECT_TRUE(report.contains("[Channel4]")) << report.toStdString();
+    EXPECT_TRUE(report.contains("[CallbackProfilerTest1]")) << report.toStdString();
+}
+
+TEST_F(CallbackProfilerTest, FullFifoDropsProfiles) {
+    const int callbacks = 5000;
+    for (int i = 0; i < callbacks; ++i) {
+        runCallback(kRelaxedSampleRate);
+    }
+    m_profiler.collect();
+    EXPECT_GT(m_profiler.droppedProfileCount(), 0u);
+    EXPECT_EQ(static_cast<quint64>(callbacks),
+              m_profiler.callbackCount() + m_profiler.droppedProfileCount());
+}
+
+}  // namespace
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+
+#include "library/columnartrackindex.h"
+
+namespace {
+
+class ColumnarTrackIndexTest : public testing::Test {
+  protected:
+    typedef ColumnarTrackIndex::SortColumn SortColumn;
+
+    ColumnarTrackIndexTest()
+            : m_index(2) {
+    }
+
+    // Adds a track with the given values in column 0 and 1.
+    void addTrack(int id, const QVariant& value0, const QVariant& value1) {
+        const int row = m_index.insertTrack(TrackId(id));
+        m_index.setValue(row, 0, value0);
+        m_index.setValue(row, 1, value1);
+        m_trackIds.append(TrackId(id));
+    }
+
+    // Returns the ids of all added tracks sorted by sortColumns.
+    QVector<int> sorted(const QVector<SortColumn>& sortColumns) const {
+        QVector<TrackId> trackIds(m_trackIds);
+        EXPECT_TRUE(m_index.sort(&trackIds, sortColumns));
+        QVector<int> result;
+        for (const auto& trackId: trackIds) {
+            result.append(trackId.toInt());
+        }
+        return result;
+    }
+
+    QVector<int> sorted(int column, Qt::SortOrder order) const {
+        QVector<SortColumn> sortColumns;
+        sortColumns.append(SortColumn(column, order));
+        return sorted(sortColumns);
+    }
+
+    static QVector<int> ids(int id1, int id2, int id3, int id4) {
+        QVector<int> result;
+        result << id1 << id2 << id3 << id4;
+        return result;
+    }
+
+    ColumnarTrackIndex m_index;
+    QVector<TrackId> m_trackIds;
+};
+
+TEST_F(ColumnarTrackIndexTest, ValuesRoundTrip) {
+    addTrack(1, QVariant(42), QVariant("Artist"));
+    addTrack(2, QVariant(1.5), QVariant("Artist"));
+
+    EXPECT_EQ(2, m_index.size());
+    EXPECT_TRUE(m_index.contains(TrackId(1)));
+    EXPECT_FALSE(m_index.contains(TrackId(3)));
+
+    // Integer values in a column of reals are reals from then on.
+    EXPECT_EQ(QVariant(42.0), m_index.value(TrackId(1), 0));
+    EXPECT_EQ(QVariant(1.5), m_index.value(TrackId(2), 0));
+    EXPECT_EQ(QVariant("Artist"), m_index.value(TrackId(1), 1));
+    EXPECT_EQ(QVariant("Artist"), m_index.value(TrackId(2), 1));
+
+    // Unknown tracks and columns
+    EXPECT_FALSE(m_index.value(TrackId(3), 0).isValid());
+    EXPECT_FALSE(m_index.value(TrackId(1), 2).isValid());
+}
+
+TEST_F(ColumnarTrackIndexTest, IntegersKeepTheirType) {
+    addTrack(1, QVariant(7), QVariant(static_cast<qlonglong>(1) << 40));
+
+    EXPECT_EQ(QVariant::Int, m_index.value(TrackId(1), 0).type());
+    EXPECT_EQ(7, m_index.value(TrackId(1), 0).toInt());
+    EXPECT_EQ(static_cast<qlonglong>(1) << 40,
+              m_index.value(TrackId(1), 1).toLongLong());
+}
+
+TEST_F(ColumnarTrackIndexTest, NullValues) {
+    addTrack(1, QVariant(QVariant::String), QVariant("Title"));
+    addTrack(2, QVariant(3), QVariant(QVariant::String));
+
+    EXPECT_TRUE(m_index.value(TrackId(1), 0).isNull());
+    EXPECT_TRUE(m_index.value(TrackId(2), 1).isNull());
+    EXPECT_EQ(QVariant(3), m_index.value(TrackId(2), 0));
+
+    // A value can be set to NULL and back.
+    const int row = m_index.insertTrack(TrackId(2));
+    m_index.setValue(row, 0, QVariant(QVariant::String));
+    EXPECT_TRUE(m_index.value(TrackId(2), 0).isNull());
+    m_index.setValue(row, 0, QVariant(4));
+    EXPECT_EQ(QVariant(4), m_index.value(TrackId(2), 0));
+}
+
+TEST_F(ColumnarTrackIndexTest, MixedTypesFallBackToVariants) {
+    addTrack(1, QVariant(5), QVariant("b"));
+    addTrack(2, QVariant("five"), QVariant(2));
+
+    EXPECT_EQ(QVariant(5), m_index.value(TrackId(1), 0));
+    EXPECT_EQ(QVariant("five"), m_index.value(TrackId(2), 0));
+    EXPECT_EQ(QVariant("b"), m_index.value(TrackId(1), 1));
+    EXPECT_EQ(QVariant(2), m_index.value(TrackId(2), 1));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortDefault) {
+    addTrack(1, QVariant("b"), QVariant(2.5));
+    addTrack(2, QVariant(QVariant::String), QVariant(-1.0));
+    addTrack(3, QVariant("a"), QVariant(10.0));
+    addTrack(4, QVariant("c"), QVariant(QVariant::String));
+
+    // NULL first
+    EXPECT_EQ(ids(2, 3, 1, 4), sorted(0, Qt::AscendingOrder));
+    EXPECT_EQ(ids(4, 1, 3, 2), sorted(0, Qt::DescendingOrder));
+    EXPECT_EQ(ids(4, 2, 1, 3), sorted(1, Qt::AscendingOrder));
+    EXPECT_EQ(ids(3, 1, 2, 4), sorted(1, Qt::DescendingOrder));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortNoCase) {
+    m_index.setCollation(0, ColumnarTrackIndex::COLLATE_NOCASE);
+    addTrack(1, QVariant("beta"), QVariant());
+    addTrack(2, QVariant("Alpha"), QVariant());
+    addTrack(3, QVariant("Gamma"), QVariant());
+    addTrack(4, QVariant("alpha"), QVariant());
+
+    // Equal values keep their order.
+    EXPECT_EQ(ids(2, 4, 1, 3), sorted(0, Qt::AscendingOrder));
+    EXPECT_EQ(ids(3, 1, 2, 4), sorted(0, Qt::DescendingOrder));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortInteger) {
+    m_index.setCollation(0, ColumnarTrackIndex::COLLATE_INTEGER);
+    addTrack(1, QVariant("10"), QVariant());
+    addTrack(2, QVariant("9/12"), QVariant());
+    addTrack(3, QVariant("A-Side"), QVariant());
+    addTrack(4, QVariant("2"), QVariant());
+
+    // Text without a number casts to 0.
+    EXPECT_EQ(ids(3, 4, 2, 1), sorted(0, Qt::AscendingOrder));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortMultipleColumns) {
+    addTrack(1, QVariant("Artist B"), QVariant(2));
+    addTrack(2, QVariant("Artist A"), QVariant(2));
+    addTrack(3, QVariant("Artist B"), QVariant(1));
+    addTrack(4, QVariant("Artist A"), QVariant(3));
+
+    QVector<SortColumn> sortColumns;
+    sortColumns.append(SortColumn(0, Qt::AscendingOrder));
+    sortColumns.append(SortColumn(1, Qt::DescendingOrder));
+    EXPECT_EQ(ids(4, 2, 1, 3), sorted(sortColumns));
+
+    sortColumns.clear();
+    sortColumns.append(SortColumn(1, Qt::AscendingOrder));
+    sortColumns.append(SortColumn(0, Qt::AscendingOrder));
+    EXPECT_EQ(ids(3, 2, 1, 4), sorted(sortColumns));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortAfterChanges) {
+    addTrack(1, QVariant("c"), QVariant());
+    addTrack(2, QVariant("b"), QVariant());
+    addTrack(3, QVariant("a"), QVariant());
+    addTrack(4, QVariant("d"), QVariant());
+    EXPECT_EQ(ids(3, 2, 1, 4), sorted(0, Qt::AscendingOrder));
+
+    m_index.setValue(m_index.insertTrack(TrackId(4)), 0, QVariant("0"));
+    EXPECT_EQ(ids(4, 3, 2, 1), sorted(0, Qt::AscendingOrder));
+}
+
+TEST_F(ColumnarTrackIndexTest, RemoveTrack) {
+    addTrack(1, QVariant(1), QVariant("one"));
+    addTrack(2, QVariant(2), QVariant("two"));
+    const int row = m_index.insertTrack(TrackId(2));
+
+    m_index.removeTrack(TrackId(2));
+    EXPECT_FALSE(m_index.contains(TrackId(2)));
+    EXPECT_EQ(1, m_index.size());
+
+    // The row is reused, without the values of the removed track.
+    EXPECT_EQ(row, m_index.insertTrack(TrackId(3)));
+    EXPECT_TRUE(m_index.value(TrackId(3), 0).isNull());
+    EXPECT_EQ(QVariant("one"), m_index.value(TrackId(1), 1));
+}
+
+TEST_F(ColumnarTrackIndexTest, SortUnknownTrack) {
+    addTrack(1, QVariant(2), QVariant());
+    addTrack(2, QVariant(1), QVariant());
+
+    QVector<TrackId> trackIds;
+    trackIds << TrackId(1) << TrackId(5) << TrackId(2);
+    QVector<SortColumn> sortColumns;
+    sortColumns.append(SortColumn(0, Qt::AscendingOrder));
+    EXPECT_FALSE(m_index.sort(&trackIds, sortColumns));
+    // Unchanged
+    EXPECT_EQ(TrackId(1), trackIds.at(0));
+    EXPECT_EQ(TrackId(5), trackIds.at(1));
+    EXPECT_EQ(TrackId(2), trackIds.at(2));
+}
+
+TEST_F(ColumnarTrackIndexTest, ClearKeepsCollations) {
+    m_index.setCollation(0, ColumnarTrackIndex::COLLATE_NOCASE);
+    addTrack(1, QVariant("x"), QVariant());
+    m_index.clear();
+    m_trackIds.clear();
+    EXPECT_EQ(0, m_index.size());
+    EXPECT_FALSE(m_index.contains(TrackId(1)));
+
+    addTrack(1, QVariant("b"), QVariant());
+    addTrack(2, QVariant("A"), QVariant());
+    addTrack(3, QVariant("c"), QVariant());
+    addTrack(4, QVariant("B"), QVariant());
+    EXPECT_EQ(ids(2, 1, 4, 3), sorted(0, Qt::AscendingOrder));
+}
+
+} // namespace
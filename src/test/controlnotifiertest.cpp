@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QThread>
+#include <QtDebug>
+
+#include "control/controlnotifier.h"
+#include "controlobject.h"
+#include "controlobjectslave.h"
+#include "test/mixxxtest.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+class ControlNotifierTest : public MixxxTest {
+  protected:
+    virtual void SetUp() {
+        m_pSource.reset(new ControlObject(ConfigKey("[Test]", "source")));
+        m_pSink.reset(new ControlObject(ConfigKey("[Test]", "sink")));
+        // Mirror every notification of [Test],source into [Test],sink.
+        m_pSourceSlave.reset(new ControlObjectSlave(ConfigKey("[Test]", "source")));
+        m_pSinkSlave.reset(new ControlObjectSlave(ConfigKey("[Test]", "sink")));
+        m_pSourceSlave->connectValueChanged(m_pSinkSlave.data(),
+                                            SLOT(slotSet(double)));
+        // Act as the GUI tick.
+        ControlNotifier::registerDispatcher();
+    }
+
+    virtual void TearDown() {
+        ControlNotifier::unregisterRealtimeThread();
+        ControlNotifier::unregisterDispatcher();
+    }
+
+    ScopedControl m_pSource;
+    ScopedControl m_pSink;
+    QScopedPointer<ControlObjectSlave> m_pSourceSlave;
+    QScopedPointer<ControlObjectSlave> m_pSinkSlave;
+};
+
+TEST_F(ControlNotifierTest, NotRealtimeThreadNotifiesImmediately) {
+    EXPECT_FALSE(ControlNotifier::isRealtimeThread());
+    m_pSource->set(1.0);
+    EXPECT_DOUBLE_EQ(1.0, m_pSink->get());
+}
+
+TEST_F(ControlNotifierTest, NoDispatcherNotifiesImmediately) {
+    ControlNotifier::registerRealtimeThread();
+    ControlNotifier::unregisterDispatcher();
+    EXPECT_FALSE(ControlNotifier::isDeferring());
+    m_pSource->set(1.0);
+    EXPECT_DOUBLE_EQ(1.0, m_pSink->get());
+    // Balance TearDown
+    ControlNotifier::registerDispatcher();
+}
+
+TEST_F(ControlNotifierTest, UnregisteringDispatcherDeliversPending) {
+    ControlNotifier::registerRealtimeThread();
+    m_pSource->set(1.0);
+    EXPECT_DOUBLE_EQ(0.0, m_pSink->get());
+    ControlNotifier::unregisterDispatcher();
+    EXPECT_DOUBLE_EQ(1.0, m_pSink->get());
+    ControlNotifier::registerDispatcher();
+}
+
+TEST_F(ControlNotifierTest, RealtimeThreadDefersUntilDispatch) {
+    ControlNotifier::registerRealtimeThread();
+    EXPECT_TRUE(ControlNotifier::isRealtimeThread());
+
+    m_pSource->set(1.0);
+    // The value itself is visible immediately, only the notification waits.
+    EXPECT_DOUBLE_EQ(1.0, m_pSourceSlave->get());
+    EXPECT_DOUBLE_EQ(0.0, m_pSink->get());
+
+    ControlNotifier::dispatch();
+    EXPECT_DOUBLE_EQ(1.0, m_pSink->get());
+}
+
+TEST_F(ControlNotifierTest, RepeatedSetsAreCoalesced) {
+    ControlNotifier::registerRealtimeThread();
+    for (int i = 1; i <= 100; ++i) {
+        m_pSource->set(i);
+    }
+    ControlNotifier::dispatch();
+    EXPECT_DOUBLE_EQ(100.0, m_pSink->get());
+
+    // Only a single notification was queued, so a second dispatch must not
+    // deliver anything.
+    m_pSink->set(0.0);
+    ControlNotifier::dispatch();
+    EXPECT_DOUBLE_EQ(0.0, m_pSink->get());
+}
+
+TEST_F(ControlNotifierTest, PendingNotificationsSurviveUnregister) {
+    ControlNotifier::registerRealtimeThread();
+    m_pSource->set(2.0);
+    ControlNotifier::unregisterRealtimeThread();
+    EXPECT_FALSE(ControlNotifier::isRealtimeThread());
+    ControlNotifier::dispatch();
+    EXPECT_DOUBLE_EQ(2.0, m_pSink->get());
+
+    // The control is not stuck in the pending state.
+    m_pSource->set(3.0);
+    EXPECT_DOUBLE_EQ(3.0, m_pSink->get());
+}
+
+TEST_F(ControlNotifierTest, DestroyedControlIsNotDispatched) {
+    ControlNotifier::registerRealtimeThread();
+    m_pSource->set(1.0);
+    m_pSourceSlave.reset();
+    m_pSource.reset();
+    ControlNotifier::dispatch();
+    EXPECT_DOUBLE_EQ(0.0, m_pSink->get());
+}
+
+class EngineSetterThread : public QThread {
+  public:
+    EngineSetterThread(ControlObject* pControl, int iterations, bool realtime)
+            : m_pControl(pControl),
+              m_iterations(iterations),
+              m_bRealtime(realtime),
+              m_elapsedNs(0) {
+    }
+
+    qint64 elapsedNs() const {
+        return m_elapsedNs;
+    }
+
+  protected:
+    void run() {
+        if (m_bRealtime) {
+            ControlNotifier::registerRealtimeThread();
+        }
+        PerformanceTimer timer;
+        timer.start();
+        for (int i = 1; i <= m_iterations; ++i) {
+            m_pControl->set(i);
+        }
+        m_elapsedNs = timer.elapsed();
+    }
+
+  private:
+    ControlObject* m_pControl;
+    const int m_iterations;
+    const bool m_bRealtime;
+    qint64 m_elapsedNs;
+};
+
+// Benchmark only, it cannot fail. Run with --gtest_also_run_disabled_tests.
+// Measures the cost of ControlObject::set from an engine thread while a
+// listener in the main thread is connected, with and without ControlNotifier.
+TEST_F(ControlNotifierTest, DISABLED_SetFromEngineThreadBenchmark) {
+    const int kIterations = 100000;
+    for (int realtime = 0; realtime <= 1; ++realtime) {
+        EngineSetterThread thread(m_pSource.data(), kIterations, realtime);
+        thread.start();
+        thread.wait();
+        // Deliver whatever was queued so that both runs start out clean.
+        ControlNotifier::dispatch();
+        QCoreApplication::processEvents();
+        qDebug() << (realtime ? "ControlNotifier:" : "Qt queued signal:")
+                 << static_cast<double>(thread.elapsedNs()) / kIterations
+                 << "ns per set";
+        EXPECT_DOUBLE_EQ(kIterations, m_pSink->get());
+        m_pSink->set(0.0);
+    }
+}
+
+}  // namespace
@@ -0,0 +1,271 @@
+#include <gtest/gtest.h>
+
+#include <QSet>
+
+#include "effects/effectprocessor.h"
+#include "effects/oversamplingeffectprocessor.h"
+#include "engine/channelhandle.h"
+#include "sampleutil.h"
+#include "util/types.h"
+
+namespace {
+
+// Counts how many states were constructed.
+struct CountingState {
+    CountingState() {
+        ++s_constructed;
+    }
+    static int s_constructed;
+};
+
+int CountingState::s_constructed = 0;
+
+class CountingProcessor : public PerChannelEffectProcessor<CountingState> {
+  public:
+    CountingProcessor()
+            : m_pLastState(NULL),
+              m_lastNumSamples(0),
+              m_lastSampleRate(0) {
+    }
+
+    void processChannel(const ChannelHandle& handle,
+                        CountingState* pState,
+                        const CSAMPLE* pInput, CSAMPLE* pOutput,
+                        const unsigned int numSamples,
+                        const unsigned int sampleRate,
+                        const EffectProcessor::EnableState enableState,
+                        const GroupFeatureState& groupFeatures) {
+        Q_UNUSED(handle);
+        Q_UNUSED(pInput);
+        Q_UNUSED(pOutput);
+        Q_UNUSED(enableState);
+        Q_UNUSED(groupFeatures);
+        m_pLastState = pState;
+        m_lastNumSamples = numSamples;
+        m_lastSampleRate = sampleRate;
+    }
+
+    CountingState* m_pLastState;
+    unsigned int m_lastNumSamples;
+    unsigned int m_lastSampleRate;
+};
+
+const int kDelayFrames = 100;
+
+struct DelayState {
+    DelayState()
+            : position(0) {
+        SampleUtil::clear(delay, kDelayFrames * 2);
+    }
+    CSAMPLE delay[kDelayFrames * 2];
+    int position;
+};
+
+// Delays the input by kDelayFrames, so its output is silent for a while
+// before the delayed input sounds.
+class DelayProcessor : public PerChannelEffectProcessor<DelayState> {
+  public:
+    DelayProcessor()
+            : m_iCalls(0) {
+    }
+
+    void processChannel(const ChannelHandle& handle,
+                        DelayState* pState,
+                        const CSAMPLE* pInput, CSAMPLE* pOutput,
+                        const unsigned int numSamples,
+                        const unsigned int sampleRate,
+                        const EffectProcessor::EnableState enableState,
+                        const GroupFeatureState& groupFeatures) {
+        Q_UNUSED(handle);
+        Q_UNUSED(sampleRate);
+        Q_UNUSED(enableState);
+        Q_UNUSED(groupFeatures);
+        for (unsigned int i = 0; i < numSamples; i += 2) {
+            CSAMPLE* pDelayed = pState->delay + pState->position * 2;
+            const CSAMPLE left = pInput[i];
+            const CSAMPLE right = pInput[i + 1];
+            pOutput[i] = pDelayed[0];
+            pOutput[i + 1] = pDelayed[1];
+            pDelayed[0] = left;
+            pDelayed[1] = right;
+            pState->position = (pState->position + 1) % kDelayFrames;
+        }
+        ++m_iCalls;
+    }
+
+    unsigned int tailFrames(const DelayState* pState,
+                            unsigned int sampleRate) const {
+        Q_UNUSED(pState);
+        Q_UNUSED(sampleRate);
+        return kDelayFrames;
+    }
+
+    int m_iCalls;
+};
+
+class EffectChannelStateTest : public testing::Test {
+  protected:
+    EffectChannelStateTest()
+            : m_channel1(m_factory.getOrCreateHandle("[Channel1]"), "[Channel1]"),
+              m_channel2(m_factory.getOrCreateHandle("[Channel2]"), "[Channel2]") {
+        CountingState::s_constructed = 0;
+    }
+
+    void process(const ChannelHandle& handle) {
+        CSAMPLE buffer[2] = { 0, 0 };
+        m_processor.process(handle, buffer, buffer, 2, 44100,
+                            EffectProcessor::ENABLED, m_features);
+    }
+
+    ChannelHandleFactory m_factory;
+    ChannelHandleAndGroup m_channel1;
+    ChannelHandleAndGroup m_channel2;
+    GroupFeatureState m_features;
+    CountingProcessor m_processor;
+};
+
+TEST_F(EffectChannelStateTest, InitializeCreatesRegisteredChannels) {
+    QSet<ChannelHandleAndGroup> registeredChannels;
+    registeredChannels.insert(m_channel1);
+    registeredChannels.insert(m_channel2);
+    m_processor.initialize(registeredChannels);
+    EXPECT_EQ(2, CountingState::s_constructed);
+
+    process(m_channel1.handle());
+    CountingState* pState1 = m_processor.m_pLastState;
+    process(m_channel2.handle());
+    EXPECT_NE(pState1, m_processor.m_pLastState);
+    process(m_channel1.handle());
+    EXPECT_EQ(pState1, m_processor.m_pLastState);
+    EXPECT_EQ(2, CountingState::s_constructed);
+}
+
+TEST_F(EffectChannelStateTest, LoadChannelState) {
+    QSet<ChannelHandleAndGroup> registeredChannels;
+    registeredChannels.insert(m_channel1);
+    m_processor.initialize(registeredChannels);
+
+    // Registering a channel later ships a state created up front.
+    EffectChannelState* pState = m_processor.createChannelState();
+    ASSERT_TRUE(pState != NULL);
+    EXPECT_TRUE(m_processor.loadChannelState(m_channel2.handle(), pState));
+    EXPECT_EQ(2, CountingState::s_constructed);
+    process(m_channel2.handle());
+    EXPECT_EQ(2, CountingState::s_constructed);
+
+    // A channel that has a state refuses another one.
+    EffectChannelState* pDuplicate = m_processor.createChannelState();
+    EXPECT_FALSE(m_processor.loadChannelState(m_channel1.handle(), pDuplicate));
+    delete pDuplicate;
+    EXPECT_FALSE(m_processor.loadChannelState(
+            m_factory.getOrCreateHandle("[Channel3]"), NULL));
+}
+
+TEST_F(EffectChannelStateTest, UnregisteredChannelPassesThrough) {
+    QSet<ChannelHandleAndGroup> registeredChannels;
+    registeredChannels.insert(m_channel1);
+    m_processor.initialize(registeredChannels);
+
+    // Only warns unless debug assertions are fatal.
+    CSAMPLE input[2] = { 0.5f, -0.5f };
+    CSAMPLE output[2] = { 0, 0 };
+    m_processor.process(m_channel2.handle(), input, output, 2, 44100,
+                        EffectProcessor::ENABLED, m_features);
+    EXPECT_FLOAT_EQ(0.5f, output[0]);
+    EXPECT_FLOAT_EQ(-0.5f, output[1]);
+    EXPECT_EQ(1, CountingState::s_constructed);
+    EXPECT_FALSE(m_processor.isSleeping(m_channel2.handle()));
+}
+
+TEST_F(EffectChannelStateTest, SleepsAfterTheTailWhileTheInputIsSilent) {
+    const int kFrames = 64;
+    CSAMPLE buffer[kFrames * 2];
+    DelayProcessor processor;
+    QSet<ChannelHandleAndGroup> registeredChannels;
+    registeredChannels.insert(m_channel1);
+    processor.initialize(registeredChannels);
+    const ChannelHandle handle = m_channel1.handle();
+
+    // Sounds in frames 0 to 63, so the output sounds in frames 100 to 163.
+    SampleUtil::fill(buffer, 0.5f, kFrames * 2);
+    processor.process(handle, buffer, buffer, kFrames * 2, 44100,
+                      EffectProcessor::ENABLED, m_features);
+    EXPECT_FALSE(processor.isSleeping(handle));
+
+    GroupFeatureState silence;
+    silence.has_silence = true;
+    silence.silence = true;
+    // The delayed sound ends in the second silent buffer. Only whole silent
+    // buffers count, so the effect sleeps after two more.
+    const CSAMPLE kExpectedFirstFrame[] = { 0.0f, 0.5f, 0.0f, 0.0f };
+    const CSAMPLE kExpectedLastFrame[] = { 0.5f, 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < 4; ++i) {
+        SampleUtil::clear(buffer, kFrames * 2);
+        processor.process(handle, buffer, buffer, kFrames * 2, 44100,
+                          EffectProcessor::ENABLED, silence);
+        EXPECT_FLOAT_EQ(kExpectedFirstFrame[i], buffer[0]) << i;
+        EXPECT_FLOAT_EQ(kExpectedLastFrame[i], buffer[kFrames * 2 - 1]) << i;
+        EXPECT_EQ(i == 3, processor.isSleeping(handle)) << i;
+    }
+    EXPECT_EQ(5, processor.m_iCalls);
+
+    // Sleeping clears the output without processing.
+    SampleUtil::fill(buffer, 0.25f, kFrames * 2);
+    processor.process(handle, buffer, buffer, kFrames * 2, 44100,
+                      EffectProcessor::ENABLED, silence);
+    EXPECT_FLOAT_EQ(0.0f, buffer[0]);
+    EXPECT_TRUE(processor.isSleeping(handle));
+    EXPECT_EQ(5, processor.m_iCalls);
+
+    // Sound wakes it up.
+    SampleUtil::fill(buffer, 0.5f, kFrames * 2);
+    processor.process(handle, buffer, buffer, kFrames * 2, 44100,
+                      EffectProcessor::ENABLED, m_features);
+    EXPECT_FALSE(processor.isSleeping(handle));
+
+    // Never sleeps while ramping.
+    for (int i = 0; i < 5; ++i) {
+        SampleUtil::clear(buffer, kFrames * 2);
+        processor.process(handle, buffer, buffer, kFrames * 2, 44100,
+                          EffectProcessor::DISABLING, silence);
+        EXPECT_FALSE(processor.isSleeping(handle));
+    }
+    EXPECT_EQ(11, processor.m_iCalls);
+}
+
+TEST_F(EffectChannelStateTest, OversamplingWrapsTheChannelStates) {
+    CountingProcessor* pInner = new CountingProcessor();
+    OversamplingEffectProcessor processor(pInner, 4, "test");
+    QSet<ChannelHandleAndGroup> registeredChannels;
+    registeredChannels.insert(m_channel1);
+    processor.initialize(registeredChannels);
+    EXPECT_EQ(1, CountingState::s_constructed);
+
+    CSAMPLE buffer[4] = { 0.5f, -0.5f, 0.5f, -0.5f };
+    processor.process(m_channel1.handle(), buffer, buffer, 4, 44100,
+                      EffectProcessor::ENABLED, m_features);
+    // The state created up front was handed to the wrapped processor.
+    EXPECT_EQ(1, CountingState::s_constructed);
+    CountingState* pState1 = pInner->m_pLastState;
+    EXPECT_EQ(44100u * 4, pInner->m_lastSampleRate);
+    EXPECT_EQ(4u * 4, pInner->m_lastNumSamples);
+
+    EffectChannelState* pState = processor.createChannelState();
+    EXPECT_EQ(2, CountingState::s_constructed);
+    EXPECT_TRUE(processor.loadChannelState(m_channel2.handle(), pState));
+    processor.process(m_channel2.handle(), buffer, buffer, 4, 44100,
+                      EffectProcessor::ENABLED, m_features);
+    EXPECT_EQ(2, CountingState::s_constructed);
+    EXPECT_NE(pState1, pInner->m_pLastState);
+
+    // Buffers longer than a block are processed in blocks.
+    const int kFrames = 3000;
+    CSAMPLE longBuffer[kFrames * 2];
+    SampleUtil::fill(longBuffer, 0.25f, kFrames * 2);
+    processor.process(m_channel1.handle(), longBuffer, longBuffer, kFrames * 2,
+                      44100, EffectProcessor::ENABLED, m_features);
+    EXPECT_EQ(pState1, pInner->m_pLastState);
+    EXPECT_EQ((kFrames % 1024) * 2u * 4, pInner->m_lastNumSamples);
+}
+
+}  // namespace
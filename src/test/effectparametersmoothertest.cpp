@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <QVector>
+
+#include "effects/effectparametersmoother.h"
+#include "util/types.h"
+
+namespace {
+
+const unsigned int kSampleRate = 44100;
+// The length of a default ramp in frames
+const int kRampFrames = static_cast<int>(kEffectParameterRampSeconds * kSampleRate);
+
+TEST(EffectParameterSmootherTest, FirstTargetJumps) {
+    EffectParameterSmoother smoother;
+    smoother.setTarget(0.5, kSampleRate);
+    EXPECT_FALSE(smoother.isRamping());
+    EXPECT_FLOAT_EQ(0.5, smoother.next());
+}
+
+TEST(EffectParameterSmootherTest, RampDoesNotDependOnBufferSize) {
+    const int bufferSizes[] = { 1, 64, 1000, kRampFrames, 4096 };
+    for (unsigned int i = 0; i < sizeof(bufferSizes) / sizeof(bufferSizes[0]); ++i) {
+        EffectParameterSmoother smoother;
+        smoother.reset(0.0);
+        smoother.setTarget(1.0, kSampleRate);
+        QVector<CSAMPLE> values(bufferSizes[i]);
+        int frames = 0;
+        while (frames < kRampFrames - 1) {
+            const int numFrames = math_min(bufferSizes[i], kRampFrames - 1 - frames);
+            smoother.fill(values.data(), numFrames);
+            frames += numFrames;
+        }
+        EXPECT_TRUE(smoother.isRamping()) << bufferSizes[i];
+        EXPECT_LT(smoother.value(), 1.0) << bufferSizes[i];
+        EXPECT_NEAR((kRampFrames - 1.0) / kRampFrames, smoother.value(), 1e-9)
+                << bufferSizes[i];
+        smoother.next();
+        EXPECT_FALSE(smoother.isRamping()) << bufferSizes[i];
+        EXPECT_EQ(1.0, smoother.value()) << bufferSizes[i];
+    }
+}
+
+TEST(EffectParameterSmootherTest, FillMatchesNext) {
+    const EffectParameterSmoother::Ramp ramps[] = {
+        EffectParameterSmoother::LINEAR, EffectParameterSmoother::EXPONENTIAL
+    };
+    for (int r = 0; r < 2; ++r) {
+        EffectParameterSmoother filled(ramps[r]);
+        EffectParameterSmoother stepped(ramps[r]);
+        filled.reset(100.0);
+        stepped.reset(100.0);
+        QVector<CSAMPLE> values(1000);
+        for (int buffer = 0; buffer < 5; ++buffer) {
+            // Retarget in the middle of a ramp
+            const double target = buffer % 2 ? 20000.0 : 300.0;
+            filled.setTarget(target, kSampleRate);
+            stepped.setTarget(target, kSampleRate);
+            filled.fill(values.data(), values.size());
+            for (int i = 0; i < values.size(); ++i) {
+                ASSERT_FLOAT_EQ(stepped.next(), values[i])
+                        << "ramp " << r << " buffer " << buffer << " frame " << i;
+            }
+        }
+    }
+}
+
+TEST(EffectParameterSmootherTest, ApplyGainMatchesNext) {
+    EffectParameterSmoother smoother;
+    EffectParameterSmoother stepped;
+    smoother.reset(1.0);
+    stepped.reset(1.0);
+    smoother.setTarget(0.25, kSampleRate);
+    stepped.setTarget(0.25, kSampleRate);
+
+    // Spans the end of the ramp
+    const int numFrames = kRampFrames + 100;
+    QVector<CSAMPLE> buffer(numFrames * 2);
+    for (int i = 0; i < buffer.size(); ++i) {
+        buffer[i] = i % 2 ? -0.5f : 0.5f;
+    }
+    smoother.applyGain(buffer.data(), numFrames);
+    // The ramping gain kernel accumulates its gain in single precision.
+    for (int i = 0; i < numFrames; ++i) {
+        const CSAMPLE gain = stepped.next();
+        ASSERT_NEAR(0.5 * gain, buffer[i * 2], 1e-4) << i;
+        ASSERT_NEAR(-0.5 * gain, buffer[i * 2 + 1], 1e-4) << i;
+    }
+    EXPECT_FLOAT_EQ(0.125f, buffer[numFrames * 2 - 2]);
+}
+
+TEST(EffectParameterSmootherTest, ExponentialRampIsGeometric) {
+    EffectParameterSmoother smoother(EffectParameterSmoother::EXPONENTIAL, 0.1);
+    smoother.reset(100.0);
+    smoother.setTarget(10000.0, 1000);
+    // Half way is the geometric mean, not the arithmetic one.
+    EXPECT_NEAR(1000.0, smoother.advance(50), 1e-6);
+    EXPECT_EQ(10000.0, smoother.advance(50));
+}
+
+TEST(EffectParameterSmootherTest, ExponentialRampFallsBackToLinear) {
+    EffectParameterSmoother smoother(EffectParameterSmoother::EXPONENTIAL, 0.1);
+    smoother.reset(0.0);
+    smoother.setTarget(1.0, 1000);
+    EXPECT_NEAR(0.5, smoother.advance(50), 1e-9);
+
+    smoother.setTarget(-1.0, 1000);
+    EXPECT_NEAR(-0.25, smoother.advance(50), 1e-9);
+    EXPECT_EQ(-1.0, smoother.advance(50));
+}
+
+}  // namespace
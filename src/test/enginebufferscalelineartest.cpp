@@ -8,6 +8,7 @@
 #include "util/math.h"
 #include "engine/readaheadmanager.h"
 #include "engine/enginebufferscalelinear.h"
+#include "engine/interpolationkernels.h"
 #include "sampleutil.h"
 
 #include "test/mixxxtest.h"
@@ -127,6 +128,43 @@ class EngineBufferScaleLinearTest : public MixxxTest {
         }
     }
 
+    // Scales a 2205 Hz sine wave at a rate of 0.87 and returns the largest
+    // difference to the ideal result.
+    double MaxErrorOfScaledSine() {
+        const int kPeriodFrames = 20;
+        const double kRate = 0.87;
+        SetRateNoLerp(kRate);
+
+        QVector<CSAMPLE> readBuffer;
+        for (int i = 0; i < kPeriodFrames; ++i) {
+            const CSAMPLE value = static_cast<CSAMPLE>(
+                    0.5 * sin(2 * M_PI * i / kPeriodFrames));
+            readBuffer.push_back(value);
+            readBuffer.push_back(-value);
+        }
+        m_pReadAheadMock->setReadBuffer(readBuffer.data(), readBuffer.size());
+
+        EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+                .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+        const int bufferSize = 1024;
+        double maxError = 0;
+        int frame = 0;
+        for (int buffer = 0; buffer < 10; ++buffer) {
+            CSAMPLE* pOutput = m_pScaler->getScaled(bufferSize);
+            for (int i = 0; i < bufferSize; i += 2, ++frame) {
+                const double expected =
+                        0.5 * sin(2 * M_PI * frame * kRate / kPeriodFrames);
+                EXPECT_FLOAT_EQ(pOutput[i], -pOutput[i + 1]);
+                // Skip the frames that are computed with the silent history
+                if (frame >= kSincTaps) {
+                    maxError = math_max(maxError, fabs(pOutput[i] - expected));
+                }
+            }
+        }
+        return maxError;
+    }
+
     StrictMock<ReadAheadManagerMock>* m_pReadAheadMock;
     EngineBufferScaleLinear* m_pScaler;
 };
@@ -284,4 +322,118 @@ TEST_F(EngineBufferScaleLinearTest, TestRepeatedScaleCalls) {
     }
 }
 
+TEST_F(EngineBufferScaleLinearTest, KernelUnityRateIsSamplePerfect) {
+    QVector<CSAMPLE> readBuffer;
+    for (int i = 0; i < 1000; ++i) {
+        readBuffer.push_back(i);
+    }
+
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    const EngineBufferScaleLinear::Interpolation interpolations[] = {
+        EngineBufferScaleLinear::CUBIC,
+        EngineBufferScaleLinear::SINC,
+    };
+    for (int i = 0; i < 2; ++i) {
+        m_pScaler->setInterpolation(interpolations[i]);
+        m_pScaler->clear();
+        SetRateNoLerp(1.0);
+        m_pReadAheadMock->setReadBuffer(readBuffer.data(), readBuffer.size());
+        const int samplesReadBefore = m_pReadAheadMock->getSamplesRead();
+
+        const int totalSamples = kiLinearScaleReadAheadLength;
+        CSAMPLE* pOutput = m_pScaler->getScaled(totalSamples);
+
+        AssertBufferCycles(pOutput, totalSamples,
+                           readBuffer.data(), readBuffer.size());
+
+        // The kernel reads a few frames ahead.
+        const int samplesRead =
+                m_pReadAheadMock->getSamplesRead() - samplesReadBefore;
+        EXPECT_LE(totalSamples, samplesRead);
+        EXPECT_GE(totalSamples + kSincTaps * 2, samplesRead);
+    }
+}
+
+TEST_F(EngineBufferScaleLinearTest, KernelHalfSpeedGolden) {
+    CSAMPLE readBuffer[] = { -101.0, 101.0,
+                             -99.0, 99.0 };
+
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    // Both kernels are symmetric, so they hit the middle between two frames
+    // like the linear interpolation does.
+    const CSAMPLE expectedResult[] = { -101.0, 101.0,
+                                       -100.0, 100.0,
+                                       -99.0, 99.0,
+                                       -100.0, 100.0 };
+    const EngineBufferScaleLinear::Interpolation interpolations[] = {
+        EngineBufferScaleLinear::CUBIC,
+        EngineBufferScaleLinear::SINC,
+    };
+    for (int i = 0; i < 2; ++i) {
+        m_pScaler->setInterpolation(interpolations[i]);
+        m_pScaler->clear();
+        SetRateNoLerp(0.5);
+        m_pReadAheadMock->setReadBuffer(readBuffer, 4);
+
+        const int bufferSize = 1024;
+        CSAMPLE* pOutput = m_pScaler->getScaled(bufferSize);
+        // Skip the frames that are computed with the silent history
+        for (int j = kSincTaps * 2; j < bufferSize; ++j) {
+            EXPECT_NEAR(expectedResult[j % 8], pOutput[j], 1e-3) << j;
+        }
+    }
+}
+
+TEST_F(EngineBufferScaleLinearTest, KernelAccuracy) {
+    const double linearError = MaxErrorOfScaledSine();
+
+    m_pScaler->setInterpolation(EngineBufferScaleLinear::CUBIC);
+    m_pScaler->clear();
+    const double cubicError = MaxErrorOfScaledSine();
+
+    m_pScaler->setInterpolation(EngineBufferScaleLinear::SINC);
+    m_pScaler->clear();
+    const double sincError = MaxErrorOfScaledSine();
+
+    EXPECT_GT(linearError, 5e-3);
+    EXPECT_LT(cubicError, 5e-4);
+    EXPECT_LT(sincError, 1e-4);
+}
+
+TEST_F(EngineBufferScaleLinearTest, SincSpeedUpDoesNotAlias) {
+    // A sine at 0.8 times the Nyquist frequency, which is above the Nyquist
+    // frequency of the output at double speed.
+    const double kPeriodFrames = 2.5;
+    QVector<CSAMPLE> readBuffer;
+    for (int i = 0; i < 5; ++i) {
+        const CSAMPLE value = static_cast<CSAMPLE>(
+                0.5 * sin(2 * M_PI * i / kPeriodFrames));
+        readBuffer.push_back(value);
+        readBuffer.push_back(value);
+    }
+    m_pReadAheadMock->setReadBuffer(readBuffer.data(), readBuffer.size());
+
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    m_pScaler->setInterpolation(EngineBufferScaleLinear::SINC);
+    m_pScaler->clear();
+    SetRateNoLerp(2.0);
+
+    const int bufferSize = 1024;
+    double maxOutput = 0;
+    for (int buffer = 0; buffer < 4; ++buffer) {
+        CSAMPLE* pOutput = m_pScaler->getScaled(bufferSize);
+        // Skip the frames that are computed with the silent history
+        for (int i = buffer == 0 ? kSincMaxTaps * 2 : 0; i < bufferSize; ++i) {
+            maxOutput = math_max(maxOutput, fabs(pOutput[i]));
+        }
+    }
+    EXPECT_LT(maxOutput, 1e-3);
+}
+
 }  // namespace
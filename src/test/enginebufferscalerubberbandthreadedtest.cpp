@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <QElapsedTimer>
+#include <QtDebug>
+
+#include "engine/enginebufferscalerubberbandthreaded.h"
+#include "engine/readaheadmanager.h"
+#include "util/math.h"
+#include "util/sleepableqthread.h"
+#include "util/types.h"
+
+#include "test/mixxxtest.h"
+
+namespace {
+
+const int kBufferSize = 1024;
+// How long to wait for the worker before calling getScaled() anyway.
+const int kWorkerTimeoutMillis = 2000;
+
+// Reads a 440 Hz sine wave from an endless track.
+class ReadAheadManagerSine : public ReadAheadManager {
+  public:
+    ReadAheadManagerSine()
+            : ReadAheadManager(),
+              m_iFrame(0) {
+    }
+
+    virtual int getNextSamples(double dRate, CSAMPLE* buffer, int requested_samples) {
+        Q_UNUSED(dRate);
+        for (int i = 0; i < requested_samples; i += 2) {
+            buffer[i] = buffer[i + 1] = static_cast<CSAMPLE>(
+                    0.5 * sin(2 * M_PI * 440 * m_iFrame++ / 44100.0));
+        }
+        return requested_samples;
+    }
+
+  private:
+    int m_iFrame;
+};
+
+class EngineBufferScaleRubberBandThreadedTest : public MixxxTest {
+  protected:
+    virtual void SetUp() {
+        m_pReadAheadManager = new ReadAheadManagerSine();
+        m_pScaler = new EngineBufferScaleRubberBandThreaded(m_pReadAheadManager);
+        m_pScaler->setSampleRate(44100);
+    }
+
+    virtual void TearDown() {
+        delete m_pScaler;
+        delete m_pReadAheadManager;
+    }
+
+    void setTempo(double tempo) {
+        double tempoRatio = tempo;
+        double pitchRatio = 1.0;
+        m_pScaler->setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    }
+
+    // Waits until the worker has output for the next buffer, with a timeout
+    // so a stuck worker shows up as fallback frames and not as a hang.
+    void waitForWorker() {
+        QElapsedTimer timer;
+        timer.start();
+        while (m_pScaler->getReadyFrames() < kBufferSize / 2 &&
+                !timer.hasExpired(kWorkerTimeoutMillis)) {
+            SleepableQThread::msleep(1);
+        }
+    }
+
+    // Calls getScaled() like the audio callback and returns the peak of the
+    // last buffer. Before each call the worker gets the time it needs, the
+    // first calls after a clear() are always interpolated though, since the
+    // worker only gets its input from getScaled().
+    CSAMPLE runCallbacks(int count) {
+        CSAMPLE peak = 0;
+        for (int i = 0; i < count; ++i) {
+            waitForWorker();
+            const CSAMPLE* pOutput = m_pScaler->getScaled(kBufferSize);
+            peak = 0;
+            for (int j = 0; j < kBufferSize; ++j) {
+                peak = math_max(peak, fabs(pOutput[j]));
+            }
+        }
+        return peak;
+    }
+
+    ReadAheadManagerSine* m_pReadAheadManager;
+    EngineBufferScaleRubberBandThreaded* m_pScaler;
+};
+
+TEST_F(EngineBufferScaleRubberBandThreadedTest, SamplesReadFollowsTempo) {
+    setTempo(1.5);
+    m_pScaler->getScaled(kBufferSize);
+    EXPECT_DOUBLE_EQ(1.5 * kBufferSize, m_pScaler->getSamplesRead());
+
+    setTempo(-0.8);
+    m_pScaler->clear();
+    m_pScaler->getScaled(kBufferSize);
+    EXPECT_DOUBLE_EQ(0.8 * kBufferSize, m_pScaler->getSamplesRead());
+}
+
+TEST_F(EngineBufferScaleRubberBandThreadedTest, WorkerCatchesUp) {
+    setTempo(1.2);
+    runCallbacks(10);
+    // The first buffers are interpolated while the worker starts.
+    const int fallbackFrames = m_pScaler->getFallbackFrames();
+
+    const CSAMPLE peak = runCallbacks(20);
+    EXPECT_EQ(fallbackFrames, m_pScaler->getFallbackFrames());
+    EXPECT_GT(peak, 0.1f);
+}
+
+TEST_F(EngineBufferScaleRubberBandThreadedTest, ClearStartsOver) {
+    setTempo(1.0);
+    runCallbacks(10);
+    m_pScaler->clear();
+    EXPECT_EQ(0, m_pScaler->getFallbackFrames());
+
+    // The output written before clear() is dropped, so the worker catches up
+    // again.
+    runCallbacks(10);
+    const int fallbackFrames = m_pScaler->getFallbackFrames();
+    runCallbacks(10);
+    EXPECT_EQ(fallbackFrames, m_pScaler->getFallbackFrames());
+}
+
+}  // namespace
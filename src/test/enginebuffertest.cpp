@@ -203,6 +203,81 @@ TEST_F(EngineBufferTest, ResetPitchAdjustUsesLinear) {
     EXPECT_EQ(m_pMockScaleVinyl1, m_pChannel1->getEngineBuffer()->m_pScale);
 }
 
+TEST_F(EngineBufferTest, KeylockScalerStaysWarmWhileScratching) {
+    ControlObject::set(ConfigKey(m_sGroup1, "keylock"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "rate"), 0.05);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ProcessBuffer();
+    EXPECT_EQ(m_pMockScaleKeylock1, m_pChannel1->getEngineBuffer()->m_pScale);
+
+    // Scratching hands over to the vinyl scaler. The keylock scaler is cleared
+    // once when it starts to shadow the vinyl scaler.
+    ControlObject::set(ConfigKey(m_sGroup1, "scratch2_enable"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "scratch2"), 1.5);
+    ProcessBuffer();
+    EXPECT_EQ(m_pMockScaleVinyl1, m_pChannel1->getEngineBuffer()->m_pScale);
+    EXPECT_EQ(m_pMockScaleKeylock1,
+              m_pChannel1->getEngineBuffer()->m_pScaleShadow);
+    const int clearCount = m_pMockScaleKeylock1->getClearCount();
+    ProcessBuffer();
+    EXPECT_EQ(clearCount, m_pMockScaleKeylock1->getClearCount());
+
+    // Back to keylock without clearing the keylock scaler
+    ControlObject::set(ConfigKey(m_sGroup1, "scratch2_enable"), 0.0);
+    ProcessBuffer();
+    EXPECT_EQ(m_pMockScaleKeylock1, m_pChannel1->getEngineBuffer()->m_pScale);
+    EXPECT_TRUE(m_pChannel1->getEngineBuffer()->m_pScaleShadow == NULL);
+    EXPECT_EQ(clearCount, m_pMockScaleKeylock1->getClearCount());
+}
+
+TEST_F(EngineBufferTest, EnablingKeylockAccountsForFadeOut) {
+    ControlObject::set(ConfigKey(m_sGroup1, "rate"), 0.05);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    ProcessBuffer();
+    EXPECT_EQ(m_pMockScaleVinyl1, m_pChannel1->getEngineBuffer()->m_pScale);
+    const double playpos1 = m_pChannel1->getEngineBuffer()->m_filepos_play;
+    ProcessBuffer();
+    const double playpos2 = m_pChannel1->getEngineBuffer()->m_filepos_play;
+    const double bufferAdvance = playpos2 - playpos1;
+    ASSERT_GT(bufferAdvance, 0.0);
+
+    // While keylock is off the keylock scaler shadows the vinyl scaler in
+    // history-only mode. Enabling keylock does not seek back, so the input the
+    // vinyl scaler read for the fade-out counts towards the position.
+    EXPECT_EQ(m_pMockScaleKeylock1,
+              m_pChannel1->getEngineBuffer()->m_pScaleShadow);
+    ControlObject::set(ConfigKey(m_sGroup1, "keylock"), 1.0);
+    ProcessBuffer();
+    EXPECT_EQ(m_pMockScaleKeylock1, m_pChannel1->getEngineBuffer()->m_pScale);
+    const double playpos3 = m_pChannel1->getEngineBuffer()->m_filepos_play;
+    EXPECT_NEAR(2 * bufferAdvance, playpos3 - playpos2, 4.0);
+}
+
+TEST_F(EngineBufferTest, EnablingKeylockPrimesOverSeveralCallbacks) {
+    ControlObject::set(ConfigKey(m_sGroup1, "rate"), 0.05);
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    // Fill the whole history of the keylock scaler
+    for (int i = 0; i < 20; ++i) {
+        ProcessBuffer();
+    }
+    EXPECT_EQ(m_pMockScaleVinyl1, m_pChannel1->getEngineBuffer()->m_pScale);
+
+    // The history is fed to the keylock scaler in steps while the vinyl
+    // scaler keeps playing, instead of all at once.
+    ControlObject::set(ConfigKey(m_sGroup1, "keylock"), 1.0);
+    ProcessBuffer();
+    EXPECT_EQ(m_pMockScaleVinyl1, m_pChannel1->getEngineBuffer()->m_pScale);
+    EXPECT_TRUE(m_pChannel1->getEngineBuffer()->m_bShadowPriming);
+    int callbacks = 1;
+    while (m_pChannel1->getEngineBuffer()->m_pScale != m_pMockScaleKeylock1 &&
+            callbacks < 10) {
+        ProcessBuffer();
+        ++callbacks;
+    }
+    EXPECT_EQ(m_pMockScaleKeylock1, m_pChannel1->getEngineBuffer()->m_pScale);
+    EXPECT_LT(2, callbacks);
+}
+
 TEST_F(EngineBufferE2ETest, SoundTouchCrashTest) {
     // Soundtouch has a bug where a pitch value of zero causes an infinite loop
     // and crash.
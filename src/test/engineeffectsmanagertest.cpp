@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <QList>
+#include <QScopedPointer>
+#include <QSet>
+#include <QVector>
+
+#include "effects/effectinstantiator.h"
+#include "effects/effectmanifest.h"
+#include "effects/effectprocessor.h"
+#include "engine/channelhandle.h"
+#include "engine/effects/engineeffect.h"
+#include "engine/effects/engineeffectchain.h"
+#include "engine/effects/engineeffectrack.h"
+#include "engine/effects/engineeffectsmanager.h"
+#include "engine/effects/message.h"
+#include "engine/enginethreadpool.h"
+#include "util/types.h"
+
+namespace {
+
+const int kNumChannels = 8;
+const int kNumCallbacks = 4;
+const unsigned int kNumSamples = 128;
+const unsigned int kSampleRate = 44100;
+
+struct CountingGainState {
+    CountingGainState() : calls(0) {
+    }
+    int calls;
+};
+
+// Halves the input and adds the number of previous calls for the channel, so
+// the output depends on the per-channel state.
+class CountingGainProcessor : public PerChannelEffectProcessor<CountingGainState> {
+  public:
+    CountingGainProcessor(EngineEffect* pEffect, const EffectManifest& manifest) {
+        Q_UNUSED(pEffect);
+        Q_UNUSED(manifest);
+    }
+
+    void processChannel(const ChannelHandle& handle,
+                        CountingGainState* pState,
+                        const CSAMPLE* pInput, CSAMPLE* pOutput,
+                        const unsigned int numSamples,
+                        const unsigned int sampleRate,
+                        const EffectProcessor::EnableState enableState,
+                        const GroupFeatureState& groupFeatures) {
+        Q_UNUSED(handle);
+        Q_UNUSED(sampleRate);
+        Q_UNUSED(enableState);
+        Q_UNUSED(groupFeatures);
+        for (unsigned int i = 0; i < numSamples; ++i) {
+            pOutput[i] = pInput[i] * 0.5f + pState->calls;
+        }
+        ++pState->calls;
+    }
+};
+
+// One rack with one chain of two effects, enabled for kNumChannels channels.
+class EffectsSetup {
+  public:
+    EffectsSetup() {
+        QPair<EffectsRequestPipe*, EffectsResponsePipe*> pipes =
+                TwoWayMessagePipe<EffectsRequest*, EffectsResponse>::makeTwoWayMessagePipe(
+                        2048, 2048, false, false);
+        m_pRequestPipe.reset(pipes.first);
+        m_pManager.reset(new EngineEffectsManager(pipes.second));
+
+        QSet<ChannelHandleAndGroup> registeredChannels;
+        for (int i = 0; i < kNumChannels; ++i) {
+            QString group = QString("[Channel%1]").arg(i + 1);
+            ChannelHandleAndGroup channel(m_factory.getOrCreateHandle(group), group);
+            m_channels.append(channel.handle());
+            registeredChannels.insert(channel);
+        }
+
+        EffectManifest manifest;
+        manifest.setId("org.mixxx.test.countinggain");
+        EffectInstantiatorPointer pInstantiator(
+                new EffectProcessorInstantiator<CountingGainProcessor>());
+        m_pRack.reset(new EngineEffectRack(0));
+        m_pChain.reset(new EngineEffectChain("test"));
+        m_pEffect1.reset(new EngineEffect(manifest, registeredChannels, pInstantiator));
+        m_pEffect2.reset(new EngineEffect(manifest, registeredChannels, pInstantiator));
+
+        EffectsRequest* pRequest = newRequest(EffectsRequest::ADD_EFFECT_RACK);
+        pRequest->AddEffectRack.pRack = m_pRack.data();
+
+        pRequest = newRequest(EffectsRequest::ADD_CHAIN_TO_RACK);
+        pRequest->pTargetRack = m_pRack.data();
+        pRequest->AddChainToRack.pChain = m_pChain.data();
+        pRequest->AddChainToRack.iIndex = 0;
+
+        pRequest = newRequest(EffectsRequest::ADD_EFFECT_TO_CHAIN);
+        pRequest->pTargetChain = m_pChain.data();
+        pRequest->AddEffectToChain.pEffect = m_pEffect1.data();
+        pRequest->AddEffectToChain.iIndex = 0;
+
+        pRequest = newRequest(EffectsRequest::ADD_EFFECT_TO_CHAIN);
+        pRequest->pTargetChain = m_pChain.data();
+        pRequest->AddEffectToChain.pEffect = m_pEffect2.data();
+        pRequest->AddEffectToChain.iIndex = 1;
+
+        // Ramping the mix from dry to wet mixes through the scratch buffer.
+        pRequest = newRequest(EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS);
+        pRequest->pTargetChain = m_pChain.data();
+        pRequest->SetEffectChainParameters.enabled = true;
+        pRequest->SetEffectChainParameters.insertion_type = EffectChain::INSERT;
+        pRequest->SetEffectChainParameters.mix = 1.0;
+
+        foreach (const ChannelHandle& handle, m_channels) {
+            pRequest = newRequest(EffectsRequest::ENABLE_EFFECT_CHAIN_FOR_CHANNEL);
+            pRequest->pTargetChain = m_pChain.data();
+            pRequest->channel = handle;
+        }
+    }
+
+    virtual ~EffectsSetup() {
+        qDeleteAll(m_requests);
+    }
+
+    // Processes kNumCallbacks callbacks of all channels and returns the
+    // concatenated output.
+    QVector<CSAMPLE> run(EngineThreadPool* pThreadPool) {
+        QVector<CSAMPLE> output;
+        QVector<CSAMPLE> buffers(kNumChannels * kNumSamples);
+        for (int callback = 0; callback < kNumCallbacks; ++callback) {
+            for (int i = 0; i < buffers.size(); ++i) {
+                buffers[i] = static_cast<CSAMPLE>((i * 7 + callback * 13) % 100) / 100;
+            }
+            m_pManager->onCallbackStart();
+            if (pThreadPool == NULL) {
+                for (int i = 0; i < kNumChannels; ++i) {
+                    m_pManager->process(m_channels[i],
+                                        buffers.data() + i * kNumSamples,
+                                        kNumSamples, kSampleRate,
+                                        GroupFeatureState());
+                }
+            } else {
+                m_pManager->reserveScratchBuffers(pThreadPool->numWorkers() + 1);
+                ChannelEffectsJob jobs[kNumChannels];
+                for (int i = 0; i < kNumChannels; ++i) {
+                    jobs[i].handle = m_channels[i];
+                    jobs[i].pInOut = buffers.data() + i * kNumSamples;
+                }
+                m_pManager->processChannels(pThreadPool, jobs, kNumChannels,
+                                            kNumSamples, kSampleRate);
+            }
+            output += buffers;
+        }
+        return output;
+    }
+
+  private:
+    EffectsRequest* newRequest(EffectsRequest::MessageType type) {
+        EffectsRequest* pRequest = new EffectsRequest();
+        pRequest->type = type;
+        m_requests.append(pRequest);
+        m_pRequestPipe->writeMessages(&pRequest, 1);
+        return pRequest;
+    }
+
+    ChannelHandleFactory m_factory;
+    QList<ChannelHandle> m_channels;
+    QScopedPointer<EffectsRequestPipe> m_pRequestPipe;
+    QScopedPointer<EngineEffectsManager> m_pManager;
+    QScopedPointer<EngineEffectRack> m_pRack;
+    QScopedPointer<EngineEffectChain> m_pChain;
+    QScopedPointer<EngineEffect> m_pEffect1;
+    QScopedPointer<EngineEffect> m_pEffect2;
+    QList<EffectsRequest*> m_requests;
+};
+
+TEST(EngineEffectsManagerTest, ParallelChannelsMatchSerialProcessing) {
+    EffectsSetup serialSetup;
+    QVector<CSAMPLE> serial = serialSetup.run(NULL);
+
+    EffectsSetup parallelSetup;
+    EngineThreadPool pool(3, "EngineEffectsManagerTest worker %1");
+    QVector<CSAMPLE> parallel = parallelSetup.run(&pool);
+
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (int i = 0; i < serial.size(); ++i) {
+        ASSERT_EQ(serial[i], parallel[i]) << "sample " << i;
+    }
+
+    // Every channel ramped in during the first callback and is fully wet in
+    // the last one: 0.25 * input + 0.5 * calls + calls.
+    const int last = (kNumCallbacks - 1) * kNumChannels * kNumSamples;
+    const CSAMPLE input = static_cast<CSAMPLE>(
+            (0 * 7 + (kNumCallbacks - 1) * 13) % 100) / 100;
+    const CSAMPLE calls = kNumCallbacks - 1;
+    EXPECT_FLOAT_EQ(0.25f * input + 0.5f * calls + calls, serial[last]);
+}
+
+}  // namespace
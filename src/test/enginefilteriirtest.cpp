@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <QVector>
+
+#include "engine/enginefilterbessel4.h"
+#include "engine/enginefilterbessel8.h"
+#include "engine/enginefilterbiquad1.h"
+#include "engine/enginefilterbutterworth8.h"
+#include "engine/enginefilterlinkwitzriley8.h"
+#include "util/types.h"
+
+namespace {
+
+const int kSampleRate = 44100;
+const int kBufferSize = 1024;
+const int kNumBuffers = 50;
+
+// Runs a filter designed by fidlib with its generic direct form II
+// interpreter, i.e. the reference for EngineFilterIIR.
+class FidlibFilter {
+  public:
+    FidlibFilter(const char* spec, double freq0, double freq1)
+            : m_pFilter(NULL),
+              m_pRun(NULL),
+              m_pFunc(NULL) {
+        char spec_d[FIDSPEC_LENGTH];
+        strcpy(spec_d, spec);
+        m_pFilter = fid_design(spec_d, kSampleRate, freq0, freq1, 0, NULL);
+        m_pRun = fid_run_new(m_pFilter, &m_pFunc);
+        m_pBuf1 = fid_run_newbuf(m_pRun);
+        m_pBuf2 = fid_run_newbuf(m_pRun);
+    }
+
+    virtual ~FidlibFilter() {
+        fid_run_freebuf(m_pBuf2);
+        fid_run_freebuf(m_pBuf1);
+        fid_run_free(m_pRun);
+        free(m_pFilter);
+    }
+
+    void process(const CSAMPLE* pIn, double* pOut, int bufferSize) {
+        for (int i = 0; i < bufferSize; i += 2) {
+            pOut[i] = m_pFunc(m_pBuf1, pIn[i]);
+            pOut[i + 1] = m_pFunc(m_pBuf2, pIn[i + 1]);
+        }
+    }
+
+  private:
+    FidFilter* m_pFilter;
+    void* m_pRun;
+    double (*m_pFunc)(void*, double);
+    void* m_pBuf1;
+    void* m_pBuf2;
+};
+
+void fillNoise(CSAMPLE* pBuffer, int bufferSize, unsigned int* pSeed) {
+    for (int i = 0; i < bufferSize; ++i) {
+        *pSeed = *pSeed * 1103515245 + 12345;
+        pBuffer[i] = static_cast<CSAMPLE>((*pSeed >> 16) % 2000) / 1000 - 1;
+    }
+}
+
+// Filters noise with a settled filter and its fidlib reference and returns
+// the largest difference of both.
+double maxDifferenceToFidlib(EngineFilterIIRBase* pFilter,
+                             const char* spec, double freq0, double freq1) {
+    FidlibFilter reference(spec, freq0, freq1);
+    pFilter->assumeSettled();
+    QVector<CSAMPLE> input(kBufferSize);
+    QVector<CSAMPLE> output(kBufferSize);
+    QVector<double> expected(kBufferSize);
+    unsigned int seed = 1;
+    double maxDifference = 0;
+    for (int i = 0; i < kNumBuffers; ++i) {
+        fillNoise(input.data(), kBufferSize, &seed);
+        pFilter->process(input.constData(), output.data(), kBufferSize);
+        reference.process(input.constData(), expected.data(), kBufferSize);
+        for (int j = 0; j < kBufferSize; ++j) {
+            maxDifference = math_max(maxDifference,
+                                     fabs(expected[j] - output[j]));
+        }
+    }
+    return maxDifference;
+}
+
+TEST(EngineFilterIIRTest, MatchesFidlibLowPass) {
+    EngineFilterBessel4Low bessel(kSampleRate, 1000);
+    EXPECT_LT(maxDifferenceToFidlib(&bessel, "LpBe4", 1000, 0), 1e-6);
+
+    // Low frequency sections have the largest internal gain
+    EngineFilterBessel8Low bessel8(kSampleRate, 50);
+    EXPECT_LT(maxDifferenceToFidlib(&bessel8, "LpBe8", 50, 0), 1e-6);
+
+    EngineFilterBiquad1Low biquad(kSampleRate, 500, 0.707, false);
+    EXPECT_LT(maxDifferenceToFidlib(&biquad, "LpBq/0.7070000000", 500, 0), 1e-6);
+}
+
+TEST(EngineFilterIIRTest, MatchesFidlibHighPass) {
+    EngineFilterButterworth8High butterworth(kSampleRate, 200);
+    EXPECT_LT(maxDifferenceToFidlib(&butterworth, "HpBu8", 200, 0), 1e-6);
+
+    EngineFilterBiquad1High biquad(kSampleRate, 500, 0.707, false);
+    EXPECT_LT(maxDifferenceToFidlib(&biquad, "HpBq/0.7070000000", 500, 0), 1e-6);
+}
+
+TEST(EngineFilterIIRTest, MatchesFidlibBandPass) {
+    EngineFilterBessel4Band bessel(kSampleRate, 200, 2000);
+    EXPECT_LT(maxDifferenceToFidlib(&bessel, "BpBe4", 200, 2000), 1e-6);
+
+    EngineFilterButterworth8Band butterworth(kSampleRate, 200, 2000);
+    EXPECT_LT(maxDifferenceToFidlib(&butterworth, "BpBu8", 200, 2000), 1e-6);
+
+    EngineFilterBiquad1Band biquad(kSampleRate, 500, 0.707);
+    EXPECT_LT(maxDifferenceToFidlib(&biquad, "BpBq/0.7070000000", 500, 0), 1e-6);
+}
+
+TEST(EngineFilterIIRTest, MatchesFidlibPeaking) {
+    EngineFilterBiquad1Peaking biquad(kSampleRate, 1000, 1.0);
+    biquad.setFrequencyCorners(kSampleRate, 1000, 1.0, 6.0);
+    EXPECT_LT(maxDifferenceToFidlib(&biquad, "PkBq/1.0000000000/6.0000000000",
+                                    1000, 0), 1e-6);
+}
+
+// After moving the coefficients the filter converges to a filter that always
+// had the new coefficients.
+TEST(EngineFilterIIRTest, RampingConvergesToNewCoefficients) {
+    EngineFilterLinkwtzRiley8Low filter(kSampleRate, 100);
+    filter.assumeSettled();
+    EngineFilterLinkwtzRiley8Low expectedFilter(kSampleRate, 2000);
+    expectedFilter.assumeSettled();
+
+    QVector<CSAMPLE> input(kBufferSize);
+    QVector<CSAMPLE> output(kBufferSize);
+    QVector<CSAMPLE> expected(kBufferSize);
+    unsigned int seed = 1;
+    for (int i = 0; i < kNumBuffers; ++i) {
+        fillNoise(input.data(), kBufferSize, &seed);
+        // Sweep up from 100 Hz to 2000 Hz in the first buffers
+        if (i < 10) {
+            filter.setFrequencyCorners(kSampleRate, 100 + (i + 1) * 190);
+        }
+        filter.process(input.constData(), output.data(), kBufferSize);
+        expectedFilter.process(input.constData(), expected.data(), kBufferSize);
+        for (int j = 0; j < kBufferSize; ++j) {
+            ASSERT_LT(fabs(output[j]), 4.0) << "buffer " << i;
+        }
+    }
+    for (int j = 0; j < kBufferSize; ++j) {
+        EXPECT_NEAR(expected[j], output[j], 1e-5);
+    }
+}
+
+}  // namespace
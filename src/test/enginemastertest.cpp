@@ -35,6 +35,7 @@ class EngineChannelMock : public EngineChannel {
     MOCK_CONST_METHOD0(isMasterEnabled, bool());
     MOCK_CONST_METHOD0(isPflEnabled, bool());
     MOCK_METHOD2(process, void(CSAMPLE* pInOut, const int iBufferSize));
+    MOCK_METHOD1(preProcess, void(const int iBufferSize));
     MOCK_METHOD1(postProcess, void(const int iBufferSize));
 };
 
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <QVector>
+
+#include "engine/engineoversampler.h"
+#include "util/types.h"
+
+namespace {
+
+const int kNumFrames = 8192;
+
+void fillSine(QVector<CSAMPLE>* pBuffer, double frequency) {
+    for (int i = 0; i < pBuffer->size() / 2; ++i) {
+        const double value = sin(2 * M_PI * frequency * i);
+        (*pBuffer)[i * 2] = static_cast<CSAMPLE>(value);
+        (*pBuffer)[i * 2 + 1] = static_cast<CSAMPLE>(-value);
+    }
+}
+
+// Returns the amplitude of the given frequency (relative to the rate of the
+// buffer) in the left channel of the second half of the buffer, which is past
+// the settling of the filters. A Hann window keeps the other frequencies out.
+double amplitude(const QVector<CSAMPLE>& buffer, double frequency) {
+    const int numFrames = buffer.size() / 4;
+    const int start = buffer.size() / 2 - numFrames;
+    double re = 0;
+    double im = 0;
+    for (int i = 0; i < numFrames; ++i) {
+        const double window = 0.5 - 0.5 * cos(2 * M_PI * i / numFrames);
+        const double phase = 2 * M_PI * frequency * (start + i);
+        re += window * buffer[(start + i) * 2] * cos(phase);
+        im += window * buffer[(start + i) * 2] * sin(phase);
+    }
+    return 4 * sqrt(re * re + im * im) / numFrames;
+}
+
+double toDb(double amplitude) {
+    return 20 * log10(amplitude + 1e-20);
+}
+
+TEST(EngineOversamplerTest, DesignedAttenuation) {
+    double coefs[EngineHalfbandStage::kNumCoefs];
+    EXPECT_GT(EngineHalfbandStage::designCoefficients(
+            coefs, EngineHalfbandStage::kNumCoefs, 0.025), 100);
+    for (int i = 0; i < EngineHalfbandStage::kNumCoefs; ++i) {
+        EXPECT_GT(coefs[i], 0);
+        EXPECT_LT(coefs[i], 1);
+    }
+}
+
+TEST(EngineOversamplerTest, RoundTripPassbandIsFlat) {
+    const double frequencies[] = { 0.001, 0.05, 0.2, 0.35, 0.45 };
+    for (int factor = 1; factor <= EngineOversampler::kMaxFactor; factor *= 2) {
+        for (unsigned int i = 0; i < sizeof(frequencies) / sizeof(frequencies[0]); ++i) {
+            EngineOversampler oversampler(factor);
+            QVector<CSAMPLE> input(kNumFrames * 2);
+            QVector<CSAMPLE> oversampled(kNumFrames * 2 * factor);
+            QVector<CSAMPLE> output(kNumFrames * 2);
+            fillSine(&input, frequencies[i]);
+            oversampler.upsample(input.constData(), oversampled.data(), kNumFrames);
+            EXPECT_NEAR(0.0, toDb(amplitude(oversampled, frequencies[i] / factor)), 0.01)
+                    << factor << "x " << frequencies[i];
+            oversampler.downsample(oversampled.constData(), output.data(), kNumFrames);
+            EXPECT_NEAR(0.0, toDb(amplitude(output, frequencies[i])), 0.01)
+                    << factor << "x " << frequencies[i];
+        }
+    }
+}
+
+TEST(EngineOversamplerTest, ImagesAreAttenuated) {
+    const double frequencies[] = { 0.01, 0.2, 0.45 };
+    for (int factor = 2; factor <= EngineOversampler::kMaxFactor; factor *= 2) {
+        for (unsigned int i = 0; i < sizeof(frequencies) / sizeof(frequencies[0]); ++i) {
+            EngineOversampler oversampler(factor);
+            QVector<CSAMPLE> input(kNumFrames * 2);
+            QVector<CSAMPLE> oversampled(kNumFrames * 2 * factor);
+            fillSine(&input, frequencies[i]);
+            oversampler.upsample(input.constData(), oversampled.data(), kNumFrames);
+            // The images are mirrored at the multiples of the original rate
+            for (int k = 1; k < factor; ++k) {
+                EXPECT_LT(toDb(amplitude(oversampled, (k - frequencies[i]) / factor)), -100)
+                        << factor << "x " << frequencies[i] << " k " << k;
+                EXPECT_LT(toDb(amplitude(oversampled, (k + frequencies[i]) / factor)), -100)
+                        << factor << "x " << frequencies[i] << " k " << k;
+            }
+        }
+    }
+}
+
+TEST(EngineOversamplerTest, AliasesAreAttenuated) {
+    // Frequencies above the passband at the original rate, as they are created
+    // by a distortion at the higher rate.
+    const double frequencies[] = { 0.55, 0.8, 1.5 };
+    for (int factor = 2; factor <= EngineOversampler::kMaxFactor; factor *= 2) {
+        for (unsigned int i = 0; i < sizeof(frequencies) / sizeof(frequencies[0]); ++i) {
+            if (frequencies[i] >= factor / 2.0) {
+                continue;
+            }
+            EngineOversampler oversampler(factor);
+            QVector<CSAMPLE> oversampled(kNumFrames * 2 * factor);
+            QVector<CSAMPLE> output(kNumFrames * 2);
+            fillSine(&oversampled, frequencies[i] / factor);
+            oversampler.downsample(oversampled.constData(), output.data(), kNumFrames);
+            double alias = frequencies[i] - floor(frequencies[i]);
+            if (alias > 0.5) {
+                alias = 1 - alias;
+            }
+            EXPECT_LT(toDb(amplitude(output, alias)), -100)
+                    << factor << "x " << frequencies[i];
+        }
+    }
+}
+
+TEST(EngineOversamplerTest, DownsampleInPlace) {
+    EngineOversampler oversampler(4);
+    EngineOversampler reference(4);
+    QVector<CSAMPLE> input(1000 * 2);
+    QVector<CSAMPLE> oversampled(1000 * 2 * 4);
+    QVector<CSAMPLE> expected(1000 * 2);
+    fillSine(&input, 0.1);
+    for (int buffer = 0; buffer < 3; ++buffer) {
+        reference.upsample(input.constData(), oversampled.data(), 1000);
+        reference.downsample(oversampled.constData(), expected.data(), 1000);
+        oversampler.upsample(input.constData(), oversampled.data(), 1000);
+        oversampler.downsample(oversampled.constData(), oversampled.data(), 1000);
+        for (int i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(expected[i], oversampled[i]) << buffer << " " << i;
+        }
+    }
+}
+
+}  // namespace
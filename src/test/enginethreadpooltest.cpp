@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QtDebug>
+
+#include "engine/enginethreadpool.h"
+#include "util/compatibility.h"
+
+namespace {
+
+struct JobCounter {
+    QAtomicInt m_calls[kEngineThreadPoolMaxJobs];
+};
+
+void countJob(void* pContext, int jobIndex) {
+    static_cast<JobCounter*>(pContext)->m_calls[jobIndex].ref();
+}
+
+struct Rendezvous {
+    QAtomicInt m_started;
+    QAtomicInt m_met;
+};
+
+// Waits for a bounded time until the other job of the batch has started, which
+// can only happen if a worker runs it.
+void rendezvousJob(void* pContext, int jobIndex) {
+    Q_UNUSED(jobIndex);
+    Rendezvous* pRendezvous = static_cast<Rendezvous*>(pContext);
+    pRendezvous->m_started.ref();
+    QElapsedTimer timer;
+    timer.start();
+    while (load_atomic(pRendezvous->m_started) < 2) {
+        if (timer.hasExpired(5000)) {
+            return;
+        }
+    }
+    pRendezvous->m_met.ref();
+}
+
+class EngineThreadPoolTest : public testing::Test {
+  protected:
+    void runAndVerify(EngineThreadPool* pPool, int count, int batches) {
+        JobCounter counter;
+        for (int batch = 0; batch < batches; ++batch) {
+            pPool->runJobs(&countJob, &counter, count);
+        }
+        for (int i = 0; i < kEngineThreadPoolMaxJobs; ++i) {
+            int expected = i < count ? batches : 0;
+            EXPECT_EQ(expected, load_atomic(counter.m_calls[i])) << "job " << i;
+        }
+    }
+};
+
+TEST_F(EngineThreadPoolTest, NoWorkersRunsSerially) {
+    EngineThreadPool pool(0, "EngineThreadPoolTest %1");
+    EXPECT_EQ(0, pool.numWorkers());
+    runAndVerify(&pool, 7, 3);
+}
+
+TEST_F(EngineThreadPoolTest, EmptyBatch) {
+    EngineThreadPool pool(2, "EngineThreadPoolTest %1");
+    runAndVerify(&pool, 0, 10);
+}
+
+TEST_F(EngineThreadPoolTest, EveryJobRunsExactlyOnce) {
+    EngineThreadPool pool(3, "EngineThreadPoolTest %1");
+    EXPECT_EQ(3, pool.numWorkers());
+    runAndVerify(&pool, 1, 100);
+    runAndVerify(&pool, 4, 1000);
+    runAndVerify(&pool, kEngineThreadPoolMaxJobs, 100);
+}
+
+TEST_F(EngineThreadPoolTest, WorkersWakeUpAfterSleeping) {
+    EngineThreadPool pool(1, "EngineThreadPoolTest %1");
+    for (int batch = 0; batch < 3; ++batch) {
+        // Idle long enough for the worker to stop spinning and go to sleep.
+        QElapsedTimer timer;
+        timer.start();
+        while (!timer.hasExpired(50)) {
+        }
+        Rendezvous rendezvous;
+        pool.runJobs(&rendezvousJob, &rendezvous, 2);
+        EXPECT_EQ(2, load_atomic(rendezvous.m_met)) << "batch " << batch;
+    }
+}
+
+}  // namespace
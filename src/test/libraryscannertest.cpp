@@ -2,8 +2,14 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <QDir>
+#include <QSignalSpy>
+#include <QSqlQuery>
+
 #include "mixxxtest.h"
+#include "library/queryutil.h"
 #include "library/scanner/libraryscanner.h"
+#include "test/librarytest.h"
 
 class LibraryScannerTest : public MixxxTest {
   protected:
@@ -62,3 +68,171 @@ TEST_F(LibraryScannerTest, ScannerRoundtrip) {
     EXPECT_EQ(m_pLibraryScanner->m_state, LibraryScanner::IDLE);
 }
 
+
+TEST(ScannerGlobalTest, TracksInFlight) {
+    ScannerGlobal scannerGlobal(QSet<QString>(), QHash<QString, int>(),
+                                QRegExp(), QRegExp(), QStringList(), 2);
+    EXPECT_TRUE(scannerGlobal.tryAcquireTrackInFlight());
+    EXPECT_TRUE(scannerGlobal.acquireTrackInFlight());
+    // The readers wait until the writer is done with a track.
+    EXPECT_FALSE(scannerGlobal.tryAcquireTrackInFlight());
+    scannerGlobal.releaseTracksInFlight(2);
+    EXPECT_TRUE(scannerGlobal.tryAcquireTrackInFlight());
+    EXPECT_TRUE(scannerGlobal.tryAcquireTrackInFlight());
+
+    // A cancelled scan does not wait.
+    scannerGlobal.cancel();
+    EXPECT_FALSE(scannerGlobal.acquireTrackInFlight());
+
+    scannerGlobal.trackRead();
+    EXPECT_EQ(1, scannerGlobal.numReadTracks());
+}
+
+// Drives the batches of new tracks through the scanner's TrackDAO on the test
+// thread, on the connection of the track collection.
+class LibraryScannerCommitTest : public LibraryTest {
+  protected:
+    LibraryScannerCommitTest()
+            : m_pParent(NULL),
+              m_pLibraryScanner(NULL),
+              m_trackDir(QDir::temp().filePath("libraryscannercommittest")),
+              m_nextTrack(0) {
+    }
+
+    virtual void SetUp() {
+        m_pParent = new QWidget();
+        // Without a track collection the scanner thread leaves the database
+        // alone.
+        m_pLibraryScanner = new LibraryScanner(m_pParent, NULL, config());
+        m_pLibraryScanner->m_database = collection()->getDatabase();
+        m_pLibraryScanner->m_scannerGlobal = ScannerGlobalPointer(
+                new ScannerGlobal(QSet<QString>(), QHash<QString, int>(),
+                                  QRegExp(), QRegExp(), QStringList(),
+                                  LibraryScanner::kTracksPerTransaction));
+        m_pLibraryScanner->m_trackDao.addTracksPrepare();
+
+        // Only sees what the scanner committed.
+        QSqlDatabase database = QSqlDatabase::cloneDatabase(
+                collection()->getDatabase(), kCommittedConnection);
+        ASSERT_TRUE(database.open());
+        m_committedTracksBefore = committedTracks();
+    }
+
+    virtual void TearDown() {
+        m_pLibraryScanner->m_trackDao.addTracksFinish(true);
+        // The connection belongs to the track collection.
+        m_pLibraryScanner->m_database = QSqlDatabase();
+        delete m_pLibraryScanner;
+        delete m_pParent;
+        QSqlDatabase::removeDatabase(kCommittedConnection);
+
+        QSqlQuery query(collection()->getDatabase());
+        query.prepare("DELETE FROM library WHERE location IN "
+                      "(SELECT id FROM track_locations "
+                      "WHERE directory = :directory)");
+        query.bindValue(":directory", m_trackDir);
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
+        }
+        query.prepare("DELETE FROM track_locations "
+                      "WHERE directory = :directory");
+        query.bindValue(":directory", m_trackDir);
+        if (!query.exec()) {
+            LOG_FAILED_QUERY(query);
+        }
+    }
+
+    // Hands count new tracks to the scanner like the import tasks do and
+    // returns the location of the last one.
+    QString addNewTracks(int count) {
+        QList<TrackPointer> tracks;
+        for (int i = 0; i < count; ++i) {
+            const QString location = QDir(m_trackDir).filePath(
+                    QString("track%1.mp3").arg(++m_nextTrack));
+            tracks.append(TrackPointer(new TrackInfoObject(
+                    QFileInfo(location), SecurityTokenPointer(), false)));
+        }
+        m_pLibraryScanner->slotAddNewTracks(tracks);
+        return tracks.last()->getLocation();
+    }
+
+    int uncommittedTracks() const {
+        return m_pLibraryScanner->m_uncommittedTracks.size();
+    }
+
+    bool scanFinishedCleanly() const {
+        return m_pLibraryScanner->m_scannerGlobal->scanFinishedCleanly();
+    }
+
+    // Commits the uncommitted tracks after discarding their transaction,
+    // which fails like a COMMIT SQLite can not complete.
+    void commitDiscardedTransaction() {
+        ASSERT_TRUE(collection()->getDatabase().rollback());
+        m_pLibraryScanner->commitNewTracks();
+    }
+
+    // The number of new tracks other connections see
+    int committedTracks() {
+        QSqlQuery query(QSqlDatabase::database(kCommittedConnection));
+        if (!query.exec("SELECT COUNT(*) FROM library") || !query.next()) {
+            LOG_FAILED_QUERY(query);
+            return -1;
+        }
+        return query.value(0).toInt() - m_committedTracksBefore;
+    }
+
+    static const char* kCommittedConnection;
+
+    QWidget* m_pParent;
+    LibraryScanner* m_pLibraryScanner;
+    const QString m_trackDir;
+    int m_nextTrack;
+    int m_committedTracksBefore;
+};
+
+const char* LibraryScannerCommitTest::kCommittedConnection =
+        "LIBRARY_SCANNER_COMMIT_TEST";
+
+TEST_F(LibraryScannerCommitTest, CommitsAndAnnouncesBatches) {
+    QSignalSpy progressLoading(m_pLibraryScanner,
+                               SIGNAL(progressLoading(QString)));
+    const int batch = LibraryScanner::kTracksPerTransaction;
+
+    addNewTracks(batch - 1);
+    EXPECT_EQ(batch - 1, uncommittedTracks());
+    EXPECT_EQ(0, committedTracks());
+    EXPECT_EQ(0, progressLoading.count());
+
+    // The track that completes the batch commits and announces all of it.
+    const QString lastLocation = addNewTracks(1);
+    EXPECT_EQ(0, uncommittedTracks());
+    EXPECT_EQ(batch, committedTracks());
+    ASSERT_EQ(1, progressLoading.count());
+    EXPECT_EQ(lastLocation, progressLoading.first().first().toString());
+
+    // The next batch starts in a new transaction.
+    addNewTracks(1);
+    EXPECT_EQ(1, uncommittedTracks());
+    EXPECT_EQ(batch, committedTracks());
+    EXPECT_TRUE(scanFinishedCleanly());
+}
+
+TEST_F(LibraryScannerCommitTest, FailedCommitIsNotAnnounced) {
+    QSignalSpy progressLoading(m_pLibraryScanner,
+                               SIGNAL(progressLoading(QString)));
+    const int batch = LibraryScanner::kTracksPerTransaction;
+
+    addNewTracks(batch - 1);
+    commitDiscardedTransaction();
+    // The tracks are dropped and the scan is incomplete.
+    EXPECT_EQ(0, uncommittedTracks());
+    EXPECT_EQ(0, committedTracks());
+    EXPECT_EQ(0, progressLoading.count());
+    EXPECT_FALSE(scanFinishedCleanly());
+
+    // The next batch is added in a new transaction again.
+    addNewTracks(batch);
+    EXPECT_EQ(0, uncommittedTracks());
+    EXPECT_EQ(batch, committedTracks());
+    EXPECT_EQ(1, progressLoading.count());
+}
@@ -33,10 +33,13 @@ class MockScaler : public EngineBufferScale {
     MockScaler()
             : EngineBufferScale(),
               m_processedTempo(-1),
-              m_processedPitch(-1) {
+              m_processedPitch(-1),
+              m_clearCount(0) {
         SampleUtil::clear(m_buffer, MAX_BUFFER_LEN);
     }
-    void clear() { }
+    void clear() {
+        ++m_clearCount;
+    }
     CSAMPLE *getScaled(unsigned long buf_size) {
         m_processedTempo = m_dTempoRatio;
         m_processedPitch = m_dPitchRatio;
@@ -53,9 +56,14 @@ class MockScaler : public EngineBufferScale {
         return m_processedPitch;
     }
 
+    int getClearCount() {
+        return m_clearCount;
+    }
+
   private:
     double m_processedTempo;
     double m_processedPitch;
+    int m_clearCount;
 };
 
 
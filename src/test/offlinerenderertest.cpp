@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <QList>
+#include <QPair>
+#include <QTemporaryFile>
+#include <QTextStream>
+#include <QtDebug>
+
+#include "engine/offlinerenderer.h"
+#include "test/mockedenginebackendtest.h"
+
+namespace {
+
+const int kSampleRate = 44100;
+
+// Remembers where each block written by the renderer starts and the
+// crossfader position while it was rendered.
+class RecordingSink : public OfflineRenderSink {
+  public:
+    RecordingSink()
+            : m_frames(0),
+              m_maxFrames(-1) {
+    }
+
+    virtual bool write(const CSAMPLE* pBuffer, int iFrames) {
+        Q_UNUSED(pBuffer);
+        m_blocks.append(qMakePair(m_frames, ControlObject::get(
+                ConfigKey("[Master]", "crossfader"))));
+        m_frames += iFrames;
+        return m_maxFrames < 0 || m_frames < m_maxFrames;
+    }
+
+    // Returns the crossfader position of the block that contains frame.
+    double crossfaderAt(SINT frame) const {
+        for (int i = m_blocks.size() - 1; i >= 0; --i) {
+            if (m_blocks[i].first <= frame) {
+                return m_blocks[i].second;
+            }
+        }
+        return -2.0;
+    }
+
+    bool hasBlockAt(SINT frame) const {
+        for (int i = 0; i < m_blocks.size(); ++i) {
+            if (m_blocks[i].first == frame) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    SINT m_frames;
+    SINT m_maxFrames;
+    QList<QPair<SINT, double> > m_blocks;
+};
+
+class OfflineRendererTest : public MockedEngineBackendTest {
+};
+
+TEST_F(OfflineRendererTest, ParseTimeline) {
+    OfflineRenderTimeline timeline;
+    QString text("# seconds group item value\n"
+                 "\n"
+                 "2.5 [Master] crossfader 1\n"
+                 "  0 [Channel1] play 1  \n"
+                 "2.5\t[Master] crossfader -0.5\n");
+    QTextStream stream(&text);
+    QString error;
+    ASSERT_TRUE(timeline.parse(&stream, &error)) << error.toStdString();
+
+    const QList<OfflineRenderEvent>& events = timeline.events();
+    ASSERT_EQ(3, events.size());
+    EXPECT_DOUBLE_EQ(0.0, events[0].seconds);
+    EXPECT_EQ(ConfigKey("[Channel1]", "play"), events[0].key);
+    EXPECT_DOUBLE_EQ(1.0, events[0].value);
+    // Events at the same time keep their order
+    EXPECT_DOUBLE_EQ(1.0, events[1].value);
+    EXPECT_DOUBLE_EQ(-0.5, events[2].value);
+}
+
+TEST_F(OfflineRendererTest, ParseTimelineError) {
+    OfflineRenderTimeline timeline;
+    QString text("1.0 [Master] crossfader 1\n"
+                 "1.0 [Master] crossfader\n");
+    QTextStream stream(&text);
+    QString error;
+    EXPECT_FALSE(timeline.parse(&stream, &error));
+    EXPECT_TRUE(error.startsWith("line 2")) << error.toStdString();
+}
+
+TEST_F(OfflineRendererTest, LoadTimeline) {
+    ScopedTemporaryFile pFile(makeTemporaryFile(
+            "0.25 [Master] crossfader 0.5\n"));
+    OfflineRenderTimeline timeline;
+    QString error;
+    ASSERT_TRUE(timeline.load(pFile->fileName(), &error)) << error.toStdString();
+    ASSERT_EQ(1, timeline.events().size());
+    EXPECT_DOUBLE_EQ(0.5, timeline.events()[0].value);
+
+    EXPECT_FALSE(timeline.load(pFile->fileName() + ".missing", &error));
+}
+
+TEST_F(OfflineRendererTest, RendersDuration) {
+    OfflineRenderer renderer(m_pEngineMaster, kSampleRate, 1000);
+    RecordingSink sink;
+    EXPECT_TRUE(renderer.render(OfflineRenderTimeline(), 0.5, &sink));
+    EXPECT_EQ(kSampleRate / 2, renderer.getRenderedFrames());
+    EXPECT_EQ(kSampleRate / 2, sink.m_frames);
+    // 22 full buffers and the rest
+    EXPECT_EQ(23, sink.m_blocks.size());
+    EXPECT_DOUBLE_EQ(kSampleRate, ControlObject::get(
+            ConfigKey(m_sMasterGroup, "samplerate")));
+}
+
+TEST_F(OfflineRendererTest, EventsAtExactFrames) {
+    OfflineRenderTimeline timeline;
+    timeline.addEvent(0.0, ConfigKey("[Master]", "crossfader"), -1.0);
+    timeline.addEvent(0.1, ConfigKey("[Master]", "crossfader"), 0.5);
+    timeline.addEvent(0.3, ConfigKey("[Master]", "crossfader"), 1.0);
+    timeline.addEvent(0.3, ConfigKey("[Master]", "no_such_control"), 1.0);
+
+    // The buffer size must not matter
+    const int framesPerBuffer[] = {64, 1000, 4096};
+    for (unsigned int i = 0; i < sizeof(framesPerBuffer) / sizeof(framesPerBuffer[0]); ++i) {
+        OfflineRenderer renderer(m_pEngineMaster, kSampleRate,
+                                 framesPerBuffer[i]);
+        RecordingSink sink;
+        EXPECT_TRUE(renderer.render(timeline, 0.5, &sink));
+        EXPECT_EQ(kSampleRate / 2, sink.m_frames);
+
+        EXPECT_TRUE(sink.hasBlockAt(4410));
+        EXPECT_TRUE(sink.hasBlockAt(13230));
+        EXPECT_DOUBLE_EQ(-1.0, sink.crossfaderAt(0));
+        EXPECT_DOUBLE_EQ(-1.0, sink.crossfaderAt(4409));
+        EXPECT_DOUBLE_EQ(0.5, sink.crossfaderAt(4410));
+        EXPECT_DOUBLE_EQ(0.5, sink.crossfaderAt(13229));
+        EXPECT_DOUBLE_EQ(1.0, sink.crossfaderAt(13230));
+    }
+}
+
+TEST_F(OfflineRendererTest, SinkAborts) {
+    OfflineRenderer renderer(m_pEngineMaster, kSampleRate, 1000);
+    RecordingSink sink;
+    sink.m_maxFrames = 2500;
+    EXPECT_FALSE(renderer.render(OfflineRenderTimeline(), 1.0, &sink));
+    EXPECT_EQ(3000, renderer.getRenderedFrames());
+}
+
+TEST_F(OfflineRendererTest, FileSink) {
+    QTemporaryFile file;
+    ASSERT_TRUE(file.open());
+    const QString fileName = file.fileName();
+    file.close();
+
+    {
+        OfflineRenderFileSink sink(fileName, kSampleRate);
+        ASSERT_TRUE(sink.isOpen()) << sink.getError().toStdString();
+        OfflineRenderer renderer(m_pEngineMaster, kSampleRate);
+        EXPECT_TRUE(renderer.render(OfflineRenderTimeline(), 0.25, &sink));
+    }
+
+    SF_INFO sfInfo;
+    memset(&sfInfo, 0, sizeof(sfInfo));
+    SNDFILE* pSndfile = sf_open(fileName.toLocal8Bit().constData(),
+                                SFM_READ, &sfInfo);
+    ASSERT_TRUE(pSndfile != NULL);
+    EXPECT_EQ(kSampleRate, sfInfo.samplerate);
+    EXPECT_EQ(2, sfInfo.channels);
+    EXPECT_EQ(kSampleRate / 4, sfInfo.frames);
+    sf_close(pSndfile);
+}
+
+}  // namespace
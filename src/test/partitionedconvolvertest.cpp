@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <QVector>
+
+#include "engine/partitionedconvolution.h"
+#include "engine/partitionedconvolver.h"
+#include "util/fft.h"
+#include "util/math.h"
+#include "util/sleepableqthread.h"
+#include "util/types.h"
+
+namespace {
+
+const int kImpulseFrames = 4000;
+const int kInputFrames = 16000;
+
+void fillNoise(QVector<CSAMPLE>* pBuffer, unsigned int seed) {
+    for (int i = 0; i < pBuffer->size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*pBuffer)[i] = static_cast<CSAMPLE>((seed >> 16) % 2000) / 1000 - 1;
+    }
+}
+
+// The direct convolution of each channel of input with the same channel of
+// impulse, delayed by latency frames.
+QVector<CSAMPLE> directConvolution(const QVector<CSAMPLE>& input,
+                                   const QVector<CSAMPLE>& impulse,
+                                   int latency) {
+    const int frames = input.size() / 2;
+    const int impulseFrames = impulse.size() / 2;
+    QVector<CSAMPLE> output(input.size());
+    for (int frame = latency; frame < frames; ++frame) {
+        for (int ch = 0; ch < 2; ++ch) {
+            double sum = 0;
+            for (int i = 0; i < impulseFrames && i <= frame - latency; ++i) {
+                sum += impulse[i * 2 + ch] * input[(frame - latency - i) * 2 + ch];
+            }
+            output[frame * 2 + ch] = static_cast<CSAMPLE>(sum);
+        }
+    }
+    return output;
+}
+
+class PartitionedConvolverTest : public testing::Test {
+  protected:
+    PartitionedConvolverTest()
+            : m_impulse(kImpulseFrames * 2),
+              m_input(kInputFrames * 2) {
+        fillNoise(&m_impulse, 1);
+        // Decay like a reverb, so the output stays in the range of the input
+        for (int i = 0; i < m_impulse.size(); ++i) {
+            m_impulse[i] *= 0.05f * exp(-3.0 * i / m_impulse.size());
+        }
+        fillNoise(&m_input, 2);
+    }
+
+    QVector<CSAMPLE> m_impulse;
+    QVector<CSAMPLE> m_input;
+};
+
+TEST_F(PartitionedConvolverTest, FftMatchesDft) {
+    const int size = 16;
+    Fft fft(size);
+    QVector<CSAMPLE> data(size * 2);
+    fillNoise(&data, 3);
+    QVector<CSAMPLE> spectrum(data);
+    fft.forward(spectrum.data());
+    for (int k = 0; k < size; ++k) {
+        double re = 0;
+        double im = 0;
+        for (int n = 0; n < size; ++n) {
+            const double phase = -2 * M_PI * k * n / size;
+            re += data[n * 2] * cos(phase) - data[n * 2 + 1] * sin(phase);
+            im += data[n * 2] * sin(phase) + data[n * 2 + 1] * cos(phase);
+        }
+        EXPECT_NEAR(re, spectrum[k * 2], 1e-5);
+        EXPECT_NEAR(im, spectrum[k * 2 + 1], 1e-5);
+    }
+
+    fft.inverse(spectrum.data());
+    for (int i = 0; i < size * 2; ++i) {
+        EXPECT_NEAR(data[i], spectrum[i] / size, 1e-6);
+    }
+}
+
+TEST_F(PartitionedConvolverTest, UniformMatchesDirectConvolution) {
+    const int blockFrames = 64;
+    const int impulseFrames = 300;
+    QVector<CSAMPLE> impulse(m_impulse.mid(0, impulseFrames * 2));
+    PartitionedImpulseResponse partitioned(impulse.constData(), impulseFrames,
+                                           blockFrames);
+    EXPECT_EQ(5, partitioned.partitions());
+    UniformPartitionedConvolution convolution(&partitioned);
+
+    const int frames = 4096;
+    QVector<CSAMPLE> input(m_input.mid(0, frames * 2));
+    QVector<CSAMPLE> output(input);
+    for (int frame = 0; frame < frames; frame += blockFrames) {
+        convolution.processBlock(output.constData() + frame * 2,
+                                 output.data() + frame * 2);
+    }
+
+    QVector<CSAMPLE> expected = directConvolution(input, impulse, 0);
+    for (int i = 0; i < frames * 2; ++i) {
+        ASSERT_NEAR(expected[i], output[i], 1e-5) << i;
+    }
+}
+
+TEST_F(PartitionedConvolverTest, MatchesDirectConvolution) {
+    PartitionedConvolverKernelPointer pKernel(new PartitionedConvolverKernel(
+            m_impulse.constData(), kImpulseFrames));
+    ASSERT_TRUE(pKernel->tail() != NULL);
+    PartitionedConvolver convolver(pKernel, PartitionedConvolverWorkerPointer());
+
+    // An odd callback size, processed in place
+    const int bufferFrames = 300;
+    QVector<CSAMPLE> output(m_input);
+    for (int frame = 0; frame < kInputFrames; frame += bufferFrames) {
+        const int frames = math_min(bufferFrames, kInputFrames - frame);
+        convolver.process(output.constData() + frame * 2,
+                          output.data() + frame * 2, frames);
+        convolver.processTail();
+    }
+
+    QVector<CSAMPLE> expected = directConvolution(
+            m_input, m_impulse, PartitionedConvolver::latencyFrames());
+    for (int i = 0; i < kInputFrames * 2; ++i) {
+        ASSERT_NEAR(expected[i], output[i], 1e-5) << i;
+    }
+}
+
+// If the worker stalls, the tail is reset and left out until the worker has
+// caught up. It is in sync again afterwards.
+TEST_F(PartitionedConvolverTest, RecoversFromStalledWorker) {
+    PartitionedConvolverKernelPointer pKernel(new PartitionedConvolverKernel(
+            m_impulse.constData(), kImpulseFrames));
+    PartitionedConvolver convolver(pKernel, PartitionedConvolverWorkerPointer());
+
+    const int bufferFrames = 512;
+    QVector<CSAMPLE> output(m_input);
+    for (int frame = 0; frame < kInputFrames; frame += bufferFrames) {
+        const int frames = math_min(bufferFrames, kInputFrames - frame);
+        convolver.process(output.constData() + frame * 2,
+                          output.data() + frame * 2, frames);
+        // Stall for long enough to overflow the queue of the worker
+        if (frame < 512 * 4 || frame >= 512 * 16) {
+            convolver.processTail();
+        }
+    }
+
+    QVector<CSAMPLE> expected = directConvolution(
+            m_input, m_impulse, PartitionedConvolver::latencyFrames());
+    for (int i = 0; i < kInputFrames * 2; ++i) {
+        ASSERT_LT(fabs(output[i]), 4.0) << i;
+    }
+    // The tail starts over with the block after the stall, so the output is
+    // exact once the delayed impulse response has passed it.
+    for (int i = (512 * 16 + kImpulseFrames +
+                  PartitionedConvolver::latencyFrames()) * 2;
+            i < kInputFrames * 2; ++i) {
+        ASSERT_NEAR(expected[i], output[i], 1e-5) << i;
+    }
+}
+
+TEST_F(PartitionedConvolverTest, WorkerConvolvesTail) {
+    PartitionedConvolverKernelPointer pKernel(new PartitionedConvolverKernel(
+            m_impulse.constData(), kImpulseFrames));
+    PartitionedConvolverWorkerPointer pWorker(new PartitionedConvolverWorker());
+    PartitionedConvolver convolver(pKernel, pWorker);
+
+    const int bufferFrames = PartitionedConvolverKernel::kTailBlockFrames;
+    QVector<CSAMPLE> output(m_input);
+    for (int frame = 0; frame < kInputFrames; frame += bufferFrames) {
+        const int frames = math_min(bufferFrames, kInputFrames - frame);
+        convolver.process(output.constData() + frame * 2,
+                          output.data() + frame * 2, frames);
+        // Leave the worker more than enough time for a tail block.
+        SleepableQThread::msleep(20);
+    }
+
+    QVector<CSAMPLE> expected = directConvolution(
+            m_input, m_impulse, PartitionedConvolver::latencyFrames());
+    for (int i = 0; i < kInputFrames * 2; ++i) {
+        ASSERT_NEAR(expected[i], output[i], 1e-5) << i;
+    }
+}
+
+}  // namespace
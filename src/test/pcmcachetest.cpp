@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QScopedPointer>
+#include <QtDebug>
+
+#include "analyserqueue.h"
+#include "pcmcache.h"
+#include "samplebuffer.h"
+#include "test/mixxxtest.h"
+
+namespace {
+
+const SINT kFrameRate = 44100;
+const SINT kFrameCount = 10000;
+
+// Decodes kFrameCount frames of a ramp, but the read that reaches
+// kGapFrame returns early and the frames up to kGapFrame + kGapLength are
+// lost, like a decoder that skips a corrupt chunk of the file. The missing
+// frames are made up at the end.
+class ShortReadAudioSource : public Mixxx::AudioSource {
+  public:
+    static const SINT kGapFrame = 5000;
+    static const SINT kGapLength = 100;
+
+    ShortReadAudioSource()
+            : Mixxx::AudioSource(QUrl()),
+              m_framesRead(0) {
+        setChannelCount(kChannelCountStereo);
+        setFrameRate(kFrameRate);
+        setFrameCount(kFrameCount);
+    }
+
+    SINT seekSampleFrame(SINT frameIndex) override {
+        return frameIndex;
+    }
+
+    SINT readSampleFrames(SINT numberOfFrames,
+                          CSAMPLE* sampleBuffer) override {
+        SINT frames = math_min(numberOfFrames, kFrameCount - m_framesRead);
+        if (m_framesRead < kGapFrame && m_framesRead + frames > kGapFrame) {
+            frames = kGapFrame - m_framesRead;
+        }
+        for (SINT i = 0; i < frames; ++i) {
+            SINT frame = m_framesRead + i;
+            if (frame >= kGapFrame) {
+                frame += kGapLength;
+            }
+            sampleBuffer[i * 2] = static_cast<CSAMPLE>(frame) / kFrameCount;
+            sampleBuffer[i * 2 + 1] = sampleBuffer[i * 2];
+        }
+        m_framesRead += frames;
+        return frames;
+    }
+
+  private:
+    SINT m_framesRead;
+};
+
+}  // namespace
+
+class PcmCacheTest : public MixxxTest {
+  protected:
+    PcmCacheTest()
+            : m_directory(QDir::temp().absoluteFilePath(
+                      QString("mixxx-pcmcachetest-%1-%2").arg(
+                              QString::number(QCoreApplication::applicationPid()),
+                              QString::number(s_testCount++)))),
+              m_sourceModified(QDateTime::fromMSecsSinceEpoch(1234567890000LL)),
+              m_samples(kFrameCount * 2) {
+        for (SINT i = 0; i < m_samples.size(); ++i) {
+            m_samples[i] = static_cast<CSAMPLE>(i) / m_samples.size();
+        }
+    }
+
+    virtual void TearDown() {
+        QDir dir(m_directory);
+        foreach (const QString& fileName, dir.entryList(QDir::Files)) {
+            dir.remove(fileName);
+        }
+        QDir().rmdir(m_directory);
+    }
+
+    // Writes the test samples in blocks of different size.
+    bool writeTrack(const PcmCache& cache, const QString& key) {
+        QScopedPointer<PcmCacheWriter> pWriter(
+                cache.createWriter(key, m_sourceModified, kFrameRate));
+        if (!pWriter) {
+            return false;
+        }
+        SINT frame = 0;
+        SINT blockFrames = 1;
+        while (frame < kFrameCount) {
+            const SINT frames = math_min(blockFrames, kFrameCount - frame);
+            EXPECT_TRUE(pWriter->write(m_samples.data() + frame * 2, frames));
+            frame += frames;
+            blockFrames *= 3;
+        }
+        return pWriter->commit(kFrameCount);
+    }
+
+    bool doAnalysis(AnalyserQueue* pQueue, TrackPointer pTrack,
+                    Mixxx::AudioSourcePointer pAudioSource,
+                    PcmCacheWriter* pWriter) {
+        return pQueue->doAnalysis(pTrack, pAudioSource, pWriter);
+    }
+
+    // Every test uses a directory of its own, because the index of the files
+    // that PcmCache keeps in memory outlives the test.
+    static int s_testCount;
+
+    const QString m_directory;
+    const QDateTime m_sourceModified;
+    SampleBuffer m_samples;
+};
+
+int PcmCacheTest::s_testCount = 0;
+
+namespace {
+
+TEST_F(PcmCacheTest, DisabledByDefault) {
+    PcmCache cache(config());
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_TRUE(cache.createWriter("1", m_sourceModified, kFrameRate) == nullptr);
+}
+
+TEST_F(PcmCacheTest, ReadBackWithSeeks) {
+    PcmCache cache(m_directory, 1024 * 1024 * 1024);
+    ASSERT_TRUE(cache.openAudioSource("1", m_sourceModified, QUrl()).isNull());
+    ASSERT_TRUE(writeTrack(cache, "1"));
+
+    Mixxx::AudioSourcePointer pAudioSource(
+            cache.openAudioSource("1", m_sourceModified, QUrl()));
+    ASSERT_FALSE(pAudioSource.isNull());
+    EXPECT_EQ(kFrameRate, pAudioSource->getFrameRate());
+    EXPECT_EQ(2, pAudioSource->getChannelCount());
+    EXPECT_EQ(kFrameCount, pAudioSource->getFrameCount());
+
+    SampleBuffer buffer(1000 * 2);
+    const SINT seekFrames[] = { 0, 4321, 9500, 17, kFrameCount - 1 };
+    for (SINT seekFrame : seekFrames) {
+        EXPECT_EQ(seekFrame, pAudioSource->seekSampleFrame(seekFrame));
+        const SINT framesRead = pAudioSource->readSampleFramesStereo(1000, &buffer);
+        EXPECT_EQ(math_min(SINT(1000), kFrameCount - seekFrame), framesRead);
+        for (SINT i = 0; i < framesRead * 2; ++i) {
+            ASSERT_EQ(m_samples[seekFrame * 2 + i], buffer[i]) << seekFrame << i;
+        }
+    }
+
+    // Already cached
+    EXPECT_TRUE(cache.createWriter("1", m_sourceModified, kFrameRate) == nullptr);
+}
+
+TEST_F(PcmCacheTest, ModifiedSourceIsNotRead) {
+    PcmCache cache(m_directory, 1024 * 1024 * 1024);
+    ASSERT_TRUE(writeTrack(cache, "1"));
+    EXPECT_TRUE(cache.openAudioSource(
+            "1", m_sourceModified.addSecs(1), QUrl()).isNull());
+}
+
+TEST_F(PcmCacheTest, UncommittedWriterLeavesNothing) {
+    PcmCache cache(m_directory, 1024 * 1024 * 1024);
+    {
+        QScopedPointer<PcmCacheWriter> pWriter(
+                cache.createWriter("1", m_sourceModified, kFrameRate));
+        ASSERT_FALSE(pWriter.isNull());
+        EXPECT_TRUE(pWriter->write(m_samples.data(), kFrameCount));
+    }
+    EXPECT_TRUE(cache.openAudioSource("1", m_sourceModified, QUrl()).isNull());
+    EXPECT_TRUE(QDir(m_directory).entryList(QDir::Files).isEmpty());
+}
+
+TEST_F(PcmCacheTest, EvictsToSizeLimit) {
+    // Room for two tracks only.
+    const qint64 trackBytes = kFrameCount * 2 * sizeof(CSAMPLE) +
+            sizeof(Mixxx::PcmCacheFileHeader);
+    PcmCache cache(m_directory, 2 * trackBytes + trackBytes / 2);
+    ASSERT_TRUE(writeTrack(cache, "1"));
+    ASSERT_TRUE(writeTrack(cache, "2"));
+    ASSERT_TRUE(writeTrack(cache, "3"));
+
+    int cachedTracks = 0;
+    for (int i = 1; i <= 3; ++i) {
+        if (!cache.openAudioSource(QString::number(i), m_sourceModified,
+                                   QUrl()).isNull()) {
+            ++cachedTracks;
+        }
+    }
+    EXPECT_EQ(2, cachedTracks);
+    EXPECT_FALSE(cache.openAudioSource("3", m_sourceModified, QUrl()).isNull());
+}
+
+TEST_F(PcmCacheTest, EvictsLeastRecentlyUsed) {
+    const qint64 trackBytes = kFrameCount * 2 * sizeof(CSAMPLE) +
+            sizeof(Mixxx::PcmCacheFileHeader);
+    PcmCache cache(m_directory, 2 * trackBytes + trackBytes / 2);
+    ASSERT_TRUE(writeTrack(cache, "1"));
+    ASSERT_TRUE(writeTrack(cache, "2"));
+    // Reading the older track makes the other one the least recently used.
+    ASSERT_FALSE(cache.openAudioSource("1", m_sourceModified, QUrl()).isNull());
+    ASSERT_TRUE(writeTrack(cache, "3"));
+
+    EXPECT_FALSE(cache.openAudioSource("1", m_sourceModified, QUrl()).isNull());
+    EXPECT_TRUE(cache.openAudioSource("2", m_sourceModified, QUrl()).isNull());
+    EXPECT_FALSE(cache.openAudioSource("3", m_sourceModified, QUrl()).isNull());
+}
+
+TEST_F(PcmCacheTest, IncompleteWriterIsDiscarded) {
+    PcmCache cache(m_directory, 1024 * 1024 * 1024);
+    QScopedPointer<PcmCacheWriter> pWriter(
+            cache.createWriter("1", m_sourceModified, kFrameRate));
+    ASSERT_FALSE(pWriter.isNull());
+    EXPECT_TRUE(pWriter->write(m_samples.data(), kFrameCount - 1));
+    EXPECT_FALSE(pWriter->commit(kFrameCount));
+    EXPECT_TRUE(cache.openAudioSource("1", m_sourceModified, QUrl()).isNull());
+    EXPECT_TRUE(QDir(m_directory).entryList(QDir::Files).isEmpty());
+}
+
+TEST_F(PcmCacheTest, AnalysisDiscardsShortRead) {
+    PcmCache cache(m_directory, 1024 * 1024 * 1024);
+    AnalyserQueue queue(config(), NULL);
+    TrackPointer pTrack(new TrackInfoObject());
+    {
+        QScopedPointer<PcmCacheWriter> pWriter(
+                cache.createWriter("1", m_sourceModified, kFrameRate));
+        ASSERT_FALSE(pWriter.isNull());
+        Mixxx::AudioSourcePointer pAudioSource(new ShortReadAudioSource());
+        // The analysis itself completes despite of the gap.
+        EXPECT_TRUE(doAnalysis(&queue, pTrack, pAudioSource, pWriter.data()));
+    }
+    EXPECT_TRUE(cache.openAudioSource("1", m_sourceModified, QUrl()).isNull());
+    EXPECT_TRUE(QDir(m_directory).entryList(QDir::Files).isEmpty());
+}
+
+}  // namespace
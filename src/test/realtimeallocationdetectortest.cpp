@@ -0,0 +1,33 @@
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+
+#include "util/realtimeallocationdetector.h"
+
+namespace {
+
+TEST(RealtimeAllocationDetectorTest, CountsAllocationsOfRealtimeThreads) {
+    if (!RealtimeAllocationDetector::enabled()) {
+        // Built without rtalloc=1.
+        EXPECT_EQ(0, RealtimeAllocationDetector::takeAllocationCount());
+        return;
+    }
+    RealtimeAllocationDetector::takeAllocationCount();
+
+    // volatile keeps the compiler from optimizing the allocations away.
+    void* volatile pBefore = malloc(16);
+    free(pBefore);
+    EXPECT_EQ(0, RealtimeAllocationDetector::takeAllocationCount());
+
+    RealtimeAllocationDetector::markRealtimeThread();
+    void* volatile pDuring = malloc(32);
+    RealtimeAllocationDetector::unmarkRealtimeThread();
+    free(pDuring);
+
+    size_t lastSize = 0;
+    EXPECT_EQ(1, RealtimeAllocationDetector::takeAllocationCount(&lastSize));
+    EXPECT_EQ(32u, lastSize);
+    EXPECT_EQ(0, RealtimeAllocationDetector::takeAllocationCount());
+}
+
+}  // namespace
@@ -3,8 +3,10 @@
 #include <QtDebug>
 #include <QList>
 #include <QPair>
+#include <QVector>
 
 #include "util/timer.h"
+#include "util/performancetimer.h"
 #include "sampleutil.h"
 
 namespace {
@@ -340,6 +342,22 @@ TEST_F(SampleUtilTest, sumAbsPerChannel) {
     }
 }
 
+TEST_F(SampleUtilTest, isSilent) {
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        FillBuffer(buffer, CSAMPLE_SILENCE_THRESHOLD / 2, size);
+        buffer[0] = -buffer[0];
+        EXPECT_TRUE(SampleUtil::isSilent(buffer, size));
+        // The last sample is in a block of its own for some sizes.
+        buffer[size - 1] = -CSAMPLE_SILENCE_THRESHOLD;
+        EXPECT_FALSE(SampleUtil::isSilent(buffer, size));
+        EXPECT_TRUE(SampleUtil::isSilent(buffer, size - 1));
+        buffer[0] = 0.5f;
+        EXPECT_FALSE(SampleUtil::isSilent(buffer, 1));
+    }
+}
+
 TEST_F(SampleUtilTest, interleaveBuffer) {
     for (int i = 0; i < buffers.size(); ++i) {
         CSAMPLE* buffer = buffers[i];
@@ -387,189 +405,759 @@ TEST_F(SampleUtilTest, deinterleaveBuffer) {
     }
 }
 
-/*
-// deactivated since it is benchmark only and cannot fail
-// Note: the order of the calls matters
-TEST_F(SampleUtilTest, memcpyspeed) {
-    CSAMPLE* buffer = buffers[0];
-
-    int size = sizes[0] - (rand() % 2) * 8; // preven predicting loop size
-    FillBuffer(buffer, 0.0f, size);
-    CSAMPLE* buffer2 = SampleUtil::alloc(size);
-    FillBuffer(buffer2, 0.0f, size);
-    CSAMPLE* buffer3 = SampleUtil::alloc(size*2);
-    FillBuffer(buffer3, 1.0f, size*2);
-    for (int j = 0; j < size; j++) {
-        buffer3[j*2] = j;
-        buffer3[j*2+1] = -j;
+// The SIMD kernels are compared against the scalar implementation for all
+// sizes up to a few vectors and for all alignments.
+const int kMaxSimdTestSize = 67;
+const int kMaxSimdTestOffset = 4;
+const int kSimdTestBufferSize = 2 * kMaxSimdTestSize + kMaxSimdTestOffset;
+
+// The operations under test. They read from pSrc1, pSrc2 or pSrcS16, and
+// write to or update pDest in place. pDest has room for 2 * size samples.
+struct ApplyGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE*, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        // Keeps the magnitude of the samples when repeated in the benchmark
+        SampleUtil::applyGain(pDest, -1.0f, size);
     }
+};
 
-    // For ensure data is cached and equal start conditions
-    SampleUtil::copy(buffer, buffer2, size);
-
-    qint64 elapsed;
-    Timer t("");
-    t.start();
-
-    memcpy(buffer, buffer2, size * sizeof(CSAMPLE));
-
-    elapsed = t.elapsed("");
-    qDebug() << "memcpy" << elapsed << "ns" << size;
-
-//#########
-
-    t.start();
-
-    std::copy(buffer2, buffer2 + size, buffer);
-
-    elapsed = t.elapsed("");
-    qDebug() << "std::copy" << elapsed << "ns" << size;
-
-//############
-
-    t.start();
-
-    SampleUtil::copy(buffer, buffer2, size);
-
-    elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::copy" << elapsed << "ns" << size;
-
-//############
-
-    // Smallest Mixxx audio buffer
-    size = 64 - (rand() % 2) * 8; // preven predicting loop size
-
-    // For ensure data is cached and equal start conditions
-    SampleUtil::copy(buffer, buffer2, size);
+struct ApplyRampingGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE*, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::applyRampingGain(pDest, -0.99f, -1.0f, size);
+    }
+};
 
-//############
+struct CopyWithGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::copyWithGain(pDest, pSrc1, 0.7f, size);
+    }
+};
 
-    t.start();
+struct CopyWithRampingGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::copyWithRampingGain(pDest, pSrc1, 0.7f, 0.1f, size);
+    }
+};
 
-    SampleUtil::copy(buffer, buffer2, size);
+struct AddWithGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::addWithGain(pDest, pSrc1, 0.7f, size);
+    }
+};
 
-    elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::copy" << elapsed << "ns" << size;
+struct AddWithRampingGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::addWithRampingGain(pDest, pSrc1, 0.2f, 1.0f, size);
+    }
+};
 
-//############
+struct CopyClampBuffer {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::copyClampBuffer(pDest, pSrc1, size);
+    }
+};
 
-    t.start();
+struct ConvertS16ToFloat32 {
+    void operator()(CSAMPLE* pDest, const CSAMPLE*, const CSAMPLE*,
+                    const SAMPLE* pSrcS16, int size) const {
+        SampleUtil::convertS16ToFloat32(pDest, pSrcS16, size);
+    }
+};
 
-    memcpy(buffer, buffer2, size * sizeof(CSAMPLE));
+struct InterleaveBuffer {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE* pSrc2,
+                    const SAMPLE*, int size) const {
+        SampleUtil::interleaveBuffer(pDest, pSrc1, pSrc2, size);
+    }
+};
 
-    elapsed = t.elapsed("");
-    qDebug() << "memcpy" << elapsed << "ns" << size;
+struct DeinterleaveBuffer {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE*,
+                    const SAMPLE*, int size) const {
+        SampleUtil::deinterleaveBuffer(pDest, pDest + size, pSrc1, size / 2);
+    }
+};
 
-//#########
+// Six sources fill a whole group and add a second one. A muted source is
+// skipped.
+struct MixWithGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE* pSrc2,
+                    const SAMPLE*, int size) const {
+        const CSAMPLE* src[] = {pSrc1, pSrc2, pSrc1 + 1, pSrc2 + 1, pSrc1, pSrc2};
+        const CSAMPLE_GAIN gain[] = {0.7f, 0.0f, 0.3f, 1.0f, -0.5f, 0.2f};
+        SampleUtil::mixWithGain(pDest, src, gain, 6, size);
+    }
+};
 
-    t.start();
+struct MixWithRampingGain {
+    void operator()(CSAMPLE* pDest, const CSAMPLE* pSrc1, const CSAMPLE* pSrc2,
+                    const SAMPLE*, int size) const {
+        const CSAMPLE* src[] = {pSrc1, pSrc2, pSrc1 + 1, pSrc2 + 1, pSrc1, pSrc2};
+        const CSAMPLE_GAIN oldGain[] = {0.7f, 0.0f, 0.3f, 1.0f, 0.0f, 0.2f};
+        const CSAMPLE_GAIN newGain[] = {0.1f, 0.0f, 0.3f, 0.0f, -0.5f, 0.9f};
+        SampleUtil::mixWithRampingGain(pDest, src, oldGain, newGain, 6, size * 2);
+    }
+};
 
-    std::copy(buffer2, buffer2 + size, buffer);
+class SampleUtilSimdTest : public testing::Test {
+  protected:
+    SampleUtilSimdTest()
+            : m_defaultIsa(SampleUtil::getIsa()) {
+    }
 
-    elapsed = t.elapsed("");
-    qDebug() << "std::copy" << elapsed << "ns" << size;
+    virtual void SetUp() {
+        // Some of the samples are clipping
+        srand(42);
+        for (int i = 0; i < kSimdTestBufferSize; ++i) {
+            m_src1[i] = 3.0f * rand() / RAND_MAX - 1.5f;
+            m_src2[i] = 2.0f * rand() / RAND_MAX - 1.0f;
+            m_dest[i] = 2.0f * rand() / RAND_MAX - 1.0f;
+            m_srcS16[i] = static_cast<SAMPLE>(
+                    rand() % (SAMPLE_MAX - SAMPLE_MIN + 1) + SAMPLE_MIN);
+        }
+    }
 
+    virtual void TearDown() {
+        SampleUtil::setIsa(m_defaultIsa);
+    }
 
-    SampleUtil::free(buffer2);
-    SampleUtil::free(buffer3);
-}
+    // All instruction sets with SIMD kernels that can be tested on this CPU
+    QList<SampleUtil::Isa> simdIsas() const {
+        QList<SampleUtil::Isa> isas;
+        for (int isa = SampleUtil::ISA_SCALAR + 1; isa < SampleUtil::ISA_COUNT; ++isa) {
+            if (SampleUtil::isIsaSupported(static_cast<SampleUtil::Isa>(isa))) {
+                isas.append(static_cast<SampleUtil::Isa>(isa));
+            }
+        }
+        return isas;
+    }
 
-TEST_F(SampleUtilTest, copy3WithGainSpeed) {
-    CSAMPLE* buffer = buffers[0];
+    template<typename Op>
+    void run(Op op, SampleUtil::Isa isa, int size, int offset,
+             CSAMPLE* pDest) {
+        ASSERT_TRUE(SampleUtil::setIsa(isa));
+        memcpy(pDest, m_dest, sizeof(m_dest));
+        op(pDest + offset, m_src1 + offset, m_src2 + offset,
+           m_srcS16 + offset, size);
+    }
 
-    int size = sizes[0] - (rand() % 2) * 8; // preven predicting loop size
-    FillBuffer(buffer, 0.0f, size);
-    CSAMPLE* buffer2 = SampleUtil::alloc(size);
-    FillBuffer(buffer2, 0.0f, size);
-    CSAMPLE* buffer3 = SampleUtil::alloc(size*2);
-    FillBuffer(buffer3, 1.0f, size*2);
-    for (int j = 0; j < size; j++) {
-        buffer3[j*2] = j;
-        buffer3[j*2+1] = -j;
+    template<typename Op>
+    void expectSimdMatchesScalar(Op op) {
+        foreach (SampleUtil::Isa isa, simdIsas()) {
+            for (int size = 0; size <= kMaxSimdTestSize; ++size) {
+                for (int offset = 0; offset < kMaxSimdTestOffset; ++offset) {
+                    CSAMPLE expected[kSimdTestBufferSize];
+                    CSAMPLE actual[kSimdTestBufferSize];
+                    run(op, SampleUtil::ISA_SCALAR, size, offset, expected);
+                    run(op, isa, size, offset, actual);
+                    // The whole buffer is compared to detect overruns.
+                    // The results may differ by rounding if the compiler
+                    // uses fused multiply-adds in one of the versions.
+                    for (int i = 0; i < kSimdTestBufferSize; ++i) {
+                        ASSERT_NEAR(expected[i], actual[i],
+                                    1e-6f * math_max(1.0f, fabs(expected[i])))
+                                << SampleUtil::isaName(isa) << " size " << size
+                                << " offset " << offset << " index " << i;
+                    }
+                }
+            }
+        }
     }
 
-    // For ensure data is cached and equal start conditions
-    SampleUtil::copy(buffer, buffer2, size);
-    SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+    // Prints the time per sample of op for all supported instruction sets.
+    template<typename Op>
+    void benchmark(Op op, const char* name) {
+        // The typical size of the buffers in the engine
+        const int kSize = 1024;
+        const int kIterations = 10000;
+        CSAMPLE* pDest = SampleUtil::alloc(kSize * 2);
+        CSAMPLE* pSrc1 = SampleUtil::alloc(kSize * 2);
+        CSAMPLE* pSrc2 = SampleUtil::alloc(kSize);
+        SAMPLE srcS16[kSize];
+        for (int i = 0; i < kSize * 2; ++i) {
+            pDest[i] = m_dest[i % kSimdTestBufferSize];
+            pSrc1[i] = m_src1[i % kSimdTestBufferSize];
+        }
+        for (int i = 0; i < kSize; ++i) {
+            pSrc2[i] = m_src2[i % kSimdTestBufferSize];
+            srcS16[i] = m_srcS16[i % kSimdTestBufferSize];
+        }
+        for (int isa = 0; isa < SampleUtil::ISA_COUNT; ++isa) {
+            if (!SampleUtil::setIsa(static_cast<SampleUtil::Isa>(isa))) {
+                continue;
+            }
+            // Warm up the caches
+            op(pDest, pSrc1, pSrc2, srcS16, kSize);
+            PerformanceTimer timer;
+            timer.start();
+            for (int i = 0; i < kIterations; ++i) {
+                op(pDest, pSrc1, pSrc2, srcS16, kSize);
+            }
+            const qint64 elapsed = timer.elapsed();
+            qDebug() << name
+                     << SampleUtil::isaName(static_cast<SampleUtil::Isa>(isa))
+                     << static_cast<double>(elapsed) / kIterations / kSize
+                     << "ns/sample";
+        }
+        SampleUtil::free(pDest);
+        SampleUtil::free(pSrc1);
+        SampleUtil::free(pSrc2);
+    }
 
-    qint64 elapsed;
-    Timer t("");
-    t.start();
+    const SampleUtil::Isa m_defaultIsa;
+    CSAMPLE m_src1[kSimdTestBufferSize];
+    CSAMPLE m_src2[kSimdTestBufferSize];
+    CSAMPLE m_dest[kSimdTestBufferSize];
+    SAMPLE m_srcS16[kSimdTestBufferSize];
+};
 
-    SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+TEST_F(SampleUtilSimdTest, isaSelection) {
+    EXPECT_TRUE(SampleUtil::isIsaSupported(SampleUtil::ISA_SCALAR));
+    EXPECT_TRUE(SampleUtil::isIsaSupported(m_defaultIsa));
+    // The best supported instruction set is selected at startup
+    for (int isa = m_defaultIsa + 1; isa < SampleUtil::ISA_COUNT; ++isa) {
+        if (isa != SampleUtil::ISA_NEON) {
+            EXPECT_FALSE(SampleUtil::isIsaSupported(
+                    static_cast<SampleUtil::Isa>(isa)));
+        }
+    }
+    EXPECT_TRUE(SampleUtil::setIsa(SampleUtil::ISA_SCALAR));
+    EXPECT_EQ(SampleUtil::ISA_SCALAR, SampleUtil::getIsa());
+}
 
-    elapsed = t.elapsed("");
-    qDebug() << "copy2WithGain" << elapsed << "ns" << size;
+TEST_F(SampleUtilSimdTest, applyGain) {
+    expectSimdMatchesScalar(ApplyGain());
+}
 
-//#########
+TEST_F(SampleUtilSimdTest, applyRampingGain) {
+    expectSimdMatchesScalar(ApplyRampingGain());
+}
 
-    t.start();
+TEST_F(SampleUtilSimdTest, copyWithGain) {
+    expectSimdMatchesScalar(CopyWithGain());
+}
 
-    SampleUtil::copy1WithGain(buffer, buffer2, 1.1f, size);
+TEST_F(SampleUtilSimdTest, copyWithRampingGain) {
+    expectSimdMatchesScalar(CopyWithRampingGain());
+}
 
-    elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::copy1WithGain" << elapsed << "ns" << size;
+TEST_F(SampleUtilSimdTest, addWithGain) {
+    expectSimdMatchesScalar(AddWithGain());
+}
 
-//############
+TEST_F(SampleUtilSimdTest, addWithRampingGain) {
+    expectSimdMatchesScalar(AddWithRampingGain());
+}
 
-    t.start();
+TEST_F(SampleUtilSimdTest, copyClampBuffer) {
+    expectSimdMatchesScalar(CopyClampBuffer());
+}
 
-    SampleUtil::copy1WithGain(buffer, buffer2, 1.1f, size);
+TEST_F(SampleUtilSimdTest, convertS16ToFloat32) {
+    expectSimdMatchesScalar(ConvertS16ToFloat32());
+}
 
-    elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::copy1WithGain" << elapsed << "ns" << size;
+TEST_F(SampleUtilSimdTest, interleaveBuffer) {
+    expectSimdMatchesScalar(InterleaveBuffer());
+}
 
-//############
+TEST_F(SampleUtilSimdTest, deinterleaveBuffer) {
+    expectSimdMatchesScalar(DeinterleaveBuffer());
+}
 
-    t.start();
+TEST_F(SampleUtilSimdTest, mixWithGain) {
+    expectSimdMatchesScalar(MixWithGain());
+}
 
-    SampleUtil::addWithGain(buffer, buffer2, 1.1f, size);
+TEST_F(SampleUtilSimdTest, mixWithRampingGain) {
+    expectSimdMatchesScalar(MixWithRampingGain());
+}
 
-    elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::addWithGain" << elapsed << "ns" << size;
+TEST_F(SampleUtilSimdTest, sumAbsPerChannel) {
+    foreach (SampleUtil::Isa isa, simdIsas()) {
+        for (int size = 0; size <= kMaxSimdTestSize; ++size) {
+            for (int offset = 0; offset < kMaxSimdTestOffset; ++offset) {
+                CSAMPLE expectedL, expectedR, actualL, actualR;
+                ASSERT_TRUE(SampleUtil::setIsa(SampleUtil::ISA_SCALAR));
+                const SampleUtil::CLIP_STATUS expectedClipping =
+                        SampleUtil::sumAbsPerChannel(&expectedL, &expectedR,
+                                                     m_src1 + offset, size);
+                ASSERT_TRUE(SampleUtil::setIsa(isa));
+                const SampleUtil::CLIP_STATUS actualClipping =
+                        SampleUtil::sumAbsPerChannel(&actualL, &actualR,
+                                                     m_src1 + offset, size);
+                // The order of the additions differs
+                EXPECT_NEAR(expectedL, actualL, 1e-4f) << SampleUtil::isaName(isa);
+                EXPECT_NEAR(expectedR, actualR, 1e-4f) << SampleUtil::isaName(isa);
+                EXPECT_EQ(static_cast<int>(expectedClipping),
+                          static_cast<int>(actualClipping))
+                        << SampleUtil::isaName(isa);
+            }
+        }
+    }
+}
 
+// Benchmark only, run with --gtest_also_run_disabled_tests
+TEST_F(SampleUtilSimdTest, DISABLED_kernelSpeed) {
+    benchmark(ApplyGain(), "applyGain");
+    benchmark(ApplyRampingGain(), "applyRampingGain");
+    benchmark(CopyWithGain(), "copyWithGain");
+    benchmark(CopyWithRampingGain(), "copyWithRampingGain");
+    benchmark(AddWithGain(), "addWithGain");
+    benchmark(AddWithRampingGain(), "addWithRampingGain");
+    benchmark(CopyClampBuffer(), "copyClampBuffer");
+    benchmark(ConvertS16ToFloat32(), "convertS16ToFloat32");
+    benchmark(InterleaveBuffer(), "interleaveBuffer");
+    benchmark(DeinterleaveBuffer(), "deinterleaveBuffer");
+}
 
-//############
+// Calls the generated copyNWithGain() function for numSources
+void copyNWithGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pGain, int numSources, int iNumSamples) {
+    switch (numSources) {
+    case 1:
+        SampleUtil::copy1WithGain(pDest, pSrc[0], pGain[0], iNumSamples);
+        break;
+    case 2:
+        SampleUtil::copy2WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                iNumSamples);
+        break;
+    case 3:
+        SampleUtil::copy3WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], iNumSamples);
+        break;
+    case 4:
+        SampleUtil::copy4WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], iNumSamples);
+        break;
+    case 5:
+        SampleUtil::copy5WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                iNumSamples);
+        break;
+    case 6:
+        SampleUtil::copy6WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], iNumSamples);
+        break;
+    case 7:
+        SampleUtil::copy7WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], iNumSamples);
+        break;
+    case 8:
+        SampleUtil::copy8WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                iNumSamples);
+        break;
+    case 9:
+        SampleUtil::copy9WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], iNumSamples);
+        break;
+    case 10:
+        SampleUtil::copy10WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], iNumSamples);
+        break;
+    case 11:
+        SampleUtil::copy11WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], pSrc[10], pGain[10],
+                iNumSamples);
+        break;
+    case 12:
+        SampleUtil::copy12WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], pSrc[10], pGain[10],
+                pSrc[11], pGain[11], iNumSamples);
+        break;
+    case 13:
+        SampleUtil::copy13WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], pSrc[10], pGain[10],
+                pSrc[11], pGain[11], pSrc[12], pGain[12], iNumSamples);
+        break;
+    case 14:
+        SampleUtil::copy14WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], pSrc[10], pGain[10],
+                pSrc[11], pGain[11], pSrc[12], pGain[12], pSrc[13], pGain[13],
+                iNumSamples);
+        break;
+    case 15:
+        SampleUtil::copy15WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], pSrc[10], pGain[10],
+                pSrc[11], pGain[11], pSrc[12], pGain[12], pSrc[13], pGain[13],
+                pSrc[14], pGain[14], iNumSamples);
+        break;
+    case 16:
+        SampleUtil::copy16WithGain(pDest, pSrc[0], pGain[0], pSrc[1], pGain[1],
+                pSrc[2], pGain[2], pSrc[3], pGain[3], pSrc[4], pGain[4],
+                pSrc[5], pGain[5], pSrc[6], pGain[6], pSrc[7], pGain[7],
+                pSrc[8], pGain[8], pSrc[9], pGain[9], pSrc[10], pGain[10],
+                pSrc[11], pGain[11], pSrc[12], pGain[12], pSrc[13], pGain[13],
+                pSrc[14], pGain[14], pSrc[15], pGain[15], iNumSamples);
+        break;
+    default:
+        FAIL() << "Not generated for " << numSources << " sources";
+    }
+}
 
-    t.start();
+// Calls the generated copyNWithRampingGain() function for numSources
+void copyNWithRampingGain(CSAMPLE* pDest, const CSAMPLE* const* pSrc,
+        const CSAMPLE_GAIN* pOldGain, const CSAMPLE_GAIN* pNewGain,
+        int numSources, int iNumSamples) {
+    switch (numSources) {
+    case 1:
+        SampleUtil::copy1WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0], iNumSamples);
+        break;
+    case 2:
+        SampleUtil::copy2WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1], iNumSamples);
+        break;
+    case 3:
+        SampleUtil::copy3WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2], iNumSamples);
+        break;
+    case 4:
+        SampleUtil::copy4WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3], iNumSamples);
+        break;
+    case 5:
+        SampleUtil::copy5WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4], iNumSamples);
+        break;
+    case 6:
+        SampleUtil::copy6WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5], iNumSamples);
+        break;
+    case 7:
+        SampleUtil::copy7WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6], iNumSamples);
+        break;
+    case 8:
+        SampleUtil::copy8WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7], iNumSamples);
+        break;
+    case 9:
+        SampleUtil::copy9WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8], iNumSamples);
+        break;
+    case 10:
+        SampleUtil::copy10WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9], iNumSamples);
+        break;
+    case 11:
+        SampleUtil::copy11WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9],
+                pSrc[10], pOldGain[10], pNewGain[10], iNumSamples);
+        break;
+    case 12:
+        SampleUtil::copy12WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9],
+                pSrc[10], pOldGain[10], pNewGain[10],
+                pSrc[11], pOldGain[11], pNewGain[11], iNumSamples);
+        break;
+    case 13:
+        SampleUtil::copy13WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9],
+                pSrc[10], pOldGain[10], pNewGain[10],
+                pSrc[11], pOldGain[11], pNewGain[11],
+                pSrc[12], pOldGain[12], pNewGain[12], iNumSamples);
+        break;
+    case 14:
+        SampleUtil::copy14WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9],
+                pSrc[10], pOldGain[10], pNewGain[10],
+                pSrc[11], pOldGain[11], pNewGain[11],
+                pSrc[12], pOldGain[12], pNewGain[12],
+                pSrc[13], pOldGain[13], pNewGain[13], iNumSamples);
+        break;
+    case 15:
+        SampleUtil::copy15WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9],
+                pSrc[10], pOldGain[10], pNewGain[10],
+                pSrc[11], pOldGain[11], pNewGain[11],
+                pSrc[12], pOldGain[12], pNewGain[12],
+                pSrc[13], pOldGain[13], pNewGain[13],
+                pSrc[14], pOldGain[14], pNewGain[14], iNumSamples);
+        break;
+    case 16:
+        SampleUtil::copy16WithRampingGain(pDest,
+                pSrc[0], pOldGain[0], pNewGain[0],
+                pSrc[1], pOldGain[1], pNewGain[1],
+                pSrc[2], pOldGain[2], pNewGain[2],
+                pSrc[3], pOldGain[3], pNewGain[3],
+                pSrc[4], pOldGain[4], pNewGain[4],
+                pSrc[5], pOldGain[5], pNewGain[5],
+                pSrc[6], pOldGain[6], pNewGain[6],
+                pSrc[7], pOldGain[7], pNewGain[7],
+                pSrc[8], pOldGain[8], pNewGain[8],
+                pSrc[9], pOldGain[9], pNewGain[9],
+                pSrc[10], pOldGain[10], pNewGain[10],
+                pSrc[11], pOldGain[11], pNewGain[11],
+                pSrc[12], pOldGain[12], pNewGain[12],
+                pSrc[13], pOldGain[13], pNewGain[13],
+                pSrc[14], pOldGain[14], pNewGain[14],
+                pSrc[15], pOldGain[15], pNewGain[15], iNumSamples);
+        break;
+    default:
+        FAIL() << "Not generated for " << numSources << " sources";
+    }
+}
 
-    CSAMPLE* __restrict__ buffer_ = buffer;
-    CSAMPLE* __restrict__ buffer1_ = buffer2;
-    CSAMPLE* __restrict__ buffer2_ = buffer3;
+class SampleUtilMixTest : public testing::Test {
+  protected:
+    // Not a multiple of the block size of the mixer
+    static const int kSize = 1030;
+    static const int kMaxSources = 40;
 
-    for (int i = 0; i < size; ++i) {
-        buffer_[i] += buffer1_[i] * 1.1f;
+    virtual void SetUp() {
+        srand(42);
+        for (int i = 0; i < kMaxSources; ++i) {
+            CSAMPLE* pBuffer = SampleUtil::alloc(kSize);
+            for (int j = 0; j < kSize; ++j) {
+                pBuffer[j] = 2.0f * rand() / RAND_MAX - 1.0f;
+            }
+            m_sources.append(pBuffer);
+            // Every fifth source is muted
+            m_oldGain.append(i % 5 == 2 ? 0.0f : static_cast<CSAMPLE_GAIN>(rand()) / RAND_MAX);
+            m_newGain.append(i % 5 == 2 ? 0.0f : static_cast<CSAMPLE_GAIN>(rand()) / RAND_MAX);
+        }
+        m_pExpected = SampleUtil::alloc(kSize);
+        m_pActual = SampleUtil::alloc(kSize);
     }
 
-    elapsed = t.elapsed("");
-    qDebug() << "addWithGain as for loop" << elapsed << "ns" << size;
+    virtual void TearDown() {
+        foreach (CSAMPLE* pBuffer, m_sources) {
+            SampleUtil::free(pBuffer);
+        }
+        m_sources.clear();
+        SampleUtil::free(m_pExpected);
+        SampleUtil::free(m_pActual);
+    }
 
-//############
+    const CSAMPLE* const* sources() const {
+        return const_cast<const CSAMPLE* const*>(m_sources.constData());
+    }
 
-    t.start();
+    void expectOutputNear(int numSources) {
+        for (int i = 0; i < kSize; ++i) {
+            ASSERT_NEAR(m_pExpected[i], m_pActual[i], 1e-5f)
+                    << numSources << " sources, index " << i;
+        }
+    }
 
-    SampleUtil::addWithGain(buffer, buffer2, 1.1f, size);
+    QVector<CSAMPLE*> m_sources;
+    QVector<CSAMPLE_GAIN> m_oldGain;
+    QVector<CSAMPLE_GAIN> m_newGain;
+    CSAMPLE* m_pExpected;
+    CSAMPLE* m_pActual;
+};
 
-    elapsed = t.elapsed("");
-    qDebug() << "SampleUtil::addWithGain" << elapsed << "ns" << size;
+TEST_F(SampleUtilMixTest, mixWithGainMatchesCopyNWithGain) {
+    for (int numSources = 1; numSources <= 16; ++numSources) {
+        copyNWithGain(m_pExpected, sources(), m_newGain.constData(),
+                      numSources, kSize);
+        SampleUtil::mixWithGain(m_pActual, sources(), m_newGain.constData(),
+                                numSources, kSize);
+        expectOutputNear(numSources);
+    }
+}
 
-//############
+TEST_F(SampleUtilMixTest, mixWithRampingGainMatchesCopyNWithRampingGain) {
+    for (int numSources = 1; numSources <= 16; ++numSources) {
+        copyNWithRampingGain(m_pExpected, sources(), m_oldGain.constData(),
+                             m_newGain.constData(), numSources, kSize);
+        SampleUtil::mixWithRampingGain(m_pActual, sources(),
+                                       m_oldGain.constData(),
+                                       m_newGain.constData(),
+                                       numSources, kSize);
+        expectOutputNear(numSources);
+    }
+}
 
+TEST_F(SampleUtilMixTest, mixManySources) {
+    SampleUtil::clear(m_pExpected, kSize);
+    for (int i = 0; i < kMaxSources; ++i) {
+        SampleUtil::addWithRampingGain(m_pExpected, m_sources[i],
+                                       m_oldGain[i], m_newGain[i], kSize);
+    }
+    SampleUtil::mixWithRampingGain(m_pActual, sources(), m_oldGain.constData(),
+                                   m_newGain.constData(), kMaxSources, kSize);
+    expectOutputNear(kMaxSources);
 
+    SampleUtil::clear(m_pExpected, kSize);
+    for (int i = 0; i < kMaxSources; ++i) {
+        SampleUtil::addWithGain(m_pExpected, m_sources[i], m_newGain[i], kSize);
+    }
+    SampleUtil::mixWithGain(m_pActual, sources(), m_newGain.constData(),
+                            kMaxSources, kSize);
+    expectOutputNear(kMaxSources);
+}
 
-    t.start();
+TEST_F(SampleUtilMixTest, mixSilence) {
+    const QVector<CSAMPLE_GAIN> zeroGain(kMaxSources, 0.0f);
+    SampleUtil::clear(m_pExpected, kSize);
 
-    SampleUtil::copy2WithGain(buffer, buffer2, 1.1f, buffer3, 1.1f, size);
+    SampleUtil::fill(m_pActual, 1.0f, kSize);
+    SampleUtil::mixWithGain(m_pActual, sources(), zeroGain.constData(), 0, kSize);
+    expectOutputNear(0);
 
-    elapsed = t.elapsed("");
-    qDebug() << "copy2WithGain" << elapsed << "ns" << size;
+    SampleUtil::fill(m_pActual, 1.0f, kSize);
+    SampleUtil::mixWithGain(m_pActual, sources(), zeroGain.constData(),
+                            kMaxSources, kSize);
+    expectOutputNear(kMaxSources);
 
-//#########
+    SampleUtil::fill(m_pActual, 1.0f, kSize);
+    SampleUtil::mixWithRampingGain(m_pActual, sources(), zeroGain.constData(),
+                                   zeroGain.constData(), kMaxSources, kSize);
+    expectOutputNear(kMaxSources);
+}
 
-    SampleUtil::free(buffer2);
-    SampleUtil::free(buffer3);
+// Benchmark only, run with --gtest_also_run_disabled_tests
+TEST_F(SampleUtilMixTest, DISABLED_mixSpeed) {
+    const int kBufferSize = 1024;
+    const int kIterations = 10000;
+    for (int numSources = 1; numSources <= 16; ++numSources) {
+        PerformanceTimer timer;
+        timer.start();
+        for (int i = 0; i < kIterations; ++i) {
+            copyNWithGain(m_pExpected, sources(), m_newGain.constData(),
+                          numSources, kBufferSize);
+        }
+        const qint64 copyN = timer.restart();
+        for (int i = 0; i < kIterations; ++i) {
+            SampleUtil::mixWithGain(m_pActual, sources(), m_newGain.constData(),
+                                    numSources, kBufferSize);
+        }
+        const qint64 mix = timer.restart();
+        for (int i = 0; i < kIterations; ++i) {
+            copyNWithRampingGain(m_pExpected, sources(), m_oldGain.constData(),
+                                 m_newGain.constData(), numSources, kBufferSize);
+        }
+        const qint64 copyNRamping = timer.restart();
+        for (int i = 0; i < kIterations; ++i) {
+            SampleUtil::mixWithRampingGain(m_pActual, sources(),
+                                           m_oldGain.constData(),
+                                           m_newGain.constData(),
+                                           numSources, kBufferSize);
+        }
+        const qint64 mixRamping = timer.restart();
+        qDebug() << numSources << "sources, ns/buffer:"
+                 << "copyNWithGain" << copyN / kIterations
+                 << "mixWithGain" << mix / kIterations
+                 << "copyNWithRampingGain" << copyNRamping / kIterations
+                 << "mixWithRampingGain" << mixRamping / kIterations;
+    }
 }
-*/
 
 TEST_F(SampleUtilTest, copy3WithRampingGainSpeed) {
     CSAMPLE* buffer = buffers[0];
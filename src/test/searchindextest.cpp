@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <QtDebug>
+
+#include "library/searchindex.h"
+
+namespace {
+
+class SearchIndexTest : public testing::Test {
+  protected:
+    SearchIndexTest()
+            : m_index(QStringList() << "artist" << "title") {
+        m_columns << "artist" << "title";
+    }
+
+    void setTrack(int id, const QString& artist, const QString& title) {
+        m_index.setTrack(TrackId(id), QStringList() << artist << title);
+    }
+
+    // Returns the ids of the tracks that match argument in columns.
+    QVector<int> search(const QStringList& columns, const QString& argument) {
+        QVector<TrackId> trackIds;
+        EXPECT_TRUE(m_index.search(columns, argument, &trackIds));
+        QVector<int> result;
+        for (const auto& trackId: trackIds) {
+            result.append(trackId.toInt());
+        }
+        return result;
+    }
+
+    QVector<int> search(const QString& argument) {
+        return search(m_columns, argument);
+    }
+
+    static QVector<int> ids() {
+        return QVector<int>();
+    }
+    static QVector<int> ids(int id1) {
+        QVector<int> result;
+        result << id1;
+        return result;
+    }
+
+    QStringList m_columns;
+    SearchIndex m_index;
+};
+
+TEST_F(SearchIndexTest, LatinLow) {
+    EXPECT_EQ(QString("sven vath"),
+              SearchIndex::latinLow(QString::fromUtf8("Sven Väth")));
+    EXPECT_EQ(QString("bjork"),
+              SearchIndex::latinLow(QString::fromUtf8("BJÖRK")));
+    EXPECT_EQ(QString("cafe"),
+              SearchIndex::latinLow(QString::fromUtf8("Café")));
+}
+
+TEST_F(SearchIndexTest, Substrings) {
+    setTrack(1, "ABBA", "Waterloo");
+    setTrack(2, "Daft Punk", "Harder Better Faster Stronger");
+    setTrack(3, "The Prodigy", "Firestarter");
+
+    EXPECT_EQ(ids(1), search("waterloo"));
+    EXPECT_EQ(ids(1), search("ATERL"));
+    EXPECT_EQ(3, search("ter").size());
+    EXPECT_EQ(ids(3), search("star"));
+    EXPECT_EQ(ids(2), search("stro"));
+    EXPECT_EQ(ids(2), search("r bet"));
+    EXPECT_EQ(ids(), search("xyz"));
+    EXPECT_EQ(ids(), search("waterloos"));
+
+    // Only in the given columns
+    EXPECT_EQ(ids(3), search(QStringList() << "artist", "the"));
+    EXPECT_EQ(ids(), search(QStringList() << "artist", "star"));
+}
+
+TEST_F(SearchIndexTest, Diacritics) {
+    setTrack(1, QString::fromUtf8("Sven Väth"), "Ritual of Life");
+    setTrack(2, "Bjork Tribute", QString::fromUtf8("Café"));
+
+    EXPECT_EQ(ids(1), search("vath"));
+    EXPECT_EQ(ids(1), search(QString::fromUtf8("VÄTH")));
+    EXPECT_EQ(ids(2), search(QString::fromUtf8("café")));
+    EXPECT_EQ(ids(2), search(QString::fromUtf8("björk")));
+}
+
+TEST_F(SearchIndexTest, Unsupported) {
+    setTrack(1, "ABBA", "Waterloo");
+    QVector<TrackId> trackIds;
+    // Too short
+    EXPECT_FALSE(m_index.search(m_columns, "ab", &trackIds));
+    // LIKE wildcards
+    EXPECT_FALSE(m_index.search(m_columns, "wat%loo", &trackIds));
+    EXPECT_FALSE(m_index.search(m_columns, "wat_rloo", &trackIds));
+    // Not indexed
+    EXPECT_FALSE(m_index.search(QStringList() << "album", "abba", &trackIds));
+}
+
+TEST_F(SearchIndexTest, MaxTracks) {
+    setTrack(1, "The Prodigy", "Firestarter");
+    setTrack(2, "Stardust", "Music Sounds Better With You");
+    setTrack(3, "ABBA", "The Winner Takes It All");
+    QVector<TrackId> trackIds;
+    EXPECT_TRUE(m_index.search(m_columns, "the", &trackIds, 2));
+    EXPECT_EQ(2, trackIds.size());
+    EXPECT_TRUE(m_index.search(m_columns, "star", &trackIds, 2));
+    EXPECT_FALSE(m_index.search(m_columns, "t", &trackIds, 2));
+    // Matches in two columns count once.
+    setTrack(2, "The Stardust", "The Stars");
+    EXPECT_FALSE(m_index.search(m_columns, "the", &trackIds, 2));
+    EXPECT_TRUE(m_index.search(m_columns, "the", &trackIds, 3));
+    EXPECT_EQ(3, trackIds.size());
+}
+
+TEST_F(SearchIndexTest, UpdateAndRemove) {
+    setTrack(1, "ABBA", "Waterloo");
+    setTrack(2, "Blur", "Song 2");
+    EXPECT_EQ(2, m_index.size());
+
+    // The old value no longer matches.
+    setTrack(1, "ABBA", "Mamma Mia");
+    EXPECT_EQ(ids(), search("waterloo"));
+    EXPECT_EQ(ids(1), search("mamma"));
+
+    m_index.removeTrack(TrackId(2));
+    EXPECT_FALSE(m_index.contains(TrackId(2)));
+    EXPECT_EQ(ids(), search("blur"));
+
+    // The row of the removed track is reused.
+    setTrack(3, "Blur", "Parklife");
+    EXPECT_EQ(ids(3), search("blur"));
+    EXPECT_EQ(ids(), search("song"));
+    EXPECT_EQ(2, m_index.size());
+
+    m_index.clear();
+    EXPECT_EQ(0, m_index.size());
+    EXPECT_EQ(ids(), search("abba"));
+}
+
+TEST_F(SearchIndexTest, ManyUpdates) {
+    // Enough changes to drop the stale trigrams a few times
+    for (int i = 0; i < 5000; ++i) {
+        setTrack(i % 10, "Artist", QString("Title %1").arg(i));
+    }
+    EXPECT_EQ(10, m_index.size());
+    EXPECT_EQ(ids(1), search("title 4991"));
+    EXPECT_EQ(ids(), search("title 4981"));
+    EXPECT_EQ(10, search("artist").size());
+}
+
+} // namespace
@@ -3,7 +3,9 @@
 #include <QDir>
 #include <QTemporaryFile>
 
+#include "library/searchindex.h"
 #include "library/searchqueryparser.h"
+#include "library/trackcollection.h"
 #include "util/assert.h"
 
 class SearchQueryParserTest : public testing::Test {
@@ -668,3 +670,227 @@ TEST_F(SearchQueryParserTest, HumanReadableDurationSearchwithRangeFilter) {
         qPrintable(QString("(duration >= 150) AND (duration <= 200)")),
         qPrintable(pQuery->toSql()));
 }
+
+TEST_F(SearchQueryParserTest, NormalizeQuery) {
+    EXPECT_EQ(QString("asdf zxcv"),
+              SearchQueryParser::normalizeQuery("  asdf   zxcv "));
+    EXPECT_EQ(QString(""), SearchQueryParser::normalizeQuery("   "));
+    // Quoted arguments keep their whitespace.
+    EXPECT_EQ(QString("comment:\"asdf  zxcv\""),
+              SearchQueryParser::normalizeQuery("comment:\"asdf  zxcv\""));
+}
+
+TEST_F(SearchQueryParserTest, Refinement) {
+    EXPECT_TRUE(m_parser.isRefinement("asdf", "asdf"));
+    EXPECT_TRUE(m_parser.isRefinement("", "a"));
+    EXPECT_TRUE(m_parser.isRefinement("asd", "asdf"));
+    EXPECT_TRUE(m_parser.isRefinement("sdf", "asdf"));
+    EXPECT_TRUE(m_parser.isRefinement("asdf", "asdf zxcv"));
+    EXPECT_TRUE(m_parser.isRefinement("asdf zx", "asdf zxcv"));
+    EXPECT_TRUE(m_parser.isRefinement("asdf", "asdf -zxcv"));
+    EXPECT_TRUE(m_parser.isRefinement("artist:ab", "artist:abc"));
+    EXPECT_TRUE(m_parser.isRefinement("artist:", "artist:abc"));
+    EXPECT_TRUE(m_parser.isRefinement("artist:", "artist: abc"));
+    EXPECT_TRUE(m_parser.isRefinement("asdf", "asdf bpm:120"));
+
+    EXPECT_FALSE(m_parser.isRefinement("asdf", "asd"));
+    EXPECT_FALSE(m_parser.isRefinement("asdf zxcv", "asdf"));
+    EXPECT_FALSE(m_parser.isRefinement("asdf", "zxcv"));
+    EXPECT_FALSE(m_parser.isRefinement("as zxcv", "asdf zxcv"));
+    // Negated terms exclude less when they get longer.
+    EXPECT_FALSE(m_parser.isRefinement("-asd", "-asdf"));
+    EXPECT_FALSE(m_parser.isRefinement("asd", "-asd"));
+    EXPECT_FALSE(m_parser.isRefinement("artist:ab", "-artist:abc"));
+    EXPECT_FALSE(m_parser.isRefinement("artist:ab", "title:abc"));
+    EXPECT_FALSE(m_parser.isRefinement("ab", "artist:ab"));
+    EXPECT_FALSE(m_parser.isRefinement("artist: ab", "artist: abc"));
+    EXPECT_FALSE(m_parser.isRefinement("bpm:12", "bpm:120"));
+    EXPECT_FALSE(m_parser.isRefinement("~bpm", "~bpmx"));
+    EXPECT_FALSE(m_parser.isRefinement("asdf", "\"asdf zxcv\""));
+}
+
+// Compares the tracks selected by the SQL of queries with and without a
+// SearchIndex.
+class SearchQueryParserIndexTest : public SearchQueryParserTest {
+  protected:
+    SearchQueryParserIndexTest()
+            : m_index(QStringList() << "artist" << "title") {
+#ifdef __SQLITE3__
+        // Compare with the like() function of the library.
+        TrackCollection::installSorting(m_database);
+#endif
+        QSqlQuery query(m_database);
+        query.exec("DROP TABLE IF EXISTS tracks");
+        RELEASE_ASSERT(query.exec(
+                "CREATE TABLE tracks (id INTEGER PRIMARY KEY, "
+                "artist TEXT, title TEXT)"));
+        m_searchColumns << "artist" << "title";
+    }
+
+    void addTrack(int id, const QString& artist, const QString& title) {
+        QSqlQuery query(m_database);
+        query.prepare("INSERT INTO tracks (id, artist, title) "
+                      "VALUES (:id, :artist, :title)");
+        query.bindValue(":id", id);
+        query.bindValue(":artist", artist);
+        query.bindValue(":title", title);
+        ASSERT_TRUE(query.exec());
+        m_index.setTrack(TrackId(id), QStringList() << artist << title);
+    }
+
+    // Returns the ids of the tracks selected by the SQL of query.
+    QList<int> select(const QString& query) {
+        QString condition = m_parser.parseQuery(
+                query, m_searchColumns, "")->toSql();
+        QString statement("SELECT id FROM tracks");
+        if (!condition.isEmpty()) {
+            statement += " WHERE " + condition;
+        }
+        statement += " ORDER BY id";
+        QSqlQuery sqlQuery(m_database);
+        EXPECT_TRUE(sqlQuery.exec(statement)) << qPrintable(statement);
+        QList<int> ids;
+        while (sqlQuery.next()) {
+            ids << sqlQuery.value(0).toInt();
+        }
+        return ids;
+    }
+
+    void expectParity(const QString& query) {
+        m_parser.setSearchIndex(NULL, QString());
+        const QList<int> expected(select(query));
+        m_parser.setSearchIndex(&m_index, "id");
+        EXPECT_EQ(expected, select(query)) << qPrintable(query);
+    }
+
+    QStringList m_searchColumns;
+    SearchIndex m_index;
+};
+
+TEST_F(SearchQueryParserIndexTest, IndexedSql) {
+    addTrack(1, "ABBA", "Waterloo");
+    addTrack(2, "Blur", "Song 2");
+    m_parser.setSearchIndex(&m_index, "id");
+
+    auto pQuery(m_parser.parseQuery("waterloo", m_searchColumns, ""));
+    EXPECT_STREQ(
+        qPrintable(QString("id IN (1)")),
+        qPrintable(pQuery->toSql()));
+
+    pQuery = m_parser.parseQuery("-title:song", m_searchColumns, "");
+    EXPECT_STREQ(
+        qPrintable(QString("NOT (id IN (2))")),
+        qPrintable(pQuery->toSql()));
+
+    pQuery = m_parser.parseQuery("abc", m_searchColumns, "");
+    EXPECT_STREQ(
+        qPrintable(QString("id IN ()")),
+        qPrintable(pQuery->toSql()));
+}
+
+TEST_F(SearchQueryParserIndexTest, Fallback) {
+    addTrack(1, "ABBA", "Waterloo");
+    m_parser.setSearchIndex(&m_index, "id");
+
+    // Too short for a trigram
+    auto pQuery(m_parser.parseQuery("ab", m_searchColumns, ""));
+    EXPECT_STREQ(
+        qPrintable(QString("(artist LIKE '%ab%') OR (title LIKE '%ab%')")),
+        qPrintable(pQuery->toSql()));
+
+    // LIKE wildcards
+    pQuery = m_parser.parseQuery("wat_rloo", m_searchColumns, "");
+    EXPECT_STREQ(
+        qPrintable(QString("(artist LIKE '%wat_rloo%') OR (title LIKE '%wat_rloo%')")),
+        qPrintable(pQuery->toSql()));
+
+    // A column that is not indexed
+    pQuery = m_parser.parseQuery("album:waterloo", m_searchColumns, "");
+    EXPECT_STREQ(
+        qPrintable(QString("album LIKE '%waterloo%'")),
+        qPrintable(pQuery->toSql()));
+}
+
+TEST_F(SearchQueryParserIndexTest, FallbackForCommonTerms) {
+    // More tracks match "title" than a library of this size may list.
+    for (int i = 1; i <= 2000; ++i) {
+        addTrack(i, QString("Artist %1").arg(i), QString("Title %1").arg(i));
+    }
+    addTrack(2001, "The Prodigy", "Firestarter");
+    m_parser.setSearchIndex(&m_index, "id");
+
+    auto pQuery(m_parser.parseQuery("title", m_searchColumns, ""));
+    EXPECT_STREQ(
+        qPrintable(QString("(artist LIKE '%title%') OR (title LIKE '%title%')")),
+        qPrintable(pQuery->toSql()));
+
+    pQuery = m_parser.parseQuery("title 1234", m_searchColumns, "");
+    EXPECT_STREQ(
+        qPrintable(QString("((artist LIKE '%title%') OR (title LIKE '%title%')) "
+                           "AND (id IN (1234))")),
+        qPrintable(pQuery->toSql()));
+
+    pQuery = m_parser.parseQuery("prodigy", m_searchColumns, "");
+    EXPECT_STREQ(
+        qPrintable(QString("id IN (2001)")),
+        qPrintable(pQuery->toSql()));
+
+    expectParity("title");
+    expectParity("title 12");
+}
+
+TEST_F(SearchQueryParserIndexTest, Parity) {
+    addTrack(1, "ABBA", "Waterloo");
+    addTrack(2, "Daft Punk", "Harder Better Faster Stronger");
+    addTrack(3, "Blur", "Song 2");
+    addTrack(4, "The Prodigy", "Firestarter");
+    addTrack(5, "Stardust", "Music Sounds Better With You");
+
+    expectParity("waterloo");
+    expectParity("WATERLOO");
+    expectParity("ter");
+    expectParity("better");
+    expectParity("star");
+    expectParity("star -firestarter");
+    expectParity("daft better");
+    expectParity("title:star");
+    expectParity("title:\"sounds better\"");
+    expectParity("-title:song");
+    expectParity("xyz");
+    // Falls back to LIKE
+    expectParity("bl");
+    expectParity("s_ng");
+}
+
+#ifdef __SQLITE3__
+TEST_F(SearchQueryParserIndexTest, ParityLatinLow) {
+    addTrack(1, QString::fromUtf8("Sven Väth"), QString::fromUtf8("L'Esperanza"));
+    addTrack(2, QString::fromUtf8("Björk"), "Army of Me");
+    addTrack(3, QString::fromUtf8("ÅSA"), QString::fromUtf8("Café del Mar"));
+    addTrack(4, "Bjork Tribute", "Cafe");
+
+    expectParity("vath");
+    expectParity(QString::fromUtf8("VÄTH"));
+    expectParity("bjork");
+    expectParity(QString::fromUtf8("björk"));
+    expectParity("asa");
+    expectParity(QString::fromUtf8("åsa"));
+    expectParity("cafe");
+    expectParity(QString::fromUtf8("café"));
+    expectParity("l'esp");
+}
+#endif // __SQLITE3__
+
+TEST_F(SearchQueryParserIndexTest, MatchFoldsLikeTheIndex) {
+    QStringList searchColumns;
+    searchColumns << "artist";
+
+    auto pQuery(m_parser.parseQuery("vath", searchColumns, ""));
+    TrackPointer pTrack(new TrackInfoObject());
+    pTrack->setArtist(QString::fromUtf8("Sven Väth"));
+    EXPECT_TRUE(pQuery->match(pTrack));
+
+    pQuery = m_parser.parseQuery(QString::fromUtf8("VÄTH"), searchColumns, "");
+    pTrack->setArtist("Sven Vath");
+    EXPECT_TRUE(pQuery->match(pTrack));
+}
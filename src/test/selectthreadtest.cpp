@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <QEventLoop>
+#include <QSqlQuery>
+#include <QTimer>
+#include <QtDebug>
+
+#include "library/selectthread.h"
+#include "test/librarytest.h"
+
+namespace {
+
+const char* kViewName = "select_thread_test_view";
+
+class SelectThreadTest : public LibraryTest {
+  protected:
+    virtual void SetUp() {
+        QSqlQuery query(collection()->getDatabase());
+        ASSERT_TRUE(query.exec("DELETE FROM library"));
+        ASSERT_TRUE(query.prepare(
+                "INSERT INTO library (artist, title) VALUES (:artist, :title)"));
+        addTrack(&query, "Abba", "Waterloo");
+        addTrack(&query, "Blur", "Song 2");
+        addTrack(&query, "Cake", "Short Skirt");
+        ASSERT_TRUE(query.exec(QString(
+                "CREATE TEMPORARY VIEW IF NOT EXISTS %1 AS "
+                "SELECT id, artist, title FROM library").arg(kViewName)));
+    }
+
+    virtual void TearDown() {
+        QSqlQuery query(collection()->getDatabase());
+        query.exec(QString("DROP VIEW IF EXISTS %1").arg(kViewName));
+        query.exec("DELETE FROM library");
+    }
+
+    static void addTrack(QSqlQuery* pQuery, const QString& artist,
+                         const QString& title) {
+        pQuery->bindValue(":artist", artist);
+        pQuery->bindValue(":title", title);
+        ASSERT_TRUE(pQuery->exec());
+    }
+
+    // Selects the rows of the view in the order of their artist and filters
+    // them by condition.
+    static SelectJobPointer newJob(const QString& condition) {
+        SelectJobPointer pJob(new SelectJob());
+        pJob->tableStatement = QString(
+                "SELECT id, artist, title FROM %1 ORDER BY artist").arg(kViewName);
+        pJob->numColumns = 3;
+        pJob->filterTable = "library";
+        pJob->filterIdColumn = "id";
+        pJob->filterCondition = condition;
+        return pJob;
+    }
+
+    QStringList matchingArtists(const SelectJob& job) {
+        QStringList artists;
+        for (const auto& row: job.rows) {
+            if (job.matchingTrackIds.contains(TrackId(row.first()))) {
+                artists << row.at(1).toString();
+            }
+        }
+        return artists;
+    }
+};
+
+TEST_F(SelectThreadTest, RunJob) {
+    SelectJobPointer pJob(newJob("artist LIKE '%b%'"));
+    EXPECT_TRUE(SelectThread::runJob(collection()->getDatabase(), pJob.data()));
+    EXPECT_TRUE(pJob->succeeded);
+
+    ASSERT_EQ(3, pJob->rows.size());
+    EXPECT_EQ(QVariant("Abba"), pJob->rows.at(0).at(1));
+    EXPECT_EQ(QVariant("Song 2"), pJob->rows.at(1).at(2));
+    EXPECT_EQ(QVariant("Cake"), pJob->rows.at(2).at(1));
+
+    EXPECT_EQ(QStringList() << "Abba" << "Blur", matchingArtists(*pJob));
+}
+
+TEST_F(SelectThreadTest, RunCanceledJob) {
+    SelectJobPointer pJob(newJob("1"));
+    pJob->cancel();
+    EXPECT_FALSE(SelectThread::runJob(collection()->getDatabase(), pJob.data()));
+    EXPECT_FALSE(pJob->succeeded);
+}
+
+TEST_F(SelectThreadTest, CopyTemporaryViews) {
+    SelectJob job;
+    EXPECT_TRUE(SelectThread::copyTemporaryViews(
+            collection()->getDatabase(),
+            QStringList() << kViewName << "library", &job));
+    // Only the temporary view is copied.
+    ASSERT_EQ(1, job.views.size());
+    EXPECT_TRUE(job.views.value(kViewName).startsWith(
+            "CREATE TEMPORARY VIEW"));
+
+    // The rows of a temporary table cannot be copied.
+    QSqlQuery query(collection()->getDatabase());
+    ASSERT_TRUE(query.exec(
+            "CREATE TEMPORARY TABLE select_thread_test_table (id INTEGER)"));
+    EXPECT_FALSE(SelectThread::copyTemporaryViews(
+            collection()->getDatabase(),
+            QStringList() << "select_thread_test_table", &job));
+    query.exec("DROP TABLE select_thread_test_table");
+}
+
+TEST_F(SelectThreadTest, QueueJob) {
+    SelectJobPointer pCanceledJob(newJob("1"));
+    SelectJobPointer pJob(newJob("title LIKE '%s%'"));
+    ASSERT_TRUE(SelectThread::copyTemporaryViews(
+            collection()->getDatabase(), QStringList() << kViewName,
+            pJob.data()));
+
+    SelectThread* pThread = collection()->getSelectThread();
+    QEventLoop loop;
+    QObject::connect(pThread, SIGNAL(jobFinished(SelectJobPointer)),
+                     &loop, SLOT(quit()));
+    pCanceledJob->cancel();
+    pThread->queueJob(pCanceledJob);
+    pThread->queueJob(pJob);
+    QTimer::singleShot(10000, &loop, SLOT(quit()));
+    loop.exec();
+
+    // The canceled job is skipped, the view is created on the connection of
+    // the thread.
+    EXPECT_FALSE(pCanceledJob->succeeded);
+    EXPECT_TRUE(pCanceledJob->rows.isEmpty());
+    ASSERT_TRUE(pJob->succeeded);
+    EXPECT_EQ(3, pJob->rows.size());
+    EXPECT_EQ(QStringList() << "Blur" << "Cake", matchingArtists(*pJob));
+}
+
+} // namespace
@@ -43,6 +43,15 @@ class CmdlineArgs {
             } else if (argv[i] == QString("--timelinePath") && i+1 < argc) {
                 m_timelinePath = QString::fromLocal8Bit(argv[i+1]);
                 i++;
+            } else if (argv[i] == QString("--render") && i+1 < argc) {
+                m_renderTimelinePath = QString::fromLocal8Bit(argv[i+1]);
+                i++;
+            } else if (argv[i] == QString("--renderOutput") && i+1 < argc) {
+                m_renderOutputPath = QString::fromLocal8Bit(argv[i+1]);
+                i++;
+            } else if (argv[i] == QString("--renderDuration") && i+1 < argc) {
+                m_renderDuration = QString::fromLocal8Bit(argv[i+1]).toDouble();
+                i++;
             } else if (QString::fromLocal8Bit(argv[i]).contains("--midiDebug", Qt::CaseInsensitive) ||
                        QString::fromLocal8Bit(argv[i]).contains("--controllerDebug", Qt::CaseInsensitive)) {
                 m_midiDebug = true;
@@ -72,6 +81,11 @@ class CmdlineArgs {
     const QString& getResourcePath() const { return m_resourcePath; }
     const QString& getPluginPath() const { return m_pluginPath; }
     const QString& getTimelinePath() const { return m_timelinePath; }
+    bool getRenderEnabled() const { return !m_renderTimelinePath.isEmpty(); }
+    const QString& getRenderTimelinePath() const { return m_renderTimelinePath; }
+    const QString& getRenderOutputPath() const { return m_renderOutputPath; }
+    // 0 if the render ends with the last event of the timeline
+    double getRenderDuration() const { return m_renderDuration; }
 
   private:
     CmdlineArgs() :
@@ -82,12 +96,14 @@ class CmdlineArgs {
         m_settingsPathSet(false),
 // We are not ready to switch to XDG folders under Linux, so keeping $HOME/.mixxx as preferences folder. see lp:1463273
 #ifdef __LINUX__
-        m_settingsPath(QDir::homePath().append("/").append(SETTINGS_PATH)) {
+        m_settingsPath(QDir::homePath().append("/").append(SETTINGS_PATH)),
 #else
         // TODO(XXX) Trailing slash not needed anymore as we switches from String::append
         // to QDir::filePath elsewhere in the code. This is candidate for removal.
-        m_settingsPath(QDesktopServices::storageLocation(QDesktopServices::DataLocation).append("/")) {
+        m_settingsPath(QDesktopServices::storageLocation(QDesktopServices::DataLocation).append("/")),
 #endif
+        m_renderOutputPath("mixxx-render.wav"),
+        m_renderDuration(0.0) {
     }
     ~CmdlineArgs() { };
 
@@ -102,6 +118,9 @@ class CmdlineArgs {
     QString m_resourcePath;
     QString m_pluginPath;
     QString m_timelinePath;
+    QString m_renderTimelinePath; // Render offline instead of starting the GUI
+    QString m_renderOutputPath;
+    double m_renderDuration;
 };
 
 #endif /* CMDLINEARGS_H */
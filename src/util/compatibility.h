@@ -2,6 +2,7 @@
 #define COMPATABILITY_H
 
 #include <QAtomicInt>
+#include <QAtomicPointer>
 #include <QStringList>
 
 #include <QLocale>
@@ -20,6 +21,26 @@ inline int load_atomic(const QAtomicInt& value) {
 #endif
 }
 
+template <typename T>
+inline T* load_atomic_pointer(const QAtomicPointer<T>& value) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+    return value;
+#else
+    return value.load();
+#endif
+}
+
+// Pairs with fetchAndStoreRelease, i.e. everything written to the object
+// before it was published is visible after this.
+template <typename T>
+inline T* load_atomic_pointer_acquire(const QAtomicPointer<T>& value) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+    return const_cast<QAtomicPointer<T>&>(value).fetchAndAddAcquire(0);
+#else
+    return value.loadAcquire();
+#endif
+}
+
 inline QLocale inputLocale() {
 #if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
     return QApplication::keyboardInputLocale();
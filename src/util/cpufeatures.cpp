@@ -0,0 +1,132 @@
+#include "util/cpufeatures.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CPUFEATURES_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+
+#ifdef CPUFEATURES_X86
+
+// CPUID leaf 1
+const unsigned int kEdxSse2 = 1u << 26;
+const unsigned int kEcxOsxsave = 1u << 27;
+const unsigned int kEcxAvx = 1u << 28;
+// CPUID leaf 7, sub-leaf 0
+const unsigned int kEbxAvx2 = 1u << 5;
+const unsigned int kEbxAvx512f = 1u << 16;
+// XCR0
+const unsigned int kXcr0SseAvx = 0x06; // XMM and YMM state
+const unsigned int kXcr0Avx512 = 0xe0; // opmask, ZMM_Hi256 and Hi16_ZMM state
+
+bool cpuid(unsigned int leaf, unsigned int subLeaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (static_cast<unsigned int>(info[0]) < leaf) {
+        return false;
+    }
+    __cpuidex(info, leaf, subLeaf);
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = info[i];
+    }
+    return true;
+#else
+    if (__get_cpuid_max(0, 0) < leaf) {
+        return false;
+    }
+    __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+    return true;
+#endif
+}
+
+unsigned int xcr0() {
+#ifdef _MSC_VER
+    return static_cast<unsigned int>(_xgetbv(0));
+#else
+    unsigned int eax, edx;
+    // xgetbv, spelled out for assemblers that don't know the mnemonic.
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+#endif
+}
+
+struct X86Features {
+    bool sse2;
+    bool avx2;
+    bool avx512f;
+
+    X86Features()
+            : sse2(false),
+              avx2(false),
+              avx512f(false) {
+        unsigned int leaf1[4] = {0, 0, 0, 0};
+        if (!cpuid(1, 0, leaf1)) {
+            return;
+        }
+        sse2 = (leaf1[3] & kEdxSse2) != 0;
+        const bool osSavesAvx = (leaf1[2] & kEcxOsxsave) &&
+                (leaf1[2] & kEcxAvx) &&
+                (xcr0() & kXcr0SseAvx) == kXcr0SseAvx;
+        if (!osSavesAvx) {
+            return;
+        }
+        unsigned int leaf7[4] = {0, 0, 0, 0};
+        if (!cpuid(7, 0, leaf7)) {
+            return;
+        }
+        avx2 = (leaf7[1] & kEbxAvx2) != 0;
+        avx512f = (leaf7[1] & kEbxAvx512f) &&
+                (xcr0() & kXcr0Avx512) == kXcr0Avx512;
+    }
+};
+
+const X86Features& x86Features() {
+    static const X86Features features;
+    return features;
+}
+
+#endif // CPUFEATURES_X86
+
+} // anonymous namespace
+
+// static
+bool CpuFeatures::hasSse2() {
+#ifdef CPUFEATURES_X86
+    return x86Features().sse2;
+#else
+    return false;
+#endif
+}
+
+// static
+bool CpuFeatures::hasAvx2() {
+#ifdef CPUFEATURES_X86
+    return x86Features().avx2;
+#else
+    return false;
+#endif
+}
+
+// static
+bool CpuFeatures::hasAvx512f() {
+#ifdef CPUFEATURES_X86
+    return x86Features().avx512f;
+#else
+    return false;
+#endif
+}
+
+// static
+bool CpuFeatures::hasNeon() {
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,18 @@
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+// Runtime detection of the SIMD instruction sets that the CPU and the
+// operating system support. The results are determined once and cached.
+class CpuFeatures {
+  public:
+    static bool hasSse2();
+    // Also requires the OS to save the AVX registers.
+    static bool hasAvx2();
+    // AVX-512 Foundation. Also requires the OS to save the AVX-512 registers.
+    static bool hasAvx512f();
+    // NEON is only used if the compiler targets it, there is no runtime
+    // detection for it.
+    static bool hasNeon();
+};
+
+#endif // CPUFEATURES_H
@@ -0,0 +1,67 @@
+#include "util/fft.h"
+
+#include "sampleutil.h"
+#include "util/assert.h"
+#include "util/math.h"
+
+Fft::Fft(int size)
+        : m_size(size),
+          m_pBitReverse(new int[size]),
+          m_pTwiddles(SampleUtil::alloc(size)) {
+    DEBUG_ASSERT(size > 0 && (size & (size - 1)) == 0);
+    int bits = 0;
+    while ((1 << bits) < size) {
+        ++bits;
+    }
+    for (int i = 0; i < size; ++i) {
+        int reversed = 0;
+        for (int bit = 0; bit < bits; ++bit) {
+            reversed |= ((i >> bit) & 1) << (bits - 1 - bit);
+        }
+        m_pBitReverse[i] = reversed;
+    }
+    for (int k = 0; k < size / 2; ++k) {
+        const double phase = -2 * M_PI * k / size;
+        m_pTwiddles[k * 2] = static_cast<CSAMPLE>(cos(phase));
+        m_pTwiddles[k * 2 + 1] = static_cast<CSAMPLE>(sin(phase));
+    }
+}
+
+Fft::~Fft() {
+    SampleUtil::free(m_pTwiddles);
+    delete [] m_pBitReverse;
+}
+
+void Fft::transform(CSAMPLE* pData, bool inverse) const {
+    for (int i = 0; i < m_size; ++i) {
+        const int j = m_pBitReverse[i];
+        if (i < j) {
+            const CSAMPLE re = pData[i * 2];
+            const CSAMPLE im = pData[i * 2 + 1];
+            pData[i * 2] = pData[j * 2];
+            pData[i * 2 + 1] = pData[j * 2 + 1];
+            pData[j * 2] = re;
+            pData[j * 2 + 1] = im;
+        }
+    }
+
+    // The inverse transform uses the complex conjugate twiddle factors.
+    const CSAMPLE sign = inverse ? -1.0f : 1.0f;
+    for (int half = 1; half < m_size; half *= 2) {
+        const int twiddleStride = m_size / (half * 2);
+        for (int start = 0; start < m_size; start += half * 2) {
+            CSAMPLE* pEven = pData + start * 2;
+            CSAMPLE* pOdd = pEven + half * 2;
+            for (int k = 0; k < half; ++k) {
+                const CSAMPLE wRe = m_pTwiddles[k * twiddleStride * 2];
+                const CSAMPLE wIm = sign * m_pTwiddles[k * twiddleStride * 2 + 1];
+                const CSAMPLE oddRe = pOdd[k * 2] * wRe - pOdd[k * 2 + 1] * wIm;
+                const CSAMPLE oddIm = pOdd[k * 2] * wIm + pOdd[k * 2 + 1] * wRe;
+                pOdd[k * 2] = pEven[k * 2] - oddRe;
+                pOdd[k * 2 + 1] = pEven[k * 2 + 1] - oddIm;
+                pEven[k * 2] += oddRe;
+                pEven[k * 2 + 1] += oddIm;
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include "util.h"
+#include "util/types.h"
+
+// An in-place radix-2 FFT of interleaved complex samples, i.e. the real and
+// imaginary part of each value are stored next to each other like the left
+// and right channel of a stereo frame. The twiddle factors are computed in
+// the constructor, so transforming does not allocate.
+class Fft {
+  public:
+    // size is the number of complex values and must be a power of two.
+    explicit Fft(int size);
+    virtual ~Fft();
+
+    int size() const {
+        return m_size;
+    }
+
+    // Computes the unnormalized forward transform of size complex values.
+    void forward(CSAMPLE* pData) const {
+        transform(pData, false);
+    }
+
+    // Computes the unnormalized inverse transform of size complex values, so
+    // inverse(forward(x)) is size * x.
+    void inverse(CSAMPLE* pData) const {
+        transform(pData, true);
+    }
+
+  private:
+    void transform(CSAMPLE* pData, bool inverse) const;
+
+    const int m_size;
+    // The bit reversed index of each value
+    int* m_pBitReverse;
+    // exp(-2 * pi * i * k / size) for k < size / 2
+    CSAMPLE* m_pTwiddles;
+
+    DISALLOW_COPY_AND_ASSIGN(Fft);
+};
+
+#endif // FFT_H
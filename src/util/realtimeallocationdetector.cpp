@@ -0,0 +1,106 @@
+#include "util/realtimeallocationdetector.h"
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <QAtomicInt>
+
+// Only built with the rtalloc SCons flag, which is limited to Linux since it
+// relies on glibc exporting its allocator under the __libc_ names.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+}
+
+namespace {
+
+// Plain thread local storage, since anything fancier may allocate itself.
+__thread bool s_bRealtimeThread = false;
+
+QAtomicInt s_allocationCount;
+QAtomicInt s_lastAllocationSize;
+
+} // anonymous namespace
+
+// Called for every allocation on a real-time thread. Not static and not
+// inlined, so that a debugger can break on it.
+extern "C" void __attribute__((noinline)) realtimeAllocationDetected(size_t size) {
+    s_allocationCount.fetchAndAddRelaxed(1);
+    s_lastAllocationSize.fetchAndStoreRelaxed(static_cast<int>(size));
+}
+
+static inline void checkAllocation(size_t size) {
+    if (s_bRealtimeThread) {
+        realtimeAllocationDetected(size);
+    }
+}
+
+extern "C" {
+
+void* malloc(size_t size) {
+    checkAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    checkAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    checkAllocation(size);
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    checkAllocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    checkAllocation(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** pPtr, size_t alignment, size_t size) {
+    // The alignment must be a power of two multiple of sizeof(void*).
+    if (alignment % sizeof(void*) != 0 ||
+            (alignment & (alignment - 1)) != 0 || alignment == 0) {
+        return EINVAL;
+    }
+    checkAllocation(size);
+    void* ptr = __libc_memalign(alignment, size);
+    if (ptr == NULL) {
+        return ENOMEM;
+    }
+    *pPtr = ptr;
+    return 0;
+}
+
+} // extern "C"
+
+// static
+bool RealtimeAllocationDetector::enabled() {
+    return true;
+}
+
+// static
+void RealtimeAllocationDetector::markRealtimeThread() {
+    s_bRealtimeThread = true;
+}
+
+// static
+void RealtimeAllocationDetector::unmarkRealtimeThread() {
+    s_bRealtimeThread = false;
+}
+
+// static
+int RealtimeAllocationDetector::takeAllocationCount(size_t* pLastSize) {
+    if (pLastSize != NULL) {
+        *pLastSize = static_cast<size_t>(
+                s_lastAllocationSize.fetchAndStoreRelaxed(0));
+    }
+    return s_allocationCount.fetchAndStoreRelaxed(0);
+}
@@ -0,0 +1,52 @@
+#ifndef REALTIMEALLOCATIONDETECTOR_H
+#define REALTIMEALLOCATIONDETECTOR_H
+
+#include <cstddef>
+
+// RealtimeAllocationDetector catches heap allocations on real-time threads
+// (the engine callback and its helper threads), which may block on the
+// allocator's locks or page in memory and cause xruns.
+//
+// It is a debugging aid built with the rtalloc=1 SCons flag, which defines
+// __RTALLOCDETECTOR__. It replaces malloc and friends of glibc with wrappers
+// that count every allocation made by a thread marked with
+// markRealtimeThread() and pass it on to glibc. Set a breakpoint on
+// realtimeAllocationDetected() in the .cpp file to see where an allocation
+// came from. Without the flag all methods are no-ops.
+class RealtimeAllocationDetector {
+  public:
+    // Whether the detector is compiled in.
+    static bool enabled();
+
+    // Marks the calling thread as real-time. Every allocation it makes from
+    // now on is counted.
+    static void markRealtimeThread();
+    // Stops counting allocations of the calling thread.
+    static void unmarkRealtimeThread();
+
+    // Returns the number of allocations on real-time threads since the last
+    // call and resets it. If pLastSize is not NULL it is set to the size of
+    // the last counted allocation.
+    static int takeAllocationCount(size_t* pLastSize = NULL);
+};
+
+#ifndef __RTALLOCDETECTOR__
+inline bool RealtimeAllocationDetector::enabled() {
+    return false;
+}
+
+inline void RealtimeAllocationDetector::markRealtimeThread() {
+}
+
+inline void RealtimeAllocationDetector::unmarkRealtimeThread() {
+}
+
+inline int RealtimeAllocationDetector::takeAllocationCount(size_t* pLastSize) {
+    if (pLastSize != NULL) {
+        *pLastSize = 0;
+    }
+    return 0;
+}
+#endif
+
+#endif /* REALTIMEALLOCATIONDETECTOR_H */
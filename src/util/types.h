@@ -41,6 +41,9 @@ typedef float CSAMPLE;
 const CSAMPLE CSAMPLE_ZERO = 0.0f;
 const CSAMPLE CSAMPLE_ONE = 1.0f;
 const CSAMPLE CSAMPLE_PEAK = CSAMPLE_ONE;
+// Samples of a smaller magnitude are treated as silence: -100 dBFS, well
+// below the least significant bit of 16 bit audio.
+const CSAMPLE CSAMPLE_SILENCE_THRESHOLD = 1e-5f;
 
 // Limits the range of a CSAMPLE value to [-CSAMPLE_PEAK, CSAMPLE_PEAK].
 inline
@@ -2,6 +2,7 @@
 
 #include "guitick.h"
 #include "controlobject.h"
+#include "control/controlnotifier.h"
 
 
 // static
@@ -13,9 +14,11 @@ GuiTick::GuiTick(QObject* pParent)
      m_pCOGuiTickTime = new ControlObject(ConfigKey("[Master]", "guiTickTime"));
      m_pCOGuiTick50ms = new ControlObject(ConfigKey("[Master]", "guiTick50ms"));
      m_cpuTimer.start();
+     ControlNotifier::registerDispatcher();
 }
 
 GuiTick::~GuiTick() {
+    ControlNotifier::unregisterDispatcher();
     delete m_pCOGuiTickTime;
     delete m_pCOGuiTick50ms;
 }
@@ -32,6 +35,9 @@ void GuiTick::process() {
         m_lastUpdateTime = m_cpuTimeLastTick;
         m_pCOGuiTick50ms->set(m_cpuTimeLastTick);
     }
+
+    // Deliver the control changes the engine made since the last tick.
+    ControlNotifier::dispatch();
 }
 
 // static